@@ -0,0 +1,130 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <openvino/core/function.hpp>
+#include <tuple>
+#include <openvino/op/i420_to_rgb.hpp>
+#include <openvino/op/i420_to_bgr.hpp>
+
+#include "base_reference_test.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace ov;
+using namespace InferenceEngine;
+using namespace reference_tests;
+
+class ReferenceConvertColorI420LayerTest : public testing::Test, public CommonReferenceTest {
+public:
+    void SetUp() override {
+        SKIP_IF_CURRENT_TEST_IS_DISABLED()
+        abs_threshold = 2.f; // allow R, G, B absolute deviation to 2 (of max 255)
+        threshold = 1.f; // Ignore relative comparison (100%)
+    }
+
+public:
+    template <typename T>
+    static std::shared_ptr<Function> CreateFunction(const Tensor& input) {
+        const auto in = std::make_shared<op::v0::Parameter>(input.type, input.shape);
+        std::shared_ptr<Node> conv;
+        conv = std::make_shared<T>(in);
+        auto res = std::make_shared<op::v0::Result>(conv);
+        return std::make_shared<Function>(ResultVector{res}, ParameterVector {in});
+    }
+
+    template <typename T>
+    static std::shared_ptr<Function> CreateFunction3(const Tensor& input1, const Tensor& input2, const Tensor& input3) {
+        const auto in1 = std::make_shared<op::v0::Parameter>(input1.type, input1.shape);
+        const auto in2 = std::make_shared<op::v0::Parameter>(input2.type, input2.shape);
+        const auto in3 = std::make_shared<op::v0::Parameter>(input3.type, input3.shape);
+        std::shared_ptr<Node> conv;
+        conv = std::make_shared<T>(in1, in2, in3);
+        auto res = std::make_shared<op::v0::Result>(conv);
+        return std::make_shared<Function>(ResultVector{res}, ParameterVector {in1, in2, in3});
+    }
+};
+
+TEST_F(ReferenceConvertColorI420LayerTest, CompareWithHardcodedRefs_r_u8_single_rgb) {
+    auto input = std::vector<uint8_t> {0x51, 0x51, 0x51, 0x51, 0x5a, 0xf0};
+    auto input_shape = Shape{1, 3, 2, 1};
+    auto exp_out = std::vector<uint8_t> {0xff, 0, 0, 0xff, 0, 0, 0xff, 0, 0, 0xff, 0, 0};
+    auto out_shape = Shape{1, 2, 2, 3};
+    Tensor inp_tensor(input_shape, element::u8, input);
+    inputData = {inp_tensor.data};
+    function = CreateFunction<op::v8::I420toRGB>(inp_tensor);
+    Tensor exp_tensor_u8(out_shape, element::u8, exp_out);
+    refOutData = {exp_tensor_u8.data};
+    Exec();
+}
+
+TEST_F(ReferenceConvertColorI420LayerTest, CompareWithHardcodedRefs_color_u8_single_bgr) {
+    auto input = std::vector<uint8_t> {0xeb, 0x51, 0xeb, 0x51, 0x6d, 0xb8};
+    auto input_shape = Shape{1, 3, 2, 1};
+    auto exp_out = std::vector<uint8_t> {215, 216, 255, 37, 37, 164, 215, 216, 255, 37, 37, 164};
+    auto out_shape = Shape{1, 2, 2, 3};
+
+    Tensor inp_tensor(input_shape, element::u8, input);
+    inputData = {inp_tensor.data};
+
+    Tensor exp_tensor_u8(out_shape, element::u8, exp_out);
+    refOutData = {exp_tensor_u8.data};
+
+    function = CreateFunction<op::v8::I420toBGR>(inp_tensor);
+
+    Exec();
+}
+
+TEST_F(ReferenceConvertColorI420LayerTest, CompareWithHardcodedRefs_batch_fp32_three_bgr) {
+    auto input_y = std::vector<float> {81.f, 81.f, 81.f, 81.f,
+                                       145.f, 145.f, 145.f, 145.f};
+    auto input_shape_y = Shape{2, 2, 2, 1};
+
+    auto input_u = std::vector<float> {90., 54.};
+    auto input_v = std::vector<float> {240., 34.};
+    auto input_shape_uv = Shape{2, 1, 1, 1};
+
+    auto exp_out = std::vector<float> {0, 0, 255., 0, 0, 255., 0, 0, 255., 0, 0, 255.,
+                                       0, 255., 0, 0, 255., 0, 0, 255., 0, 0, 255., 0};
+    auto out_shape = Shape{2, 2, 2, 3};
+
+    Tensor inp_tensor_y(input_shape_y, element::f32, input_y);
+    Tensor inp_tensor_u(input_shape_uv, element::f32, input_u);
+    Tensor inp_tensor_v(input_shape_uv, element::f32, input_v);
+    inputData = {inp_tensor_y.data, inp_tensor_u.data, inp_tensor_v.data};
+
+    Tensor exp_tensor(out_shape, element::f32, exp_out);
+    refOutData = {exp_tensor.data};
+
+    function = CreateFunction3<op::v8::I420toBGR>(inp_tensor_y, inp_tensor_u, inp_tensor_v);
+
+    Exec();
+}
+
+TEST_F(ReferenceConvertColorI420LayerTest, CompareWithHardcodedRefs_color4x2_f32_three_rgb) {
+    // the rows of 2x2 blocks with different U and V values
+    auto input_y = std::vector<float> {81, 81, 235, 235,
+                                       81, 81, 235, 235};
+    auto input_shape_y = Shape{1, 2, 4, 1};
+
+    auto input_u = std::vector<float> {90, 109};
+    auto input_v = std::vector<float> {240, 184};
+    auto input_shape_uv = Shape{1, 1, 2, 1};
+
+    auto exp_out = std::vector<float> {255, 0, 0, 255, 0, 0, 255, 216, 216, 255, 216, 216,
+                                       255, 0, 0, 255, 0, 0, 255, 216, 216, 255, 216, 216};
+    auto out_shape = Shape{1, 2, 4, 3};
+
+    Tensor inp_tensor_y(input_shape_y, element::f32, input_y);
+    Tensor inp_tensor_u(input_shape_uv, element::f32, input_u);
+    Tensor inp_tensor_v(input_shape_uv, element::f32, input_v);
+    inputData = {inp_tensor_y.data, inp_tensor_u.data, inp_tensor_v.data};
+
+    Tensor exp_tensor(out_shape, element::f32, exp_out);
+    refOutData = {exp_tensor.data};
+
+    function = CreateFunction3<op::v8::I420toRGB>(inp_tensor_y, inp_tensor_u, inp_tensor_v);
+
+    Exec();
+}
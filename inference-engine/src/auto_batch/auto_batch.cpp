@@ -0,0 +1,608 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <blob_factory.hpp>
+#include <ie_metric_helpers.hpp>
+#include <ie_ngraph_utils.hpp>
+#include <ie_plugin_config.hpp>
+#include <cpp/ie_infer_request.hpp>
+#include <threading/ie_immediate_executor.hpp>
+#include "auto_batch.hpp"
+
+namespace AutoBatchPlugin {
+    using namespace InferenceEngine;
+
+namespace {
+
+    std::map<std::string, std::string> mergeConfigs(std::map<std::string, std::string> config,
+                                                    const std::map<std::string, std::string> & local) {
+        for (auto && kvp : local) {
+            config[kvp.first] = kvp.second;
+        }
+        return config;
+    }
+
+    // the batch is the outermost dimension of the tensor, so the tensor of the batched network
+    // consists of the dense tensors of the individual requests placed one after another
+    bool hasOuterBatch(const TensorDesc& desc) {
+        switch (desc.getLayout()) {
+        case Layout::NC:
+        case Layout::NCHW:
+        case Layout::NHWC:
+        case Layout::NCDHW:
+        case Layout::NDHWC:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    unsigned int parseTimeout(const std::string& value) {
+        try {
+            const auto timeout = std::stoi(value);
+            if (timeout >= 0)
+                return static_cast<unsigned int>(timeout);
+        } catch (...) {
+        }
+        IE_THROW() << "Wrong value " << value << " for the " << AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT
+                   << " config key, the non-negative number of milliseconds is expected";
+    }
+
+    const std::vector<std::string> supported_configKeys = {
+        AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG,
+        AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT
+    };
+}  // namespace
+
+// ------------------------------AutoBatchInferRequest----------------------------
+AutoBatchInferRequest::AutoBatchInferRequest(const InputsDataMap&                networkInputs,
+                                             const OutputsDataMap&               networkOutputs,
+                                             const SoIInferRequestInternal&      inferRequestWithoutBatch,
+                                             int                                 batchSize)
+        : IInferRequestInternal(networkInputs, networkOutputs),
+          _batchSize(batchSize) {
+    // the request isn't bound to a place in the batch, so the blobs are the ones of the request of the original batch,
+    // they are executed in place when the batch isn't collected and copied to the batched request otherwise
+    for (const auto &it : _networkInputs)
+        _inputs[it.first] = inferRequestWithoutBatch->GetBlob(it.first);
+    for (const auto &it : _networkOutputs)
+        _outputs[it.first] = inferRequestWithoutBatch->GetBlob(it.first);
+}
+
+void AutoBatchInferRequest::CopyBlob(const Blob::Ptr& src, const Blob::Ptr& dst, size_t batchId, bool isInput) {
+    auto srcBlob = as<MemoryBlob>(src);
+    auto dstBlob = as<MemoryBlob>(dst);
+    if (!srcBlob || !dstBlob)
+        IE_THROW(NotImplemented) << "Only memory blobs are supported by the BATCH device";
+    const auto& batched = isInput ? dstBlob : srcBlob;
+    const auto& single = isInput ? srcBlob : dstBlob;
+    if (batched->byteSize() != single->byteSize() * _batchSize ||
+        batched->getTensorDesc().getPrecision() != single->getTensorDesc().getPrecision() ||
+        batched->getTensorDesc().getLayout() != single->getTensorDesc().getLayout())
+        IE_THROW(NotImplemented) << "The BATCH device doesn't support preprocessing of the blobs";
+
+    const auto offset = batchId * single->byteSize();
+    auto srcMap = srcBlob->rmap();
+    auto dstMap = dstBlob->wmap();
+    std::memcpy(dstMap.as<uint8_t*>() + (isInput ? offset : 0),
+                srcMap.as<const uint8_t*>() + (isInput ? 0 : offset),
+                single->byteSize());
+}
+
+void AutoBatchInferRequest::CopyInputsToBatched(const SoIInferRequestInternal& req, size_t batchId) {
+    for (const auto &it : _networkInputs) {
+        auto &name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        CopyBlob(GetBlob(name), req->GetBlob(name), batchId, true);
+    }
+}
+
+void AutoBatchInferRequest::CopyOutputsFromBatched(const SoIInferRequestInternal& req, size_t batchId) {
+    for (const auto &it : _networkOutputs) {
+        auto &name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        CopyBlob(req->GetBlob(name), GetBlob(name), batchId, false);
+    }
+}
+
+void AutoBatchInferRequest::SetBlobsToAnotherRequest(const SoIInferRequestInternal& req) {
+    for (const auto &it : _networkInputs) {
+        auto &name = it.first;
+        auto blob = GetBlob(name);
+        if (req->GetBlob(name) != blob)
+            req->SetBlob(name, blob);
+    }
+    for (const auto &it : _networkOutputs) {
+        auto &name = it.first;
+        auto blob = GetBlob(name);
+        if (req->GetBlob(name) != blob)
+            req->SetBlob(name, blob);
+    }
+}
+
+std::map<std::string, InferenceEngineProfileInfo> AutoBatchInferRequest::GetPerformanceCounts() const {
+    IE_THROW(NotImplemented);
+}
+
+void AutoBatchInferRequest::InferImpl() {
+    IE_THROW(NotImplemented);
+}
+
+// ------------------------------AutoBatchAsyncInferRequest----------------------------
+AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(const AutoBatchInferRequest::Ptr&   inferRequest,
+                                                       const bool                          needPerfCounters,
+                                                       const SoIInferRequestInternal&      inferRequestWithoutBatch,
+                                                       AutoBatchExecutableNetwork&         network,
+                                                       const ITaskExecutor::Ptr&           callbackExecutor) :
+    AsyncInferRequestThreadSafeDefault(inferRequest, nullptr, callbackExecutor),
+    _inferRequestWithoutBatch{inferRequestWithoutBatch},
+    _inferRequest{inferRequest},
+    _needPerfCounters{needPerfCounters},
+    _network{network} {
+    // this executor doesn't run the task immediately but passes it to the queue of the network,
+    // the task (checking the result) is called by the worker when the request is executed
+    struct ThisRequestExecutor : public ITaskExecutor {
+        explicit ThisRequestExecutor(AutoBatchAsyncInferRequest* _this_) : _this{_this_} {}
+        void run(Task task) override {
+            _this->_network.SubmitRequest(_this, std::move(task));
+        };
+        AutoBatchAsyncInferRequest* _this = nullptr;
+    };
+    _pipeline = {
+        { /*TaskExecutor*/ std::make_shared<ThisRequestExecutor>(this), /*task*/ [this] {
+            if (nullptr != _inferRequest->_exceptionPtr) {
+                std::rethrow_exception(_inferRequest->_exceptionPtr);
+            }
+            if (_needPerfCounters) {
+                _perfMap = _inferRequest->_executionFlavor == AutoBatchInferRequest::ExecutionFlavor::BATCH_EXECUTED ?
+                           _inferRequest->_inferRequestBatched->GetPerformanceCounts() :
+                           _inferRequestWithoutBatch->GetPerformanceCounts();
+            }
+        }}
+    };
+}
+
+void AutoBatchAsyncInferRequest::Infer_ThreadUnsafe() {
+    InferUsingAsync();
+}
+
+std::map<std::string, InferenceEngineProfileInfo> AutoBatchAsyncInferRequest::GetPerformanceCounts() const {
+    CheckState();
+    return _perfMap;
+}
+
+AutoBatchAsyncInferRequest::~AutoBatchAsyncInferRequest() {
+    StopAndWait();
+    _network.ReleaseRequest();
+}
+
+// ------------------------------AutoBatchExecutableNetwork----------------------------
+AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(const SoExecutableNetworkInternal&                   networkWithBatch,
+                                                       const SoExecutableNetworkInternal&                   networkWithoutBatch,
+                                                       const DeviceInformation&                             networkDevice,
+                                                       const std::unordered_map<std::string, Parameter>&    config,
+                                                       const bool                                           needPerfCounters) :
+    InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr, std::make_shared<InferenceEngine::ImmediateExecutor>()),
+    _networkWithBatch{networkWithBatch},
+    _networkWithoutBatch{networkWithoutBatch},
+    _device{networkDevice},
+    _config{config},
+    _needPerfCounters{needPerfCounters} {
+    _taskExecutor.reset();
+    auto timeout = _config.find(AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT);
+    if (timeout != _config.end())
+        _timeOut = parseTimeout(timeout->second.as<std::string>());
+}
+
+AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
+    /* NOTE: The user-facing requests keep the network alive, so all of them are destroyed at the moment
+     *       and there are no tasks in the queue
+     */
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _terminate = true;
+    }
+    _cond.notify_all();
+    for (auto&& workerRequest : _workerRequests)
+        workerRequest->_thread.join();
+    _workerRequests.clear();
+}
+
+void AutoBatchExecutableNetwork::SubmitRequest(AutoBatchAsyncInferRequest* request, Task task) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pendingRequests.emplace_back(request, std::move(task));
+    }
+    _cond.notify_all();
+}
+
+void AutoBatchExecutableNetwork::ReleaseRequest() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _numRequests--;
+    }
+    // the workers waiting for the batch may give up now
+    _cond.notify_all();
+}
+
+bool AutoBatchExecutableNetwork::CanCollectBatch() const {
+    // the requests which are neither queued nor executed may be submitted to fill the batch, otherwise there is
+    // no point to wait as the queue is too shallow
+    return _numRequests - _numRequestsInFlight >= static_cast<size_t>(_device.batchForDevice);
+}
+
+void AutoBatchExecutableNetwork::ProcessRequests(WorkerInferRequest& workerRequest) {
+    const auto batchSize = static_cast<size_t>(_device.batchForDevice);
+    std::vector<PendingRequest> requests;
+    requests.reserve(batchSize);
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _cond.wait(lock, [&] { return _terminate || !_pendingRequests.empty(); });
+        if (_terminate)
+            break;
+        // the timeout is counted from the moment the worker has seen the first request of the batch,
+        // the worker doesn't wait if no other request may come to fill the batch
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(_timeOut);
+        _cond.wait_until(lock, deadline, [&] {
+            return _terminate || _pendingRequests.size() >= batchSize || _pendingRequests.empty() || !CanCollectBatch();
+        });
+        if (_terminate)
+            break;
+        // another worker has taken the requests
+        if (_pendingRequests.empty())
+            continue;
+
+        const bool isBatchCollected = _pendingRequests.size() >= batchSize;
+        const auto count = isBatchCollected ? batchSize : _pendingRequests.size();
+        requests.assign(std::make_move_iterator(_pendingRequests.begin()), std::make_move_iterator(_pendingRequests.begin() + count));
+        _pendingRequests.erase(_pendingRequests.begin(), _pendingRequests.begin() + count);
+        _numRequestsInFlight += count;
+        lock.unlock();
+
+        if (isBatchCollected) {
+            ExecuteBatched(workerRequest, requests);
+        } else {
+            // the queue is too shallow to collect the batch, the requests are executed with the original batch
+            ExecuteWithoutBatch(requests);
+        }
+        CompleteRequests(requests);
+        requests.clear();
+        lock.lock();
+    }
+}
+
+void AutoBatchExecutableNetwork::ExecuteBatched(WorkerInferRequest& workerRequest, std::vector<PendingRequest>& requests) {
+    std::exception_ptr exceptionPtr;
+    try {
+        for (size_t batchId = 0; batchId < requests.size(); batchId++) {
+            auto& inferRequest = requests[batchId].first->_inferRequest;
+            inferRequest->_executionFlavor = AutoBatchInferRequest::ExecutionFlavor::BATCH_EXECUTED;
+            inferRequest->_inferRequestBatched = workerRequest._inferRequestBatched;
+            inferRequest->CopyInputsToBatched(workerRequest._inferRequestBatched, batchId);
+        }
+        workerRequest._inferRequestBatched->StartAsync();
+        workerRequest._inferRequestBatched->Wait(InferRequest::WaitMode::RESULT_READY);
+        for (size_t batchId = 0; batchId < requests.size(); batchId++)
+            requests[batchId].first->_inferRequest->CopyOutputsFromBatched(workerRequest._inferRequestBatched, batchId);
+    } catch (...) {
+        exceptionPtr = std::current_exception();
+    }
+    for (auto&& request : requests)
+        request.first->_inferRequest->_exceptionPtr = exceptionPtr;
+}
+
+void AutoBatchExecutableNetwork::ExecuteWithoutBatch(std::vector<PendingRequest>& requests) {
+    for (auto&& request : requests) {
+        auto& inferRequest = request.first->_inferRequest;
+        inferRequest->_executionFlavor = AutoBatchInferRequest::ExecutionFlavor::TIMEOUT_EXECUTED;
+        inferRequest->_exceptionPtr = nullptr;
+        try {
+            // the blobs are the ones of the request of the original batch unless the user has set own, so no copy is made
+            inferRequest->SetBlobsToAnotherRequest(request.first->_inferRequestWithoutBatch);
+            request.first->_inferRequestWithoutBatch->StartAsync();
+        } catch (...) {
+            inferRequest->_exceptionPtr = std::current_exception();
+        }
+    }
+    for (auto&& request : requests) {
+        auto& inferRequest = request.first->_inferRequest;
+        if (nullptr == inferRequest->_exceptionPtr) {
+            try {
+                request.first->_inferRequestWithoutBatch->Wait(InferRequest::WaitMode::RESULT_READY);
+            } catch (...) {
+                inferRequest->_exceptionPtr = std::current_exception();
+            }
+        }
+    }
+}
+
+void AutoBatchExecutableNetwork::CompleteRequests(std::vector<PendingRequest>& requests) {
+    // the requests aren't in flight anymore before the callbacks are called, as the callbacks may resubmit them
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _numRequestsInFlight -= requests.size();
+    }
+    _cond.notify_all();
+    for (auto&& request : requests)
+        request.second();
+}
+
+InferenceEngine::IInferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                                               InferenceEngine::OutputsDataMap networkOutputs) {
+    SoIInferRequestInternal inferRequestWithoutBatch = {_networkWithoutBatch, _networkWithoutBatch->CreateInferRequest()};
+    return std::make_shared<AutoBatchInferRequest>(networkInputs, networkOutputs, inferRequestWithoutBatch, _device.batchForDevice);
+}
+
+IInferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateInferRequest() {
+    SoIInferRequestInternal inferRequestWithoutBatch = {_networkWithoutBatch, _networkWithoutBatch->CreateInferRequest()};
+    auto syncRequestImpl = std::make_shared<AutoBatchInferRequest>(_networkInputs, _networkOutputs, inferRequestWithoutBatch,
+                                                                   _device.batchForDevice);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _numRequests++;
+        // one batched request per batchForDevice user-facing requests is enough to execute all of them at once
+        if (_workerRequests.size() * _device.batchForDevice < _numRequests) {
+            auto workerRequestPtr = std::make_shared<WorkerInferRequest>();
+            workerRequestPtr->_inferRequestBatched = {_networkWithBatch, _networkWithBatch->CreateInferRequest()};
+            auto* workerRequest = workerRequestPtr.get();
+            workerRequestPtr->_thread = std::thread([workerRequest, this] {
+                ProcessRequests(*workerRequest);
+            });
+            _workerRequests.push_back(workerRequestPtr);
+        }
+    }
+    return std::make_shared<AutoBatchAsyncInferRequest>(syncRequestImpl,
+                                                        _needPerfCounters,
+                                                        inferRequestWithoutBatch,
+                                                        *this,
+                                                        _callbackExecutor);
+}
+
+std::shared_ptr<ngraph::Function> AutoBatchExecutableNetwork::GetExecGraphInfo() {
+    return _networkWithBatch->GetExecGraphInfo();
+}
+
+void AutoBatchExecutableNetwork::SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) {
+    auto timeout = config.find(AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT);
+    if (timeout == config.end() || config.size() > 1) {
+        IE_THROW() << "The only config supported for the Network's SetConfig is AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT";
+    }
+    _timeOut = parseTimeout(timeout->second.as<std::string>());
+    _config[AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT] = timeout->second;
+}
+
+InferenceEngine::Parameter AutoBatchExecutableNetwork::GetConfig(const std::string &name) const {
+    auto it = _config.find(name);
+    if (it != _config.end()) {
+        return it->second;
+    } else {
+        // find config key among networks config keys
+        auto param = _networkWithBatch->GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+        for (auto &&configKey : param.as<std::vector<std::string>>()) {
+            if (configKey == name) {
+                return _networkWithBatch->GetConfig(configKey);
+            }
+        }
+        IE_THROW(NotFound) << name <<" not found in the ExecutableNetwork config";
+    }
+}
+
+InferenceEngine::Parameter AutoBatchExecutableNetwork::GetMetric(const std::string &name) const {
+    if (name == METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)) {
+        unsigned int res = 0u;
+        try {
+            res = _networkWithBatch->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        } catch (const InferenceEngine::Exception &iie) {
+            IE_THROW()
+                << "The device used with the BATCH should "
+                << "support OPTIMAL_NUMBER_OF_INFER_REQUESTS ExecutableNetwork metric. "
+                << "Failed to query the metric for the " << _device.deviceName << " with error:" << iie.what();
+        }
+        // every batched request is fed by the batchForDevice user-facing requests taken from the shared queue
+        IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, res * _device.batchForDevice);
+    } else if (name == METRIC_KEY(NETWORK_NAME)) {
+        IE_SET_METRIC_RETURN(NETWORK_NAME, _networkWithoutBatch->GetMetric(
+            METRIC_KEY(NETWORK_NAME)).as<std::string>());
+    } else if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, {
+            METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
+            METRIC_KEY(SUPPORTED_METRICS),
+            METRIC_KEY(NETWORK_NAME),
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+        });
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, supported_configKeys);
+    } else {
+        IE_THROW() << "Unsupported Network metric: " << name;
+    }
+}
+
+// ------------------------------AutoBatchInferencePlugin----------------------------
+static const Version version = {{2, 1}, CI_BUILD_NUMBER, "AutoBatchPlugin"};
+IE_DEFINE_PLUGIN_CREATE_FUNCTION(AutoBatchInferencePlugin, version)
+
+AutoBatchInferencePlugin::AutoBatchInferencePlugin() {
+    _pluginName = "BATCH";
+}
+
+std::map<std::string, std::string> AutoBatchInferencePlugin::GetSupportedConfig(
+    const std::map<std::string, std::string> & config, const std::string & deviceName) const {
+    std::vector<std::string> supportedConfigKeys = GetCore()->GetMetric(deviceName, METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+    std::map<std::string, std::string> supportedConfig;
+    for (auto&& key : supportedConfigKeys) {
+        auto itKey = config.find(key);
+        if (config.end() != itKey) {
+            supportedConfig[key] = itKey->second;
+        }
+    }
+    return supportedConfig;
+}
+
+DeviceInformation AutoBatchInferencePlugin::ParseBatchDevice(const std::string& deviceWithBatch) {
+    auto openingBracket = deviceWithBatch.find_first_of('(');
+    auto closingBracket = deviceWithBatch.find_first_of(')', openingBracket);
+    auto deviceName = deviceWithBatch.substr(0, openingBracket);
+
+    int batch = 0;
+    if (openingBracket != std::string::npos && closingBracket != std::string::npos) {
+        try {
+            batch = std::stoi(deviceWithBatch.substr(openingBracket + 1, closingBracket - openingBracket - 1));
+        } catch (...) {
+        }
+    }
+    if (batch <= 0) {
+        IE_THROW() << "Wrong device config " << deviceWithBatch
+                   << " for the BATCH device, the batch size is expected in brackets, e.g. CPU(16)";
+    }
+    return {deviceName, {}, batch};
+}
+
+DeviceInformation AutoBatchInferencePlugin::ParseMetaDevice(const std::string& deviceBatchCfg,
+                                                            const std::map<std::string, std::string>& config) const {
+    auto metaDevice = ParseBatchDevice(deviceBatchCfg);
+
+    DeviceIDParser deviceParser(metaDevice.deviceName);
+    auto tconfig = mergeConfigs(_config, config);
+    // set device ID if any
+    std::string deviceIDLocal = deviceParser.getDeviceID();
+    if (!deviceIDLocal.empty()) {
+        tconfig[PluginConfigParams::KEY_DEVICE_ID] = deviceIDLocal;
+    }
+    metaDevice.config = GetSupportedConfig(tconfig, deviceParser.getDeviceName());
+    metaDevice.deviceName = deviceParser.getDeviceName();
+    return metaDevice;
+}
+
+void AutoBatchInferencePlugin::SetConfig(const std::map<std::string, std::string>& config) {
+    for (auto && kvp : config) {
+        if (kvp.first == AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG) {
+            ParseBatchDevice(kvp.second);
+        } else if (kvp.first == AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT) {
+            parseTimeout(kvp.second);
+        } else {
+            IE_THROW(NotFound) << "Unsupported config key: " << kvp.first;
+        }
+        _config[kvp.first] = kvp.second;
+    }
+}
+
+InferenceEngine::Parameter AutoBatchInferencePlugin::GetConfig(const std::string& name,
+                                                               const std::map<std::string, InferenceEngine::Parameter> & options) const {
+    auto it = _config.find(name);
+    if (it == _config.end()) {
+        IE_THROW(NotFound) << "Value for " << name << " is not set";
+    }
+    return it->second;
+}
+
+InferenceEngine::Parameter AutoBatchInferencePlugin::GetMetric(const std::string& name,
+                                                               const std::map<std::string, InferenceEngine::Parameter> & options) const {
+    if (name == METRIC_KEY(SUPPORTED_METRICS)) {
+        std::vector<std::string> metrics;
+        metrics.push_back(METRIC_KEY(SUPPORTED_METRICS));
+        metrics.push_back(METRIC_KEY(FULL_DEVICE_NAME));
+        metrics.push_back(METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+        IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
+    } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
+        std::string device_name = { GetName() };
+        IE_SET_METRIC_RETURN(FULL_DEVICE_NAME, device_name);
+    } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
+        IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, supported_configKeys);
+    } else {
+        IE_THROW() << "Unsupported metric key " << name;
+    }
+}
+
+IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadExeNetworkImpl(const CNNNetwork& network,
+                                                                             const std::map<std::string, std::string>& config) {
+    if (GetCore() == nullptr) {
+        IE_THROW() << "Please, work with " << GetName() << " device via InferenceEngine::Core object";
+    }
+    if (network.getFunction() == nullptr) {
+        IE_THROW() << GetName() << " device supports just ngraph network representation";
+    }
+
+    auto fullConfig = mergeConfigs(_config, config);
+    auto deviceConfig = fullConfig.find(AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG);
+    if (deviceConfig == fullConfig.end()) {
+        IE_THROW() << "KEY_AUTO_BATCH_DEVICE_CONFIG key is not set for " << GetName() << " device";
+    }
+    auto metaDevice = ParseMetaDevice(deviceConfig->second, fullConfig);
+    const auto& deviceName = metaDevice.deviceName;
+    const auto batch = static_cast<size_t>(metaDevice.batchForDevice);
+
+    // the batch of every input and output is multiplied, the other dimensions are kept
+    CNNNetwork clonedNetwork = InferenceEngine::details::cloneNetwork(network);
+    ICNNNetwork::InputShapes shapes = clonedNetwork.getInputShapes();
+    for (const auto& input : clonedNetwork.getInputsInfo()) {
+        if (!hasOuterBatch(input.second->getTensorDesc())) {
+            IE_THROW(NotImplemented) << GetName() << " device doesn't support the input " << input.first
+                                     << " with layout " << input.second->getLayout();
+        }
+        shapes[input.first][0] *= batch;
+    }
+    clonedNetwork.reshape(shapes);
+    const auto originalOutputs = network.getOutputsInfo();
+    for (const auto& output : clonedNetwork.getOutputsInfo()) {
+        const auto& originalDims = originalOutputs.at(output.first)->getTensorDesc().getDims();
+        const auto& dims = output.second->getTensorDesc().getDims();
+        if (!hasOuterBatch(output.second->getTensorDesc()) || dims.empty() || dims[0] != originalDims[0] * batch) {
+            IE_THROW(NotImplemented) << GetName() << " device can't batch the network, the batch of the output " << output.first
+                                     << " doesn't follow the batch of the inputs";
+        }
+    }
+
+    auto networkWithBatch = GetCore()->LoadNetwork(clonedNetwork, deviceName, metaDevice.config);
+    // the network of the original batch executes the requests which weren't batched within the timeout
+    auto networkWithoutBatch = GetCore()->LoadNetwork(network, deviceName, metaDevice.config);
+
+    bool enablePerfCounters = false;
+    try {
+        enablePerfCounters = networkWithBatch->GetConfig(PluginConfigParams::KEY_PERF_COUNT).as<std::string>() ==
+                             PluginConfigParams::YES;
+    } catch (...) {
+    }
+
+    std::unordered_map<std::string, InferenceEngine::Parameter> networkConfig;
+    networkConfig[AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG] = deviceConfig->second;
+    auto timeout = fullConfig.find(AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT);
+    if (timeout != fullConfig.end())
+        networkConfig[AutoBatchConfigParams::KEY_AUTO_BATCH_TIMEOUT] = timeout->second;
+
+    return std::make_shared<AutoBatchExecutableNetwork>(networkWithBatch,
+                                                        networkWithoutBatch,
+                                                        metaDevice,
+                                                        networkConfig,
+                                                        enablePerfCounters);
+}
+
+QueryNetworkResult AutoBatchInferencePlugin::QueryNetwork(const CNNNetwork&                         network,
+                                                          const std::map<std::string, std::string>& config) const {
+    if (GetCore() == nullptr) {
+        IE_THROW() << "Please, work with " << GetName() <<  " device via InferencEngine::Core object";
+    }
+
+    auto fullConfig = mergeConfigs(_config, config);
+    auto deviceConfig = fullConfig.find(AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG);
+    if (deviceConfig == fullConfig.end()) {
+        IE_THROW() << "KEY_AUTO_BATCH_DEVICE_CONFIG key is not set for " << GetName() << " device";
+    }
+    auto metaDevice = ParseMetaDevice(deviceConfig->second, fullConfig);
+    return GetCore()->QueryNetwork(network, metaDevice.deviceName, metaDevice.config);
+}
+
+}  // namespace AutoBatchPlugin
@@ -0,0 +1,168 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+#include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
+#include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+#include "ie_icore.hpp"
+
+namespace AutoBatchPlugin {
+
+using DeviceName = std::string;
+
+struct DeviceInformation {
+    DeviceName deviceName;
+    std::map<std::string, std::string> config;
+    int batchForDevice;
+};
+
+class AutoBatchAsyncInferRequest;
+
+class AutoBatchExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<AutoBatchExecutableNetwork>;
+    using PendingRequest = std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>;
+
+    // The request of the batched network with the thread feeding it.
+    // All the workers take the submitted requests from the queue shared by the network.
+    struct WorkerInferRequest {
+        using Ptr = std::shared_ptr<WorkerInferRequest>;
+        InferenceEngine::SoIInferRequestInternal  _inferRequestBatched;
+        std::thread                               _thread;
+    };
+
+    explicit AutoBatchExecutableNetwork(const InferenceEngine::SoExecutableNetworkInternal&                 networkWithBatch,
+                                        const InferenceEngine::SoExecutableNetworkInternal&                 networkWithoutBatch,
+                                        const DeviceInformation&                                            networkDevice,
+                                        const std::unordered_map<std::string, InferenceEngine::Parameter>&  config,
+                                        const bool                                                          needPerfCounters = false);
+
+    void SetConfig(const std::map<std::string, InferenceEngine::Parameter>& config) override;
+    InferenceEngine::Parameter GetConfig(const std::string& name) const override;
+    InferenceEngine::Parameter GetMetric(const std::string& name) const override;
+    std::shared_ptr<ngraph::Function> GetExecGraphInfo() override;
+    InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
+    InferenceEngine::IInferRequestInternal::Ptr CreateInferRequestImpl(InferenceEngine::InputsDataMap networkInputs,
+                                                                       InferenceEngine::OutputsDataMap networkOutputs) override;
+    ~AutoBatchExecutableNetwork();
+
+    void SubmitRequest(AutoBatchAsyncInferRequest* request, InferenceEngine::Task task);
+    void ReleaseRequest();
+
+private:
+    void ProcessRequests(WorkerInferRequest& workerRequest);
+    bool CanCollectBatch() const;
+    void ExecuteBatched(WorkerInferRequest& workerRequest, std::vector<PendingRequest>& requests);
+    void ExecuteWithoutBatch(std::vector<PendingRequest>& requests);
+    void CompleteRequests(std::vector<PendingRequest>& requests);
+
+    InferenceEngine::SoExecutableNetworkInternal                _networkWithBatch;
+    InferenceEngine::SoExecutableNetworkInternal                _networkWithoutBatch;
+    DeviceInformation                                           _device;
+    std::unordered_map<std::string, InferenceEngine::Parameter> _config;
+    bool                                                        _needPerfCounters = false;
+
+    // guards the queue, the workers and the counters of the requests
+    std::mutex                                                  _mutex;
+    std::condition_variable                                     _cond;
+    std::vector<PendingRequest>                                 _pendingRequests;
+    std::vector<WorkerInferRequest::Ptr>                        _workerRequests;
+    // the user-facing requests alive and the ones taken from the queue and not completed yet
+    size_t                                                      _numRequests = 0;
+    size_t                                                      _numRequestsInFlight = 0;
+    bool                                                        _terminate = false;
+    std::atomic<unsigned int>                                   _timeOut = {5};
+};
+
+class AutoBatchInferRequest : public InferenceEngine::IInferRequestInternal {
+public:
+    using Ptr = std::shared_ptr<AutoBatchInferRequest>;
+    enum class ExecutionFlavor { NOT_EXECUTED, BATCH_EXECUTED, TIMEOUT_EXECUTED };
+
+    explicit AutoBatchInferRequest(const InferenceEngine::InputsDataMap&              networkInputs,
+                                   const InferenceEngine::OutputsDataMap&             networkOutputs,
+                                   const InferenceEngine::SoIInferRequestInternal&    inferRequestWithoutBatch,
+                                   int                                                batchSize);
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
+    void InferImpl() override;
+
+    // the data is copied to and from the given place of the batched request
+    void CopyInputsToBatched(const InferenceEngine::SoIInferRequestInternal& req, size_t batchId);
+    void CopyOutputsFromBatched(const InferenceEngine::SoIInferRequestInternal& req, size_t batchId);
+    // sets the blobs to the request of the original batch (used when the batch can't be collected)
+    void SetBlobsToAnotherRequest(const InferenceEngine::SoIInferRequestInternal& req);
+
+    std::exception_ptr                               _exceptionPtr;
+    ExecutionFlavor                                  _executionFlavor = ExecutionFlavor::NOT_EXECUTED;
+    // the batched request which executed this one last time, used to get the performance counters
+    InferenceEngine::SoIInferRequestInternal         _inferRequestBatched;
+
+private:
+    void CopyBlob(const InferenceEngine::Blob::Ptr& src, const InferenceEngine::Blob::Ptr& dst, size_t batchId, bool isInput);
+
+    size_t _batchSize;
+};
+
+class AutoBatchAsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDefault {
+public:
+    using Ptr = std::shared_ptr<AutoBatchAsyncInferRequest>;
+
+    explicit AutoBatchAsyncInferRequest(const AutoBatchInferRequest::Ptr&                   inferRequest,
+                                        const bool                                          needPerfCounters,
+                                        const InferenceEngine::SoIInferRequestInternal&     inferRequestWithoutBatch,
+                                        AutoBatchExecutableNetwork&                         network,
+                                        const InferenceEngine::ITaskExecutor::Ptr&          callbackExecutor);
+    void Infer_ThreadUnsafe() override;
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
+    ~AutoBatchAsyncInferRequest();
+
+    InferenceEngine::SoIInferRequestInternal                            _inferRequestWithoutBatch;
+    AutoBatchInferRequest::Ptr                                          _inferRequest;
+
+protected:
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo>  _perfMap;
+    bool                                                                _needPerfCounters = false;
+    AutoBatchExecutableNetwork&                                         _network;
+};
+
+class AutoBatchInferencePlugin : public InferenceEngine::IInferencePlugin {
+public:
+    AutoBatchInferencePlugin();
+    ~AutoBatchInferencePlugin() = default;
+
+    InferenceEngine::IExecutableNetworkInternal::Ptr LoadExeNetworkImpl(const InferenceEngine::CNNNetwork&        network,
+                                                                       const std::map<std::string, std::string>& config) override;
+
+    void SetConfig(const std::map<std::string, std::string>& config) override;
+    InferenceEngine::Parameter GetConfig(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter>& options) const override;
+    InferenceEngine::QueryNetworkResult QueryNetwork(const InferenceEngine::CNNNetwork&        network,
+                                                     const std::map<std::string, std::string>& config) const override;
+    InferenceEngine::Parameter GetMetric(const std::string& name,
+                                         const std::map<std::string, InferenceEngine::Parameter>& options) const override;
+
+    DeviceInformation ParseMetaDevice(const std::string& deviceBatchCfg, const std::map<std::string, std::string>& config) const;
+    static DeviceInformation ParseBatchDevice(const std::string& deviceWithBatch);
+
+protected:
+    std::map<std::string, std::string> GetSupportedConfig(const std::map<std::string, std::string>& config,
+                                                          const DeviceName& deviceName) const;
+};
+
+}  // namespace AutoBatchPlugin
@@ -0,0 +1,46 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header that defines advanced related properties for Auto Batching plugin.
+ * These properties should be used in SetConfig() and LoadNetwork() methods
+ *
+ * @file auto_batch_config.hpp
+ */
+
+#pragma once
+
+#include "ie_plugin_config.hpp"
+
+namespace InferenceEngine {
+
+/**
+ * @brief Auto Batching plugin configuration
+ */
+namespace AutoBatchConfigParams {
+
+/**
+ * @def AUTO_BATCH_CONFIG_KEY(name)
+ * @brief A macro which provides an AUTO_BATCH-mangled name for configuration key with name `name`
+ */
+#define AUTO_BATCH_CONFIG_KEY(name) InferenceEngine::AutoBatchConfigParams::_CONFIG_KEY(AUTO_BATCH_##name)
+
+#define DECLARE_AUTO_BATCH_CONFIG_KEY(name) DECLARE_CONFIG_KEY(AUTO_BATCH_##name)
+
+/**
+ * @brief The device to execute the batched network on with the batch size in brackets, e.g. "CPU(16)".
+ * The same value can be passed as the device name: "BATCH:CPU(16)".
+ */
+DECLARE_AUTO_BATCH_CONFIG_KEY(DEVICE_CONFIG);
+
+/**
+ * @brief The time in milliseconds to collect the batch. The requests submitted to the network are taken from one queue
+ * by any batched request. The requests which didn't fill the batch within the time are executed one by one with the
+ * network of the original batch. They are executed immediately if no other request of the network may come to fill
+ * the batch, e.g. the network has fewer requests than the batch size. Default value is "5".
+ */
+DECLARE_AUTO_BATCH_CONFIG_KEY(TIMEOUT);
+
+}  // namespace AutoBatchConfigParams
+}  // namespace InferenceEngine
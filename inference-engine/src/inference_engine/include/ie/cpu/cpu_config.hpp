@@ -0,0 +1,113 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header for advanced hardware related properties for CPU plugin
+ *        To use in SetConfig() method of plugins
+ *
+ * @file cpu_config.hpp
+ */
+#pragma once
+
+#include "ie_plugin_config.hpp"
+
+namespace InferenceEngine {
+
+namespace Metrics {
+
+/**
+ * @def CPU_METRIC_KEY(name)
+ * @brief shortcut for defining CPU plugin metrics
+ */
+#define CPU_METRIC_KEY(name)              METRIC_KEY(CPU_##name)
+#define DECLARE_CPU_METRIC_KEY(name, ...) DECLARE_METRIC_KEY(CPU_##name, __VA_ARGS__)
+
+/**
+ * @brief Metric to get the number of runtime parameters cache lookups which were served from the cache
+ */
+DECLARE_CPU_METRIC_KEY(RUNTIME_CACHE_HITS, uint64_t);
+
+/**
+ * @brief Metric to get the number of runtime parameters cache lookups which required creation of new parameters
+ */
+DECLARE_CPU_METRIC_KEY(RUNTIME_CACHE_MISSES, uint64_t);
+
+}  // namespace Metrics
+
+/**
+ * @brief CPU plugin configuration
+ */
+namespace CPUConfigParams {
+
+/**
+ * @brief shortcut for defining configuration keys
+ */
+#define CPU_CONFIG_KEY(name)           InferenceEngine::CPUConfigParams::_CONFIG_KEY(CPU_##name)
+#define DECLARE_CPU_CONFIG_KEY(name)   DECLARE_CONFIG_KEY(CPU_##name)
+#define DECLARE_CPU_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(CPU_##name)
+
+/**
+ * @brief Defines the maximum number of records in the runtime parameters cache of the CPU plugin.
+ * The cache stores primitives and JIT kernels created for dynamic shapes so they can be reused when
+ * an input shape is met again. It is shared by all the networks loaded with the capacity set for the plugin.
+ * A network loaded with another capacity gets its own cache of that capacity, which isn't counted by the
+ * CPU_RUNTIME_CACHE_HITS/MISSES metrics. Changing the capacity of the plugin affects the networks sharing its cache.
+ * The value should be a non-negative integer, 0 disables the cache.
+ */
+DECLARE_CPU_CONFIG_KEY(RUNTIME_CACHE_CAPACITY);
+
+/**
+ * @brief Defines upper bounds of the network inputs with dynamic shapes.
+ * The bounds are propagated through the network on load, so the dynamic tensors are planned in the shared memory
+ * of the network for their maximal shapes once and reused by every inference. The bounds don't limit the input shapes:
+ * a bigger input is accepted, and only the tensors exceeding their planned size are reallocated.
+ * The value is a comma separated list of the input names with the maximal shapes, e.g. "data[1,3,1024,1024],mask[1,1024]".
+ * Static dimensions of an input must be equal to the corresponding values. Empty string (default) means no bounds.
+ */
+DECLARE_CPU_CONFIG_KEY(DYNAMIC_SHAPES_UPPER_BOUNDS);
+
+/**
+ * @brief Enables concurrent execution of independent branches of the network within one inference.
+ * It helps to utilize the cores in the latency mode if the network has parallel branches (e.g. Inception-like blocks)
+ * with nodes which can't load all the threads. The achieved parallelism is reported by the performance counters.
+ * The key has effect only if the plugin is built with TBB threading, the branches are executed sequentially with OpenMP.
+ * The value should be PluginConfigParams::YES or PluginConfigParams::NO (default).
+ */
+DECLARE_CPU_CONFIG_KEY(PARALLEL_BRANCHES);
+
+/**
+ * @brief Defines a directory to share the reordered weights between processes running on the same host.
+ * The first process which compiles a network stores the weights in the layouts chosen for the host to the directory,
+ * the other processes loading the same network map the stored files instead of keeping own copies of the weights.
+ * One copy is kept per NUMA node. The directory should be on a memory backed file system (e.g. /dev/shm).
+ * Empty string (default) disables the sharing.
+ */
+DECLARE_CPU_CONFIG_KEY(SHARED_WEIGHTS_DIR);
+
+/**
+ * @brief Limits the size of the shared weights directory in bytes.
+ * When a process stores new weights, the least recently used files are removed until the directory fits the limit.
+ * The processes which already mapped the removed files keep using them.
+ * 0 (default) means no limit.
+ */
+DECLARE_CPU_CONFIG_KEY(SHARED_WEIGHTS_DIR_MAX_SIZE);
+
+/**
+ * @brief Defines the precision the constant weights of the FullyConnected layers are stored in.
+ * The compressed weights are converted to FP32 inside the kernel, so the memory footprint and the memory traffic
+ * of the bandwidth bound layers (e.g. FullyConnected with batch 1) are reduced in the cost of the accuracy.
+ * The value should be "FP32" (default, no compression), "FP16" or "I8" (symmetric quantization per output channel).
+ */
+DECLARE_CPU_CONFIG_KEY(FC_WEIGHTS_COMPRESSION);
+
+/**
+ * @brief Enables the fusion of the chains of eltwise operations into JIT compiled subgraphs.
+ * The fused operations are computed in one pass over the memory, the inputs of smaller shapes are broadcast on the fly.
+ * The number of the original operations fused into a subgraph is reported by the executable graph.
+ * The value should be PluginConfigParams::YES or PluginConfigParams::NO (default).
+ */
+DECLARE_CPU_CONFIG_KEY(SNIPPETS);
+
+}  // namespace CPUConfigParams
+}  // namespace InferenceEngine
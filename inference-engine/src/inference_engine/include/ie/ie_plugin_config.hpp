@@ -405,6 +405,33 @@ DECLARE_CONFIG_KEY(ENFORCE_BF16);
  */
 DECLARE_CONFIG_KEY(CACHE_DIR);
 
+/**
+ * @brief This key limits the total size of the compiled network blobs in the cache directory set by CACHE_DIR
+ *
+ * The value is the size in bytes, 0 (default) means unlimited. When the limit is exceeded after the network is
+ * cached, the least recently used blobs are removed. The key is set for the Core only (without a device name).
+ *
+ * @code
+ * ie.SetConfig({{CONFIG_KEY(CACHE_DIR), "cache/"}, {CONFIG_KEY(CACHE_MAX_SIZE), "1073741824"}}); // up to 1 GB
+ * @endcode
+ */
+DECLARE_CONFIG_KEY(CACHE_MAX_SIZE);
+
+/**
+ * @brief This key enables memory mapping of the weights files by Core::ReadNetwork
+ *
+ * The constants of the network refer to the pages of the mapped file, so they are loaded lazily and shared between
+ * all the processes reading the same model. The file must not be modified while the network is alive: the changes
+ * are seen by the constants, and if the file is truncated, the access to the lost pages crashes the process (SIGBUS).
+ * Disable the mapping if the weights files may be replaced in place.
+ * The key is set for the Core only (without a device name), the value is YES (default) or NO.
+ *
+ * @code
+ * ie.SetConfig({{CONFIG_KEY(ENABLE_MMAP), CONFIG_VALUE(NO)}}); // read the weights to the allocated memory
+ * @endcode
+ */
+DECLARE_CONFIG_KEY(ENABLE_MMAP);
+
 }  // namespace PluginConfigParams
 
 /**
@@ -424,6 +451,7 @@ DECLARE_AUTO_CONFIG_KEY(DEVICE_LIST);
 
 #include "hetero/hetero_plugin_config.hpp"
 #include "multi-device/multi_device_config.hpp"
+#include "auto_batch/auto_batch_config.hpp"
 
 // remove in 2022.1 major release
 #include "cldnn/cldnn_config.hpp"
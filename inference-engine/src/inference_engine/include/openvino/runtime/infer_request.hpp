@@ -12,6 +12,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "openvino/runtime/common.hpp"
 #include "openvino/runtime/profiling_info.hpp"
@@ -61,6 +62,17 @@ public:
      */
     void set_tensor(const std::string& name, const Tensor& tensor);
 
+    /**
+     * @brief Sets the batch of the input data as the separate tensors, e.g. the images decoded to their own buffers
+     *
+     * @note Memory allocation does not happen, the device reads the tensors in place where it can. The input can't
+     * be got by get_tensor() until a single tensor is set.
+     * @param name Name of the input tensor.
+     * @param tensors Tensors of the batch items. The count of the tensors must match the batch of the input and the
+     * shape of every tensor is the shape of the input with the batch equal to 1.
+     */
+    void set_tensors(const std::string& name, const std::vector<Tensor>& tensors);
+
     /**
      * @brief Gets input/output data for inference
      *
@@ -12,15 +12,23 @@
 #endif
 #include <xml_parse_utils.h>
 
+#include <mutex>
+#include <set>
+#include <unordered_map>
+
 #include "cpp/ie_cnn_network.h"
 #include "details/ie_exception.hpp"
 #include "file_utils.h"
+#include "ie_hash128.hpp"
 #include "ie_itt.hpp"
+#include "ie_parallel.hpp"
+#include "ngraph/op/util/framework_node.hpp"
+#include "ngraph/op/util/variable.hpp"
 #include "ngraph/opsets/opset6.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/variant.hpp"
 #include "transformations/rt_info/fused_names_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
-#include "transformations/serialize.hpp"
 
 #ifdef _WIN32
 #    define stat _stat
@@ -39,30 +47,277 @@ static int32_t as_int32_t(T v) {
     return static_cast<int32_t>(v);
 }
 
-class OstreamHashWrapper final : public std::streambuf {
-    std::size_t m_res = 0;
+namespace {
+
+using details::Hash128;
+
+// The buffers of this size and larger are hashed by the fixed chunks in parallel, so the digest doesn't depend on the
+// number of threads
+constexpr size_t PARALLEL_HASH_THRESHOLD = 4 * 1024 * 1024;
+constexpr size_t PARALLEL_HASH_CHUNK = 1024 * 1024;
+
+void digestBuffer(const void* data, size_t size, uint64_t& low, uint64_t& high) {
+    Hash128 hash;
+    if (size < PARALLEL_HASH_THRESHOLD) {
+        hash.update(data, size);
+    } else {
+        const size_t chunks = (size + PARALLEL_HASH_CHUNK - 1) / PARALLEL_HASH_CHUNK;
+        std::vector<uint64_t> digests(2 * chunks);
+        parallel_for(chunks, [&](size_t i) {
+            Hash128 chunkHash;
+            const size_t offset = i * PARALLEL_HASH_CHUNK;
+            chunkHash.update(static_cast<const uint8_t*>(data) + offset, std::min(PARALLEL_HASH_CHUNK, size - offset));
+            chunkHash.finish(digests[2 * i], digests[2 * i + 1]);
+        });
+        hash.add(static_cast<uint64_t>(size));
+        hash.update(digests.data(), digests.size() * sizeof(uint64_t));
+    }
+    hash.finish(low, high);
+}
 
+/**
+ * @brief The digest of the Constant data memoized in the runtime info, so the same network is hashed again in O(ops)
+ *
+ * The digest is valid while the Constant holds the same buffer, it isn't copied to the nodes created by the
+ * transformations.
+ */
+class ConstantDigest : public ngraph::Variant {
 public:
-    std::size_t getResult() const {
-        return m_res;
-    }
-    std::streamsize xsputn(const char* s, std::streamsize n) override {
-        const std::int64_t* intS = (const std::int64_t*)s;
-        std::streamsize n64 = n / sizeof(std::int64_t);
-        std::streamsize i = 0;
-        // Using 64-bit values executes much faster than char
-        while (i++ < n64) {
-            m_res += *(intS++);
-        }
+    OPENVINO_RTTI("constant_digest", "0");
+
+    ConstantDigest(const void* data, size_t size, uint64_t low, uint64_t high)
+        : m_data(data),
+          m_size(size),
+          m_low(low),
+          m_high(high) {}
+
+    bool is_copyable() const override {
+        return false;
+    }
+
+    bool matches(const void* data, size_t size) const {
+        return m_data == data && m_size == size;
+    }
+
+    const void* m_data;
+    size_t m_size;
+    uint64_t m_low;
+    uint64_t m_high;
+};
+
+// Guards the runtime info of the nodes of the networks being hashed
+std::mutex& rtInfoMutex() {
+    static std::mutex mutex;
+    return mutex;
+}
+
+void hashConstant(Hash128& hash, ngraph::op::v0::Constant& constant) {
+    const void* data = constant.get_data_ptr();
+    const size_t size = constant.get_byte_size();
+    const std::string key = ConstantDigest::get_type_info_static();
+
+    std::shared_ptr<ConstantDigest> digest;
+    {
+        std::lock_guard<std::mutex> lock(rtInfoMutex());
+        const auto& rtInfo = constant.get_rt_info();
+        auto it = rtInfo.find(key);
+        if (it != rtInfo.end())
+            digest = std::dynamic_pointer_cast<ConstantDigest>(it->second);
+    }
+    if (!digest || !digest->matches(data, size)) {
+        uint64_t low = 0, high = 0;
+        digestBuffer(data, size, low, high);
+        digest = std::make_shared<ConstantDigest>(data, size, low, high);
+        std::lock_guard<std::mutex> lock(rtInfoMutex());
+        constant.get_rt_info()[key] = digest;
+    }
+    hash.add(digest->m_low).add(digest->m_high);
+}
+
+void hashFunction(Hash128& hash, const ngraph::Function& function);
+
+void hashPartialShape(Hash128& hash, const ngraph::PartialShape& shape) {
+    if (shape.rank().is_dynamic()) {
+        hash.add(int64_t(-1));
+        return;
+    }
+    hash.add(shape.rank().get_length());
+    for (const auto& dim : shape)
+        hash.add(dim.get_min_length()).add(dim.get_max_length());
+}
 
-        std::streamsize rest = n % sizeof(std::int64_t);
-        for (i = 0; i < rest; i++) {
-            m_res += s[n - rest + i];
+// Hashes the attributes of the node as they are visited, the same attribute types are supported as by the serialization
+class HashingVisitor : public ngraph::AttributeVisitor {
+public:
+    explicit HashingVisitor(Hash128& hash) : m_hash(hash) {}
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        m_hash.add(name);
+        using ngraph::op::util::SubGraphOp;
+        if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::vector<std::shared_ptr<SubGraphOp::InputDescription>>>>(&adapter)) {
+            for (const auto& description : a->get()) {
+                m_hash.add(std::string(description->get_type_info().name));
+                m_hash.add(description->m_input_index).add(description->m_body_parameter_index);
+                if (auto slice = ngraph::as_type_ptr<SubGraphOp::SliceInputDescription>(description)) {
+                    m_hash.add(slice->m_start).add(slice->m_stride).add(slice->m_part_size).add(slice->m_end).add(slice->m_axis);
+                } else if (auto merged = ngraph::as_type_ptr<SubGraphOp::MergedInputDescription>(description)) {
+                    m_hash.add(merged->m_body_value_index);
+                }
+            }
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::vector<std::shared_ptr<SubGraphOp::OutputDescription>>>>(&adapter)) {
+            for (const auto& description : a->get()) {
+                m_hash.add(std::string(description->get_type_info().name));
+                m_hash.add(description->m_body_value_index).add(description->m_output_index);
+                if (auto concat = ngraph::as_type_ptr<SubGraphOp::ConcatOutputDescription>(description)) {
+                    m_hash.add(concat->m_start).add(concat->m_stride).add(concat->m_part_size).add(concat->m_end).add(concat->m_axis);
+                } else if (auto body = ngraph::as_type_ptr<SubGraphOp::BodyOutputDescription>(description)) {
+                    m_hash.add(body->m_iteration);
+                }
+            }
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::op::v5::Loop::SpecialBodyPorts>>(&adapter)) {
+            m_hash.add(a->get().current_iteration_input_idx).add(a->get().body_condition_output_idx);
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::Variable>>>(&adapter)) {
+            const auto& info = a->get()->get_info();
+            m_hash.add(info.variable_id).add(info.data_type.get_type_name());
+            hashPartialShape(m_hash, info.data_shape);
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+            uint64_t low = 0, high = 0;
+            digestBuffer(a->get()->get_ptr(), a->get()->size(), low, high);
+            m_hash.add(low).add(high);
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<ov::op::util::FrameworkNodeAttrs>>(&adapter)) {
+            const auto& attrs = a->get();
+            m_hash.add(attrs.get_type_name()).add(attrs.get_opset_name());
+            const std::map<std::string, std::string> sorted(attrs.begin(), attrs.end());
+            for (const auto& attr : sorted)
+                m_hash.add(attr.first).add(attr.second);
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<ngraph::element::TypeVector>>(&adapter)) {
+            for (const auto& type : a->get())
+                m_hash.add(type.get_type_name());
+        } else {
+            // unknown to the hashing, at least the type of the attribute is taken into account
+            m_hash.add(std::string(adapter.get_type_info().name));
         }
-        return n;
     }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        m_hash.add(name).add(adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        m_hash.add(name).add(adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        m_hash.add(name).add(adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        m_hash.add(name).add(adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        addVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        addVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        addVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        addVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        addVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        addVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        addVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        addVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        addVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override {
+        addVector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        m_hash.add(name).add(static_cast<uint64_t>(adapter.get().size()));
+        for (const auto& value : adapter.get())
+            m_hash.add(value);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::shared_ptr<ngraph::Function>>& adapter) override {
+        m_hash.add(name);
+        hashFunction(m_hash, *adapter.get());
+    }
+
+private:
+    template <typename T>
+    void addVector(const std::string& name, const std::vector<T>& values) {
+        m_hash.add(name).add(static_cast<uint64_t>(values.size()));
+        m_hash.update(values.data(), values.size() * sizeof(T));
+    }
+
+    Hash128& m_hash;
 };
 
+// Hashes the topology, the attributes and the weights of the function without the serialization
+void hashFunction(Hash128& hash, const ngraph::Function& function) {
+    hash.add(function.get_friendly_name());
+    std::unordered_map<const ngraph::Node*, uint64_t> ids;
+    const auto ops = function.get_ordered_ops();
+    hash.add(static_cast<uint64_t>(ops.size()));
+    for (const auto& op : ops) {
+        const uint64_t id = ids.size();
+        ids[op.get()] = id;
+
+        const auto& typeInfo = op->get_type_info();
+        hash.add(std::string(typeInfo.name)).add(typeInfo.get_version());
+        hash.add(op->get_friendly_name());
+
+        hash.add(static_cast<uint64_t>(op->get_input_size()));
+        for (const auto& input : op->inputs()) {
+            const auto source = input.get_source_output();
+            hash.add(ids.at(source.get_node())).add(static_cast<uint64_t>(source.get_index()));
+        }
+
+        hash.add(static_cast<uint64_t>(op->get_output_size()));
+        for (const auto& output : op->outputs()) {
+            hash.add(output.get_element_type().get_type_name());
+            hashPartialShape(hash, output.get_partial_shape());
+            const auto& names = output.get_tensor().get_names();
+            const std::set<std::string> sortedNames(names.begin(), names.end());
+            hash.add(static_cast<uint64_t>(sortedNames.size()));
+            for (const auto& name : sortedNames)
+                hash.add(name);
+        }
+
+        if (auto constant = ngraph::as_type_ptr<ngraph::op::v0::Constant>(op)) {
+            // the attributes of the Constant are not visited, it costs the pass over the data
+            hash.add(constant->get_element_type().get_type_name());
+            hashPartialShape(hash, constant->get_shape());
+            hashConstant(hash, *constant);
+        } else {
+            HashingVisitor visitor(hash);
+            op->visit_attributes(visitor);
+        }
+    }
+
+    auto addIds = [&](const ngraph::NodeVector& nodes) {
+        hash.add(static_cast<uint64_t>(nodes.size()));
+        for (const auto& node : nodes)
+            hash.add(ids.at(node.get()));
+    };
+    const auto& parameters = function.get_parameters();
+    const auto& results = function.get_results();
+    const auto& sinks = function.get_sinks();
+    addIds(ngraph::NodeVector(parameters.begin(), parameters.end()));
+    addIds(ngraph::NodeVector(results.begin(), results.end()));
+    addIds(ngraph::NodeVector(sinks.begin(), sinks.end()));
+}
+
+}  // namespace
+
 //////////////////////////////////////////////////
 
 std::string NetworkCompilationContext::calculateFileInfo(const std::string& filePath) {
@@ -88,43 +343,37 @@ std::string NetworkCompilationContext::calculateFileInfo(const std::string& file
 std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
                                                    const std::map<std::string, std::string>& compileOptions) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_LT, "NetworkCompilationContext::computeHash - CNN");
-    OstreamHashWrapper xmlHash;
-    OstreamHashWrapper binHash;
-    std::ostream xml(&xmlHash);
-    std::ostream bin(&binHash);
-
     IE_ASSERT(network.getFunction());
 
-    // 1. Serialize
-    CNNNetwork net(network);
-    ngraph::pass::Serialize serializer(xml, bin, ngraph::pass::Serialize::Version::IR_V10);
-    serializer.run_on_function(net.getFunction());
-
-    // 2. Compute hash on serialized data and options
-    size_t seed = 0;
-    seed = hash_combine(seed, xmlHash.getResult());
-    seed = hash_combine(seed, binHash.getResult());
+    // 1. Hash the function, the weights are hashed by the parallel chunks and memoized in the runtime info
+    Hash128 hash;
+    hashFunction(hash, *network.getFunction());
 
+    // 2. Add options
     for (const auto& kvp : compileOptions) {
-        seed = hash_combine(seed, kvp.first + kvp.second);
+        hash.add(kvp.first).add(kvp.second);
     }
 
     // 3. Add runtime information which may not be serialized
+    const std::string digestKey = ConstantDigest::get_type_info_static();
     for (const auto& op : network.getFunction()->get_ordered_ops()) {
+        std::lock_guard<std::mutex> lock(rtInfoMutex());
         const auto& rt = op->get_rt_info();
         for (const auto& rtMapData : rt) {
-            seed = hash_combine(seed, rtMapData.first);
+            if (rtMapData.first == digestKey)
+                continue;
+            hash.add(rtMapData.first);
 
             if (auto stringData = std::dynamic_pointer_cast<ngraph::VariantWrapper<std::string>>(rtMapData.second)) {
-                seed = hash_combine(seed, stringData->get());
+                hash.add(stringData->get());
             } else if (auto intData =
                            std::dynamic_pointer_cast<ngraph::VariantWrapper<std::int64_t>>(rtMapData.second)) {
-                seed = hash_combine(seed, intData->get());
+                hash.add(intData->get());
             } else if (auto fNames =
                            std::dynamic_pointer_cast<ngraph::VariantWrapper<ngraph::FusedNames>>(rtMapData.second)) {
-                seed = hash_combine(seed, fNames->get().getNames());
+                hash.add(fNames->get().getNames());
             } else if (auto prim = std::dynamic_pointer_cast<ov::PrimitivesPriority>(rtMapData.second)) {
-                seed = hash_combine(seed, prim->get());
+                hash.add(prim->get());
             }
         }
     }
@@ -132,18 +381,18 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
     // 4. Add inputs info
     for (const auto& input : network.getInputsInfo()) {
         InputInfo::Ptr info = input.second;
-        seed = hash_combine(seed, as_int32_t(info->getPrecision()));
-        seed = hash_combine(seed, as_int32_t(info->getLayout()));
+        hash.add(as_int32_t(info->getPrecision()));
+        hash.add(as_int32_t(info->getLayout()));
 
         const InferenceEngine::PreProcessInfo& preproc = info->getPreProcess();
-        seed = hash_combine(seed, as_int32_t(preproc.getMeanVariant()));
+        hash.add(as_int32_t(preproc.getMeanVariant()));
 
         if (preproc.getMeanVariant() == MeanVariant::MEAN_VALUE) {
-            seed = hash_combine(seed, preproc.getNumberOfChannels());
+            hash.add(preproc.getNumberOfChannels());
             for (size_t c = 0; c < preproc.getNumberOfChannels(); ++c) {
                 const PreProcessChannel::Ptr& channelInfo = preproc[c];
-                seed = hash_combine(seed, channelInfo->stdScale);
-                seed = hash_combine(seed, channelInfo->meanValue);
+                hash.add(channelInfo->stdScale);
+                hash.add(channelInfo->meanValue);
             }
         } else if (preproc.getMeanVariant() == MeanVariant::MEAN_IMAGE) {
             // TODO: think if we need to compute hash for mean image if it exists
@@ -153,11 +402,11 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
     // 5. Add outputs info
     for (const auto& output : network.getOutputsInfo()) {
         DataPtr info = output.second;
-        seed = hash_combine(seed, as_int32_t(info->getPrecision()));
-        seed = hash_combine(seed, as_int32_t(info->getLayout()));
+        hash.add(as_int32_t(info->getPrecision()));
+        hash.add(as_int32_t(info->getLayout()));
     }
 
-    return std::to_string(seed);
+    return hash.hex();
 }
 
 std::string NetworkCompilationContext::computeHash(const std::string& modelName,
@@ -216,9 +216,23 @@ InferRequest::InferRequest(const std::shared_ptr<void>& so, const ie::IInferRequ
 void InferRequest::set_tensor(const std::string& name, const Tensor& tensor){
     OV_INFER_REQ_CALL_STATEMENT({ _impl->SetBlob(name, tensor._impl); })}
 
+void InferRequest::set_tensors(const std::string& name, const std::vector<Tensor>& tensors) {
+    OV_INFER_REQ_CALL_STATEMENT({
+        std::vector<ie::Blob::Ptr> blobs;
+        blobs.reserve(tensors.size());
+        for (const auto& tensor : tensors)
+            blobs.push_back(tensor._impl);
+        _impl->SetBlobs(name, blobs);
+    })
+}
+
 Tensor InferRequest::get_tensor(const std::string& name) {
     OV_INFER_REQ_CALL_STATEMENT({
         auto blob = _impl->GetBlob(name);
+        if (blob != nullptr && blob->is<ie::BatchedBlob>()) {
+            IE_THROW(NotImplemented) << "The tensor with name `" << name
+                                     << "` is set as the batch of tensors and can't be returned as a single tensor";
+        }
         const bool remoteBlobPassed = blob->is<ie::RemoteBlob>();
         if (blob == nullptr) {
             IE_THROW(NotAllocated) << "Internal tensor implementation with name `" << name << "` is not allocated!";
@@ -113,6 +113,50 @@ void IInferRequestInternal::SetBlob(const std::string& name, const Blob::Ptr& us
     }
 }
 
+void IInferRequestInternal::SetBlobs(const std::string& name, const std::vector<Blob::Ptr>& blobs) {
+    OV_ITT_SCOPED_TASK(itt::domains::Plugin, "SetBlobs");
+    if (blobs.empty()) {
+        IE_THROW() << "Failed to set empty batch of blobs with name: \'" << name << "\'";
+    }
+    InputInfo::Ptr foundInput;
+    DataPtr foundOutput;
+    if (name.empty() || !findInputAndOutputBlobByName(name, foundInput, foundOutput)) {
+        IE_THROW(NotFound) << "Failed to set the batch of blobs to the input with name: \'" << name << "\'";
+    }
+    if (foundInput->getInputData()->isDynamic()) {
+        IE_THROW(NotImplemented) << "Failed to set the batch of blobs to the dynamic input with name: \'" << name << "\'";
+    }
+    const auto& inputDesc = foundInput->getTensorDesc();
+    if (inputDesc.getLayout() == SCALAR || inputDesc.getDims().empty() || inputDesc.getDims()[0] != blobs.size()) {
+        IE_THROW(ParameterMismatch) << "Failed to set " << blobs.size() << " blobs to the input with name: \'" << name
+                                    << "\', the count must be equal to the batch of the input";
+    }
+    auto itemDims = inputDesc.getDims();
+    itemDims[0] = 1;
+    for (const auto& blob : blobs) {
+        if (!blob || blob->is<CompoundBlob>() || blob->is<RemoteBlob>() || blob->buffer() == nullptr)
+            IE_THROW(NotAllocated) << "Input data was not allocated. Input name: \'" << name << "\'";
+        const auto& blobDesc = blob->getTensorDesc();
+        if (blobDesc.getPrecision() != foundInput->getPrecision()) {
+            IE_THROW(ParameterMismatch)
+                << "Failed to set Blob with precision not corresponding to user input precision";
+        }
+        if (blobDesc.getDims() != itemDims) {
+            IE_THROW(ParameterMismatch) << "Failed to set the batch of blobs with name: \'" << name
+                                        << "\', every blob must have the shape of the input with the batch of 1";
+        }
+        if (blobDesc.getLayout() != ANY && blobDesc.getLayout() != inputDesc.getLayout()) {
+            IE_THROW(ParameterMismatch) << "Failed to set the batch of blobs with name: \'" << name
+                                        << "\', the layout of the blobs differs from the input one";
+        }
+    }
+    SetBlobsImpl(name, std::make_shared<BatchedBlob>(blobs));
+}
+
+void IInferRequestInternal::SetBlobsImpl(const std::string& name, const BatchedBlob::Ptr& batchedBlob) {
+    IE_THROW(NotImplemented) << "Setting the batch of blobs is not supported by the device";
+}
+
 Blob::Ptr IInferRequestInternal::GetBlob(const std::string& name) {
     OV_ITT_SCOPED_TASK(itt::domains::Plugin, "GetBlob");
     Blob::Ptr data;
@@ -15,6 +15,10 @@ void IVariableStateInternal::Reset() {
     IE_THROW(NotImplemented);
 }
 
+void IVariableStateInternal::Trim(size_t) {
+    IE_THROW(NotImplemented);
+}
+
 void IVariableStateInternal::SetState(const Blob::Ptr& newState) {
     state = newState;
 }
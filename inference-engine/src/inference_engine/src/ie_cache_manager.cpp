@@ -0,0 +1,452 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_cache_manager.hpp"
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#    include <process.h>
+#    include <sys/utime.h>
+#else
+#    include <fcntl.h>
+#    include <sys/time.h>
+#    include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <random>
+#include <vector>
+
+#include "ie_common.h"
+#include "ie_hash128.hpp"
+#include "openvino/util/file_util.hpp"
+
+namespace InferenceEngine {
+
+namespace {
+
+constexpr char BLOB_MAGIC[8] = {'I', 'E', 'C', 'A', 'C', 'H', 'E', '1'};
+
+// The header of the cache entry: the magic, the size of the payload and the 128-bit checksum of it
+struct BlobHeader {
+    char magic[8];
+    uint64_t payloadSize;
+    uint64_t checksum[2];
+};
+constexpr size_t BLOB_HEADER_SIZE = sizeof(BlobHeader);
+static_assert(BLOB_HEADER_SIZE == 32, "The cache entry header must be packed");
+
+constexpr char BLOB_EXT[] = ".blob";
+constexpr char TEMP_EXT[] = ".tmp";
+constexpr char LOCK_FILE[] = ".cache.lock";
+// The temporary files of the writers which crashed are removed after this time
+constexpr int64_t STALE_TEMP_FILE_AGE_NS = 3600LL * 1000 * 1000 * 1000;
+
+bool endsWith(const std::string& str, const std::string& suffix) {
+    return str.size() >= suffix.size() && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+int64_t nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+// The size and the modification time in nanoseconds since the epoch
+bool getFileInfo(const std::string& path, uint64_t& size, int64_t& time) {
+#ifdef _WIN32
+    struct _stat64 info;
+    if (_stat64(path.c_str(), &info) != 0)
+        return false;
+    time = static_cast<int64_t>(info.st_mtime) * 1000000000LL;
+#else
+    struct stat info;
+    if (stat(path.c_str(), &info) != 0)
+        return false;
+#    ifdef __APPLE__
+    time = static_cast<int64_t>(info.st_mtimespec.tv_sec) * 1000000000LL + info.st_mtimespec.tv_nsec;
+#    else
+    time = static_cast<int64_t>(info.st_mtim.tv_sec) * 1000000000LL + info.st_mtim.tv_nsec;
+#    endif
+#endif
+    size = static_cast<uint64_t>(info.st_size);
+    return true;
+}
+
+// Marks the entry as recently used
+void touchFile(const std::string& path) {
+#ifdef _WIN32
+    _utime(path.c_str(), nullptr);
+#else
+    utimes(path.c_str(), nullptr);
+#endif
+}
+
+// Replaces the destination file if it exists, the readers see either the old or the new file
+bool renameFile(const std::string& from, const std::string& to) {
+#ifdef _WIN32
+    return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+    return std::rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+
+std::string getTempFile(const std::string& blobFile) {
+    static std::atomic<uint64_t> counter{0};
+    // the pids of the processes in the different containers sharing the directory may be the same
+    static const uint64_t instance = std::random_device{}();
+#ifdef _WIN32
+    const auto pid = _getpid();
+#else
+    const auto pid = getpid();
+#endif
+    return blobFile + "." + std::to_string(pid) + "_" + std::to_string(instance) + "_" + std::to_string(counter++) +
+           TEMP_EXT;
+}
+
+// The checksum of the stream from the current position to the end
+void computeChecksum(std::istream& stream, uint64_t& low, uint64_t& high) {
+    details::Hash128 hash;
+    std::vector<char> buffer(1024 * 1024);
+    while (stream) {
+        stream.read(buffer.data(), buffer.size());
+        hash.update(buffer.data(), static_cast<size_t>(stream.gcount()));
+    }
+    hash.finish(low, high);
+}
+
+// Reads and checks the header of the entry and the size of the payload
+bool readHeader(std::filebuf& file, BlobHeader& header) {
+    if (file.sgetn(reinterpret_cast<char*>(&header), BLOB_HEADER_SIZE) != static_cast<std::streamsize>(BLOB_HEADER_SIZE) ||
+        !std::equal(std::begin(BLOB_MAGIC), std::end(BLOB_MAGIC), header.magic))
+        return false;
+    const auto end = file.pubseekoff(0, std::ios::end, std::ios::in);
+    return end != std::streampos(std::streamoff(-1)) &&
+           static_cast<uint64_t>(std::streamoff(end)) == BLOB_HEADER_SIZE + header.payloadSize;
+}
+
+/**
+ * @brief The payload of the entry, computes the checksum of the payload while it is read
+ *
+ * The bytes are hashed the first time the contiguous hashed part of the payload reaches them, so the payload read in
+ * order (even with the seeks back) is read from the file once. The bytes the reader skipped or didn't read are read
+ * and hashed by verify().
+ */
+class ChecksumStreamBuf : public std::streambuf {
+public:
+    ChecksumStreamBuf(std::filebuf& file, uint64_t size) : m_file(file), m_size(size), m_buffer(1024 * 1024) {
+        setg(m_buffer.data(), m_buffer.data(), m_buffer.data());
+        m_file.pubseekpos(static_cast<std::streamoff>(BLOB_HEADER_SIZE), std::ios::in);
+    }
+
+    // Hashes the rest of the payload and compares the checksum with the expected one
+    bool verify(const uint64_t (&checksum)[2]) {
+        seekpos(static_cast<std::streamoff>(m_hashed), std::ios::in);
+        while (m_hashed < m_size) {
+            if (!fill())
+                return false;
+            setg(eback(), egptr(), egptr());
+        }
+        uint64_t low = 0, high = 0;
+        m_hash.finish(low, high);
+        return low == checksum[0] && high == checksum[1];
+    }
+
+protected:
+    int_type underflow() override {
+        if (gptr() == egptr() && !fill())
+            return traits_type::eof();
+        return traits_type::to_int_type(*gptr());
+    }
+
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        off_type base = 0;
+        if (dir == std::ios::cur)
+            base = static_cast<off_type>(position());
+        else if (dir == std::ios::end)
+            base = static_cast<off_type>(m_size);
+        return seekpos(base + off, which);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        const off_type offset = pos;
+        if ((which & std::ios::out) || offset < 0 || static_cast<uint64_t>(offset) > m_size)
+            return pos_type(off_type(-1));
+        const uint64_t bufferEnd = m_bufferPos + static_cast<uint64_t>(egptr() - eback());
+        if (static_cast<uint64_t>(offset) >= m_bufferPos && static_cast<uint64_t>(offset) <= bufferEnd) {
+            setg(eback(), eback() + (offset - m_bufferPos), egptr());
+        } else {
+            m_bufferPos = static_cast<uint64_t>(offset);
+            setg(m_buffer.data(), m_buffer.data(), m_buffer.data());
+        }
+        return pos;
+    }
+
+private:
+    uint64_t position() const {
+        return m_bufferPos + static_cast<uint64_t>(gptr() - eback());
+    }
+
+    // Reads the next chunk of the payload from the current position
+    bool fill() {
+        const uint64_t pos = position();
+        if (pos >= m_size)
+            return false;
+        if (pos != m_filePos) {
+            const std::streamoff filePos = static_cast<std::streamoff>(BLOB_HEADER_SIZE + pos);
+            if (m_file.pubseekpos(filePos, std::ios::in) != std::streampos(filePos))
+                return false;
+        }
+        const auto size = static_cast<std::streamsize>(std::min<uint64_t>(m_buffer.size(), m_size - pos));
+        const auto read = m_file.sgetn(m_buffer.data(), size);
+        if (read <= 0)
+            return false;
+        m_bufferPos = pos;
+        m_filePos = pos + static_cast<uint64_t>(read);
+        setg(m_buffer.data(), m_buffer.data(), m_buffer.data() + read);
+        if (pos <= m_hashed && m_filePos > m_hashed) {
+            m_hash.update(m_buffer.data() + (m_hashed - pos), static_cast<size_t>(m_filePos - m_hashed));
+            m_hashed = m_filePos;
+        }
+        return true;
+    }
+
+    std::filebuf& m_file;
+    const uint64_t m_size;
+    std::vector<char> m_buffer;
+    // the position of the buffer in the payload
+    uint64_t m_bufferPos = 0;
+    // the position of the file in the payload
+    uint64_t m_filePos = 0;
+    // the end of the hashed part of the payload
+    uint64_t m_hashed = 0;
+    details::Hash128 m_hash;
+};
+
+/**
+ * @brief Exclusive lock of the cache directory held by one thread of all the processes sharing the directory
+ *
+ * The POSIX record locks are owned by the process, so the threads of the process are serialized by the mutex.
+ */
+class CacheDirLock {
+public:
+    explicit CacheDirLock(const std::string& dir) : m_guard(mutex()) {
+        const auto path = FileUtils::makePath(dir, std::string(LOCK_FILE));
+#ifdef _WIN32
+        m_handle = CreateFileA(path.c_str(),
+                               GENERIC_READ | GENERIC_WRITE,
+                               FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                               nullptr,
+                               OPEN_ALWAYS,
+                               FILE_ATTRIBUTE_NORMAL,
+                               nullptr);
+        if (m_handle != INVALID_HANDLE_VALUE) {
+            OVERLAPPED overlapped = {};
+            m_locked = LockFileEx(m_handle, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped) != 0;
+        }
+#else
+        m_fd = open(path.c_str(), O_RDWR | O_CREAT, 0666);
+        if (m_fd != -1) {
+            struct flock lock = {};
+            lock.l_type = F_WRLCK;
+            lock.l_whence = SEEK_SET;
+            int res = 0;
+            while ((res = fcntl(m_fd, F_SETLKW, &lock)) == -1 && errno == EINTR) {
+            }
+            m_locked = res == 0;
+        }
+#endif
+    }
+
+    ~CacheDirLock() {
+#ifdef _WIN32
+        if (m_handle != INVALID_HANDLE_VALUE) {
+            if (m_locked) {
+                OVERLAPPED overlapped = {};
+                UnlockFileEx(m_handle, 0, MAXDWORD, MAXDWORD, &overlapped);
+            }
+            CloseHandle(m_handle);
+        }
+#else
+        // closing the file releases the lock
+        if (m_fd != -1)
+            close(m_fd);
+#endif
+    }
+
+    CacheDirLock(const CacheDirLock&) = delete;
+    CacheDirLock& operator=(const CacheDirLock&) = delete;
+
+    // The cache stays usable if the lock can't be taken (e.g. on a file system without the locks), only the
+    // concurrent evictions may remove more entries than needed
+    bool isLocked() const {
+        return m_locked;
+    }
+
+private:
+    static std::mutex& mutex() {
+        static std::mutex dirMutex;
+        return dirMutex;
+    }
+
+    std::lock_guard<std::mutex> m_guard;
+    bool m_locked = false;
+#ifdef _WIN32
+    HANDLE m_handle = INVALID_HANDLE_VALUE;
+#else
+    int m_fd = -1;
+#endif
+};
+
+}  // namespace
+
+FileStorageCacheManager::Statistics FileStorageCacheManager::getStatistics() const {
+    Statistics statistics;
+    statistics.hits = m_hits;
+    statistics.misses = m_misses;
+    statistics.evictions = m_evictions;
+    return statistics;
+}
+
+void FileStorageCacheManager::writeCacheEntry(const std::string& id, StreamWriter writer) {
+    const auto blobFile = getBlobFile(id);
+    const auto tempFile = getTempFile(blobFile);
+    try {
+        {
+            std::ofstream stream(tempFile, std::ios_base::binary | std::ofstream::out);
+            if (!stream.is_open())
+                return;
+            // the header is written when the payload is complete
+            const char placeholder[BLOB_HEADER_SIZE] = {};
+            stream.write(placeholder, BLOB_HEADER_SIZE);
+            writer(stream);
+            stream.flush();
+            if (!stream)
+                IE_THROW() << "Failed to write the cache entry " << blobFile;
+        }
+
+        BlobHeader header;
+        std::copy(std::begin(BLOB_MAGIC), std::end(BLOB_MAGIC), header.magic);
+        {
+            std::ifstream stream(tempFile, std::ios_base::binary);
+            stream.seekg(0, std::ios::end);
+            header.payloadSize = static_cast<uint64_t>(stream.tellg()) - BLOB_HEADER_SIZE;
+            stream.seekg(BLOB_HEADER_SIZE, std::ios::beg);
+            computeChecksum(stream, header.checksum[0], header.checksum[1]);
+        }
+        {
+            std::fstream stream(tempFile, std::ios_base::binary | std::ios_base::in | std::ios_base::out);
+            stream.write(reinterpret_cast<const char*>(&header), BLOB_HEADER_SIZE);
+            stream.flush();
+            if (!stream)
+                IE_THROW() << "Failed to write the cache entry " << blobFile;
+        }
+
+        if (!renameFile(tempFile, blobFile)) {
+            // e.g. the entry is being read on Windows, it is kept as is
+            std::remove(tempFile.c_str());
+            return;
+        }
+    } catch (...) {
+        std::remove(tempFile.c_str());
+        throw;
+    }
+
+    if (m_maxSize)
+        evict();
+}
+
+void FileStorageCacheManager::readCacheEntry(const std::string& id, StreamReader reader) {
+    const auto blobFile = getBlobFile(id);
+    std::filebuf file;
+    if (!file.open(blobFile, std::ios_base::in | std::ios_base::binary)) {
+        m_misses++;
+        return;
+    }
+    BlobHeader header;
+    if (!readHeader(file, header)) {
+        file.close();
+        std::remove(blobFile.c_str());
+        m_misses++;
+        return;
+    }
+
+    // The checksum is checked after the reader, so the corrupted entry is reported by the exception and the caller
+    // drops what the reader has imported
+    ChecksumStreamBuf payload(file, header.payloadSize);
+    std::istream stream(&payload);
+    reader(stream);
+    if (!payload.verify(header.checksum)) {
+        file.close();
+        std::remove(blobFile.c_str());
+        m_misses++;
+        IE_THROW() << "The cache entry " << blobFile << " is corrupted";
+    }
+    touchFile(blobFile);
+    m_hits++;
+}
+
+void FileStorageCacheManager::removeCacheEntry(const std::string& id) {
+    auto blobFileName = getBlobFile(id);
+    if (FileUtils::fileExist(blobFileName))
+        std::remove(blobFileName.c_str());
+}
+
+void FileStorageCacheManager::evict() {
+    struct Entry {
+        std::string path;
+        uint64_t size;
+        int64_t time;
+    };
+
+    CacheDirLock lock(m_cachePath);
+    std::vector<Entry> entries;
+    uint64_t totalSize = 0;
+    const auto now = nowNs();
+    try {
+        ov::util::iterate_files(
+            m_cachePath,
+            [&](const std::string& file, bool isDir) {
+                Entry entry{file, 0, 0};
+                if (isDir || !getFileInfo(file, entry.size, entry.time))
+                    return;
+                if (endsWith(file, BLOB_EXT)) {
+                    totalSize += entry.size;
+                    entries.push_back(std::move(entry));
+                } else if (endsWith(file, TEMP_EXT) && now - entry.time > STALE_TEMP_FILE_AGE_NS) {
+                    std::remove(file.c_str());
+                }
+            },
+            false,
+            false);
+    } catch (...) {
+        // the directory can't be listed, nothing is evicted
+        return;
+    }
+    if (totalSize <= m_maxSize)
+        return;
+
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        return a.time < b.time || (a.time == b.time && a.path < b.path);
+    });
+    for (const auto& entry : entries) {
+        if (totalSize <= m_maxSize)
+            break;
+        if (std::remove(entry.path.c_str()) == 0) {
+            totalSize -= entry.size;
+            m_evictions++;
+        }
+    }
+}
+
+}  // namespace InferenceEngine
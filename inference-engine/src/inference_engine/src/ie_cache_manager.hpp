@@ -9,9 +9,11 @@
  */
 #pragma once
 
-#include <fstream>
+#include <atomic>
 #include <functional>
+#include <istream>
 #include <memory>
+#include <ostream>
 #include <string>
 
 #include "file_utils.h"
@@ -75,22 +77,37 @@ public:
 /**
  * @brief File storage-based Implementation of ICacheManager
  *
- * Uses simple file for read/write cached models.
+ * Uses one file per cached model. The directory may be shared by many processes:
+ *  - the entry is written to the temporary file and published by the atomic rename, so the readers never see the
+ *    partially written entry,
+ *  - the entry starts with the header containing the size and the checksum of the payload. The entry of the wrong
+ *    size (e.g. truncated on the power loss) is removed and treated as missing. The checksum is computed while the
+ *    reader reads the payload, so the entry which doesn't match it is removed and readCacheEntry throws after the
+ *    reader returns,
+ *  - if the maximum size is set, the least recently used entries are evicted after the write, the access time is the
+ *    modification time of the file updated on each read. The eviction is serialized by the file lock in the directory.
  *
  */
 class FileStorageCacheManager final : public ICacheManager {
-    std::string m_cachePath;
-
-    std::string getBlobFile(const std::string& blobHash) const {
-        return FileUtils::makePath(m_cachePath, blobHash + ".blob");
-    }
-
 public:
+    /**
+     * @brief Counters of the cache accesses made by this manager
+     */
+    struct Statistics {
+        uint64_t hits = 0;       //!< The entry was verified and passed to the reader
+        uint64_t misses = 0;     //!< The entry is missing or corrupted
+        uint64_t evictions = 0;  //!< The entries removed to fit the maximum size
+    };
+
     /**
      * @brief Constructor
      *
+     * @param cachePath The directory of the cache
+     * @param maxSize The maximum total size of the entries in bytes, 0 means unlimited
      */
-    FileStorageCacheManager(std::string&& cachePath) : m_cachePath(std::move(cachePath)) {}
+    FileStorageCacheManager(std::string&& cachePath, uint64_t maxSize = 0)
+        : m_cachePath(std::move(cachePath)),
+          m_maxSize(maxSize) {}
 
     /**
      * @brief Destructor
@@ -98,25 +115,29 @@ public:
      */
     ~FileStorageCacheManager() override = default;
 
+    /**
+     * @brief Returns the counters of the cache accesses
+     */
+    Statistics getStatistics() const;
+
 private:
-    void writeCacheEntry(const std::string& id, StreamWriter writer) override {
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
-        writer(stream);
+    std::string getBlobFile(const std::string& blobHash) const {
+        return FileUtils::makePath(m_cachePath, blobHash + ".blob");
     }
 
-    void readCacheEntry(const std::string& id, StreamReader reader) override {
-        auto blobFileName = getBlobFile(id);
-        if (FileUtils::fileExist(blobFileName)) {
-            std::ifstream stream(blobFileName, std::ios_base::binary);
-            reader(stream);
-        }
-    }
+    void writeCacheEntry(const std::string& id, StreamWriter writer) override;
 
-    void removeCacheEntry(const std::string& id) override {
-        auto blobFileName = getBlobFile(id);
-        if (FileUtils::fileExist(blobFileName))
-            std::remove(blobFileName.c_str());
-    }
+    void readCacheEntry(const std::string& id, StreamReader reader) override;
+
+    void removeCacheEntry(const std::string& id) override;
+
+    void evict();
+
+    std::string m_cachePath;
+    uint64_t m_maxSize;
+    std::atomic<uint64_t> m_hits{0};
+    std::atomic<uint64_t> m_misses{0};
+    std::atomic<uint64_t> m_evictions{0};
 };
 
 }  // namespace InferenceEngine
@@ -6,6 +6,8 @@
 
 #include <sys/stat.h>
 
+#include <atomic>
+#include <cctype>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -71,6 +73,9 @@ Parsed<T> parseDeviceNameIntoConfig(const std::string& deviceName, const std::ma
     } else if (deviceName_.find("MULTI:") == 0) {
         deviceName_ = "MULTI";
         config_[ie::MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES] = deviceName.substr(6);
+    } else if (deviceName_.find("BATCH:") == 0) {
+        deviceName_ = "BATCH";
+        config_[ie::AutoBatchConfigParams::KEY_AUTO_BATCH_DEVICE_CONFIG] = deviceName.substr(6);
     } else if (deviceName.find("AUTO") == 0) {
         deviceName_ = "AUTO";
         if (deviceName.find("AUTO:") == 0) {
@@ -148,19 +153,60 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         };
 
         void setAndUpdate(std::map<std::string, std::string>& config) {
-            auto it = config.find(CONFIG_KEY(CACHE_DIR));
+            auto it = config.find(CONFIG_KEY(CACHE_MAX_SIZE));
+            if (it != config.end()) {
+                uint64_t maxSize = 0;
+                try {
+                    size_t pos = 0;
+                    if (it->second.empty() || !std::isdigit(static_cast<unsigned char>(it->second.front())))
+                        throw std::invalid_argument(it->second);
+                    maxSize = std::stoull(it->second, &pos);
+                    if (pos != it->second.size())
+                        throw std::invalid_argument(it->second);
+                } catch (...) {
+                    IE_THROW() << "Wrong value for property key " << CONFIG_KEY(CACHE_MAX_SIZE)
+                               << ". Expected the size in bytes";
+                }
+                std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+                _cacheMaxSize = maxSize;
+                if (!_cacheConfig._cacheDir.empty()) {
+                    _cacheConfig._cacheManager =
+                        std::make_shared<ie::FileStorageCacheManager>(std::string(_cacheConfig._cacheDir),
+                                                                      _cacheMaxSize);
+                }
+                config.erase(it);
+            }
+
+            it = config.find(CONFIG_KEY(CACHE_DIR));
             if (it != config.end()) {
                 std::lock_guard<std::mutex> lock(_cacheConfigMutex);
                 _cacheConfig._cacheDir = it->second;
                 if (!it->second.empty()) {
                     FileUtils::createDirectoryRecursive(it->second);
-                    _cacheConfig._cacheManager = std::make_shared<ie::FileStorageCacheManager>(std::move(it->second));
+                    _cacheConfig._cacheManager =
+                        std::make_shared<ie::FileStorageCacheManager>(std::move(it->second), _cacheMaxSize);
                 } else {
                     _cacheConfig._cacheManager = nullptr;
                 }
 
                 config.erase(it);
             }
+
+            it = config.find(CONFIG_KEY(ENABLE_MMAP));
+            if (it != config.end()) {
+                if (it->second == CONFIG_VALUE(YES)) {
+                    _enableMmap = true;
+                } else if (it->second == CONFIG_VALUE(NO)) {
+                    _enableMmap = false;
+                } else {
+                    IE_THROW() << "Wrong value for property key " << CONFIG_KEY(ENABLE_MMAP) << ". Expected only YES/NO";
+                }
+                config.erase(it);
+            }
+        }
+
+        bool isMmapEnabled() const {
+            return _enableMmap;
         }
 
         // Creating thread-safe copy of config including shared_ptr to ICacheManager
@@ -172,6 +218,8 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
     private:
         mutable std::mutex _cacheConfigMutex;
         CacheConfig _cacheConfig;
+        uint64_t _cacheMaxSize = 0;
+        std::atomic<bool> _enableMmap{true};
     };
 
     // Core settings (cache config, etc)
@@ -450,7 +498,7 @@ public:
 
     ie::CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath) const override {
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "CoreImpl::ReadNetwork from file");
-        auto cnnNet = InferenceEngine::details::ReadNetwork(modelPath, binPath, extensions);
+        auto cnnNet = InferenceEngine::details::ReadNetwork(modelPath, binPath, extensions, coreConfig.isMmapEnabled());
         OPENVINO_ASSERT(cnnNet.getFunction() || !newAPI, "Cannot read IR v7 from OpenVINO 2.0 API");
         if (!newAPI)
             return cnnNet;
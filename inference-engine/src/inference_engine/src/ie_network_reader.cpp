@@ -166,7 +166,8 @@ ov::Extensions get_extensions_map(const std::vector<InferenceEngine::IExtensionP
 
 CNNNetwork details::ReadNetwork(const std::string& modelPath,
                                 const std::string& binPath,
-                                const std::vector<IExtensionPtr>& exts) {
+                                const std::vector<IExtensionPtr>& exts,
+                                bool enableMmap) {
     // Register readers if it is needed
     registerReaders();
 
@@ -258,10 +259,13 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath,
 #endif
         params.emplace_back(ov::make_variant(weights_path));
     }
-
     FE = manager.load_by_model(params);
-    if (FE)
+    if (FE) {
+        // only IR frontend reads the weights file by itself
+        if (FE->get_name() == "ir")
+            params.emplace_back(ov::make_variant(enableMmap ? ov::WeightsLoadMode::Mmap : ov::WeightsLoadMode::Read));
         inputModel = FE->load(params);
+    }
 
     if (inputModel) {
         auto ngFunc = FE->convert(inputModel);
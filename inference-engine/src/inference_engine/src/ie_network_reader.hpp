@@ -19,11 +19,13 @@ namespace details {
  * @param binPath path to bin file, if path is empty, will try to read bin file with the same name as xml and
  * if bin file with the same name was not found, will load IR without weights.
  * @param exts vector with extensions
+ * @param enableMmap allows memory-mapping of the weights file instead of reading it to an allocated buffer
  * @return CNNNetwork
  */
 CNNNetwork ReadNetwork(const std::string& modelPath,
                        const std::string& binPath,
-                       const std::vector<IExtensionPtr>& exts);
+                       const std::vector<IExtensionPtr>& exts,
+                       bool enableMmap = false);
 /**
  * @brief Reads IR xml and bin (with the same name) files
  * @param model string with IR
@@ -6,8 +6,10 @@
 
 #include <atomic>
 #include <cassert>
+#include <chrono>
 #include <climits>
 #include <condition_variable>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <openvino/itt.hpp>
@@ -26,6 +28,84 @@ using namespace openvino;
 
 namespace InferenceEngine {
 struct CPUStreamsExecutor::Impl {
+    /**
+     * @brief Bounded multi-producer multi-consumer queue (D. Vyukov's algorithm).
+     * Every cell has a sequence number which tells the producers and consumers whether the cell is free or busy,
+     * so the only contended operation is the CAS on the enqueue or the dequeue position.
+     */
+    class TaskQueue {
+    public:
+        explicit TaskQueue(const std::size_t capacity) : _cells(capacity), _mask{capacity - 1} {
+            assert(capacity >= 2 && (capacity & (capacity - 1)) == 0);
+            for (std::size_t i = 0; i < capacity; ++i) {
+                _cells[i]._sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        bool TryPush(Task& task) {
+            Cell* cell = nullptr;
+            auto pos = _enqueuePos.load(std::memory_order_relaxed);
+            for (;;) {
+                cell = &_cells[pos & _mask];
+                const auto seq = cell->_sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+                if (diff == 0) {
+                    if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (diff < 0) {
+                    return false;  // the queue is full
+                } else {
+                    pos = _enqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+            cell->_task = std::move(task);
+            cell->_sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool TryPop(Task& task) {
+            Cell* cell = nullptr;
+            auto pos = _dequeuePos.load(std::memory_order_relaxed);
+            for (;;) {
+                cell = &_cells[pos & _mask];
+                const auto seq = cell->_sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+                if (diff == 0) {
+                    if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (diff < 0) {
+                    return false;  // the queue is empty
+                } else {
+                    pos = _dequeuePos.load(std::memory_order_relaxed);
+                }
+            }
+            task = std::move(cell->_task);
+            // the captured objects should not outlive the task
+            cell->_task = nullptr;
+            cell->_sequence.store(pos + _mask + 1, std::memory_order_release);
+            return true;
+        }
+
+    private:
+        static constexpr std::size_t cacheLineSize = 64;
+        struct Cell {
+            std::atomic<std::size_t> _sequence;
+            Task _task;
+        };
+        std::vector<Cell> _cells;
+        const std::size_t _mask;
+        // the positions are placed to the separate cache lines to avoid false sharing of producers and consumers
+        char _pad0[cacheLineSize];
+        std::atomic<std::size_t> _enqueuePos = {0};
+        char _pad1[cacheLineSize];
+        std::atomic<std::size_t> _dequeuePos = {0};
+        char _pad2[cacheLineSize];
+    };
+
+    static constexpr std::size_t taskQueueCapacity = 1024;
+
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         struct Observer : public custom::task_scheduler_observer {
@@ -215,35 +295,87 @@ struct CPUStreamsExecutor::Impl {
             }
         }
 #endif
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _taskQueues.emplace_back(new TaskQueue{taskQueueCapacity});
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
-                for (bool stopped = false; !stopped;) {
-                    Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
-                        });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
-                    }
-                    if (task) {
-                        Execute(task, *(_streams.local()));
-                    }
+                for (Task task; Pop(streamId, task);) {
+                    Execute(task, *(_streams.local()));
+                    task = nullptr;
                 }
             });
         }
     }
 
     void Enqueue(Task task) {
-        {
+        // the producers are spread over the queues, the idle streams steal the tasks from the busy ones
+        const auto first = _nextQueue.fetch_add(1, std::memory_order_relaxed);
+        bool pushed = false;
+        for (std::size_t i = 0; i < _taskQueues.size() && !pushed; ++i) {
+            pushed = _taskQueues[(first + i) % _taskQueues.size()]->TryPush(task);
+        }
+        if (!pushed) {
+            // all the queues are full, so the contention on the lock is not a concern
             std::lock_guard<std::mutex> lock(_mutex);
             _taskQueue.emplace(std::move(task));
+            ++_overflowTasks;
+        }
+        ++_pendingTasks;
+        if (_parkedThreads > 0) {
+            // the parked thread either has not checked the pending tasks yet or waits for the notification
+            { std::lock_guard<std::mutex> lock(_mutex); }
+            _queueCondVar.notify_one();
+        }
+    }
+
+    bool TryPop(const int streamId, Task& task) {
+        for (std::size_t i = 0; i < _taskQueues.size(); ++i) {
+            if (_taskQueues[(streamId + i) % _taskQueues.size()]->TryPop(task)) {
+                --_pendingTasks;
+                return true;
+            }
+        }
+        if (_overflowTasks > 0) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!_taskQueue.empty()) {
+                task = std::move(_taskQueue.front());
+                _taskQueue.pop();
+                --_overflowTasks;
+                --_pendingTasks;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool Pop(const int streamId, Task& task) {
+        // the thread polls the queues for a while, as the next task often comes shortly (e.g. the next inference)
+        const auto spinEnd = std::chrono::steady_clock::now() + std::chrono::microseconds(_config._threadSpinBudget);
+        do {
+            if (TryPop(streamId, task)) {
+                return true;
+            }
+            std::this_thread::yield();
+        } while (std::chrono::steady_clock::now() < spinEnd);
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                ++_parkedThreads;
+                _queueCondVar.wait(lock, [&] {
+                    return _pendingTasks > 0 || _isStopped;
+                });
+                --_parkedThreads;
+            }
+            if (TryPop(streamId, task)) {
+                return true;
+            }
+            // all the submitted tasks are executed before the threads are stopped
+            if (_isStopped && _pendingTasks <= 0) {
+                return false;
+            }
         }
-        _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -280,10 +412,15 @@ struct CPUStreamsExecutor::Impl {
     int _streamId = 0;
     std::queue<int> _streamIdQueue;
     std::vector<std::thread> _threads;
+    std::vector<std::unique_ptr<TaskQueue>> _taskQueues;
+    std::atomic<std::size_t> _nextQueue = {0};
+    std::atomic<int> _pendingTasks = {0};
+    std::atomic<int> _parkedThreads = {0};
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
-    bool _isStopped = false;
+    std::queue<Task> _taskQueue;  // is used when all the lock-free queues are full
+    std::atomic<int> _overflowTasks = {0};
+    std::atomic_bool _isStopped = {false};
     std::vector<int> _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>> _streams;
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
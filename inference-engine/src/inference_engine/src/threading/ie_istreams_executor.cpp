@@ -25,6 +25,7 @@ std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() {
         CONFIG_KEY(CPU_BIND_THREAD),
         CONFIG_KEY(CPU_THREADS_NUM),
         CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM),
+        CONFIG_KEY_INTERNAL(CPU_STREAMS_SPIN_BUDGET),
     };
 }
 int IStreamsExecutor::Config::GetDefaultNumStreams() {
@@ -106,6 +107,19 @@ void IStreamsExecutor::Config::SetConfig(const std::string& key, const std::stri
                        << ". Expected only non negative numbers (#threads)";
         }
         _threadsPerStream = val_i;
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_STREAMS_SPIN_BUDGET)) {
+        int val_i;
+        try {
+            val_i = std::stoi(value);
+        } catch (const std::exception&) {
+            IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_STREAMS_SPIN_BUDGET)
+                       << ". Expected only non negative numbers (microseconds)";
+        }
+        if (val_i < 0) {
+            IE_THROW() << "Wrong value for property key " << CONFIG_KEY_INTERNAL(CPU_STREAMS_SPIN_BUDGET)
+                       << ". Expected only non negative numbers (microseconds)";
+        }
+        _threadSpinBudget = val_i;
     } else {
         IE_THROW() << "Wrong value for property key " << key;
     }
@@ -133,6 +147,8 @@ Parameter IStreamsExecutor::Config::GetConfig(const std::string& key) {
         return {std::to_string(_threads)};
     } else if (key == CONFIG_KEY_INTERNAL(CPU_THREADS_PER_STREAM)) {
         return {std::to_string(_threadsPerStream)};
+    } else if (key == CONFIG_KEY_INTERNAL(CPU_STREAMS_SPIN_BUDGET)) {
+        return {std::to_string(_threadSpinBudget)};
     } else {
         IE_THROW() << "Wrong value for property key " << key;
     }
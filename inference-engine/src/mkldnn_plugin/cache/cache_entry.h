@@ -0,0 +1,87 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <functional>
+#include <utility>
+#include "lru_cache.h"
+
+namespace MKLDNNPlugin {
+
+class CacheEntryBase {
+public:
+    enum class LookUpStatus : int8_t {
+        Hit,
+        Miss
+    };
+public:
+    virtual ~CacheEntryBase() = default;
+    virtual void setCapacity(size_t capacity) = 0;
+    virtual size_t size() const = 0;
+};
+
+/**
+ * @brief Class represents a templated record in multi cache
+ * @tparam KeyType is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
+ * @tparam ValueType is a type that must meet all the requirements to the std::unordered_map mapped type. The default constructed
+ * instance of the ValueType must be convertible to false (e.g. empty std::shared_ptr), it is used as a "not found" marker.
+ * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType) and ValueType get(const KeyType&)
+ * interface and must have constructor of type ImplType(size_t).
+ *
+ * @note The builder is called outside of the entry lock, so two threads may build a value for the same key concurrently.
+ * Both values are valid, the one that is put last stays in the cache.
+ */
+template<typename KeyType,
+         typename ValueType,
+         typename ImplType = LruCache<KeyType, ValueType>>
+class CacheEntry : public CacheEntryBase {
+public:
+    using ResultType = std::pair<ValueType, LookUpStatus>;
+
+public:
+    explicit CacheEntry(size_t capacity) : _impl(capacity) {}
+
+    /**
+     * @brief Searches the key in the underlying storage and returns value if it exists, or creates a value using the builder functor
+     * and adds it to the underlying storage.
+     * @param key is the search key
+     * @param builder is a callable object that creates the ValueType object from the KeyType lval reference
+     * @return result of the operation which is a pair of the requested object of ValType and the status of whether the cache hit or miss occurred
+     */
+    ResultType getOrCreate(const KeyType& key, std::function<ValueType(const KeyType&)> builder) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto retVal = _impl.get(key);
+            if (retVal) {
+                return {retVal, LookUpStatus::Hit};
+            }
+        }
+
+        auto retVal = builder(key);
+        if (retVal) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _impl.put(key, retVal);
+        }
+        return {retVal, LookUpStatus::Miss};
+    }
+
+    void setCapacity(size_t capacity) override {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _impl.setCapacity(capacity);
+    }
+
+    size_t size() const override {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _impl.size();
+    }
+
+private:
+    mutable std::mutex _mutex;
+    ImplType _impl;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,20 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "multi_cache.h"
+
+using namespace MKLDNNPlugin;
+
+void MultiCache::setCapacity(size_t capacity) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _capacity = capacity;
+    for (auto& entry : _storage) {
+        entry.second->setCapacity(capacity);
+    }
+}
+
+size_t MultiCache::getCapacity() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _capacity;
+}
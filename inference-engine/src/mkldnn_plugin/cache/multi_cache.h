@@ -0,0 +1,92 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <functional>
+#include <typeindex>
+#include <unordered_map>
+#include "cache_entry.h"
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Class that represent a preemptive cache for different key/value pair types.
+ *
+ * @attention This implementation IS THREAD SAFE. It may be shared between the executable networks created by one plugin
+ * instance, so the values stored in it must not refer to any particular graph or node.
+ */
+class MultiCache {
+public:
+    template<typename KeyType, typename ValueType>
+    using EntryTypeT = CacheEntry<KeyType, ValueType>;
+    using EntryBasePtr = std::shared_ptr<CacheEntryBase>;
+    template<typename KeyType, typename ValueType>
+    using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
+
+public:
+    /**
+    * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+    * @note zero capacity means empty cache so no records are stored
+    */
+    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+
+    /**
+    * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if nothing was found)
+    *       using the key and the builder functor and adds the new record to the cache
+    * @param key is the search key
+    * @param builder is a callable object that creates the ValType object from the KeyType lval reference.
+    *        Also the builder type is used for the ValueType deduction
+    * @return result of the operation which is a pair of the requested object of ValType and the status of whether the cache hit or miss occurred
+    */
+    template<typename KeyType, typename BuilderType, typename ValueType = typename std::result_of<BuilderType&(const KeyType&)>::type>
+    typename CacheEntry<KeyType, ValueType>::ResultType
+    getOrCreate(const KeyType& key, BuilderType builder) {
+        auto entry = getEntry<KeyType, ValueType>();
+        auto result = entry->getOrCreate(key, std::move(builder));
+        if (CacheEntryBase::LookUpStatus::Hit == result.second) {
+            _hits++;
+        } else {
+            _misses++;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Changes the records limit for all the existing entries and for the entries created afterwards.
+     * @param capacity new records limit
+     */
+    void setCapacity(size_t capacity);
+
+    size_t getCapacity() const;
+    size_t getHitsCount() const { return _hits; }
+    size_t getMissesCount() const { return _misses; }
+
+private:
+    template<typename KeyType, typename ValueType>
+    EntryPtr<KeyType, ValueType> getEntry() {
+        using EntryType = EntryTypeT<KeyType, ValueType>;
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto itr = _storage.find(std::type_index(typeid(EntryType)));
+        if (itr == _storage.end()) {
+            itr = _storage.insert({std::type_index(typeid(EntryType)), std::make_shared<EntryType>(_capacity)}).first;
+        }
+        return std::static_pointer_cast<EntryType>(itr->second);
+    }
+
+private:
+    mutable std::mutex _mutex;
+    size_t _capacity;
+    std::unordered_map<std::type_index, EntryBasePtr> _storage;
+    std::atomic<size_t> _hits{0};
+    std::atomic<size_t> _misses{0};
+};
+
+using MultiCachePtr = std::shared_ptr<MultiCache>;
+using MultiCacheCPtr = std::shared_ptr<const MultiCache>;
+
+}  // namespace MKLDNNPlugin
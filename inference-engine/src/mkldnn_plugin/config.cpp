@@ -7,8 +7,11 @@
 #include <string>
 #include <map>
 #include <algorithm>
+#include <sstream>
+#include <cctype>
 
 #include "ie_plugin_config.hpp"
+#include "cpu/cpu_config.hpp"
 #include "ie_common.h"
 #include "ie_parallel.hpp"
 #include "ie_system_conf.h"
@@ -19,6 +22,52 @@ namespace MKLDNNPlugin {
 
 using namespace InferenceEngine;
 
+std::map<std::string, std::vector<size_t>> Config::parseUpperBounds(const std::string& str) {
+    std::map<std::string, std::vector<size_t>> bounds;
+    size_t pos = 0;
+    while (pos < str.size()) {
+        const auto open = str.find('[', pos);
+        const auto close = str.find(']', pos);
+        if (open == std::string::npos || close == std::string::npos || close < open || open == pos)
+            IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES_UPPER_BOUNDS
+                       << ". Expected format is name1[d0,d1,...],name2[d0,...]";
+        const auto name = str.substr(pos, open - pos);
+        std::vector<size_t> dims;
+        std::stringstream dimsStream(str.substr(open + 1, close - open - 1));
+        std::string dim;
+        while (std::getline(dimsStream, dim, ',')) {
+            // std::stoul accepts the sign, so the digits are checked explicitly
+            if (dim.empty() || dim.find_first_not_of("0123456789") != std::string::npos)
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES_UPPER_BOUNDS
+                           << ". Expected only non-negative integer dimensions, got '" << dim << "' for input " << name;
+            try {
+                dims.push_back(std::stoul(dim));
+            } catch (const std::out_of_range&) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES_UPPER_BOUNDS
+                           << ". The dimension '" << dim << "' of input " << name << " is out of range";
+            }
+        }
+        bounds[name] = dims;
+
+        pos = close + 1;
+        if (pos < str.size()) {
+            if (str[pos] != ',')
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES_UPPER_BOUNDS
+                           << ". Inputs must be separated by comma";
+            pos++;
+        }
+    }
+    return bounds;
+}
+
+Precision Config::parseWeightsCompression(const std::string& str) {
+    const auto precision = Precision::FromStr(str);
+    if (precision != Precision::FP32 && precision != Precision::FP16 && precision != Precision::I8)
+        IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_FC_WEIGHTS_COMPRESSION
+                   << ". Expected only FP32/FP16/I8";
+    return precision;
+}
+
 Config::Config() {
     // this is default mode
     streamExecutorConfig._threadBindingType = InferenceEngine::IStreamsExecutor::CORES;
@@ -115,6 +164,48 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 IE_THROW() << "Wrong value for property key " << PluginConfigParams::KEY_ENFORCE_BF16
                     << ". Expected only YES/NO";
             }
+        } else if (key == CPUConfigParams::KEY_CPU_RUNTIME_CACHE_CAPACITY) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_RUNTIME_CACHE_CAPACITY
+                           << ". Expected only integer numbers";
+            }
+            // any negative value will be treated
+            // as zero that means disabling the cache
+            rtCacheCapacity = std::max(val_i, 0);
+        } else if (key == CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES_UPPER_BOUNDS) {
+            inputsUpperBounds = parseUpperBounds(val);
+            dynamicShapesUpperBounds = val;
+        } else if (key == CPUConfigParams::KEY_CPU_PARALLEL_BRANCHES) {
+            if (val == PluginConfigParams::YES) parallelBranches = true;
+            else if (val == PluginConfigParams::NO) parallelBranches = false;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_PARALLEL_BRANCHES
+                           << ". Expected only YES/NO";
+        } else if (key == CPUConfigParams::KEY_CPU_SHARED_WEIGHTS_DIR) {
+            sharedWeightsDir = val;
+        } else if (key == CPUConfigParams::KEY_CPU_SHARED_WEIGHTS_DIR_MAX_SIZE) {
+            try {
+                size_t pos = 0;
+                if (val.empty() || !std::isdigit(static_cast<unsigned char>(val.front())))
+                    throw std::invalid_argument(val);
+                sharedWeightsDirMaxSize = std::stoull(val, &pos);
+                if (pos != val.size())
+                    throw std::invalid_argument(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_SHARED_WEIGHTS_DIR_MAX_SIZE
+                           << ". Expected the size in bytes";
+            }
+        } else if (key == CPUConfigParams::KEY_CPU_FC_WEIGHTS_COMPRESSION) {
+            fcWeightsCompression = parseWeightsCompression(val);
+        } else if (key == CPUConfigParams::KEY_CPU_SNIPPETS) {
+            if (val == PluginConfigParams::YES) snippets = true;
+            else if (val == PluginConfigParams::NO) snippets = false;
+            else
+                IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_SNIPPETS
+                           << ". Expected only YES/NO";
         } else {
             IE_THROW(NotFound) << "Unsupported property " << key << " by CPU plugin";
         }
@@ -164,6 +255,15 @@ void Config::updateProperties() {
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::YES });
         else
             _config.insert({ PluginConfigParams::KEY_ENFORCE_BF16, PluginConfigParams::NO });
+        _config.insert({ CPUConfigParams::KEY_CPU_RUNTIME_CACHE_CAPACITY, std::to_string(rtCacheCapacity) });
+        _config.insert({ CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES_UPPER_BOUNDS, dynamicShapesUpperBounds });
+        _config.insert({ CPUConfigParams::KEY_CPU_PARALLEL_BRANCHES,
+                         parallelBranches ? PluginConfigParams::YES : PluginConfigParams::NO });
+        _config.insert({ CPUConfigParams::KEY_CPU_SHARED_WEIGHTS_DIR, sharedWeightsDir });
+        _config.insert({ CPUConfigParams::KEY_CPU_SHARED_WEIGHTS_DIR_MAX_SIZE, std::to_string(sharedWeightsDirMaxSize) });
+        _config.insert({ CPUConfigParams::KEY_CPU_FC_WEIGHTS_COMPRESSION, fcWeightsCompression.name() });
+        _config.insert({ CPUConfigParams::KEY_CPU_SNIPPETS,
+                         snippets ? PluginConfigParams::YES : PluginConfigParams::NO });
         _config.insert({ PluginConfigParams::KEY_PERFORMANCE_HINT, perfHintsConfig.ovPerfHint });
         _config.insert({ PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS,
                          std::to_string(perfHintsConfig.ovPerfHintNumRequests) });
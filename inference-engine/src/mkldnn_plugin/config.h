@@ -6,10 +6,12 @@
 
 #include <threading/ie_istreams_executor.hpp>
 #include <ie_performance_hints.hpp>
+#include <ie_precision.hpp>
 #include "utils/debug_capabilities.h"
 
 #include <string>
 #include <map>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
@@ -26,6 +28,17 @@ struct Config {
     bool enableDynamicBatch = false;
     std::string dumpToDot = "";
     int batchLimit = 0;
+    size_t rtCacheCapacity = 5000ul;
+    std::string dynamicShapesUpperBounds = "";
+    // parsed dynamicShapesUpperBounds: input name -> maximal shape
+    std::map<std::string, std::vector<size_t>> inputsUpperBounds;
+    bool parallelBranches = false;
+    std::string sharedWeightsDir = "";
+    // 0 means the size of the shared weights directory isn't limited
+    uint64_t sharedWeightsDirMaxSize = 0;
+    // precision of the FullyConnected weights kept in memory, FP32 means the weights aren't compressed
+    InferenceEngine::Precision fcWeightsCompression = InferenceEngine::Precision::FP32;
+    bool snippets = false;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
 #if defined(__arm__) || defined(__aarch64__)
@@ -43,6 +56,9 @@ struct Config {
 #endif
 
     void readProperties(const std::map<std::string, std::string> &config);
+    // parses the upper bounds string of "name1[d0,d1,...],name2[d0,...]" format
+    static std::map<std::string, std::vector<size_t>> parseUpperBounds(const std::string& str);
+    static InferenceEngine::Precision parseWeightsCompression(const std::string& str);
     void updateProperties();
     std::map<std::string, std::string> _config;
 };
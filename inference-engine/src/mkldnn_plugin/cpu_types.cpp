@@ -177,7 +177,11 @@ const InferenceEngine::details::caseless_unordered_map<std::string, Type> type_t
         { "NonMaxSuppression", NonMaxSuppression},
         { "NonMaxSuppressionIEInternal", NonMaxSuppression},
         { "MatrixNms", MatrixNms},
-        { "MulticlassNms", MulticlassNms}
+        { "MulticlassNms", MulticlassNms},
+        { "Subgraph", Subgraph},
+        { "ScaledDotProductAttention", ScaledDotProductAttention},
+        { "KVCache", KVCache},
+        { "ColorConvert", ColorConvert}
 };
 
 Type TypeFromName(const std::string& type) {
@@ -351,6 +355,14 @@ std::string NameFromType(const Type type) {
             return "MatrixNms";
         case MulticlassNms:
             return "MulticlassNms";
+        case Subgraph:
+            return "Subgraph";
+        case ScaledDotProductAttention:
+            return "ScaledDotProductAttention";
+        case KVCache:
+            return "KVCache";
+        case ColorConvert:
+            return "ColorConvert";
         default:
             return "Unknown";
     }
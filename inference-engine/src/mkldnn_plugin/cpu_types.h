@@ -96,7 +96,11 @@ enum Type {
     ExtractImagePatches,
     NonMaxSuppression,
     MatrixNms,
-    MulticlassNms
+    MulticlassNms,
+    Subgraph,
+    ScaledDotProductAttention,
+    KVCache,
+    ColorConvert
 };
 
 enum Algorithm {
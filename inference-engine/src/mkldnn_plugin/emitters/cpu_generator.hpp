@@ -0,0 +1,43 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpu/x64/jit_generator.hpp>
+#include "snippets/generator.hpp"
+
+namespace MKLDNNPlugin {
+
+// Holds the code of the snippet, the emitters append it instruction by instruction
+class jit_snippet : public dnnl::impl::cpu::x64::jit_generator {
+public:
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_snippet)
+
+    ~jit_snippet() = default;
+
+    jit_snippet() : jit_generator() {}
+
+    void generate() override {}
+};
+
+class CPUTargetMachine : public ngraph::snippets::TargetMachine {
+public:
+    explicit CPUTargetMachine(dnnl::impl::cpu::x64::cpu_isa_t host_isa);
+
+    bool is_supported() const override;
+    ngraph::snippets::code get_snippet() const override;
+    size_t get_lanes() const override;
+
+private:
+    std::unique_ptr<jit_snippet> h;
+    dnnl::impl::cpu::x64::cpu_isa_t isa;
+};
+
+class CPUGenerator : public ngraph::snippets::Generator {
+public:
+    explicit CPUGenerator(dnnl::impl::cpu::x64::cpu_isa_t isa);
+    ~CPUGenerator() = default;
+};
+
+}  // namespace MKLDNNPlugin
@@ -1305,16 +1305,9 @@ jit_power_static_emitter::jit_power_static_emitter(jit_generator *host, cpu_isa_
     prepare_table();
 }
 
-jit_power_static_emitter::jit_power_static_emitter(jit_generator *host, cpu_isa_t host_isa, const MKLDNNNode* node, Precision exec_prc)
-: jit_emitter(host, host_isa, node, exec_prc) {
-    const MKLDNNEltwiseNode *powerNode = dynamic_cast<const MKLDNNEltwiseNode *>(node);
-    if (powerNode == nullptr) {
-        IE_THROW() << "Can't cast to MKLDNNEltwiseNode";
-    }
-    power = powerNode->getAlpha();
-    scale = powerNode->getBeta();
-    shift = powerNode->getGamma();
-
+jit_power_static_emitter::jit_power_static_emitter(jit_generator *host, cpu_isa_t host_isa, float power, float scale, float shift,
+                                                   Precision exec_prc)
+: jit_emitter(host, host_isa, static_cast<const MKLDNNNode*>(nullptr), exec_prc), power(power), scale(scale), shift(shift) {
     prepare_table();
 }
 
@@ -1611,6 +1604,11 @@ jit_erf_emitter::jit_erf_emitter(jit_generator *host, cpu_isa_t host_isa, const
     prepare_table();
 }
 
+jit_erf_emitter::jit_erf_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node, Precision exec_prc)
+: jit_emitter(host, host_isa, node, exec_prc) {
+    prepare_table();
+}
+
 size_t jit_erf_emitter::get_inputs_num() const { return 1; }
 
 void jit_erf_emitter::emit_impl(
@@ -3,7 +3,7 @@
 //
 
 #include "jit_mkldnn_emitters.hpp"
-#include "nodes/mkldnn_eltwise_node.h"
+#include <ngraph/opsets/opset1.hpp>
 
 using namespace mkldnn::impl::utils;
 using namespace mkldnn::impl;
@@ -14,20 +14,33 @@ namespace MKLDNNPlugin {
 
 jit_mkldnn_emitter::jit_mkldnn_emitter(jit_generator *host, cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& node, InferenceEngine::Precision exec_prc)
     : jit_emitter(host, host_isa, node, exec_prc) {
-
-    kind = mkldnn_eltwise_tanh;
-    alpha = 0.f;
-    beta = 0.f;
+    if (ngraph::is_type<ngraph::opset1::Relu>(node)) {
+        kind = mkldnn_eltwise_relu;
+    } else if (ngraph::is_type<ngraph::opset1::Sigmoid>(node)) {
+        kind = mkldnn_eltwise_logistic;
+    } else if (ngraph::is_type<ngraph::opset1::Tanh>(node)) {
+        kind = mkldnn_eltwise_tanh;
+    } else if (ngraph::is_type<ngraph::opset1::Abs>(node)) {
+        kind = mkldnn_eltwise_abs;
+    } else if (ngraph::is_type<ngraph::opset1::Exp>(node)) {
+        kind = mkldnn_eltwise_exp;
+    } else if (auto elu = ngraph::as_type_ptr<ngraph::opset1::Elu>(node)) {
+        kind = mkldnn_eltwise_elu;
+        alpha = static_cast<float>(elu->get_alpha());
+    } else if (auto clamp = ngraph::as_type_ptr<ngraph::opset1::Clamp>(node)) {
+        kind = mkldnn_eltwise_clip;
+        alpha = static_cast<float>(clamp->get_min());
+        beta = static_cast<float>(clamp->get_max());
+    } else {
+        IE_THROW() << "Unsupported operation type '" << node->get_type_name() << "' for mkldnn emitter";
+    }
 
     set_injector();
 }
 
-jit_mkldnn_emitter::jit_mkldnn_emitter(jit_generator *host, cpu_isa_t host_isa, const MKLDNNNode* node, InferenceEngine::Precision exec_prc)
-    : jit_emitter(host, host_isa, node, exec_prc) {
-    auto eltwiseNode = dynamic_cast<const MKLDNNEltwiseNode*>(node);
-    kind = static_cast<mkldnn_alg_kind_t>(eltwiseNode->getMKLDNNAlgorithm());
-    alpha = eltwiseNode->getAlpha();
-    beta = eltwiseNode->getBeta();
+jit_mkldnn_emitter::jit_mkldnn_emitter(jit_generator *host, cpu_isa_t host_isa, mkldnn_alg_kind_t algKind, float alpha, float beta,
+                                       InferenceEngine::Precision exec_prc)
+    : jit_emitter(host, host_isa, static_cast<const MKLDNNNode*>(nullptr), exec_prc), kind(algKind), alpha(alpha), beta(beta) {
 
     set_injector();
 }
@@ -80,8 +93,9 @@ void jit_mkldnn_emitter::emit_data() const {
     }
 }
 
-jit_mkldnn_aux_emitter::jit_mkldnn_aux_emitter(jit_generator *host, cpu_isa_t host_isa, const MKLDNNNode* node, InferenceEngine::Precision exec_prc)
-    : jit_mkldnn_emitter(host, host_isa, node, exec_prc) {
+jit_mkldnn_aux_emitter::jit_mkldnn_aux_emitter(jit_generator *host, cpu_isa_t host_isa, mkldnn_alg_kind_t algKind, float alpha, float beta,
+                                               InferenceEngine::Precision exec_prc)
+    : jit_mkldnn_emitter(host, host_isa, algKind, alpha, beta, exec_prc) {
 }
 
 } // namespace MKLDNNPlugin
@@ -15,6 +15,10 @@ namespace MKLDNNPlugin {
 
 class jit_mkldnn_emitter : public jit_emitter {
 public:
+    // The activation is taken from the type of the ngraph operation, e.g. Relu, Sigmoid or Clamp
+    jit_mkldnn_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n,
+                       InferenceEngine::Precision exec_prc = InferenceEngine::Precision::FP32);
+
     void emit_code(const std::vector<size_t> &in_vec_idxs, const std::vector<size_t> &out_vec_idxs,
                    const std::vector<size_t> &pool_vec_idxs, const std::vector<size_t> &pool_gpr_idxs) const override;
 
@@ -25,9 +29,8 @@ public:
                    const emitter_context *emit_context = nullptr) const override {};
 
 protected:
-    jit_mkldnn_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const MKLDNNNode* node,
-                       InferenceEngine::Precision exec_prc = InferenceEngine::Precision::FP32);
-    jit_mkldnn_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ngraph::Node>& n,
+    jit_mkldnn_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa,
+                       mkldnn_alg_kind_t algKind, float alpha, float beta,
                        InferenceEngine::Precision exec_prc = InferenceEngine::Precision::FP32);
     void set_injector();
 
@@ -45,7 +48,8 @@ private:
 
 class jit_mkldnn_aux_emitter : public jit_mkldnn_emitter {
 public:
-    jit_mkldnn_aux_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa, const MKLDNNNode* node,
+    jit_mkldnn_aux_emitter(mkldnn::impl::cpu::x64::jit_generator *host, mkldnn::impl::cpu::x64::cpu_isa_t host_isa,
+                           mkldnn_alg_kind_t algKind, float alpha, float beta,
                            InferenceEngine::Precision exec_prc = InferenceEngine::Precision::FP32);
 
 private:
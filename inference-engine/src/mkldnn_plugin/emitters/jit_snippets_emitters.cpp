@@ -0,0 +1,207 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "jit_snippets_emitters.hpp"
+
+#include <snippets/op/kernel.hpp>
+#include <snippets/op/tile.hpp>
+#include <snippets/op/scalar.hpp>
+
+using namespace InferenceEngine;
+using namespace mkldnn::impl::utils;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_snippets_call_args, field)
+
+namespace MKLDNNPlugin {
+
+// The first pointer register, the same as the one the effective addresses are assigned from
+static constexpr int reg64_tmp_start = 8;
+static const Reg64 reg_const_params = abi_param1;
+static const Reg64 reg_work_amount = abi_param2;
+
+#define EMIT_FOR_ISA(...)                                           \
+    if (host_isa_ == cpu::x64::sse41) {                             \
+        emit_isa<cpu::x64::sse41>(__VA_ARGS__);                     \
+    } else if (host_isa_ == cpu::x64::avx2) {                       \
+        emit_isa<cpu::x64::avx2>(__VA_ARGS__);                      \
+    } else if (host_isa_ == cpu::x64::avx512_common) {              \
+        emit_isa<cpu::x64::avx512_common>(__VA_ARGS__);             \
+    } else {                                                        \
+        IE_THROW() << "Snippets don't support the isa " << host_isa_; \
+    }
+
+/// KERNEL ///
+KernelEmitter::KernelEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+: jit_emitter(h, isa, n) {
+    auto kernel = ngraph::as_type_ptr<ngraph::snippets::op::Kernel>(n);
+    if (!kernel)
+        IE_THROW() << "KernelEmitter expects Kernel operation";
+    code = kernel->region;
+}
+
+void KernelEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                              const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                              const MKLDNNPlugin::emitter_context *emit_context) const {
+    const size_t num_params = in[0];
+    const size_t num_results = in[1];
+    if (num_params > SNIPPETS_MAX_NUM_PTRS || num_results > SNIPPETS_MAX_NUM_PTRS)
+        IE_THROW() << "Snippet has too many parameters or results";
+
+    h->preamble();
+
+    for (size_t i = 0; i < num_params; i++)
+        h->mov(Reg64(reg64_tmp_start + i), h->ptr[reg_const_params + GET_OFF(src_ptrs) + i * sizeof(void*)]);
+    for (size_t i = 0; i < num_results; i++)
+        h->mov(Reg64(reg64_tmp_start + num_params + i), h->ptr[reg_const_params + GET_OFF(dst_ptrs) + i * sizeof(void*)]);
+    h->mov(reg_work_amount, h->ptr[reg_const_params + GET_OFF(work_amount)]);
+
+    for (const auto& c : code)
+        c.first->emit_code(c.second.first, c.second.second);
+
+    h->postamble();
+}
+
+/// TILE ///
+TileEmitter::TileEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+: jit_emitter(h, isa, n) {
+    auto tile = ngraph::as_type_ptr<ngraph::snippets::op::Tile>(n);
+    if (!tile)
+        IE_THROW() << "TileEmitter expects Tile operation";
+    code = tile->region;
+}
+
+void TileEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                            const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                            const MKLDNNPlugin::emitter_context *emit_context) const {
+    const size_t inc = in[0];
+    Label loop_label, exit_label;
+
+    h->L(loop_label);
+    h->cmp(reg_work_amount, inc);
+    h->jl(exit_label, jit_generator::T_NEAR);
+
+    for (const auto& c : code)
+        c.first->emit_code(c.second.first, c.second.second);
+
+    h->sub(reg_work_amount, inc);
+    h->jmp(loop_label, jit_generator::T_NEAR);
+    h->L(exit_label);
+}
+
+/// FAKE BROADCAST ///
+void FakeBroadcastEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                                     const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                                     const MKLDNNPlugin::emitter_context *emit_context) const {
+    EMIT_FOR_ISA(in, out)
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void FakeBroadcastEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    h->uni_vbroadcastss(Vmm(out[0]), Xmm(in[0]));
+}
+
+/// SCALAR ///
+ScalarEmitter::ScalarEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+: jit_emitter(h, isa, n) {
+    auto scalar = ngraph::as_type_ptr<ngraph::snippets::op::Scalar>(n);
+    if (!scalar)
+        IE_THROW() << "ScalarEmitter expects Scalar operation";
+    push_arg_entry_of("scalar", float2int(scalar->cast_vector<float>()[0]), true);
+    prepare_table();
+}
+
+void ScalarEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                              const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                              const MKLDNNPlugin::emitter_context *emit_context) const {
+    EMIT_FOR_ISA(in, out)
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void ScalarEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    h->uni_vmovups(Vmm(out[0]), table_val("scalar"));
+}
+
+/// MEMORY ///
+MemoryEmitter::MemoryEmitter(jit_generator* h, cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+: jit_emitter(h, isa, n) {
+    auto& rt = n->get_rt_info();
+    auto it = rt.find("effectiveAddress");
+    if (it == rt.end())
+        IE_THROW() << "Memory access operation '" << n->get_friendly_name() << "' has no effective address";
+    ea = ngraph::as_type_ptr<ngraph::VariantWrapper<int64_t>>(it->second)->get();
+
+    const auto& shape = n->get_input_shape(0);
+    advances = shape.empty() || shape.back() != 1;
+}
+
+void StoreEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                             const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                             const MKLDNNPlugin::emitter_context *emit_context) const {
+    EMIT_FOR_ISA(in, out)
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void StoreEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Reg64 out_reg(static_cast<int>(ea));
+    h->uni_vmovups(h->ptr[out_reg], Vmm(in[0]));
+    if (advances)
+        h->add(out_reg, get_vec_length());
+}
+
+void ScalarStoreEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                                   const MKLDNNPlugin::emitter_context *emit_context) const {
+    Reg64 out_reg(static_cast<int>(ea));
+    h->uni_vmovss(h->ptr[out_reg], Xmm(in[0]));
+    if (advances)
+        h->add(out_reg, sizeof(float));
+}
+
+void LoadEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                            const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                            const MKLDNNPlugin::emitter_context *emit_context) const {
+    EMIT_FOR_ISA(in, out)
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void LoadEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    Reg64 in_reg(static_cast<int>(ea));
+    if (advances) {
+        h->uni_vmovups(Vmm(out[0]), h->ptr[in_reg]);
+        h->add(in_reg, get_vec_length());
+    } else {
+        // the source has a single element, the following broadcast uses the first lane only
+        h->uni_vbroadcastss(Vmm(out[0]), h->ptr[in_reg]);
+    }
+}
+
+void BroadcastLoadEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                                     const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                                     const MKLDNNPlugin::emitter_context *emit_context) const {
+    EMIT_FOR_ISA(in, out)
+}
+
+template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+void BroadcastLoadEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xmm, isa == cpu::x64::avx2, Ymm, Zmm>::type;
+    h->uni_vbroadcastss(Vmm(out[0]), h->ptr[Reg64(static_cast<int>(ea))]);
+}
+
+void ScalarLoadEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                                  const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                                  const MKLDNNPlugin::emitter_context *emit_context) const {
+    Reg64 in_reg(static_cast<int>(ea));
+    h->uni_vmovss(Xmm(out[0]), h->ptr[in_reg]);
+    if (advances)
+        h->add(in_reg, sizeof(float));
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,186 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/rt_info.hpp>
+#include <cpu/x64/jit_generator.hpp>
+
+#include "jit_emitter.hpp"
+
+namespace MKLDNNPlugin {
+
+#define SNIPPETS_MAX_NUM_PTRS 7
+
+/*
+ * The arguments of the generated snippet. The pointers of the parameters and the results are loaded to R8, R9, ...
+ * in the order of the body parameters followed by the body results, the work amount is the number of the elements
+ * processed by the call along the innermost dimension.
+ */
+struct jit_snippets_call_args {
+    const void* src_ptrs[SNIPPETS_MAX_NUM_PTRS] = {};
+    void* dst_ptrs[SNIPPETS_MAX_NUM_PTRS] = {};
+    size_t work_amount = 0;
+};
+
+/*
+ * Emits the whole snippet: the ABI preamble, the loading of the arguments and the tiles one after another.
+ * The tiles continue the work left by the previous ones, e.g. the scalar tile processes the tail of the vector one.
+ */
+class KernelEmitter : public jit_emitter {
+public:
+    KernelEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>> code;
+};
+
+// Repeats the body while at least the increment of elements is left, the loads and the stores advance the pointers
+class TileEmitter : public jit_emitter {
+public:
+    TileEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    std::vector<std::pair<std::shared_ptr<ngraph::snippets::Emitter>, ngraph::snippets::RegInfo>> code;
+};
+
+// Parameters and results of the body, the pointers are already loaded by the kernel
+class NopEmitter : public jit_emitter {
+public:
+    NopEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {}
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override {}
+};
+
+// Broadcasts the first lane of the vector to the others
+class FakeBroadcastEmitter : public jit_emitter {
+public:
+    FakeBroadcastEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : jit_emitter(h, isa, n) {}
+
+    size_t get_inputs_num() const override { return 1; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const;
+};
+
+// Broadcasts the scalar constant from the table
+class ScalarEmitter : public jit_emitter {
+public:
+    ScalarEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 0; }
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const;
+};
+
+/*
+ * The memory access emitters take the pointer register assigned to the parameter or the result of the body
+ * (the effective address). The tensors of size 1 along the innermost dimension are broadcast and the pointer stays.
+ */
+class MemoryEmitter : public jit_emitter {
+public:
+    MemoryEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n);
+
+    size_t get_inputs_num() const override { return 1; }
+
+protected:
+    int64_t ea;
+    bool advances;
+};
+
+class StoreEmitter : public MemoryEmitter {
+public:
+    StoreEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : MemoryEmitter(h, isa, n) {}
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const;
+};
+
+class ScalarStoreEmitter : public MemoryEmitter {
+public:
+    ScalarStoreEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : MemoryEmitter(h, isa, n) {}
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+};
+
+class LoadEmitter : public MemoryEmitter {
+public:
+    LoadEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : MemoryEmitter(h, isa, n) {}
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const;
+};
+
+class BroadcastLoadEmitter : public MemoryEmitter {
+public:
+    BroadcastLoadEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : MemoryEmitter(h, isa, n) {}
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+
+    template <mkldnn::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const;
+};
+
+class ScalarLoadEmitter : public MemoryEmitter {
+public:
+    ScalarLoadEmitter(mkldnn::impl::cpu::x64::jit_generator* h, mkldnn::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ngraph::Node>& n)
+    : MemoryEmitter(h, isa, n) {}
+
+private:
+    void emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool, const std::vector<size_t>& gpr,
+                   const MKLDNNPlugin::emitter_context *emit_context) const override;
+};
+
+}  // namespace MKLDNNPlugin
@@ -187,13 +187,13 @@ std::string MKLDNNEdge::name() const {
     return  result.str();
 }
 
-void MKLDNNEdge::externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache) {
+void MKLDNNEdge::externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache, const void* mem_ptr) {
     if (status != Status::NeedAllocation)
         return;
 
     if (weightsCache) {
-        auto alloc = [this] () {
-            allocate();
+        auto alloc = [this, mem_ptr] () {
+            allocate(mem_ptr);
             return memoryPtr;
         };
 
@@ -202,7 +202,7 @@ void MKLDNNEdge::externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache) {
         useExternalMemory = true;
         status = Status::Allocated;
     } else {
-        allocate();
+        allocate(mem_ptr);
     }
 }
 
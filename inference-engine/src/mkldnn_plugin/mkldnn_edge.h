@@ -43,7 +43,7 @@ public:
 
     void init();
     void allocate(const void* mem_ptr = nullptr);
-    void externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache);
+    void externalAllocate(MKLDNNWeightsSharing::Ptr weightsCache, const void* mem_ptr = nullptr);
     void reuse(MKLDNNMemoryPtr ptr);
     void validate();
     void drop();
@@ -71,9 +71,9 @@ public:
         return getDesc().hasDefinedMaxSize();
     }
 
-private:
     std::string name() const;
 
+private:
     std::weak_ptr<MKLDNNNode> parent;
     std::weak_ptr<MKLDNNNode> child;
     int parent_port;
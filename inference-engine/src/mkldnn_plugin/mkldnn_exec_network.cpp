@@ -12,6 +12,7 @@
 #include "mkldnn_itt.h"
 #include "mkldnn_serialize.h"
 #include "nodes/mkldnn_memory_node.hpp"
+#include "nodes/mkldnn_kv_cache_node.h"
 #include <threading/ie_executor_manager.hpp>
 #define FIX_62820 0
 #if FIX_62820 && ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
@@ -36,6 +37,15 @@ MKLDNNExecNetwork::CreateInferRequestImpl(InferenceEngine::InputsDataMap network
     return std::make_shared<MKLDNNInferRequest>(networkInputs, networkOutputs, std::static_pointer_cast<MKLDNNExecNetwork>(shared_from_this()));
 }
 
+// The networks loaded with the capacity of the plugin share its cache, the other networks get their own cache
+static MultiCachePtr selectRuntimeCache(size_t capacity, const MultiCachePtr& pluginCache) {
+    if (capacity == 0)
+        return nullptr;
+    if (pluginCache && pluginCache->getCapacity() == capacity)
+        return pluginCache;
+    return std::make_shared<MultiCache>(capacity);
+}
+
 struct ImmediateSerialExecutor : public ITaskExecutor {
     void run(InferenceEngine::Task task) override {
         std::lock_guard<std::mutex> l{_mutex};
@@ -45,15 +55,21 @@ struct ImmediateSerialExecutor : public ITaskExecutor {
 };
 
 MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
+                                     const InferenceEngine::CNNNetwork &exportedNetwork,
                                      const Config &cfg,
                                      const MKLDNNExtensionManager::Ptr& extMgr,
-                                     NumaNodesWeights &numaNodesWeights) :
+                                     NumaNodesWeights &numaNodesWeights,
+                                     const MultiCachePtr &rtParamsCache,
+                                     const std::shared_ptr<const CompiledConstants> &compiledConstants) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
     _name{network.getName()},
     _numaNodesWeights(numaNodesWeights),
-        _network(network) {
+    _rtParamsCache(selectRuntimeCache(cfg.rtCacheCapacity, rtParamsCache)),
+    _compiledConstants(compiledConstants),
+        _network(network),
+        _exportedNetwork(exportedNetwork) {
     auto function = network.getFunction();
     if (function == nullptr) {
         IE_THROW() << "CPU plug-in doesn't support not ngraph-based model!";
@@ -111,6 +127,7 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         MKLDNNExecNetwork::GetGraph();
     }
+    _compiledConstants.reset();
 
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
@@ -128,6 +145,8 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
                     state_name = state_name.substr(0, suffix_idx);
 
                 memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
+            } else if (node->getType() == KVCache) {
+                memoryStates.emplace_back(dynamic_cast<MKLDNNKVCacheNode*>(node.get())->createState());
             }
         }
     }
@@ -150,6 +169,11 @@ MKLDNNExecNetwork::Graph::Lock MKLDNNExecNetwork::GetGraph() const {
                     std::lock_guard<std::mutex> lock{_cfgMutex};
                     graphLock._graph.setConfig(_cfg);
                 }
+                graphLock._graph.setRuntimeCache(_rtParamsCache);
+                graphLock._graph.setCompiledConstants(_compiledConstants);
+                const auto& sharedWeightsDir = graphLock._graph.getConfig().sharedWeightsDir;
+                graphLock._graph.setSharedWeightsStorage(sharedWeightsDir.empty() ? nullptr
+                                                         : _numaNodesWeights.getSharedStorage(numaNodeId, sharedWeightsDir));
                 graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId]);
             } catch(...) {
                 exception = std::current_exception();
@@ -287,6 +311,13 @@ std::vector<IVariableStateInternal::Ptr> MKLDNNExecNetwork::QueryState() {
 IE_SUPPRESS_DEPRECATED_END
 
 void MKLDNNExecNetwork::Export(std::ostream& modelStream) {
+    // the constants are valid for the same plugin build only, the unknown build never matches on import
+    const CompiledBlobHeader header(_cfg, _plugin ? _plugin->GetVersion().buildNumber : "");
+    modelStream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
     CNNNetworkSerializer serializer(modelStream, extensionManager);
-    serializer <<_network;
+    serializer <<_exportedNetwork;
+
+    CompiledConstantsSerializer constantsSerializer(modelStream);
+    constantsSerializer << GetGraph()._graph;
 }
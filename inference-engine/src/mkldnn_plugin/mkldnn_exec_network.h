@@ -29,8 +29,11 @@ public:
 
     InferenceEngine::IInferRequestInternal::Ptr CreateInferRequest() override;
 
-    MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
-                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing);
+    MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network, const InferenceEngine::CNNNetwork &exportedNetwork,
+                      const Config &cfg,
+                      const MKLDNNExtensionManager::Ptr &extMgr, NumaNodesWeights &weightsSharing,
+                      const MultiCachePtr &rtParamsCache,
+                      const std::shared_ptr<const CompiledConstants> &compiledConstants = nullptr);
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
@@ -50,6 +53,8 @@ protected:
     MKLDNNExtensionManager::Ptr extensionManager;
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
     const InferenceEngine::CNNNetwork           _network;
+    // the network written by Export, it differs from the executed one if the snippets are tokenized
+    const InferenceEngine::CNNNetwork           _exportedNetwork;
     mutable std::mutex                          _cfgMutex;
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
@@ -65,6 +70,9 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<Graph>                   _graphs;
     NumaNodesWeights&                           _numaNodesWeights;
+    MultiCachePtr                               _rtParamsCache;
+    // imported constants, released once all the graphs are created
+    std::shared_ptr<const CompiledConstants>    _compiledConstants;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
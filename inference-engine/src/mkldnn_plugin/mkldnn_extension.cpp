@@ -7,6 +7,9 @@
 #include "ngraph_transformations/op/leaky_relu.hpp"
 #include "ngraph_transformations/op/power_static.hpp"
 #include "ngraph_transformations/op/swish_cpu.hpp"
+#include "ngraph_transformations/op/scaled_dot_product_attention.hpp"
+#include "ngraph_transformations/op/kv_cache.hpp"
+#include "ngraph_transformations/op/color_convert.hpp"
 
 #include <ngraph/ngraph.hpp>
 #include <ngraph_ops/type_relaxed.hpp>
@@ -38,6 +41,9 @@ std::map<std::string, ngraph::OpSet> MKLDNNExtension::getOpSets() {
         NGRAPH_OP(LeakyReluNode, MKLDNNPlugin)
         NGRAPH_OP(PowerStaticNode, MKLDNNPlugin)
         NGRAPH_OP(SwishNode, MKLDNNPlugin)
+        NGRAPH_OP(ScaledDotProductAttentionNode, MKLDNNPlugin)
+        NGRAPH_OP(KVCacheNode, MKLDNNPlugin)
+        NGRAPH_OP(ColorConvertNode, MKLDNNPlugin)
 #undef NGRAPH_OP
 
         return opset;
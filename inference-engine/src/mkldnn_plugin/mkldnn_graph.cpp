@@ -13,6 +13,9 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <sstream>
+#include <iomanip>
+#include <numeric>
 
 #include "mkldnn_graph.h"
 #include "mkldnn_graph_dumper.h"
@@ -27,6 +30,8 @@
 #include <nodes/mkldnn_convert_node.h>
 
 #include <ie_algorithm.hpp>
+#include <ie_parallel.hpp>
+#include <ie_hash128.hpp>
 #include <blob_factory.hpp>
 #include "nodes/common/cpu_memcpy.h"
 #include "nodes/common/cpu_convert.h"
@@ -44,6 +49,7 @@
 
 #include <ngraph/node.hpp>
 #include <ngraph/function.hpp>
+#include <ngraph/graph_util.hpp>
 #include <ngraph/variant.hpp>
 #include <ngraph/ops.hpp>
 #include <transformations/utils/utils.hpp>
@@ -172,6 +178,64 @@ void MKLDNNGraph::Replicate(const std::shared_ptr<const ngraph::Function> &subgr
     }
 }
 
+// The upper bounds of the network inputs are propagated through the copy of the function to find out the maximal shapes
+// of the dynamic node outputs. The network shapes stay as is, the bounds only size the initial allocations.
+static std::unordered_map<std::string, std::vector<VectorDims>> InferOutputsUpperBounds(
+        const std::shared_ptr<const ngraph::Function>& func, const std::map<std::string, std::vector<size_t>>& inputsUpperBounds) {
+    auto boundedFunc = ngraph::clone_function(*func);
+    for (const auto& bound : inputsUpperBounds) {
+        const auto& parameters = boundedFunc->get_parameters();
+        const auto param = std::find_if(parameters.begin(), parameters.end(), [&](const std::shared_ptr<ngraph::op::v0::Parameter>& p) {
+            return p->get_friendly_name() == bound.first;
+        });
+        if (param == parameters.end())
+            IE_THROW() << "Upper bound is provided for unknown input " << bound.first;
+
+        const auto& inputShape = (*param)->get_partial_shape();
+        const auto& maxDims = bound.second;
+        if (inputShape.rank().is_dynamic() || inputShape.rank().get_length() != static_cast<int64_t>(maxDims.size()))
+            IE_THROW() << "Upper bound rank for input " << bound.first << " doesn't match the input shape " << inputShape;
+
+        ngraph::PartialShape boundedShape = inputShape;
+        for (size_t i = 0; i < maxDims.size(); i++) {
+            const auto& dim = inputShape[i];
+            const auto maxDim = static_cast<int64_t>(maxDims[i]);
+            if (dim.is_static()) {
+                if (dim.get_length() != maxDim)
+                    IE_THROW() << "Upper bound for static dimension " << i << " of input " << bound.first << " must be equal to " << dim;
+                continue;
+            }
+            if (maxDim < dim.get_min_length())
+                IE_THROW() << "Upper bound " << maxDim << " is less than the lower bound of dimension " << i << " of input " << bound.first;
+            const auto upper = dim.get_interval().has_upper_bound() ? std::min(maxDim, dim.get_max_length()) : maxDim;
+            boundedShape[i] = ngraph::Dimension(dim.get_min_length(), upper);
+        }
+        (*param)->set_partial_shape(boundedShape);
+    }
+    boundedFunc->validate_nodes_and_infer_types();
+
+    std::unordered_map<std::string, std::vector<VectorDims>> outputsUpperBounds;
+    for (const auto& op : boundedFunc->get_ordered_ops()) {
+        std::vector<VectorDims> maxShapes(op->get_output_size());
+        bool isBounded = false;
+        for (size_t i = 0; i < op->get_output_size(); i++) {
+            const auto& shape = op->get_output_partial_shape(i);
+            if (shape.rank().is_dynamic() || shape.is_static())
+                continue;
+            const auto hasUpperBound = std::all_of(shape.begin(), shape.end(), [](const ngraph::Dimension& dim) {
+                return dim.get_interval().has_upper_bound();
+            });
+            if (hasUpperBound) {
+                maxShapes[i] = shape.get_max_shape();
+                isBounded = true;
+            }
+        }
+        if (isBounded)
+            outputsUpperBounds[op->get_friendly_name()] = std::move(maxShapes);
+    }
+    return outputsUpperBounds;
+}
+
 void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionManager::Ptr& extMgr) {
     OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::MKLDNN_LT, "MKLDNNGraph::Replicate", "CNNNetwork");
 
@@ -275,6 +339,9 @@ void MKLDNNGraph::Replicate(const CNNNetwork &network, const MKLDNNExtensionMana
         graphNodes.push_back(outNode);
     }
 
+    if (!config.inputsUpperBounds.empty())
+        outputsUpperBounds = InferOutputsUpperBounds(func, config.inputsUpperBounds);
+
     if (config.enforceBF16)
         EnforceBF16();
 
@@ -347,6 +414,8 @@ void MKLDNNGraph::InitGraph() {
 #endif
     ExtractConstantAndExecutableNodes();
 
+    CreateScheduler();
+
     ExecuteConstantNodesOnly();
 }
 
@@ -400,6 +469,33 @@ void MKLDNNGraph::ExtractConstantAndExecutableNodes() {
     }
 }
 
+// The nodes executed concurrently must share the threads with their own parallel loops, which TBB does. With OpenMP
+// the parallel regions started from the worker threads are nested and run by a single thread, so the key is ignored.
+static bool isParallelBranchesEnabled(const Config& config) {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    return config.parallelBranches;
+#else
+    return false;
+#endif
+}
+
+void MKLDNNGraph::CreateScheduler() {
+    scheduler.reset();
+    if (!isParallelBranchesEnabled(config))
+        return;
+
+    // the state is read and written by the separate nodes which are not connected by edges
+    for (const auto& node : executableGraphNodes) {
+        if (one_of(node->getType(), MemoryInput, MemoryOutput))
+            return;
+    }
+
+    auto graphScheduler = std::make_shared<MKLDNNGraphScheduler>(graphNodes, executableGraphNodes, memoryReuseDependencies, eng);
+    if (graphScheduler->getWidth() > 1)
+        scheduler = graphScheduler;
+    memoryReuseDependencies.clear();
+}
+
 void MKLDNNGraph::ExecuteConstantNodesOnly() const {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "MKLDNNGraph::ExecuteConstantNodesOnly");
     mkldnn::stream stream(eng);
@@ -428,22 +524,119 @@ void MKLDNNGraph::ExecuteConstantNodesOnly() const {
         return std::make_tuple(hasExternalInvalidEdges, hasLocalAllocatedEdges, outputs);
     };
 
+    auto computeOutputs = [&](const MKLDNNNodePtr& node) {
+        if (IsMappedFromSharedWeights(node))
+            return;
+        if (!RestoreCompiledConstants(node))
+            ExecuteNode(node, stream);
+        PublishSharedWeights(node);
+    };
+
     for (const auto &node : constantGraphNodes) {
         if (weightsCache) {
             auto sharedOutputs = acquireSharedOutputs(node);
 
             if (std::get<0>(sharedOutputs) || std::get<1>(sharedOutputs)) {
-                ExecuteNode(node, stream);
+                computeOutputs(node);
 
                 for (auto & output : std::get<2>(sharedOutputs))
                     output->valid(true);
             }
         } else {
-            ExecuteNode(node, stream);
+            computeOutputs(node);
         }
     }
 }
 
+std::unordered_map<const MKLDNNNode*, std::array<uint64_t, 2>> MKLDNNGraph::HashConstantNodes() const {
+    // The data of the constant nodes is identified by the 128-bit digests of the constant inputs of the network
+    // and the nodes computing it. The node attributes which aren't passed as inputs are identified by the node names.
+    std::unordered_map<const MKLDNNNode*, std::array<uint64_t, 2>> hashes;
+    for (const auto& node : graphNodes) {
+        if (!node->isConstant())
+            continue;
+
+        InferenceEngine::details::Hash128 hash;
+        if (node->getType() == Input) {
+            const auto memory = std::static_pointer_cast<MKLDNNInputNode>(node)->getMemoryPtr();
+            if (!memory)
+                continue;
+            hash.update(memory->GetPtr(), memory->GetSize());
+        } else {
+            hash.add(node->getName()).add(node->getTypeStr()).add(static_cast<int>(node->getAlgorithm()));
+            for (const auto& fusedNode : node->getFusedWith())
+                hash.add(fusedNode->getTypeStr()).add(static_cast<int>(fusedNode->getAlgorithm()));
+
+            bool hasUnknownInputs = false;
+            for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+                const auto parentEdge = node->getParentEdgeAt(i);
+                const auto parentHash = hashes.find(parentEdge->getParent().get());
+                if (parentHash == hashes.end()) {
+                    hasUnknownInputs = true;
+                    break;
+                }
+                hash.add(parentHash->second[0]).add(parentHash->second[1]).add(parentEdge->getInputNum());
+            }
+            if (hasUnknownInputs)
+                continue;
+        }
+        auto& digest = hashes[node.get()];
+        hash.finish(digest[0], digest[1]);
+    }
+    return hashes;
+}
+
+bool MKLDNNGraph::IsMappedFromSharedWeights(const MKLDNNNodePtr& node) const {
+    if (sharedWeightsEdges.empty() || node->getChildEdges().empty())
+        return false;
+
+    for (size_t i = 0; i < node->getChildEdges().size(); ++i) {
+        auto edgePtr = node->getChildEdgeAt(i);
+        if (edgePtr && !sharedWeightsEdges.count(edgePtr.get()))
+            return false;
+    }
+    return true;
+}
+
+void MKLDNNGraph::PublishSharedWeights(const MKLDNNNodePtr& node) const {
+    if (!sharedWeightsStorage)
+        return;
+
+    for (size_t i = 0; i < node->getChildEdges().size(); ++i) {
+        auto edgePtr = node->getChildEdgeAt(i);
+        if (!edgePtr || sharedWeightsEdges.count(edgePtr.get()))
+            continue;
+        auto key = sharedWeightsKeys.find(edgePtr.get());
+        if (key == sharedWeightsKeys.end())
+            continue;
+        // the process keeps its own copy, the published one is used by the processes compiling the network later
+        sharedWeightsStorage->publish(key->second, edgePtr->getMemory().GetData(), config.sharedWeightsDirMaxSize);
+    }
+}
+
+bool MKLDNNGraph::RestoreCompiledConstants(const MKLDNNNodePtr& node) const {
+    if (!compiledConstants)
+        return false;
+
+    // the node may be skipped only if all its outputs are available with the same memory descriptors
+    std::vector<std::pair<MKLDNNEdgePtr, const std::vector<char>*>> outputs;
+    for (size_t i = 0; i < node->getChildEdges().size(); ++i) {
+        auto edgePtr = node->getChildEdgeAt(i);
+        if (!edgePtr)
+            continue;
+        auto constant = compiledConstants->find(edgePtr->name());
+        if (constant == compiledConstants->end() ||
+            constant->second.desc != CompiledBlobHeader::describe(edgePtr->getMemory().getDesc()) ||
+            constant->second.data.size() != edgePtr->getMemory().GetSize())
+            return false;
+        outputs.emplace_back(edgePtr, &constant->second.data);
+    }
+
+    for (const auto& output : outputs)
+        cpu_memcpy(output.first->getMemory().GetData(), output.second->data(), output.second->size());
+    return true;
+}
+
 static bool isReorderAvailable(const MemoryDesc& parentDesc, const MemoryDesc& childDesc, const mkldnn::engine& eng) {
     memory::desc dstMemDesc = MemoryDescUtils::convertToDnnlMemoryDesc(childDesc.clone())->getDnnlDesc();
     memory::desc srcMemDesc = MemoryDescUtils::convertToDnnlMemoryDesc(parentDesc.clone())->getDnnlDesc();
@@ -521,14 +714,40 @@ static inline bool isConstOutput(MKLDNNEdgePtr edge) {
     return edge->getParent()->isConstant() && !edge->getChild()->isConstant();
 }
 
-static edge_clusters_t findEdgeClusters(const std::vector<MKLDNNEdgePtr> & graphEdges) {
+typedef std::unordered_map<MKLDNNEdgePtr, int64_t> edge_sizes_t;
+
+// The memory solver plans the edges with defined maximal size and the dynamic edges bounded by the input upper bounds.
+// The bounded edge is planned for its maximal tensor, a bigger tensor is moved to the own storage of the edge memory.
+static edge_sizes_t findEdgesMaxMemSizes(const std::vector<MKLDNNEdgePtr>& graphEdges,
+                                         const std::unordered_map<std::string, std::vector<VectorDims>>& outputsUpperBounds) {
+    edge_sizes_t edgesSizes;
+    for (const auto& edge : graphEdges) {
+        const auto& desc = edge->getDesc();
+        if (desc.hasDefinedMaxSize()) {
+            edgesSizes[edge] = desc.getMaxMemSize();
+            continue;
+        }
+
+        const auto bounds = outputsUpperBounds.find(edge->getParent()->getName());
+        const auto port = edge->getInputNum();
+        if (bounds == outputsUpperBounds.end() || port < 0 || static_cast<size_t>(port) >= bounds->second.size())
+            continue;
+        const auto& maxDims = bounds->second[port];
+        if (maxDims.empty() || !desc.getShape().isCompatible(maxDims))
+            continue;
+        edgesSizes[edge] = desc.cloneWithNewDims(maxDims)->getMaxMemSize();
+    }
+    return edgesSizes;
+}
+
+static edge_clusters_t findEdgeClusters(const std::vector<MKLDNNEdgePtr> & graphEdges, const edge_sizes_t& edgesSizes) {
     typedef std::unordered_map<MKLDNNEdgePtr, size_t> edge_cluster_idx_map_t;
 
     edge_clusters_t edge_clusters;
     edge_cluster_idx_map_t edge_cluster_indices;
 
     for (auto &edge : graphEdges) {
-        if (!edge->hasDefinedMaxSize())
+        if (edgesSizes.find(edge) == edgesSizes.end())
             continue;
 
         auto edge_it = edge_cluster_indices.find(edge);
@@ -570,11 +789,75 @@ static edge_clusters_t findEdgeClusters(const std::vector<MKLDNNEdgePtr> & graph
     return edge_clusters;
 }
 
+// The memory of an edge cluster may be reused only after all the nodes accessing the previous cluster placed
+// at the same addresses are completed, so its writers must wait for them in case of concurrent execution.
+static std::vector<MKLDNNGraphScheduler::Dependency> findMemoryReuseDependencies(const edge_clusters_t& clusters,
+                                                                                 const std::vector<MemorySolver::Box>& boxes,
+                                                                                 const MemorySolver& solver) {
+    std::vector<MKLDNNGraphScheduler::Dependency> dependencies;
+    for (size_t i = 0; i < boxes.size(); i++) {
+        const auto& first = boxes[i];
+        if (first.finish == -1)
+            continue;
+        const auto firstOffset = solver.getOffset(first.id);
+        for (size_t j = 0; j < boxes.size(); j++) {
+            const auto& second = boxes[j];
+            if (i == j || first.finish >= second.start)
+                continue;
+            const auto secondOffset = solver.getOffset(second.id);
+            if (firstOffset + first.size <= secondOffset || secondOffset + second.size <= firstOffset)
+                continue;
+
+            for (const auto& secondEdge : clusters[j]) {
+                const auto writer = secondEdge->getParent();
+                for (const auto& firstEdge : clusters[i]) {
+                    dependencies.emplace_back(firstEdge->getParent(), writer);
+                    dependencies.emplace_back(firstEdge->getChild(), writer);
+                }
+            }
+        }
+    }
+    return dependencies;
+}
+
 void MKLDNNGraph::AllocateWithReuse() {
-    edge_clusters_t edge_clusters = findEdgeClusters(graphEdges);
+    const edge_sizes_t edgesSizes = findEdgesMaxMemSizes(graphEdges, outputsUpperBounds);
+    edge_clusters_t edge_clusters = findEdgeClusters(graphEdges, edgesSizes);
 
     size_t edge_clusters_count = edge_clusters.size();
 
+    std::unordered_map<const MKLDNNNode*, std::array<uint64_t, 2>> constantNodesHashes;
+    if (sharedWeightsStorage)
+        constantNodesHashes = HashConstantNodes();
+
+    // The output of a constant node is mapped from the shared storage if it has been stored by any process.
+    // Only the memory not shared with the other nodes is mapped, so the nodes may be just skipped.
+    auto findSharedWeights = [&](const MKLDNNEdgePtr& edge, const edge_cluster_t& cluster) -> std::shared_ptr<const void> {
+        const auto parent = edge->getParent();
+        const auto nodeHash = constantNodesHashes.find(parent.get());
+        if (nodeHash == constantNodesHashes.end())
+            return nullptr;
+        for (const auto& clusterEdge : cluster) {
+            if (clusterEdge->getParent() != parent)
+                return nullptr;
+        }
+
+        const auto& desc = edge->getDesc();
+        MKLDNNSharedWeightsStorage::DataInfo info;
+        info.precision = desc.getPrecision();
+        info.layout = desc.serializeFormat() + vec2str(desc.getShape().getStaticDims());
+        info.size = desc.getCurrentMemSize();
+        // the digest covers the whole memory descriptor (e.g. the padding and the compensation of the weights)
+        const auto dnnlDesc = MemoryDescUtils::convertToDnnlMemoryDesc(desc.clone())->getDnnlDesc().data;
+        InferenceEngine::details::Hash128 hash;
+        hash.add(nodeHash->second[0]).add(nodeHash->second[1]).add(edge->getInputNum());
+        hash.update(&dnnlDesc, sizeof(dnnlDesc));
+        hash.finish(info.digest[0], info.digest[1]);
+        sharedWeightsKeys[edge.get()] = info;
+
+        return sharedWeightsStorage->find(info);
+    };
+
     for (size_t i = 0; i < edge_clusters_count;) {
         auto &cluster = edge_clusters[i];
         bool erase = false;
@@ -584,6 +867,15 @@ void MKLDNNGraph::AllocateWithReuse() {
                 if (edge->getParent()->getType() == Input) {
                     auto constNode = std::static_pointer_cast<MKLDNNInputNode>(edge->getParent());
                     edge->reuse(std::const_pointer_cast<MKLDNNMemory>(constNode->getMemoryPtr()));
+                } else if (sharedWeightsStorage) {
+                    const auto sharedData = findSharedWeights(edge, cluster);
+                    edge->externalAllocate(weightsCache, sharedData.get());
+                    // the memory allocated by another graph is used if the weights cache is enabled
+                    if (sharedData && edge->getMemory().GetData() == sharedData.get()) {
+                        for (const auto& clusterEdge : cluster)
+                            sharedWeightsEdges.insert(clusterEdge.get());
+                        sharedWeightsMappings.push_back(sharedData);
+                    }
                 } else {
                     edge->externalAllocate(weightsCache);
                 }
@@ -611,11 +903,12 @@ void MKLDNNGraph::AllocateWithReuse() {
             int e_start = edge->getParent()->execIndex;
             int e_finish = edge->getChild()->execIndex;
 
-            if (!edge->hasDefinedMaxSize()) {
+            const auto edgeSize = edgesSizes.find(edge);
+            if (edgeSize == edgesSizes.end()) {
                 IE_THROW() << "Can not allocate memory since the size is undefined.";
             }
 
-            int64_t e_size = edge->getDesc().getMaxMemSize();  // size in bytes (from the beginning of data to the last element)
+            int64_t e_size = edgeSize->second;  // size in bytes (from the beginning of data to the last element)
             box.start = std::min(e_start, box.start);
             box.finish = std::max(e_finish, box.finish);
             box.size =  std::max(e_size, box.size);
@@ -647,6 +940,9 @@ void MKLDNNGraph::AllocateWithReuse() {
     MemorySolver memSolver(boxes);
     size_t total_size = static_cast<size_t>(memSolver.solve()) * alignment;
 
+    if (isParallelBranchesEnabled(config))
+        memoryReuseDependencies = findMemoryReuseDependencies(edge_clusters, boxes, memSolver);
+
     memWorkspace = std::make_shared<MKLDNNMemory>(eng);
     memWorkspace->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{total_size})));
 
@@ -663,6 +959,8 @@ void MKLDNNGraph::AllocateWithReuse() {
                 // !! Fallback to individual memory allocation !!
                 // if you like to check infer without reuse just call this function without arguments.
                 edge->allocate(workspace_ptr + offset * alignment);  // alignment in byte
+                if (!edge->hasDefinedMaxSize())
+                    edge->getMemoryPtr()->bindStorage(workspace_ptr + offset * alignment, edgesSizes.at(edge));
 
                 // TODO: WA for some test (like strided_slice_test) which use tensors with
                 //       shapes {0}. And it is implisitly converted into {1} tensor.
@@ -702,6 +1000,7 @@ void MKLDNNGraph::CreatePrimitives() {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "MKLDNNGraph::CreatePrimitives");
     for (auto& node : graphNodes) {
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, node->profiling.createPrimitive);
+        node->setRuntimeCache(rtParamsCache);
         node->createPrimitive();
     }
 }
@@ -826,16 +1125,29 @@ void MKLDNNGraph::Infer(MKLDNNInferRequest* request, int batch) {
         IE_THROW() << "Wrong state. Topology is not ready.";
     }
 
-    mkldnn::stream stream(eng);
+    if (scheduler) {
+        PERF(scheduler, config.collectPerfCounters);
+        scheduler->execute([&](const MKLDNNNodePtr& node, const mkldnn::stream& stream) {
+            VERBOSE(node, config.debugCaps.verbose);
+            PERF(node, config.collectPerfCounters);
 
-    for (const auto& node : executableGraphNodes) {
-        VERBOSE(node, config.debugCaps.verbose);
-        PERF(node, config.collectPerfCounters);
+            if (request)
+                request->ThrowIfCanceled();
+
+            ExecuteNode(node, stream);
+        });
+    } else {
+        mkldnn::stream stream(eng);
+
+        for (const auto& node : executableGraphNodes) {
+            VERBOSE(node, config.debugCaps.verbose);
+            PERF(node, config.collectPerfCounters);
 
-        if (request)
-            request->ThrowIfCanceled();
+            if (request)
+                request->ThrowIfCanceled();
 
-        ExecuteNode(node, stream);
+            ExecuteNode(node, stream);
+        }
     }
 
     if (infer_count != -1) infer_count++;
@@ -955,6 +1267,29 @@ void MKLDNNGraph::GetPerfData(std::map<std::string, InferenceEngine::InferenceEn
     for (int i = 1; i < graphNodes.size(); i++) {
         getPerfMapFor(perfMap, graphNodes[i]);
     }
+
+    if (scheduler) {
+        // cpu_uSec is the total time of the nodes, realTime_uSec is the time of the whole inference,
+        // so their ratio is the achieved parallelism
+        uint64_t nodesTime = 0;
+        for (const auto& node : executableGraphNodes)
+            nodesTime += node->PerfCounter().avg();
+        const auto inferTime = scheduler->PerfCounter().avg();
+
+        InferenceEngine::InferenceEngineProfileInfo &pc = perfMap["ParallelBranches"];
+        pc.execution_index = i++;
+        pc.cpu_uSec = static_cast<long long>(nodesTime);
+        pc.realTime_uSec = static_cast<long long>(inferTime);
+        pc.status = inferTime > 0 ? InferenceEngine::InferenceEngineProfileInfo::EXECUTED
+                                  : InferenceEngine::InferenceEngineProfileInfo::NOT_RUN;
+        std::ostringstream execType;
+        execType << "parallelism_" << std::fixed << std::setprecision(2)
+                 << (inferTime > 0 ? static_cast<double>(nodesTime) / inferTime : 0.0)
+                 << "_width_" << scheduler->getWidth()
+                 << "_concurrency_" << scheduler->getMaxConcurrency();
+        execType.str().copy(pc.exec_type, sizeof(pc.exec_type) / sizeof(pc.exec_type[0]) - 1, 0);
+        std::string("Scheduler").copy(pc.layer_type, sizeof(pc.layer_type) / sizeof(pc.layer_type[0]) - 1, 0);
+    }
 }
 
 void MKLDNNGraph::setConfig(const Config &cfg) {
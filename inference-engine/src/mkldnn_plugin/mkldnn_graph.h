@@ -10,11 +10,15 @@
 #include "normalize_preprocess.h"
 #include "mkldnn_node.h"
 #include "mkldnn_edge.h"
+#include "mkldnn_graph_scheduler.h"
+#include "mkldnn_serialize.h"
 #include <map>
 #include <string>
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace MKLDNNPlugin {
 class MKLDNNInferRequest;
@@ -44,6 +48,26 @@ public:
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty() const;
 
+    void setRuntimeCache(const MultiCachePtr& cache) {
+        rtParamsCache = cache;
+    }
+
+    /**
+     * @brief Sets outputs of the constant subgraphs computed by the exported graph,
+     * they are used instead of executing the constant nodes on the graph creation
+     */
+    void setCompiledConstants(const std::shared_ptr<const CompiledConstants>& constants) {
+        compiledConstants = constants;
+    }
+
+    /**
+     * @brief Sets the storage to share outputs of the constant subgraphs with other processes,
+     * nullptr disables the sharing
+     */
+    void setSharedWeightsStorage(const MKLDNNSharedWeightsStorage::Ptr& storage) {
+        sharedWeightsStorage = storage;
+    }
+
     InferenceEngine::Blob::Ptr getInputBlob(const std::string& name);
     InferenceEngine::Blob::Ptr getOutputBlob(const std::string& name);
 
@@ -202,10 +226,28 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         _normalizePreprocMap.clear();
+        sharedWeightsKeys.clear();
+        sharedWeightsEdges.clear();
+        sharedWeightsMappings.clear();
     }
     Status status { NotReady };
     Config config;
 
+    // shared between all the graphs created by the plugin, nullptr means the cache is disabled
+    MultiCachePtr rtParamsCache;
+
+    // constants of the imported graph, nullptr if the graph is compiled from scratch
+    std::shared_ptr<const CompiledConstants> compiledConstants;
+
+    // outputs of the constant nodes shared between processes, nullptr if the sharing is disabled
+    MKLDNNSharedWeightsStorage::Ptr sharedWeightsStorage;
+    // identities of the constant node outputs which may be stored to the shared storage, by the allocating edges
+    std::unordered_map<const MKLDNNEdge*, MKLDNNSharedWeightsStorage::DataInfo> sharedWeightsKeys;
+    // edges which memory is mapped from the shared storage, so their parent nodes aren't executed
+    std::unordered_set<const MKLDNNEdge*> sharedWeightsEdges;
+    // the mapped data of the shared storage used by the edges, the files stay mapped while any graph uses them
+    std::vector<std::shared_ptr<const void>> sharedWeightsMappings;
+
     // For dumping purposes. -1 - no counting, all other positive
     // values mean increment it within each Infer() call
     int infer_count = -1;
@@ -222,6 +264,8 @@ protected:
 
     bool isQuantizedFlag = false;
     bool graphHasDynamicInput = false;
+    // node name -> maximal shapes of the dynamic outputs derived from the input upper bounds, empty if unknown
+    std::unordered_map<std::string, std::vector<VectorDims>> outputsUpperBounds;
 
     static mkldnn::engine eng;
 
@@ -236,8 +280,13 @@ protected:
     void AllocateWithReuse();
     void CreatePrimitives();
     void ExtractConstantAndExecutableNodes();
+    void CreateScheduler();
     void ExecuteNode(const MKLDNNNodePtr& node, const mkldnn::stream& stream) const;
     void ExecuteConstantNodesOnly() const;
+    bool RestoreCompiledConstants(const MKLDNNNodePtr& node) const;
+    std::unordered_map<const MKLDNNNode*, std::array<uint64_t, 2>> HashConstantNodes() const;
+    bool IsMappedFromSharedWeights(const MKLDNNNodePtr& node) const;
+    void PublishSharedWeights(const MKLDNNNodePtr& node) const;
 
     friend class MKLDNNInferRequest;
     friend class MKLDNNGraphlessInferRequest;
@@ -254,6 +303,11 @@ private:
     std::vector<MKLDNNNodePtr> constantGraphNodes;
     std::vector<MKLDNNNodePtr> executableGraphNodes;
 
+    // nodes which must not be executed concurrently as their tensors share memory, filled if parallelBranches is enabled
+    std::vector<MKLDNNGraphScheduler::Dependency> memoryReuseDependencies;
+    // executes independent branches concurrently, nullptr means sequential execution
+    MKLDNNGraphScheduler::Ptr scheduler;
+
     void EnforceBF16();
 };
 
@@ -9,6 +9,7 @@
 #include "exec_graph_info.hpp"
 #include "ie_common.h"
 #include "mkldnn_debug.h"
+#include "nodes/mkldnn_snippet_node.h"
 #include <ngraph/variant.hpp>
 #include "ngraph/ngraph.hpp"
 #include <ngraph/pass/manager.hpp>
@@ -108,6 +109,12 @@ std::map<std::string, std::string> extract_node_metadata(const MKLDNNNodePtr &no
 
     serialization_info[ExecGraphInfoSerialization::RUNTIME_PRECISION] = node->getRuntimePrecision().name();
 
+    if (node->getType() == Subgraph) {
+        auto snippet = std::dynamic_pointer_cast<MKLDNNSnippetNode>(node);
+        if (snippet)
+            serialization_info[ExecGraphInfoSerialization::FUSED_OPS_COUNT] = std::to_string(snippet->getFusedOpsCount());
+    }
+
     return serialization_info;
 }
 
@@ -11,6 +11,7 @@
 #include "nodes/mkldnn_concat_node.h"
 #include "nodes/mkldnn_reorder_node.h"
 #include "nodes/mkldnn_conv_node.h"
+#include "nodes/mkldnn_fullyconnected_node.h"
 #include "nodes/mkldnn_bin_conv_node.h"
 #include "nodes/mkldnn_fake_quantize_node.h"
 #include "nodes/mkldnn_mvn_node.h"
@@ -18,6 +19,8 @@
 #include "nodes/mkldnn_interpolate_node.h"
 #include "nodes/mkldnn_input_node.h"
 #include "nodes/mkldnn_rnn.h"
+#include "nodes/mkldnn_matmul_node.h"
+#include "nodes/mkldnn_sdpa_node.h"
 #include "nodes/common/cpu_convert.h"
 
 #include "mkldnn/ie_mkldnn.h"
@@ -53,7 +56,11 @@ using namespace InferenceEngine;
 MKLDNNGraphOptimizer::MKLDNNGraphOptimizer() {}
 
 void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
-    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::MKLDNN_LT, "ApplyCommonGraphOptimizations", "FuseConvolutionAndBias");
+    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::MKLDNN_LT, "ApplyCommonGraphOptimizations", "FuseFullyConnectedAndWeightsDecompression");
+    FuseFullyConnectedAndWeightsDecompression(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvolutionAndBias");
     FuseConvolutionAndBias(graph);
     graph.RemoveDroppedNodes();
 
@@ -129,6 +136,14 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseNormalizeL2AndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseMatMulAndTranspose");
+    FuseMatMulAndTranspose(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseTransposeAndSimpleOperation");
+    FuseTransposeAndSimpleOperation(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseEltwiseAndSimple");
     FuseEltwiseAndSimple(graph);
     graph.RemoveDroppedNodes();
@@ -153,6 +168,96 @@ void MKLDNNGraphOptimizer::ApplyImplSpecificGraphOptimizations(MKLDNNGraph &grap
     graph.RemoveDroppedEdges();
 }
 
+void MKLDNNGraphOptimizer::FuseFullyConnectedAndWeightsDecompression(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isConstantInput = [](const MKLDNNNodePtr& node) {
+        return node->getType() == Input && node->isConstant() && node->getChildEdges().size() == 1;
+    };
+
+    auto isSuitableConvert = [&](const MKLDNNNodePtr& node) {
+        return node->getType() == Convert && node->getChildEdges().size() == 1 &&
+               node->getOriginalOutputPrecisionAtPort(0) == Precision::FP32 &&
+               isConstantInput(node->getParentEdgeAt(0)->getParent());
+    };
+
+    auto isSuitableMultiply = [&](const MKLDNNNodePtr& node) {
+        if (node->getAlgorithm() != EltwiseMultiply || !node->getFusedWith().empty() ||
+            node->getParentEdges().size() != 2 || node->getChildEdges().size() != 1)
+            return false;
+        auto scalesNode = node->getParentEdgesAtPort(1)[0]->getParent();
+        const auto& weightsDims = node->getOutputShapeAtPort(0).getStaticDims();
+        const auto& scalesDims = scalesNode->getOutputShapeAtPort(0).getStaticDims();
+        return isConstantInput(scalesNode) && scalesNode->getOriginalOutputPrecisionAtPort(0) == Precision::FP32 &&
+               scalesDims.size() == 2 && scalesDims[0] == weightsDims[0] && scalesDims[1] == 1 &&
+               isSuitableConvert(node->getParentEdgesAtPort(0)[0]->getParent());
+    };
+
+    auto dropParentEdges = [&](const MKLDNNNodePtr& node) {
+        auto parentEdges = node->parentEdges;
+        for (auto& parentEdge : parentEdges) {
+            auto p_edge = parentEdge.lock();
+            if (!p_edge)
+                continue;
+            p_edge->drop();
+            graph.RemoveEdge(p_edge);
+        }
+    };
+
+    const int weightsPort = 1;
+    for (const auto& node : graphNodes) {
+        auto fcNode = std::dynamic_pointer_cast<MKLDNNFullyConnectedNode>(node);
+        // the decompression is fused into the own kernel which supports neither post ops nor low precision data
+        if (!fcNode || !fcNode->getFusedWith().empty() || fcNode->getInputShapeAtPort(weightsPort).getRank() != 2 ||
+            !fcNode->canApplyWeightsDecompression() ||
+            fcNode->getOriginalInputPrecisionAtPort(0) != Precision::FP32 ||
+            fcNode->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            continue;
+
+        auto decompressionNode = fcNode->getParentEdgesAtPort(weightsPort)[0]->getParent();
+        MKLDNNNodePtr multiplyNode;
+        if (decompressionNode->getType() == Eltwise) {
+            if (!isSuitableMultiply(decompressionNode))
+                continue;
+            multiplyNode = decompressionNode;
+            decompressionNode = multiplyNode->getParentEdgesAtPort(0)[0]->getParent();
+        } else if (!isSuitableConvert(decompressionNode)) {
+            continue;
+        }
+
+        auto weightsNode = decompressionNode->getParentEdgeAt(0)->getParent();
+        const auto weightsPrecision = weightsNode->getOriginalOutputPrecisionAtPort(0);
+        if (!(weightsPrecision == Precision::FP16 && !multiplyNode) && !(weightsPrecision == Precision::I8 && multiplyNode))
+            continue;
+
+        std::vector<float> scales;
+        if (multiplyNode) {
+            auto scalesNode = multiplyNode->getParentEdgesAtPort(1)[0]->getParent();
+            auto scalesConstant = dynamic_cast<MKLDNNInputNode*>(scalesNode.get());
+            if (scalesConstant == nullptr)
+                IE_THROW() << "Cannot cast to Input node";
+            auto scalesData = static_cast<const float*>(scalesConstant->getMemoryPtr()->GetPtr());
+            scales.assign(scalesData, scalesData + scalesNode->getOutputShapeAtPort(0).getStaticDims()[0]);
+
+            dropParentEdges(multiplyNode);
+            fcNode->addOriginalLayer(multiplyNode->getOriginalLayers());
+        }
+        dropParentEdges(decompressionNode);
+        fcNode->addOriginalLayer(decompressionNode->getOriginalLayers());
+
+        auto weightsEdge = fcNode->getParentEdgesAtPort(weightsPort)[0];
+        weightsEdge->drop();
+        graph.RemoveEdge(weightsEdge);
+
+        // the compressed weights are passed to the node as is, the dropped decompression nodes are removed afterwards
+        MKLDNNEdgePtr newEdge(new MKLDNNEdge(weightsNode, fcNode, 0, weightsPort));
+        graph.GetEdges().push_back(newEdge);
+        weightsNode->addEdge(newEdge);
+
+        fcNode->setWeightsDecompression(weightsPrecision, scales);
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseConvolutionAndBias(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -1278,6 +1383,118 @@ void MKLDNNGraphOptimizer::FuseNormalizeL2AndSimpleOperation(MKLDNNGraph &graph)
     }
 }
 
+void MKLDNNGraphOptimizer::FuseMatMulAndTranspose(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    // the GEMM based nodes and the number of their inputs which are the GEMM operands
+    auto getGemmInputsNum = [](const MKLDNNNodePtr& node) -> size_t {
+        if (node->getType() == MatMul)
+            return 2;
+        if (node->getType() == ScaledDotProductAttention)
+            return 3;
+        return 0;
+    };
+
+    // the batch axis stays in place for the dynamic batch
+    auto isSuitableTranspose = [](const MKLDNNNodePtr& node) {
+        if (node->getType() != Transpose || !node->getFusedWith().empty() || node->getChildEdges().size() != 1)
+            return false;
+        const auto& order = std::dynamic_pointer_cast<MKLDNNTransposeNode>(node)->getOrder();
+        return order.size() >= 2 && order[0] == 0;
+    };
+
+    // the constants of the orders, they are removed after the pass unless other nodes use them
+    std::vector<MKLDNNNodePtr> orderNodes;
+    auto dropTranspose = [&graph, &orderNodes](const MKLDNNNodePtr& transpose) {
+        auto orderEdge = transpose->getParentEdgesAtPort(1)[0];
+        orderNodes.push_back(orderEdge->getParent());
+        orderEdge->drop();
+        graph.RemoveEdge(orderEdge);
+        graph.DropNode(transpose);
+    };
+
+    for (auto &node : graphNodes) {
+        const size_t gemmInputsNum = getGemmInputsNum(node);
+        if (gemmInputsNum == 0)
+            continue;
+
+        for (size_t port = 0; port < gemmInputsNum; port++) {
+            auto transpose = node->getParentEdgesAtPort(port)[0]->getParent();
+            if (!isSuitableTranspose(transpose))
+                continue;
+
+            const auto& order = std::dynamic_pointer_cast<MKLDNNTransposeNode>(transpose)->getOrder();
+            VectorDims viewDims, viewStrides;
+            getTransposedView(transpose->getInputShapeAtPort(0).getStaticDims(), order, viewDims, viewStrides);
+            if (!isGemmCompatibleView(viewDims, viewStrides))
+                continue;
+
+            if (auto matMul = std::dynamic_pointer_cast<MKLDNNMatMulNode>(node)) {
+                matMul->setInputOrder(port, order);
+            } else {
+                std::dynamic_pointer_cast<MKLDNNScaledDotProductAttentionNode>(node)->setInputOrder(port, order);
+            }
+            node->inputShapes[port] = transpose->getInputShapeAtPort(0);
+            node->addOriginalLayer(transpose->getOriginalLayers());
+            dropTranspose(transpose);
+        }
+
+        if (node->getChildEdges().size() != 1)
+            continue;
+        auto transpose = node->getChildEdgeAt(0)->getChild();
+        if (!isSuitableTranspose(transpose))
+            continue;
+        // the output rows are written densely
+        const auto& order = std::dynamic_pointer_cast<MKLDNNTransposeNode>(transpose)->getOrder();
+        if (order.back() != order.size() - 1)
+            continue;
+
+        if (auto matMul = std::dynamic_pointer_cast<MKLDNNMatMulNode>(node)) {
+            matMul->setOutputOrder(order);
+        } else {
+            std::dynamic_pointer_cast<MKLDNNScaledDotProductAttentionNode>(node)->setOutputOrder(order);
+        }
+        node->outputShapes[0] = transpose->getOutputShapeAtPort(0);
+        node->addOriginalLayer(transpose->getOriginalLayers());
+        dropTranspose(transpose);
+    }
+
+    for (const auto& orderNode : orderNodes) {
+        if (!orderNode->getChildEdges().empty())
+            continue;
+        auto it = std::find(graphNodes.begin(), graphNodes.end(), orderNode);
+        if (it != graphNodes.end())
+            graphNodes.erase(it);
+    }
+}
+
+void MKLDNNGraphOptimizer::FuseTransposeAndSimpleOperation(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableParentNode = [](MKLDNNNodePtr node) {
+        return node->getType() == Transpose && node->getChildEdges().size() == 1;
+    };
+
+    auto parent = graphNodes.begin();
+    while (parent != graphNodes.end()) {
+        auto parentNode = *parent;
+        if (!isSuitableParentNode(parentNode)) {
+            parent++;
+            continue;
+        }
+
+        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
+        if (!parentNode->canFuse(childNode)) {
+            parent++;
+            continue;
+        }
+
+        // the fused nodes have the only input, so dropping the node connects its children to the transpose
+        childNode->fuseInto(parentNode);
+        graph.DropNode(childNode);
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseEltwiseAndSimple(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -1666,7 +1883,7 @@ void MKLDNNGraphOptimizer::MergeTransposeAndReorder(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
     auto isSuitableParentNode = [](MKLDNNNodePtr node) {
-        return node->getType() == Transpose && node->getChildEdges().size() == 1;
+        return node->getType() == Transpose && node->getChildEdges().size() == 1 && node->getFusedWith().empty();
     };
 
     auto isSuitableChildNode = [](MKLDNNNodePtr node) {
@@ -19,6 +19,7 @@ public:
     void ApplyImplSpecificGraphOptimizations(MKLDNNGraph& graph);
 
 private:
+    void FuseFullyConnectedAndWeightsDecompression(MKLDNNGraph &graph);
     void FuseConvolutionAndBias(MKLDNNGraph &graph);
     void FuseDeconvolutionAndSimpleOperation(MKLDNNGraph &graph);
     void FuseMultiplyAndAdd(MKLDNNGraph &graph);
@@ -31,6 +32,8 @@ private:
     void FuseMVNAndSimpleOperation(MKLDNNGraph &graph);
     void FuseInterpolateAndSimpleOperation(MKLDNNGraph &graph);
     void FuseNormalizeL2AndSimpleOperation(MKLDNNGraph &graph);
+    void FuseMatMulAndTranspose(MKLDNNGraph &graph);
+    void FuseTransposeAndSimpleOperation(MKLDNNGraph &graph);
 
     void DropDoubleReorders(MKLDNNGraph& graph);
     void FuseConvolutionAndZeroPoints(MKLDNNGraph &graph);
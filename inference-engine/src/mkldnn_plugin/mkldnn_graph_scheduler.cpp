@@ -0,0 +1,116 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_graph_scheduler.h"
+
+#include <algorithm>
+#include <set>
+#include <unordered_map>
+
+#include <ie_parallel.hpp>
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+#include <tbb/task_group.h>
+#endif
+
+using namespace MKLDNNPlugin;
+
+MKLDNNGraphScheduler::MKLDNNGraphScheduler(const std::vector<MKLDNNNodePtr>& graphNodes,
+                                           const std::vector<MKLDNNNodePtr>& executableNodes,
+                                           const std::vector<Dependency>& extraDependencies,
+                                           const mkldnn::engine& eng)
+        : nodes(executableNodes), streams([eng] { return mkldnn::stream(eng); }) {
+    std::unordered_map<const MKLDNNNode*, size_t> indices;
+    for (size_t i = 0; i < nodes.size(); i++)
+        indices[nodes[i].get()] = i;
+
+    // The executable nodes which have to be completed before the node output is available.
+    // For a non-executable node (e.g. Input or in-place Concat) these are the nearest executable ancestors.
+    std::unordered_map<const MKLDNNNode*, std::set<size_t>> producers;
+    std::vector<std::set<size_t>> predecessors(nodes.size());
+    for (const auto& node : graphNodes) {
+        std::set<size_t> inputProducers;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            const auto parent = node->getParentEdgeAt(i)->getParent();
+            const auto& parentProducers = producers[parent.get()];
+            inputProducers.insert(parentProducers.begin(), parentProducers.end());
+        }
+
+        const auto index = indices.find(node.get());
+        if (index != indices.end()) {
+            predecessors[index->second] = std::move(inputProducers);
+            producers[node.get()] = {index->second};
+        } else {
+            producers[node.get()] = std::move(inputProducers);
+        }
+    }
+
+    for (const auto& dependency : extraDependencies) {
+        const auto first = indices.find(dependency.first.get());
+        const auto second = indices.find(dependency.second.get());
+        // the nodes which are not executed can't break anything
+        if (first == indices.end() || second == indices.end() || first->second == second->second)
+            continue;
+        if (first->second > second->second)
+            IE_THROW() << "Dependency of node " << dependency.second->getName() << " on node " << dependency.first->getName()
+                       << " contradicts the execution order";
+        predecessors[second->second].insert(first->second);
+    }
+
+    successors.resize(nodes.size());
+    predecessorsCount.resize(nodes.size());
+    std::vector<size_t> depth(nodes.size(), 0);
+    std::vector<size_t> depthWidth(nodes.size(), 0);
+    // the executable nodes keep the topological order, so the predecessors always have smaller indices
+    for (size_t i = 0; i < nodes.size(); i++) {
+        predecessorsCount[i] = predecessors[i].size();
+        if (predecessors[i].empty())
+            roots.push_back(i);
+        for (auto predecessor : predecessors[i]) {
+            successors[predecessor].push_back(i);
+            depth[i] = std::max(depth[i], depth[predecessor] + 1);
+        }
+        width = std::max(width, ++depthWidth[depth[i]]);
+    }
+
+    pending.reset(new std::atomic<size_t>[nodes.size()]);
+}
+
+void MKLDNNGraphScheduler::execute(const ExecuteFunc& func) {
+    for (size_t i = 0; i < nodes.size(); i++)
+        pending[i] = predecessorsCount[i];
+    // the count is left non-zero if a node threw
+    runningCount = 0;
+
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    tbb::task_group group;
+    std::function<void(size_t)> run = [&](size_t index) {
+        // the first successor which became ready is executed by the same thread to keep its inputs in cache
+        while (true) {
+            const auto running = ++runningCount;
+            auto peak = maxConcurrency.load();
+            while (running > peak && !maxConcurrency.compare_exchange_weak(peak, running)) {}
+            func(nodes[index], streams.local());
+            --runningCount;
+
+            size_t next = nodes.size();
+            for (auto successor : successors[index]) {
+                if (--pending[successor] != 0)
+                    continue;
+                if (next == nodes.size())
+                    next = successor;
+                else
+                    group.run([&run, successor] { run(successor); });
+            }
+            if (next == nodes.size())
+                break;
+            index = next;
+        }
+    };
+    for (auto root : roots)
+        group.run([&run, root] { run(root); });
+    group.wait();
+#else
+    IE_THROW(NotImplemented) << "Concurrent execution of the graph branches is supported with TBB threading only";
+#endif
+}
@@ -0,0 +1,81 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "mkldnn_node.h"
+#include "perf_count.h"
+#include <threading/ie_thread_local.hpp>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * @brief Executes independent branches of the graph concurrently.
+ * The dependency graph of the executable nodes is built once on construction. A node is started as soon as all
+ * the nodes it depends on are completed, so the threads are shared between the branches and the parallel loops of
+ * the nodes by the TBB work stealing.
+ * It is available with TBB threading only: with OpenMP the parallel regions of the nodes started from the worker
+ * threads are nested, so each node would be executed by a single thread.
+ * @attention The object is not thread safe, execute() mustn't be called concurrently.
+ */
+class MKLDNNGraphScheduler {
+public:
+    using Ptr = std::shared_ptr<MKLDNNGraphScheduler>;
+    using ExecuteFunc = std::function<void(const MKLDNNNodePtr&, const mkldnn::stream&)>;
+    using Dependency = std::pair<MKLDNNNodePtr, MKLDNNNodePtr>;
+
+    /**
+     * @param graphNodes all the graph nodes sorted topologically, the data dependencies are taken from their edges
+     * @param executableNodes nodes to be executed, the other nodes are only passed through
+     * @param extraDependencies pairs of nodes where the second one must not be started before the first one
+     *        is completed although they are not connected by the data edges (e.g. their tensors share memory)
+     * @param eng engine to create the execution streams
+     */
+    MKLDNNGraphScheduler(const std::vector<MKLDNNNodePtr>& graphNodes,
+                         const std::vector<MKLDNNNodePtr>& executableNodes,
+                         const std::vector<Dependency>& extraDependencies,
+                         const mkldnn::engine& eng);
+
+    /**
+     * @return the maximal number of nodes of the same depth in the dependency graph,
+     *         1 means the graph is a chain and there is nothing to execute concurrently
+     */
+    size_t getWidth() const {
+        return width;
+    }
+
+    void execute(const ExecuteFunc& func);
+
+    /**
+     * @return the maximal number of nodes executed at the same time since the scheduler is created
+     */
+    size_t getMaxConcurrency() const {
+        return maxConcurrency;
+    }
+
+    PerfCount& PerfCounter() {
+        return perfCounter;
+    }
+
+private:
+    std::vector<MKLDNNNodePtr> nodes;
+    std::vector<std::vector<size_t>> successors;
+    std::vector<size_t> predecessorsCount;
+    std::vector<size_t> roots;
+    size_t width = 0;
+
+    // number of not completed predecessors of each node during the execution
+    std::unique_ptr<std::atomic<size_t>[]> pending;
+    std::atomic<size_t> runningCount{0};
+    std::atomic<size_t> maxConcurrency{0};
+    InferenceEngine::ThreadLocal<mkldnn::stream> streams;
+    PerfCount perfCounter;
+};
+
+}  // namespace MKLDNNPlugin
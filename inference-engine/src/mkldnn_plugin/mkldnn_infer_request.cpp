@@ -10,6 +10,7 @@
 #include <blob_factory.hpp>
 #include <nodes/mkldnn_concat_node.h>
 #include <nodes/mkldnn_split_node.h>
+#include <nodes/mkldnn_reorder_node.h>
 #include <ie_compound_blob.h>
 #include <ie_common.h>
 #include "mkldnn_exec_network.h"
@@ -17,6 +18,7 @@
 #include "nodes/common/cpu_convert.h"
 #include "mkldnn_memory_state.h"
 #include "nodes/mkldnn_memory_node.hpp"
+#include "nodes/mkldnn_kv_cache_node.h"
 #include "nodes/common/cpu_memcpy.h"
 #include "mkldnn_async_infer_request.h"
 #include <debug.h>
@@ -62,6 +64,8 @@ MKLDNNPlugin::MKLDNNInferRequest::MKLDNNInferRequest(InferenceEngine::InputsData
                     state_name = state_name.substr(0, suffix_idx);
 
                 memoryStates.emplace_back(new MKLDNNVariableState(state_name, state_store));
+           } else if (node->getType() == KVCache) {
+                memoryStates.emplace_back(dynamic_cast<MKLDNNKVCacheNode*>(node.get())->createState());
            }
         }
     } else {
@@ -123,10 +127,58 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
             input.second->getTensorDesc().setLayout(_networkInputs[input.first]->getLayout());
         }
 
+        auto batched = batchedInputs.find(input.first);
+        if (batched != batchedInputs.end()) {
+            if (pushBatchItems(input.first, batched->second, inPrec))
+                continue;
+            gatherBatchItems(batched->second, input.second);
+        }
+
         pushInput(input.first, input.second, inPrec);
     }
 }
 
+bool MKLDNNPlugin::MKLDNNInferRequest::pushBatchItems(const std::string& inputName, const InferenceEngine::BatchedBlob::Ptr& batchedBlob,
+                                                      InferenceEngine::Precision inPrec) {
+    // the reorder after the input converts the items one by one, so the input memory isn't filled at all
+    const auto inputNode = graph->getInputNodeByName(inputName);
+    const auto& desc = _networkInputs[inputName]->getTensorDesc();
+    if (inPrec != desc.getPrecision() || graph->hasMeanImageFor(inputName) || inputNode->getChildEdges().size() != 1 ||
+            desc != MemoryDescUtils::convertToTensorDesc(inputNode->getChildEdgeAt(0)->getMemory().getDesc()))
+        return false;
+
+    auto reorder = std::dynamic_pointer_cast<MKLDNNReorderNode>(inputNode->getChildEdgeAt(0)->getChild());
+    if (!reorder)
+        return false;
+
+    std::vector<const void*> items;
+    for (size_t i = 0; i < batchedBlob->size(); i++)
+        items.push_back(batchedBlob->getBlob(i)->cbuffer().as<const void*>());
+    if (!reorder->setBatchItems(items))
+        return false;
+
+    batchItemsReaders.push_back(reorder.get());
+    return true;
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::gatherBatchItems(const InferenceEngine::BatchedBlob::Ptr& batchedBlob, InferenceEngine::Blob::Ptr& inputBlob) {
+    // the input blob is the memory of the input node if it can be, so the items are copied once
+    auto dst = inputBlob->buffer().as<uint8_t*>();
+    const size_t itemSize = inputBlob->byteSize() / batchedBlob->size();
+    for (size_t i = 0; i < batchedBlob->size(); i++) {
+        const auto& item = batchedBlob->getBlob(i);
+        if (item->byteSize() != itemSize)
+            IE_THROW() << "Can't copy the batch item: the item and the input have different sizes: " << item->byteSize() << " and " << itemSize;
+        cpu_memcpy(dst + i * itemSize, item->cbuffer().as<const uint8_t*>(), itemSize);
+    }
+}
+
+void MKLDNNPlugin::MKLDNNInferRequest::releaseBatchItems() {
+    for (auto reorder : batchItemsReaders)
+        reorder->setBatchItems({});
+    batchItemsReaders.clear();
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::PushStates() {
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == MemoryInput) {
@@ -142,6 +194,14 @@ void MKLDNNPlugin::MKLDNNInferRequest::PushStates() {
                     cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
                 }
             }
+        } else if (node->getType() == KVCache) {
+            // the state is appended in place, so it is bound to the node instead of being copied
+            auto cur_node = dynamic_cast<MKLDNNKVCacheNode*>(node.get());
+            auto cur_name = cur_node->getStateName();
+            for (const auto& state : memoryStates) {
+                if (state->GetName() == cur_name)
+                    cur_node->setState(std::dynamic_pointer_cast<MKLDNNVariableStateKVCache>(state));
+            }
         }
     }
 }
@@ -194,13 +254,20 @@ void MKLDNNPlugin::MKLDNNInferRequest::InferImpl() {
 
     ThrowIfCanceled();
 
-    PushInputData();
+    try {
+        PushInputData();
 
-    if (memoryStates.size() != 0) {
-        PushStates();
-    }
+        if (memoryStates.size() != 0) {
+            PushStates();
+        }
 
-    graph->Infer(this, m_curBatch);
+        graph->Infer(this, m_curBatch);
+    } catch (...) {
+        releaseBatchItems();
+        throw;
+    }
+    // the graph is shared by the requests, so the batch items are bound to it only for the inference
+    releaseBatchItems();
 
     if (memoryStates.size() != 0) {
         PullStates();
@@ -228,6 +295,11 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
     InferenceEngine::Blob::Ptr data;
 
     if (graph->hasInputWithName(name)) {
+        // the batch of blobs is returned as it was set, the own contiguous blob isn't filled if the items are read in place
+        auto batched = batchedInputs.find(name);
+        if (batched != batchedInputs.end())
+            return batched->second;
+
         // ROI blob is returned only if it was set previously.
         auto it = _preProcData.find(name);
         if (it != _preProcData.end()) {
@@ -334,6 +406,36 @@ InferenceEngine::Blob::Ptr MKLDNNPlugin::MKLDNNInferRequest::GetBlob(const std::
     return data;
 }
 
+void MKLDNNPlugin::MKLDNNInferRequest::SetBlobsImpl(const std::string& name, const InferenceEngine::BatchedBlob::Ptr& batchedBlob) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "SetBlobsImpl");
+    if (!graph || !graph->IsReady())
+        IE_THROW() << "Graph is not ready!";
+    if (!graph->hasInputWithName(name))
+        IE_THROW(NotFound) << "Failed to set the batch of blobs to the input with name: \'" << name << "\'";
+    if (graph->getProperty().batchLimit)
+        IE_THROW(NotImplemented) << "The batch of blobs can't be set if the dynamic batch is enabled";
+
+    const auto& preProcess = _networkInputs[name]->getPreProcess();
+    if (preProcess.getResizeAlgorithm() != InferenceEngine::NO_RESIZE || preProcess.getColorFormat() != InferenceEngine::ColorFormat::RAW)
+        IE_THROW(NotImplemented) << "The batch of blobs can't be set to the input with the pre-processing: \'" << name << "\'";
+    _preProcData.erase(name);
+
+    // the own contiguous blob is filled if the items can't be read in place, the blob set by the user isn't overwritten
+    if (batchedInputs.find(name) == batchedInputs.end()) {
+        const auto& desc = _networkInputs[name]->getTensorDesc();
+        _inputs[name] = make_blob_with_precision(desc);
+        _inputs[name]->allocate();
+
+        if (desc == MemoryDescUtils::convertToTensorDesc(graph->getInputNodeByName(name)->getChildEdgesAtPort(0)[0]->getMemory().getDesc()) &&
+                !graph->hasMeanImageFor(name)) {
+            externalPtr[name] = _inputs[name]->buffer();
+        } else {
+            externalPtr.erase(name);
+        }
+    }
+    batchedInputs[name] = batchedBlob;
+}
+
 void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr &data) {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "SetBlob");
     if (name.empty()) {
@@ -356,6 +458,7 @@ void MKLDNNPlugin::MKLDNNInferRequest::SetBlob(const std::string& name, const In
     const auto &blobDesc = data->getTensorDesc();
 
     if (foundInput) {
+        batchedInputs.erase(name);
         if (foundInput->getPrecision() != blobDesc.getPrecision()) {
             IE_THROW(ParameterMismatch) << "Failed to set input blob with precision: "
                                << blobDesc.getPrecision() << ", if CNNNetwork input blob precision is: " << foundInput->getPrecision();
@@ -14,6 +14,7 @@ namespace MKLDNNPlugin {
 
 class MKLDNNExecNetwork;
 class MKLDNNAsyncInferRequest;
+class MKLDNNReorderNode;
 
 class MKLDNNInferRequest : public InferenceEngine::IInferRequestInternal {
 public:
@@ -32,6 +33,8 @@ public:
 
     InferenceEngine::Blob::Ptr GetBlob(const std::string& name) override;
 
+    void SetBlobsImpl(const std::string& name, const InferenceEngine::BatchedBlob::Ptr& batchedBlob) override;
+
     void SetBatch(int batch = -1) override;
 
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> QueryState() override;
@@ -54,11 +57,17 @@ private:
     void redefineMemoryForInputNodes();
 
     void pushInput(const std::string& inputName, InferenceEngine::Blob::Ptr& inputBlob, InferenceEngine::Precision dataType);
+    bool pushBatchItems(const std::string& inputName, const InferenceEngine::BatchedBlob::Ptr& batchedBlob, InferenceEngine::Precision dataType);
+    void gatherBatchItems(const InferenceEngine::BatchedBlob::Ptr& batchedBlob, InferenceEngine::Blob::Ptr& inputBlob);
+    void releaseBatchItems();
 
     void changeDefaultPtr();
     std::shared_ptr<MKLDNNExecNetwork>  execNetwork;
     MKLDNNGraph*                        graph = nullptr;
     std::map<std::string, void*>        externalPtr;
+    // the inputs set as the batch items, they are copied to the contiguous input blobs only if they can't be read in place
+    std::map<std::string, InferenceEngine::BatchedBlob::Ptr> batchedInputs;
+    std::vector<MKLDNNReorderNode*>     batchItemsReaders;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
     MKLDNNAsyncInferRequest*            _asyncRequest = nullptr;
@@ -109,6 +109,11 @@ void MKLDNNMemory::Create(MemoryDescPtr desc, const void* data, bool pads_zeroin
         DnnlBlockedMemoryDesc dummyDesc(InferenceEngine::Precision::U8, Shape(dummySize));
         Create(dummyDesc.getDnnlDesc(), data, false);  // no pads zeroing
     }
+    if (useExternalStorage) {
+        ownedStorage.reset();
+    } else {
+        ownedStorage = prim;
+    }
     size_t newUpperBound = MKLDNNExtensionUtils::getMemSizeForDnnlDesc(prim->get_desc());
     if (newUpperBound > memUpperBound) {
         memUpperBound = newUpperBound;
@@ -161,11 +166,28 @@ void MKLDNNMemory::redefineDesc(MemoryDescPtr desc, void *data) {
         } else {
             this->Create(std::move(desc), nullptr, false);
         }
+    } else if (ownedStorage && desc->hasDefinedMaxSize() &&
+               desc->getMaxMemSize() <= MKLDNNExtensionUtils::getMemSizeForDnnlDesc(ownedStorage->get_desc())) {
+        // the owned storage is big enough, so only the descriptor is replaced
+        auto storage = ownedStorage;
+        this->Create(std::move(desc), storage->get_data_handle(), false);
+        ownedStorage = std::move(storage);
+        useExternalStorage = false;
     } else {
         this->Create(std::move(desc), nullptr, false);
     }
 }
 
+void MKLDNNMemory::bindStorage(void* data, size_t size) {
+    if (data == nullptr || pMemDesc->isDefined())
+        IE_THROW() << "Can not bind the storage to the memory with defined descriptor.";
+    DnnlBlockedMemoryDesc dummyDesc(InferenceEngine::Precision::U8, Shape(VectorDims{size}));
+    Create(dummyDesc.getDnnlDesc(), data, false);  // no pads zeroing
+    ownedStorage.reset();
+    useExternalStorage = true;
+    memUpperBound = size;
+}
+
 template<>
 DnnlMemoryDescPtr MKLDNNMemory::GetDescWithType<DnnlMemoryDesc, 0, 0>() const {
     return MemoryDescUtils::convertToDnnlMemoryDesc(pMemDesc);
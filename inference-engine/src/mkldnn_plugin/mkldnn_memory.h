@@ -91,10 +91,15 @@ public:
 
     // Redefines descriptor. The memory descriptor will be replaced with the new one.
     // Memory will not be reallocated if the new tensor size is less or equal the upper bound.
+    // The storage owned by the memory object grows only, so it's reused for all the smaller tensors.
     // Caution!!! This action invalidates the previous data layout. The old data may become unreachable.
     void redefineDesc(const MemoryDesc& desc, void *data = nullptr);
     void redefineDesc(MemoryDescPtr desc, void *data = nullptr);
 
+    // Binds the external storage of the given size in bytes to the memory with undefined descriptor,
+    // so the following redefinitions use it while the tensor fits. A bigger tensor is moved to the owned storage.
+    void bindStorage(void* data, size_t size);
+
     void SetData(const MKLDNNMemory& memory, size_t size = 0, bool ftz = true) const;
     void FillZero();
 
@@ -123,6 +128,8 @@ private:
 private:
     MemoryDescPtr pMemDesc;
     std::shared_ptr<mkldnn::memory> prim;
+    // memory object that owns the allocated storage, null if the storage is external
+    std::shared_ptr<mkldnn::memory> ownedStorage;
     mkldnn::engine eng;
     bool useExternalStorage = false;
     size_t memUpperBound = 0ul;
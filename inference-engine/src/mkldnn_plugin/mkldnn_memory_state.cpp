@@ -6,6 +6,11 @@
 #include "mkldnn_extension_utils.h"
 #include "blob_factory.hpp"
 
+#include <cstring>
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
 using namespace InferenceEngine;
 
 namespace MKLDNNPlugin {
@@ -14,4 +19,90 @@ void  MKLDNNVariableState::Reset() {
     std::memset(state->buffer(), 0, state->byteSize());
 }
 
+MKLDNNVariableStateKVCache::MKLDNNVariableStateKVCache(std::string name, const TensorDesc& desc, size_t axis, size_t appendLength) :
+        IVariableStateInternal{name}, appendLength(appendLength) {
+    const auto& dims = desc.getDims();
+    if (axis >= dims.size() || appendLength == 0)
+        IE_THROW() << "KV cache state '" << name << "' has unexpected axis or appended length";
+
+    outerCount = std::accumulate(dims.begin(), dims.begin() + axis, size_t(1), std::multiplies<size_t>());
+    rowSize = std::accumulate(dims.begin() + axis + 1, dims.end(), size_t(1), std::multiplies<size_t>()) * desc.getPrecision().size();
+    windowLength = dims[axis];
+    capacity = 2 * windowLength + appendLength;
+    outerStride = capacity * rowSize;
+    data.resize(outerCount * outerStride, 0);
+
+    state = make_blob_with_precision(desc);
+    state->allocate();
+}
+
+void MKLDNNVariableStateKVCache::zeroRows(size_t first, size_t count) {
+    for (size_t i = 0; i < outerCount; i++)
+        std::memset(rows(i, first), 0, count * rowSize);
+}
+
+void MKLDNNVariableStateKVCache::Reset() {
+    zeroRows(start, windowLength);
+    storedLength = 0;
+}
+
+void MKLDNNVariableStateKVCache::Trim(size_t length) {
+    if (length >= storedLength)
+        return;
+
+    // the kept rows stay where they are, the window is moved back so they become its tail
+    const size_t dropped = storedLength - length;
+    const size_t kept = start + windowLength - storedLength;
+    if (start >= dropped) {
+        start -= dropped;
+    } else {
+        for (size_t i = 0; i < outerCount; i++)
+            std::memmove(rows(i, windowLength - length), rows(i, kept), length * rowSize);
+        start = 0;
+    }
+    zeroRows(start, windowLength - length);
+    storedLength = length;
+}
+
+void MKLDNNVariableStateKVCache::SetState(const Blob::Ptr& newState) {
+    if (newState->byteSize() != outerCount * windowLength * rowSize)
+        IE_THROW() << "KV cache state '" << name << "' can't be set from the blob of " << newState->byteSize() << " bytes";
+
+    const auto src = newState->cbuffer().as<const uint8_t*>();
+    start = 0;
+    for (size_t i = 0; i < outerCount; i++)
+        cpu_memcpy(rows(i, start), src + i * windowLength * rowSize, windowLength * rowSize);
+    storedLength = windowLength;
+}
+
+Blob::CPtr MKLDNNVariableStateKVCache::GetState() const {
+    auto dst = state->buffer().as<uint8_t*>();
+    for (size_t i = 0; i < outerCount; i++)
+        cpu_memcpy(dst + i * windowLength * rowSize, data.data() + i * outerStride + start * rowSize, windowLength * rowSize);
+    return state;
+}
+
+void MKLDNNVariableStateKVCache::append(const void* src) {
+    if (start + windowLength + appendLength > capacity) {
+        for (size_t i = 0; i < outerCount; i++)
+            std::memmove(rows(i, 0), rows(i, start), windowLength * rowSize);
+        start = 0;
+    }
+
+    const auto srcRows = static_cast<const uint8_t*>(src);
+    for (size_t i = 0; i < outerCount; i++)
+        cpu_memcpy(rows(i, start + windowLength), srcRows + i * appendLength * rowSize, appendLength * rowSize);
+}
+
+void MKLDNNVariableStateKVCache::copyConcatenation(void* dst) const {
+    const size_t size = (windowLength + appendLength) * rowSize;
+    for (size_t i = 0; i < outerCount; i++)
+        cpu_memcpy(static_cast<uint8_t*>(dst) + i * size, data.data() + i * outerStride + start * rowSize, size);
+}
+
+void MKLDNNVariableStateKVCache::commit() {
+    start += appendLength;
+    storedLength = std::min(storedLength + appendLength, windowLength);
+}
+
 }  // namespace MKLDNNPlugin
@@ -11,6 +11,7 @@
 #include "memory_desc/cpu_memory_desc_utils.h"
 
 #include <string>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
@@ -26,4 +27,57 @@ public:
     void Reset() override;
 };
 
-}  // namespace MKLDNNPlugin
\ No newline at end of file
+/**
+ * @brief The state of a KV cache: the window of the last rows along the axis of the state, the new rows are appended
+ * right after the window and the window slides over them.
+ *
+ * The rows are kept in the preallocated buffer which is twice the window along the axis, so the window is moved back to
+ * the beginning of the buffer once per the window length of the appended rows. The state not filled yet is zero, the
+ * stored rows are the tail of the window.
+ */
+class MKLDNNVariableStateKVCache : public InferenceEngine::IVariableStateInternal {
+public:
+    MKLDNNVariableStateKVCache(std::string name, const InferenceEngine::TensorDesc& desc, size_t axis, size_t appendLength);
+
+    void Reset() override;
+    void Trim(size_t length) override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+    InferenceEngine::Blob::CPtr GetState() const override;
+
+    /**
+     * @brief Writes the new rows right after the window, so the window followed by them is the concatenation of the state
+     * and the new rows along the axis
+     * @param src The dense tensor of the new rows
+     */
+    void append(const void* src);
+
+    /**
+     * @brief The concatenation written by append() as the dense tensor, it is available only if the state has no outer
+     * axes, otherwise it is copied by copyConcatenation()
+     */
+    uint8_t* getConcatenation() {
+        return outerCount == 1 ? data.data() + start * rowSize : nullptr;
+    }
+    void copyConcatenation(void* dst) const;
+
+    // Slides the window over the rows written by append()
+    void commit();
+
+private:
+    uint8_t* rows(size_t outer, size_t row) {
+        return data.data() + outer * outerStride + row * rowSize;
+    }
+    void zeroRows(size_t first, size_t count);
+
+    std::vector<uint8_t> data;
+    size_t outerCount = 1;      // the number of the slabs of the axes before the axis
+    size_t rowSize = 0;         // in bytes, the axes after the axis
+    size_t windowLength = 0;    // the rows of the state
+    size_t appendLength = 0;    // the rows appended by an inference
+    size_t capacity = 0;        // the rows in a slab of the buffer
+    size_t outerStride = 0;     // in bytes
+    size_t start = 0;           // the first row of the window
+    size_t storedLength = 0;    // the rows appended since the reset, the window length at most
+};
+
+}  // namespace MKLDNNPlugin
@@ -12,6 +12,7 @@
 #include <string>
 #include <limits>
 #include <cstdint>
+#include <cstring>
 #include <unordered_map>
 
 #include <nodes/mkldnn_concat_node.h>
@@ -1213,10 +1214,52 @@ bool MKLDNNNode::inputShapesModified() const {
 }
 
 bool MKLDNNNode::needShapeInfer() const {
-    return inputShapesModified();
+    if (inputShapesModified())
+        return true;
+
+    // the output shapes depend on the values of the data ports too
+    if (staticShapeInfer) {
+        const auto &dataPorts = staticShapeInfer->get_data_ports();
+        if (lastShapeInferData.size() != dataPorts.size())
+            return true;
+        for (size_t i = 0; i < dataPorts.size(); i++) {
+            const auto &mem = getParentEdgesAtPort(dataPorts[i])[0]->getMemory();
+            const auto size = mem.GetSize();
+            if (lastShapeInferData[i].size() != size || std::memcmp(lastShapeInferData[i].data(), mem.GetPtr(), size) != 0)
+                return true;
+        }
+    }
+    return false;
 }
 
-std::vector<VectorDims> MKLDNNNode::shapeInfer() const {
+const std::vector<VectorDims>& MKLDNNNode::shapeInfer() const {
+    lastOutputShapes.resize(outputShapes.size());
+    if (staticShapeInfer) {
+        for (size_t i = 0; i < shapeInferInputs.size(); i++) {
+            const auto &dims = getParentEdgesAtPort(i)[0]->getMemory().getStaticDims();
+            shapeInferInputs[i].assign(dims.begin(), dims.end());
+        }
+
+        const auto getData = [this](size_t port, std::vector<int64_t> &values) {
+            return readShapeInferData(port, values);
+        };
+        if (staticShapeInfer->infer(shapeInferInputs, shapeInferOutputs, getData)) {
+            for (size_t i = 0; i < lastOutputShapes.size(); i++) {
+                const auto &shape = shapeInferOutputs[i];
+                auto &dims = lastOutputShapes[i];
+                if (shape.empty()) {
+                    dims.assign(1, 1);
+                    continue;
+                }
+                dims.resize(shape.size());
+                for (size_t j = 0; j < shape.size(); j++)
+                    dims[j] = shape[j].get_length();
+            }
+            return lastOutputShapes;
+        }
+    }
+
+    // fallback to the ngraph shape inference for operations which don't have a static implementation
     for (size_t i = 0; i < opToShapeInfer->get_input_size(); i++) {
         if (!dynamic_cast<ngraph::opset1::Constant *>(opToShapeInfer->get_input_node_ptr(i))) {
             opToShapeInfer->get_input_tensor(i).set_partial_shape(
@@ -1228,14 +1271,47 @@ std::vector<VectorDims> MKLDNNNode::shapeInfer() const {
 
     IE_ASSERT(opToShapeInfer->get_output_size() == outputShapes.size());
 
-    std::vector<VectorDims> newOutputShapes(outputShapes.size());
-    for (size_t i = 0; i < newOutputShapes.size(); i++) {
+    for (size_t i = 0; i < lastOutputShapes.size(); i++) {
         const auto &partShape = opToShapeInfer->get_output_partial_shape(i);
         if (partShape.is_dynamic())
             IE_THROW(NotImplemented) << "CPU plug-in doesn't support default shape infer for nodes with internal dynamism";
-        newOutputShapes[i] = partShape.get_shape();
+        lastOutputShapes[i] = partShape.get_shape();
+    }
+    return lastOutputShapes;
+}
+
+bool MKLDNNNode::readShapeInferData(size_t port, std::vector<int64_t> &values) const {
+    if (port >= getParentEdges().size())
+        return false;
+
+    const auto &mem = getParentEdgesAtPort(port)[0]->getMemory();
+    const auto count = mem.GetShape().getElementsCount();
+    values.resize(count);
+    switch (mem.getDesc().getPrecision()) {
+        case Precision::I32: {
+            const auto src = reinterpret_cast<const int32_t *>(mem.GetPtr());
+            std::copy(src, src + count, values.begin());
+            break;
+        }
+        case Precision::I64: {
+            const auto src = reinterpret_cast<const int64_t *>(mem.GetPtr());
+            std::copy(src, src + count, values.begin());
+            break;
+        }
+        case Precision::I8: {
+            const auto src = reinterpret_cast<const int8_t *>(mem.GetPtr());
+            std::copy(src, src + count, values.begin());
+            break;
+        }
+        case Precision::U8: {
+            const auto src = reinterpret_cast<const uint8_t *>(mem.GetPtr());
+            std::copy(src, src + count, values.begin());
+            break;
+        }
+        default:
+            return false;
     }
-    return newOutputShapes;
+    return true;
 }
 
 void MKLDNNNode::updateLastInputDims() {
@@ -1247,6 +1323,16 @@ void MKLDNNNode::updateLastInputDims() {
 
     for (size_t i = 0; i < lastInputDims.size(); i++)
         lastInputDims[i] = getParentEdgesAtPort(i)[0]->getMemory().getStaticDims();
+
+    if (staticShapeInfer) {
+        const auto &dataPorts = staticShapeInfer->get_data_ports();
+        lastShapeInferData.resize(dataPorts.size());
+        for (size_t i = 0; i < dataPorts.size(); i++) {
+            const auto &mem = getParentEdgesAtPort(dataPorts[i])[0]->getMemory();
+            const auto src = reinterpret_cast<const uint8_t *>(mem.GetPtr());
+            lastShapeInferData[i].assign(src, src + mem.GetSize());
+        }
+    }
 }
 
 bool MKLDNNNode::canFuseSimpleOperation(const MKLDNNNodePtr& node) const {
@@ -1356,4 +1442,8 @@ void MKLDNNNode::createShapeInferSubgraph(const std::shared_ptr<ngraph::Node>& o
         }
     }
     opToShapeInfer = op->clone_with_new_inputs(inputsForShapeInfer);
+
+    staticShapeInfer = ov::make_shape_inference(opToShapeInfer);
+    shapeInferInputs.assign(inputShapes.size(), ov::StaticShape{});
+    shapeInferOutputs.assign(outputShapes.size(), ov::StaticShape{});
 }
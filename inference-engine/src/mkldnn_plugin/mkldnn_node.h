@@ -29,6 +29,8 @@
 #include "cpu_types.h"
 #include "cpu_shape.h"
 #include "memory_desc/cpu_memory_desc.h"
+#include "cache/multi_cache.h"
+#include "utils/shape_inference/shape_inference.hpp"
 
 namespace MKLDNNPlugin {
 
@@ -542,6 +544,10 @@ public:
         return isDynamic;
     }
 
+    void setRuntimeCache(MultiCachePtr cache) {
+        rtParamsCache = cache;
+    }
+
     const Shape& getInputShapeAtPort(size_t port) const {
         if (inputShapes.size() <= port) {
             IE_THROW() << "Incorrect input port number for node " << getName();
@@ -698,7 +704,11 @@ protected:
 
     bool inputShapesModified() const;
     virtual bool needShapeInfer() const;
-    virtual std::vector<VectorDims> shapeInfer() const;
+    /**
+     * @brief Infers the output shapes for the current input memory
+     * @return reference to lastOutputShapes, the buffer is reused between the calls
+     */
+    virtual const std::vector<VectorDims>& shapeInfer() const;
     // TODO [DS] : make pure after all nodes will be support dynamic shapes
     virtual void executeDynamicImpl(mkldnn::stream strm) {
         IE_THROW(NotImplemented) << "[DS] executeDynamicImpl not implemented for node with type: " << getTypeStr();
@@ -712,9 +722,29 @@ protected:
     }
 
     std::vector<VectorDims> lastInputDims = {};
+    mutable std::vector<VectorDims> lastOutputShapes = {};
+
+    /**
+     * @brief Returns the runtime parameters cache that prepareParams() implementations may use to reuse primitives
+     * and kernels created for the same shapes and attributes before.
+     * @return pointer to the cache or nullptr if caching is disabled for the node
+     */
+    MultiCachePtr getRuntimeCache() const {
+        return rtParamsCache;
+    }
 
 private:
+    bool readShapeInferData(size_t port, std::vector<int64_t>& values) const;
+
     std::shared_ptr<ngraph::Node> opToShapeInfer;
+    std::shared_ptr<ov::IStaticShapeInfer> staticShapeInfer;
+    // shapes buffers are kept between shapeInfer() calls to avoid reallocations
+    mutable std::vector<ov::StaticShape> shapeInferInputs;
+    mutable std::vector<ov::StaticShape> shapeInferOutputs;
+    // the values of the shape-defining inputs (e.g. Reshape target shape) used by the last shape inference
+    std::vector<std::vector<uint8_t>> lastShapeInferData;
+
+    MultiCachePtr rtParamsCache;
 
     std::vector<MKLDNNEdgeWeakPtr> parentEdges;
     std::vector<MKLDNNEdgeWeakPtr> childEdges;
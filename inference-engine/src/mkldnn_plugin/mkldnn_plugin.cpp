@@ -11,13 +11,17 @@
 
 #include <threading/ie_executor_manager.hpp>
 #include <memory>
+#include <algorithm>
 #include <ie_plugin_config.hpp>
+#include <cpu/cpu_config.hpp>
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <ie_icore.hpp>
 #include <fstream>
 #include <vector>
 #include <tuple>
 #include <unordered_set>
+#include <unordered_map>
+#include <set>
 #include <ie_system_conf.h>
 #include <nodes/list.hpp>
 #include <ie_ngraph_utils.hpp>
@@ -69,6 +73,10 @@
 #include <transformations/op_conversions/fq_decomposition.hpp>
 #include <transformations/utils/utils.hpp>
 #include <transformations/serialize.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+
+#include <snippets/pass/collapse_subgraph.hpp>
+#include <snippets/op/subgraph.hpp>
 
 #include <ngraph/opsets/opset2.hpp>
 #include <ngraph/opsets/opset3.hpp>
@@ -96,6 +104,7 @@
 #include "nodes/mkldnn_mvn_node.h"
 #include "nodes/mkldnn_fake_quantize_node.h"
 #include "nodes/mkldnn_normalize_node.h"
+#include "nodes/mkldnn_snippet_node.h"
 #include "ngraph_transformations/convert_to_cpu_specific_opset.hpp"
 
 #if !defined(__arm__) && !defined(_M_ARM) && !defined(__aarch64__) && !defined(_M_ARM64)
@@ -113,6 +122,7 @@ using namespace InferenceEngine;
 Engine::Engine() {
     _pluginName = "CPU";
     extensionManager->AddExtension(std::make_shared<Extensions::Cpu::MKLDNNExtensions>());
+    rtParamsCache = std::make_shared<MultiCache>(engConfig.rtCacheCapacity);
 }
 
 Engine::~Engine() {
@@ -426,6 +436,83 @@ static void Transformation(CNNNetwork& clonedNetwork, const bool _enableLPT) {
     ConvertToCPUSpecificOpset(nGraphFunc);
 }
 
+// Returns true if the node is fused into the convolution-like parent by the graph optimizer, possibly via a chain of eltwises
+static bool isFusedIntoParent(const std::shared_ptr<const ngraph::Node>& node) {
+    static const std::set<std::string> fusingTypes = {
+        "Convolution", "GroupConvolution", "ConvolutionBackpropData", "GroupConvolutionBackpropData", "BinaryConvolution",
+        "MatMul", "FullyConnected", "MVN", "NormalizeL2", "Interpolate", "FakeQuantize"
+    };
+    for (const auto& input : node->input_values()) {
+        const auto parent = input.get_node_shared_ptr();
+        if (fusingTypes.count(parent->get_type_name()) || std::string(parent->get_type_name()).rfind("Reduce", 0) == 0)
+            return true;
+        const bool isEltwise = ngraph::op::is_unary_elementwise_arithmetic(parent) || ngraph::op::is_binary_elementwise_arithmetic(parent);
+        if (isEltwise && input.get_target_inputs().size() == 1 && isFusedIntoParent(parent))
+            return true;
+    }
+    return false;
+}
+
+// The subgraphs the snippet node can't execute are turned back into the original operations
+static void unwrapUnsupportedSnippets(std::shared_ptr<ngraph::Function> nGraphFunc) {
+    for (const auto& op : nGraphFunc->get_ordered_ops()) {
+        auto subgraph = ngraph::as_type_ptr<ngraph::snippets::op::Subgraph>(op);
+        std::string errorMessage;
+        if (!subgraph || MKLDNNSnippetNode::isSupportedOperation(subgraph, errorMessage))
+            continue;
+
+        const auto body = subgraph->get_body();
+        std::unordered_map<ngraph::Node*, ngraph::OutputVector> outputs;
+        for (size_t i = 0; i < body->get_parameters().size(); i++)
+            outputs[body->get_parameters()[i].get()] = {subgraph->input_value(i)};
+        for (const auto& bodyOp : body->get_ordered_ops()) {
+            if (ngraph::op::is_parameter(bodyOp) || ngraph::op::is_output(bodyOp))
+                continue;
+            ngraph::OutputVector inputs;
+            for (const auto& input : bodyOp->input_values())
+                inputs.push_back(outputs.at(input.get_node())[input.get_index()]);
+            auto unwrapped = bodyOp->clone_with_new_inputs(inputs);
+            unwrapped->set_friendly_name(bodyOp->get_friendly_name());
+            ngraph::copy_runtime_info(bodyOp, unwrapped);
+            outputs[bodyOp.get()] = unwrapped->outputs();
+        }
+        for (size_t i = 0; i < body->get_results().size(); i++) {
+            const auto result = body->get_results()[i]->input_value(0);
+            subgraph->output(i).replace(outputs.at(result.get_node())[result.get_index()]);
+        }
+    }
+}
+
+// Collapses the chains of the eltwise operations into the subgraphs executed by the snippet node
+static void TokenizeSnippets(std::shared_ptr<ngraph::Function> nGraphFunc) {
+    ngraph::pass::Manager snippetsManager;
+    snippetsManager.register_pass<ngraph::snippets::pass::TokenizeSnippets>(false, true);
+    snippetsManager.get_pass_config()->set_callback<ngraph::snippets::pass::StartSubgraph,
+                                                    ngraph::snippets::pass::AttachToSubgraph>(
+            [](const std::shared_ptr<const ngraph::Node> &node) -> bool {
+                // the decompression of the compressed FullyConnected weights is fused into the FullyConnected node
+                if (node->get_rt_info().count(ov::DisableConstantFolding::get_type_info_static()))
+                    return true;
+                for (const auto& output : node->outputs()) {
+                    if (output.get_element_type() != ngraph::element::f32)
+                        return true;
+                }
+                return isFusedIntoParent(node);
+            });
+    snippetsManager.run_passes(nGraphFunc);
+    unwrapUnsupportedSnippets(nGraphFunc);
+}
+
+// The subgraph bodies aren't serializable, so the network is exported as it is before the tokenization.
+// Returns the network to export: the untokenized copy if the snippets are tokenized, the network itself otherwise.
+static CNNNetwork TokenizeSnippets(CNNNetwork& network, bool enableSnippets) {
+    if (!enableSnippets || !dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::sse41))
+        return network;
+    auto exportedNetwork = InferenceEngine::details::cloneNetwork(network);
+    TokenizeSnippets(network.getFunction());
+    return exportedNetwork;
+}
+
 InferenceEngine::IExecutableNetworkInternal::Ptr
 Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &orig_config) {
     OV_ITT_SCOPED_TASK(itt::domains::MKLDNNPlugin, "Engine::LoadExeNetworkImpl");
@@ -528,7 +615,14 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
            }
         }
     }
-    ConvertToCPUSpecificOpset(nGraphFunc);
+    const auto& compressionProp = config.find(CPUConfigParams::KEY_CPU_FC_WEIGHTS_COMPRESSION);
+    const auto fcWeightsCompression = compressionProp != config.end() ? Config::parseWeightsCompression(compressionProp->second)
+                                                                      : engConfig.fcWeightsCompression;
+    ConvertToCPUSpecificOpset(nGraphFunc, details::convertPrecision(fcWeightsCompression));
+
+    const auto& snippetsProp = config.find(CPUConfigParams::KEY_CPU_SNIPPETS);
+    const bool enableSnippets = snippetsProp != config.end() ? snippetsProp->second == PluginConfigParams::YES : engConfig.snippets;
+    const auto exportedNetwork = TokenizeSnippets(clonedNetwork, enableSnippets);
 
     // update the props after the perf mode translated to configs
     // TODO: Clarify the behavior of SetConfig method. Skip eng_config or not?
@@ -538,13 +632,14 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         conf.batchLimit = static_cast<int>(network.getBatchSize());
     }
 
-    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, conf, extensionManager, weightsSharing);
+    return std::make_shared<MKLDNNExecNetwork>(clonedNetwork, exportedNetwork, conf, extensionManager, weightsSharing, rtParamsCache);
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
     // accumulate config parameters on engine level
     streamsSet = (config.find(PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS) != config.end());
     engConfig.readProperties(config);
+    rtParamsCache->setCapacity(engConfig.rtCacheCapacity);
 }
 
 Parameter Engine::GetConfig(const std::string& name, const std::map<std::string, Parameter>& /*options*/) const {
@@ -583,6 +678,8 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
             METRIC_KEY(RANGE_FOR_ASYNC_INFER_REQUESTS),
             METRIC_KEY(RANGE_FOR_STREAMS),
             METRIC_KEY(IMPORT_EXPORT_SUPPORT),
+            CPU_METRIC_KEY(RUNTIME_CACHE_HITS),
+            CPU_METRIC_KEY(RUNTIME_CACHE_MISSES),
         };
         IE_SET_METRIC_RETURN(SUPPORTED_METRICS, metrics);
     } else if (name == METRIC_KEY(FULL_DEVICE_NAME)) {
@@ -618,6 +715,7 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         capabilities.push_back(METRIC_VALUE(FP16));
         capabilities.push_back(METRIC_VALUE(INT8));
         capabilities.push_back(METRIC_VALUE(BIN));
+        capabilities.push_back(METRIC_VALUE(BATCHED_BLOB));
         IE_SET_METRIC_RETURN(OPTIMIZATION_CAPABILITIES, capabilities);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys;
@@ -632,6 +730,10 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         IE_SET_METRIC_RETURN(RANGE_FOR_STREAMS, range);
     } else if (name == METRIC_KEY(IMPORT_EXPORT_SUPPORT)) {
         IE_SET_METRIC_RETURN(IMPORT_EXPORT_SUPPORT, true);
+    } else if (name == CPU_METRIC_KEY(RUNTIME_CACHE_HITS)) {
+        IE_SET_METRIC_RETURN(CPU_RUNTIME_CACHE_HITS, static_cast<uint64_t>(rtParamsCache->getHitsCount()));
+    } else if (name == CPU_METRIC_KEY(RUNTIME_CACHE_MISSES)) {
+        IE_SET_METRIC_RETURN(CPU_RUNTIME_CACHE_MISSES, static_cast<uint64_t>(rtParamsCache->getMissesCount()));
     } else {
         IE_THROW() << "Unsupported metric key " << name;
     }
@@ -732,6 +834,19 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
                                             const std::map<std::string, std::string>& config) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::MKLDNN_LT, "ImportNetwork");
 
+    Config conf = engConfig;
+    conf.readProperties(config);
+
+    // the blobs exported by the previous versions contain the network only
+    const auto networkPos = networkModel.tellg();
+    const std::string pluginVersion = GetVersion().buildNumber;
+    CompiledBlobHeader header(conf, pluginVersion);
+    networkModel.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!networkModel.good() || !header.isCompiledBlob()) {
+        networkModel.clear();
+        networkModel.seekg(networkPos);
+    }
+
     CNNNetworkDeserializer deserializer(networkModel,
         [this](const std::string& model, const Blob::CPtr& weights) {
             return GetCore()->ReadNetwork(model, weights);
@@ -740,14 +855,24 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
     CNNNetwork cnnnetwork;
     deserializer >> cnnnetwork;
 
-    Config conf = engConfig;
-    conf.readProperties(config);
+    // the constants compiled by another plugin build, for another ISA or precision config are ignored,
+    // so they are computed once again
+    std::shared_ptr<CompiledConstants> compiledConstants;
+    if (header.isCompatible(CompiledBlobHeader(conf, pluginVersion))) {
+        compiledConstants = std::make_shared<CompiledConstants>();
+        CompiledConstantsDeserializer constantsDeserializer(networkModel);
+        constantsDeserializer >> *compiledConstants;
+    }
 
     if (conf.enableDynamicBatch) {
         conf.batchLimit = static_cast<int>(cnnnetwork.getBatchSize());
     }
 
-    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(cnnnetwork, conf, extensionManager, weightsSharing);
+    // the blob contains the network before the tokenization, so the snippets are tokenized once again
+    const auto exportedNetwork = TokenizeSnippets(cnnnetwork, conf.snippets);
+
+    auto execNetwork = std::make_shared<MKLDNNExecNetwork>(cnnnetwork, exportedNetwork, conf, extensionManager, weightsSharing,
+                                                           rtParamsCache, compiledConstants);
 
     execNetwork->setNetworkInputs(cnnnetwork.getInputsInfo());
     execNetwork->setNetworkOutputs(cnnnetwork.getOutputsInfo());
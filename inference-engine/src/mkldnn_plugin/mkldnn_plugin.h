@@ -43,6 +43,7 @@ public:
 private:
     Config engConfig;
     NumaNodesWeights weightsSharing;
+    MultiCachePtr rtParamsCache;
     MKLDNNExtensionManager::Ptr extensionManager = std::make_shared<MKLDNNExtensionManager>();
     bool streamsSet = false;
 };
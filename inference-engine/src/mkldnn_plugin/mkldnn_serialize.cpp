@@ -2,7 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 #include "mkldnn_serialize.h"
+#include "mkldnn_graph.h"
 
+#include <cstring>
+#include <sstream>
 #include <transformations/serialize.hpp>
 
 #include <pugixml.hpp>
@@ -160,6 +163,8 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     _istream.read(const_cast<char*>(xmlString.c_str()), hdr.model_size);
 
     network = _cnn_network_builder(xmlString, std::move(dataBlob));
+    // leave the stream after the network data as something may be written next
+    _istream.seekg(hdr.model_offset + hdr.model_size);
 
     // Set input and output precisions
     pugi::xml_node root = xmlInOutDoc.child("cnndata");
@@ -170,4 +175,107 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     setPrecisionsAndLayouts(outputs.children("out"), network.getOutputsInfo());
 }
 
+namespace {
+    constexpr char compiledBlobMagic[8] = "CPUGRPH";
+    // must be increased on any change of the compiled constants format or the graph compilation affecting them
+    constexpr uint32_t compiledBlobVersion = 2;
+
+    enum CompiledBlobFlags : uint32_t {
+        EnforceBF16 = 1 << 0,
+        LPTransforms = 1 << 1,
+    };
+}  // namespace
+
+CompiledBlobHeader::CompiledBlobHeader(const Config& config, const std::string& pluginVersion)
+    : version(compiledBlobVersion)
+    , isa(static_cast<uint32_t>(dnnl::get_effective_cpu_isa()))
+    , flags((config.enforceBF16 ? EnforceBF16 : 0) | (config.lpTransformsMode == Config::LPTransformsMode::On ? LPTransforms : 0))
+    , fcWeightsPrecision(static_cast<uint32_t>(config.fcWeightsCompression)) {
+    std::memcpy(magic, compiledBlobMagic, sizeof(magic));
+    // the longer versions are truncated, the last character is kept zero
+    std::memset(this->pluginVersion, 0, sizeof(this->pluginVersion));
+    pluginVersion.copy(this->pluginVersion, sizeof(this->pluginVersion) - 1);
+}
+
+bool CompiledBlobHeader::isCompiledBlob() const {
+    return std::memcmp(magic, compiledBlobMagic, sizeof(magic)) == 0;
+}
+
+bool CompiledBlobHeader::isCompatible(const CompiledBlobHeader& other) const {
+    return isCompiledBlob() && other.isCompiledBlob() &&
+           version == other.version && isa == other.isa && flags == other.flags &&
+           fcWeightsPrecision == other.fcWeightsPrecision &&
+           std::memcmp(pluginVersion, other.pluginVersion, sizeof(pluginVersion)) == 0;
+}
+
+std::string CompiledBlobHeader::describe(const MemoryDesc& desc) {
+    std::stringstream result;
+    result << desc.getPrecision().name() << ":" << desc.serializeFormat() << ":" << desc.getShape().toString();
+    return result.str();
+}
+
+CompiledConstantsSerializer::CompiledConstantsSerializer(std::ostream & ostream)
+    : _ostream(ostream) {
+}
+
+void CompiledConstantsSerializer::operator << (MKLDNNGraph & graph) {
+    // Only the edges between the constant subgraphs and the rest of the graph are stored,
+    // data of the Input nodes is already kept by the network itself.
+    std::vector<MKLDNNEdgePtr> edges;
+    for (const auto& edge : graph.GetEdges()) {
+        const auto parent = edge->getParent();
+        if (parent->isConstant() && parent->getType() != Input && !edge->getChild()->isConstant() &&
+            edge->getMemory().getDesc().isDefined())
+            edges.push_back(edge);
+    }
+
+    auto writeSize = [this](uint64_t size) {
+        _ostream.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    };
+
+    auto writeString = [&](const std::string& str) {
+        writeSize(str.size());
+        _ostream.write(str.data(), str.size());
+    };
+
+    writeSize(edges.size());
+    for (const auto& edge : edges) {
+        const auto& memory = edge->getMemory();
+        writeString(edge->name());
+        writeString(CompiledBlobHeader::describe(memory.getDesc()));
+        writeSize(memory.GetSize());
+        _ostream.write(static_cast<const char*>(memory.GetData()), memory.GetSize());
+    }
+}
+
+CompiledConstantsDeserializer::CompiledConstantsDeserializer(std::istream & istream)
+    : _istream(istream) {
+}
+
+void CompiledConstantsDeserializer::operator >> (CompiledConstants & constants) {
+    auto readSize = [this]() {
+        uint64_t size = 0;
+        _istream.read(reinterpret_cast<char*>(&size), sizeof(size));
+        if (!_istream.good())
+            IE_THROW(NetworkNotRead) << "The compiled constants information is invalid.";
+        return static_cast<size_t>(size);
+    };
+
+    auto readString = [&]() {
+        std::string str(readSize(), '\0');
+        _istream.read(&str[0], str.size());
+        return str;
+    };
+
+    const auto count = readSize();
+    for (size_t i = 0; i < count; i++) {
+        auto& constant = constants[readString()];
+        constant.desc = readString();
+        constant.data.resize(readSize());
+        _istream.read(constant.data.data(), constant.data.size());
+        if (!_istream.good())
+            IE_THROW(NetworkNotRead) << "The compiled constants information is invalid.";
+    }
+}
+
 }  // namespace MKLDNNPlugin
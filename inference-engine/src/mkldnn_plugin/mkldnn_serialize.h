@@ -3,9 +3,14 @@
 //
 #pragma once
 #include "mkldnn_extension_mngr.h"
+#include "config.h"
+#include "memory_desc/cpu_memory_desc.h"
 
 #include <iostream>
 #include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
 #include <cpp/ie_cnn_network.h>
 
 namespace MKLDNNPlugin {
@@ -36,4 +41,58 @@ private:
 
 // const std::string& model, const Blob::CPtr& weights
 
+class MKLDNNGraph;
+
+/**
+ * @brief Output of a constant subgraph of the compiled graph (e.g. reordered weights) with its memory descriptor
+ */
+struct CompiledConstant {
+    // precision, layout and dims of the data, the data is used only if the descriptor of the imported graph matches
+    std::string desc;
+    std::vector<char> data;
+};
+
+/**
+ * @brief Outputs of the constant subgraphs of the compiled graph by the names of the edges
+ */
+using CompiledConstants = std::unordered_map<std::string, CompiledConstant>;
+
+/**
+ * @brief Header of the exported network. The compiled constants are written after the network and they are valid
+ * only for the same format version, plugin build, ISA and precision config.
+ */
+struct CompiledBlobHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t isa;
+    uint32_t flags;
+    uint32_t fcWeightsPrecision;
+    char pluginVersion[64];
+
+    CompiledBlobHeader(const Config& config, const std::string& pluginVersion);
+    bool isCompatible(const CompiledBlobHeader& other) const;
+    bool isCompiledBlob() const;
+
+    // describes the memory of the compiled constant, the descriptors of the exported and imported data must match
+    static std::string describe(const MemoryDesc& desc);
+};
+
+class CompiledConstantsSerializer {
+public:
+    explicit CompiledConstantsSerializer(std::ostream & ostream);
+    void operator << (MKLDNNGraph & graph);
+
+private:
+    std::ostream & _ostream;
+};
+
+class CompiledConstantsDeserializer {
+public:
+    explicit CompiledConstantsDeserializer(std::istream & istream);
+    void operator >> (CompiledConstants & constants);
+
+private:
+    std::istream & _istream;
+};
+
 }  // namespace MKLDNNPlugin
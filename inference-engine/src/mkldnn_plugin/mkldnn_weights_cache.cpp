@@ -5,7 +5,26 @@
 #include "mkldnn_weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <file_utils.h>
+#include <openvino/util/file_util.hpp>
+
+#include <sys/stat.h>
+#include <sys/types.h>
+#ifdef _WIN32
+# include <sys/utime.h>
+#else
+# include <sys/time.h>
+#endif
+
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
 #include <memory>
+#include <random>
+#include <sstream>
+#include <vector>
 
 namespace MKLDNNPlugin {
 
@@ -70,6 +89,205 @@ MKLDNNWeightsSharing::MKLDNNSharedMemory::Ptr MKLDNNWeightsSharing::get(const st
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
+namespace {
+
+constexpr char STORED_MAGIC[8] = {'O', 'V', 'C', 'P', 'U', 'S', 'W', '1'};
+
+// The header of the stored file: the magic, the digest, the precision and the size of the data.
+// The layout string follows the header, the data starts at the next aligned offset.
+struct StoredHeader {
+    char magic[8];
+    uint64_t digest[2];
+    uint32_t precision;
+    uint32_t layoutSize;
+    uint64_t dataSize;
+};
+static_assert(sizeof(StoredHeader) == 40, "The header of the stored weights must be packed");
+
+constexpr size_t DATA_ALIGNMENT = 64;
+constexpr char STORED_EXT[] = ".bin";
+constexpr char TEMP_EXT[] = ".tmp";
+// The temporary files of the writers which crashed are removed after this time
+constexpr int64_t STALE_TEMP_FILE_AGE_S = 3600;
+
+size_t getDataOffset(const MKLDNNSharedWeightsStorage::DataInfo& info) {
+    return (sizeof(StoredHeader) + info.layout.size() + DATA_ALIGNMENT - 1) / DATA_ALIGNMENT * DATA_ALIGNMENT;
+}
+
+bool endsWith(const std::string& str, const std::string& suffix) {
+    return str.size() >= suffix.size() && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+// The size and the modification time in seconds since the epoch
+bool getFileInfo(const std::string& path, uint64_t& size, int64_t& time) {
+#ifdef _WIN32
+    struct _stat64 info;
+    if (_stat64(path.c_str(), &info) != 0)
+        return false;
+#else
+    struct stat info;
+    if (stat(path.c_str(), &info) != 0)
+        return false;
+#endif
+    size = static_cast<uint64_t>(info.st_size);
+    time = static_cast<int64_t>(info.st_mtime);
+    return true;
+}
+
+// Marks the file as recently used
+void touchFile(const std::string& path) {
+#ifdef _WIN32
+    _utime(path.c_str(), nullptr);
+#else
+    utimes(path.c_str(), nullptr);
+#endif
+}
+
+}  // namespace
+
+MKLDNNSharedWeightsStorage::MKLDNNSharedWeightsStorage(const std::string& directory, int numaNodeId)
+    : directory(directory)
+    , numaNodeId(numaNodeId) {
+    FileUtils::createDirectoryRecursive(directory);
+}
+
+std::string MKLDNNSharedWeightsStorage::filePath(const DataInfo& info) const {
+    std::stringstream name;
+    name << "numa" << numaNodeId << "_" << std::hex << std::setfill('0')
+         << std::setw(16) << info.digest[1] << std::setw(16) << info.digest[0] << STORED_EXT;
+    return FileUtils::makePath(directory, name.str());
+}
+
+std::shared_ptr<const void> MKLDNNSharedWeightsStorage::map(const std::string& path, const DataInfo& info) {
+    const auto offset = getDataOffset(info);
+    auto found = mappings.find(path);
+    if (found != mappings.end()) {
+        if (const auto mapped = found->second.lock())
+            return std::shared_ptr<const void>(mapped, mapped->data() + offset);
+        mappings.erase(found);
+    }
+
+    if (!FileUtils::fileExist(path))
+        return nullptr;
+
+    std::shared_ptr<ov::util::MappedMemory> mapped;
+    try {
+        mapped = ov::util::load_mmap_object(path, true);
+    } catch (const std::runtime_error&) {
+        return nullptr;
+    }
+    // the file may be written by another version of the plugin or truncated by a failed process
+    if (mapped->size() != offset + info.size)
+        return nullptr;
+    const auto header = reinterpret_cast<const StoredHeader*>(mapped->data());
+    if (!std::equal(std::begin(STORED_MAGIC), std::end(STORED_MAGIC), header->magic)
+        || header->digest[0] != info.digest[0] || header->digest[1] != info.digest[1]
+        || header->precision != static_cast<uint32_t>(info.precision)
+        || header->dataSize != info.size
+        || header->layoutSize != info.layout.size()
+        || info.layout.compare(0, info.layout.size(), mapped->data() + sizeof(StoredHeader), header->layoutSize) != 0)
+        return nullptr;
+
+    mappings[path] = mapped;
+    // the pointer to the data shares the ownership of the mapping
+    return std::shared_ptr<const void>(mapped, mapped->data() + offset);
+}
+
+std::shared_ptr<const void> MKLDNNSharedWeightsStorage::find(const DataInfo& info) {
+    std::lock_guard<std::mutex> lock(guard);
+    const auto path = filePath(info);
+    const auto data = map(path, info);
+    if (data)
+        touchFile(path);
+    return data;
+}
+
+std::shared_ptr<const void> MKLDNNSharedWeightsStorage::publish(const DataInfo& info, const void* data, uint64_t maxDirSize) {
+    std::lock_guard<std::mutex> lock(guard);
+    const auto path = filePath(info);
+    if (auto mapped = map(path, info))
+        return mapped;
+
+    StoredHeader header = {};
+    std::copy(std::begin(STORED_MAGIC), std::end(STORED_MAGIC), header.magic);
+    header.digest[0] = info.digest[0];
+    header.digest[1] = info.digest[1];
+    header.precision = static_cast<uint32_t>(info.precision);
+    header.layoutSize = static_cast<uint32_t>(info.layout.size());
+    header.dataSize = info.size;
+    const std::vector<char> padding(getDataOffset(info) - sizeof(StoredHeader) - info.layout.size(), 0);
+
+    // the data is written to a unique temporary file and renamed, so other processes never see a partial file
+    std::random_device random;
+    const auto tmpPath = path + "." + std::to_string(random()) + TEMP_EXT;
+    {
+        std::ofstream file(tmpPath, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(info.layout.data(), info.layout.size());
+        file.write(padding.data(), padding.size());
+        if (!file.write(static_cast<const char*>(data), info.size)) {
+            file.close();
+            std::remove(tmpPath.c_str());
+            return nullptr;
+        }
+    }
+    // rename fails on Windows if the file is already published by another process, its copy is used then
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0)
+        std::remove(tmpPath.c_str());
+
+    const auto mapped = map(path, info);
+    if (maxDirSize)
+        evict(maxDirSize);
+    return mapped;
+}
+
+void MKLDNNSharedWeightsStorage::evict(uint64_t maxDirSize) const {
+    struct Entry {
+        std::string path;
+        uint64_t size;
+        int64_t time;
+    };
+
+    // the files mapped by the processes stay valid after they are removed (the removal fails on Windows then),
+    // only the processes compiling the network later have to publish the data again
+    std::vector<Entry> entries;
+    uint64_t totalSize = 0;
+    const auto now = static_cast<int64_t>(std::time(nullptr));
+    try {
+        ov::util::iterate_files(
+            directory,
+            [&](const std::string& file, bool isDir) {
+                Entry entry{file, 0, 0};
+                if (isDir || !getFileInfo(file, entry.size, entry.time))
+                    return;
+                if (endsWith(file, STORED_EXT)) {
+                    totalSize += entry.size;
+                    entries.push_back(std::move(entry));
+                } else if (endsWith(file, TEMP_EXT) && now - entry.time > STALE_TEMP_FILE_AGE_S) {
+                    std::remove(file.c_str());
+                }
+            },
+            false,
+            false);
+    } catch (...) {
+        // the directory can't be listed, nothing is evicted
+        return;
+    }
+    if (totalSize <= maxDirSize)
+        return;
+
+    // concurrent evictions of several processes may remove more files than needed
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        return a.time < b.time || (a.time == b.time && a.path < b.path);
+    });
+    for (const auto& entry : entries) {
+        if (totalSize <= maxDirSize)
+            break;
+        if (std::remove(entry.path.c_str()) == 0)
+            totalSize -= entry.size;
+    }
+}
+
 NumaNodesWeights::NumaNodesWeights() {
     for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
         _cache_map[numa_id] = std::make_shared<MKLDNNWeightsSharing>();
@@ -89,4 +307,12 @@ const MKLDNNWeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) const
     return found->second;
 }
 
+MKLDNNSharedWeightsStorage::Ptr NumaNodesWeights::getSharedStorage(int numa_id, const std::string& directory) {
+    std::lock_guard<std::mutex> lock(_storage_guard);
+    auto& storage = _storage_map[{numa_id, directory}];
+    if (!storage)
+        storage = std::make_shared<MKLDNNSharedWeightsStorage>(directory, numa_id);
+    return storage;
+}
+
 }  // namespace MKLDNNPlugin
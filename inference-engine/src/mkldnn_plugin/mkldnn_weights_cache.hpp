@@ -5,14 +5,17 @@
 #pragma once
 
 #include <mkldnn_memory.h>
+#include <openvino/util/mmap_object.hpp>
 
 #include <unordered_map>
+#include <array>
 #include <functional>
 #include <string>
 #include <memory>
 #include <atomic>
 #include <mutex>
 #include <map>
+#include <utility>
 
 // TODO: While CPU plugin has no ease way to clone graph object we use weight
 //       caching in global Engine context to avoid tensor memory duplication.
@@ -101,6 +104,64 @@ protected:
     static const SimpleDataHash simpleCRC;
 };
 
+/**
+ * File backed store of reordered weights shared between processes of one host
+ * The first process compiling a network publishes the weights to the directory, the other
+ * processes map the published files instead of keeping own copies of the same data.
+ * Since the files are mapped read-only, all the processes use the same pages of the page cache
+ * (the directory is expected to be on tmpfs, e.g. /dev/shm, to avoid disk IO).
+ * Each NUMA node has own files, so the weights are local to the node.
+ *
+ * Every file starts with a header describing the data, the header and the size of the file are
+ * checked before the data is used. The least recently used files are evicted if the size of
+ * the directory is limited.
+ *
+ * Is a thread safe
+ */
+class MKLDNNSharedWeightsStorage {
+public:
+    typedef std::shared_ptr<MKLDNNSharedWeightsStorage> Ptr;
+
+    /**
+     * Identity of the stored data
+     */
+    struct DataInfo {
+        // 128-bit digest of the content the data is computed from and of its memory descriptor
+        std::array<uint64_t, 2> digest;
+        InferenceEngine::Precision precision;
+        // serialized format and dimensions of the data
+        std::string layout;
+        size_t size;
+    };
+
+    MKLDNNSharedWeightsStorage(const std::string& directory, int numaNodeId);
+
+    /**
+     * @return pointer to the mapped data or nullptr if there is no data matching the info,
+     * the file stays mapped while the pointer or its copies are alive
+     */
+    std::shared_ptr<const void> find(const DataInfo& info);
+
+    /**
+     * Stores the data, the data stored by another process has a priority
+     * @param maxDirSize the least recently used files are removed until the directory fits the size, 0 means no limit
+     * @return pointer to the mapped copy of the stored data or nullptr if the data can't be stored,
+     * the file stays mapped while the pointer or its copies are alive
+     */
+    std::shared_ptr<const void> publish(const DataInfo& info, const void* data, uint64_t maxDirSize = 0);
+
+private:
+    std::string filePath(const DataInfo& info) const;
+    std::shared_ptr<const void> map(const std::string& path, const DataInfo& info);
+    void evict(uint64_t maxDirSize) const;
+
+    std::mutex guard;
+    std::string directory;
+    int numaNodeId;
+    // the mappings are owned by their users, so the files are unmapped once no graph refers them
+    std::unordered_map<std::string, std::weak_ptr<ov::util::MappedMemory>> mappings;
+};
+
 /**
  * Collection of memory caching store per NUMA node(former socket)
  *
@@ -113,8 +174,15 @@ public:
     MKLDNNWeightsSharing::Ptr& operator[](int i);
     const MKLDNNWeightsSharing::Ptr& operator[](int i) const;
 
+    /**
+     * @return shared weights storage of the NUMA node in the directory, created on the first call
+     */
+    MKLDNNSharedWeightsStorage::Ptr getSharedStorage(int numa_id, const std::string& directory);
+
 private:
     std::map<int, MKLDNNWeightsSharing::Ptr> _cache_map;
+    std::mutex _storage_guard;
+    std::map<std::pair<int, std::string>, MKLDNNSharedWeightsStorage::Ptr> _storage_map;
 };
 
 }  // namespace MKLDNNPlugin
@@ -0,0 +1,192 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "color_convert_fusion.hpp"
+#include "op/color_convert.hpp"
+#include <algorithm>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/opsets/opset4.hpp>
+#include <ngraph/opsets/opset8.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::ColorConvertFusion, "ColorConvertFusion", 0);
+
+namespace {
+
+using ColorAttrs = MKLDNNPlugin::ColorConvertNode::Attributes;
+using ResizeMode = MKLDNNPlugin::ColorConvertNode::ResizeMode;
+
+bool hasSingleConsumer(const std::shared_ptr<ngraph::Node>& node) {
+    return node->get_output_size() == 1 && node->get_output_target_inputs(0).size() == 1;
+}
+
+// The values of the f32 constant on the port per output channel, if it is the scalar or it is broadcast along
+// the channels axis only
+bool getPerChannel(const std::shared_ptr<ngraph::Node>& node, size_t port, size_t channelsAxis, std::vector<float>& values) {
+    auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(node->get_input_node_shared_ptr(port));
+    if (!constant || constant->get_element_type() != ngraph::element::f32)
+        return false;
+    const auto shape = constant->get_shape();
+    const auto data = constant->cast_vector<float>();
+    if (ngraph::shape_size(shape) == 1 && shape.size() <= 4) {
+        values.assign(3, data[0]);
+        return true;
+    }
+    if (shape.size() > 4 || ngraph::shape_size(shape) != 3)
+        return false;
+    // the constant is aligned to the 4D output by the last axes
+    if (channelsAxis < 4 - shape.size() || shape[channelsAxis - (4 - shape.size())] != 3)
+        return false;
+    values = data;
+    return true;
+}
+
+// Applies y = x (op) c to the scale and the shift accumulated so far
+bool fuseEltwise(const std::shared_ptr<ngraph::Node>& node, const std::shared_ptr<ngraph::Node>& prev, ColorAttrs& attrs) {
+    const size_t dataPort = node->get_input_node_shared_ptr(0) == prev ? 0 : 1;
+    const size_t constPort = 1 - dataPort;
+    const size_t channelsAxis = attrs.planar ? 1 : 3;
+    std::vector<float> values;
+    if (!getPerChannel(node, constPort, channelsAxis, values))
+        return false;
+
+    if (ngraph::is_type<ngraph::opset1::Multiply>(node)) {
+        for (size_t c = 0; c < 3; c++) {
+            attrs.scales[c] *= values[c];
+            attrs.shifts[c] *= values[c];
+        }
+    } else if (ngraph::is_type<ngraph::opset1::Add>(node)) {
+        for (size_t c = 0; c < 3; c++)
+            attrs.shifts[c] += values[c];
+    } else if (ngraph::is_type<ngraph::opset1::Subtract>(node) && dataPort == 0) {
+        for (size_t c = 0; c < 3; c++)
+            attrs.shifts[c] -= values[c];
+    } else if (ngraph::is_type<ngraph::opset1::Divide>(node) && dataPort == 0) {
+        for (size_t c = 0; c < 3; c++) {
+            if (values[c] == 0.f)
+                return false;
+            attrs.scales[c] /= values[c];
+            attrs.shifts[c] /= values[c];
+        }
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// The resize commutes with the per-channel scale and shift, so it is fused wherever it is in the chain
+bool fuseInterpolate(const std::shared_ptr<ngraph::opset4::Interpolate>& interp, ColorAttrs& attrs) {
+    using InterpolateMode = ngraph::opset4::Interpolate::InterpolateMode;
+    const auto& interpAttrs = interp->get_attrs();
+    if (interpAttrs.mode != InterpolateMode::NEAREST && interpAttrs.mode != InterpolateMode::LINEAR &&
+        interpAttrs.mode != InterpolateMode::LINEAR_ONNX)
+        return false;
+    if (interpAttrs.shape_calculation_mode != ngraph::opset4::Interpolate::ShapeCalcMode::SIZES ||
+        interpAttrs.coordinate_transformation_mode != ngraph::opset4::Interpolate::CoordinateTransformMode::HALF_PIXEL ||
+        interpAttrs.antialias)
+        return false;
+    if (interpAttrs.mode == InterpolateMode::NEAREST && interpAttrs.nearest_mode != ngraph::opset4::Interpolate::NearestMode::ROUND_PREFER_FLOOR)
+        return false;
+    auto isZero = [](size_t v) { return v == 0; };
+    if (!std::all_of(interpAttrs.pads_begin.begin(), interpAttrs.pads_begin.end(), isZero) ||
+        !std::all_of(interpAttrs.pads_end.begin(), interpAttrs.pads_end.end(), isZero))
+        return false;
+
+    const auto inShape = interp->get_input_shape(0);
+    const auto outShape = interp->get_output_shape(0);
+    const size_t heightAxis = attrs.planar ? 2 : 1;
+    const size_t widthAxis = attrs.planar ? 3 : 2;
+    for (size_t i = 0; i < 4; i++) {
+        if (i != heightAxis && i != widthAxis && inShape[i] != outShape[i])
+            return false;
+    }
+    attrs.resize_mode = interpAttrs.mode == InterpolateMode::NEAREST ? ResizeMode::NEAREST : ResizeMode::LINEAR;
+    attrs.out_height = outShape[heightAxis];
+    attrs.out_width = outShape[widthAxis];
+    return true;
+}
+
+bool isNHWCToNCHW(const std::shared_ptr<ngraph::Node>& transpose) {
+    auto order = std::dynamic_pointer_cast<ngraph::opset1::Constant>(transpose->get_input_node_shared_ptr(1));
+    return order && order->cast_vector<int64_t>() == std::vector<int64_t>{0, 3, 1, 2};
+}
+
+}  // namespace
+
+MKLDNNPlugin::ColorConvertFusion::ColorConvertFusion() {
+    auto m_color = ngraph::pattern::wrap_type<ngraph::opset8::NV12toRGB, ngraph::opset8::NV12toBGR,
+                                              ngraph::opset8::I420toRGB, ngraph::opset8::I420toBGR>(ngraph::pattern::has_static_shape());
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher &m) {
+        auto color = m.get_match_root();
+        const auto type = color->get_element_type();
+        if (type != ngraph::element::u8 && type != ngraph::element::f32)
+            return false;
+
+        ColorAttrs attrs;
+        attrs.i420 = ngraph::is_type<ngraph::opset8::I420toRGB>(color) || ngraph::is_type<ngraph::opset8::I420toBGR>(color);
+        attrs.bgr = ngraph::is_type<ngraph::opset8::NV12toBGR>(color) || ngraph::is_type<ngraph::opset8::I420toBGR>(color);
+        attrs.truncate = type == ngraph::element::u8;
+        attrs.output_type = type;
+
+        ngraph::NodeVector fused = {color};
+        ngraph::OutputVector planes = color->input_values();
+        // u8 planes converted to f32 are read as is
+        if (type == ngraph::element::f32) {
+            const bool fromU8 = std::all_of(planes.begin(), planes.end(), [](const ngraph::Output<ngraph::Node>& plane) {
+                auto convert = ngraph::as_type_ptr<ngraph::opset1::Convert>(plane.get_node_shared_ptr());
+                return convert && convert->get_input_element_type(0) == ngraph::element::u8 && hasSingleConsumer(convert);
+            });
+            if (fromU8) {
+                for (auto& plane : planes) {
+                    fused.push_back(plane.get_node_shared_ptr());
+                    plane = plane.get_node()->input_value(0);
+                }
+            }
+        }
+
+        std::shared_ptr<ngraph::Node> last = color;
+        while (hasSingleConsumer(last)) {
+            auto next = last->get_output_target_inputs(0).begin()->get_node()->shared_from_this();
+            if (next->get_output_partial_shape(0).is_dynamic())
+                break;
+
+            bool absorbed = false;
+            if (auto convert = ngraph::as_type_ptr<ngraph::opset1::Convert>(next)) {
+                absorbed = attrs.output_type == ngraph::element::u8 && convert->get_destination_type() == ngraph::element::f32;
+                if (absorbed)
+                    attrs.output_type = ngraph::element::f32;
+            } else if (ngraph::is_type<ngraph::opset1::Multiply>(next) || ngraph::is_type<ngraph::opset1::Add>(next) ||
+                       ngraph::is_type<ngraph::opset1::Subtract>(next) || ngraph::is_type<ngraph::opset1::Divide>(next)) {
+                absorbed = attrs.output_type == ngraph::element::f32 && next->get_output_shape(0) == last->get_output_shape(0) &&
+                           fuseEltwise(next, last, attrs);
+            } else if (auto interp = ngraph::as_type_ptr<ngraph::opset4::Interpolate>(next)) {
+                absorbed = attrs.output_type == ngraph::element::f32 && attrs.resize_mode == ResizeMode::NONE &&
+                           next->get_input_node_shared_ptr(0) == last && fuseInterpolate(interp, attrs);
+            } else if (ngraph::is_type<ngraph::opset1::Transpose>(next)) {
+                absorbed = !attrs.planar && next->get_input_node_shared_ptr(0) == last && isNHWCToNCHW(next);
+                if (absorbed)
+                    attrs.planar = true;
+            }
+            if (!absorbed)
+                break;
+            fused.push_back(next);
+            last = next;
+        }
+
+        auto colorConvert = std::make_shared<MKLDNNPlugin::ColorConvertNode>(planes, attrs);
+        if (colorConvert->get_output_shape(0) != last->get_output_shape(0) ||
+            colorConvert->get_output_element_type(0) != last->get_output_element_type(0))
+            return false;
+
+        colorConvert->set_friendly_name(last->get_friendly_name());
+        ngraph::copy_runtime_info(fused, colorConvert);
+        ngraph::replace_node(last, colorConvert);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(m_color, "ColorConvertFusion");
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,23 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/*
+ * Replaces NV12toRGB/NV12toBGR/I420toRGB/I420toBGR with ColorConvert absorbing the preprocessing which follows:
+ * u8 -> f32 Convert, Multiply/Add/Subtract/Divide by the scalar or per-channel constants, half-pixel linear or
+ * nearest Interpolate of the height and width, and NHWC -> NCHW Transpose. The u8 -> f32 Converts of the planes are
+ * absorbed as well, so the frame is read once and the network input is written once.
+ */
+class ColorConvertFusion : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    ColorConvertFusion();
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,86 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "compress_fc_weights.hpp"
+#include "op/fully_connected.hpp"
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <ngraph/pattern/op/or.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::CompressFullyConnectedWeights, "CompressFullyConnectedWeights", 0);
+
+MKLDNNPlugin::CompressFullyConnectedWeights::CompressFullyConnectedWeights(const ngraph::element::Type& weightsPrecision) {
+    auto weights = ngraph::pattern::wrap_type<ngraph::opset1::Constant>(ngraph::pattern::type_matches(ngraph::element::f32));
+    auto fc = ngraph::pattern::wrap_type<MKLDNNPlugin::FullyConnectedNode>({ngraph::pattern::any_input(), weights});
+    auto fcWithBias = ngraph::pattern::wrap_type<MKLDNNPlugin::FullyConnectedNode>({ngraph::pattern::any_input(), weights,
+                                                                                    ngraph::pattern::any_input()});
+    const auto fcTwoOrThreeInputs = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{fc, fcWithBias});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        auto fcNode = std::dynamic_pointer_cast<MKLDNNPlugin::FullyConnectedNode>(m.get_match_root());
+        if (!fcNode || transformation_callback(fcNode))
+            return false;
+
+        auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(fcNode->get_input_node_shared_ptr(1));
+        // the weights shared with other consumers would be kept uncompressed anyway
+        if (!constant || constant->get_shape().size() != 2 || constant->get_output_target_inputs(0).size() != 1 ||
+            fcNode->get_input_element_type(0) != ngraph::element::f32)
+            return false;
+
+        const auto& shape = constant->get_shape();
+        const auto outputChannels = shape[0];
+        const auto channelSize = shape[1];
+        const auto data = constant->get_data_ptr<float>();
+
+        std::shared_ptr<ngraph::opset1::Constant> compressed;
+        std::shared_ptr<ngraph::opset1::Constant> scales;
+        if (weightsPrecision == ngraph::element::f16) {
+            std::vector<ngraph::float16> values(data, data + ngraph::shape_size(shape));
+            compressed = std::make_shared<ngraph::opset1::Constant>(ngraph::element::f16, shape, values.data());
+        } else if (weightsPrecision == ngraph::element::i8) {
+            std::vector<int8_t> values(ngraph::shape_size(shape));
+            std::vector<float> channelScales(outputChannels);
+            for (size_t oc = 0; oc < outputChannels; oc++) {
+                const auto channel = data + oc * channelSize;
+                float absMax = 0.f;
+                for (size_t i = 0; i < channelSize; i++)
+                    absMax = std::max(absMax, std::abs(channel[i]));
+                const float scale = absMax > 0.f ? absMax / 127.f : 1.f;
+                for (size_t i = 0; i < channelSize; i++)
+                    values[oc * channelSize + i] = static_cast<int8_t>(std::lround(channel[i] / scale));
+                channelScales[oc] = scale;
+            }
+            compressed = std::make_shared<ngraph::opset1::Constant>(ngraph::element::i8, shape, values.data());
+            scales = std::make_shared<ngraph::opset1::Constant>(ngraph::element::f32, ngraph::Shape{outputChannels, 1}, channelScales.data());
+        } else {
+            return false;
+        }
+
+        ngraph::NodeVector newNodes = {compressed};
+        std::shared_ptr<ngraph::Node> decompressed = std::make_shared<ngraph::opset1::Convert>(compressed, ngraph::element::f32);
+        ov::disable_constant_folding(decompressed);
+        newNodes.push_back(decompressed);
+        if (scales) {
+            decompressed = std::make_shared<ngraph::opset1::Multiply>(decompressed, scales);
+            ov::disable_constant_folding(decompressed);
+            newNodes.push_back(scales);
+            newNodes.push_back(decompressed);
+        }
+
+        compressed->set_friendly_name(constant->get_friendly_name());
+        decompressed->set_friendly_name(constant->get_friendly_name() + "/Decompression");
+        ngraph::copy_runtime_info(constant, newNodes);
+        fcNode->input(1).replace_source_output(decompressed);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(fcTwoOrThreeInputs, "CompressFullyConnectedWeights");
+    this->register_matcher(m, callback);
+}
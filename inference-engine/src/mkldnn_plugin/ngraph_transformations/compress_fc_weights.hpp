@@ -0,0 +1,27 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+/*
+ * Description:
+ *     CompressFullyConnectedWeights transformation replaces FP32 constant weights of FullyConnected operations
+ *     with the weights of lower precision followed by the decompression subgraph:
+ *         FP16: Constant(f16) -> Convert(f32) -> FullyConnected
+ *         I8:   Constant(i8) -> Convert(f32) -> Multiply(per output channel scales) -> FullyConnected
+ *     Constant folding is disabled for the decompression subgraph, so the weights are kept compressed
+ *     and the decompression is fused into FullyConnected node by the CPU graph optimizer.
+ */
+
+namespace MKLDNNPlugin {
+
+class CompressFullyConnectedWeights: public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    explicit CompressFullyConnectedWeights(const ngraph::element::Type& weightsPrecision);
+};
+
+}  // namespace MKLDNNPlugin
@@ -15,18 +15,26 @@
 #include "convert_to_swish_cpu.hpp"
 #include "reshape_prelu.hpp"
 #include "rnn_sequences_optimization.hpp"
+#include "compress_fc_weights.hpp"
+#include "sdpa_fusion.hpp"
+#include "kv_cache_fusion.hpp"
+#include "color_convert_fusion.hpp"
 
 namespace MKLDNNPlugin {
 
-inline void ConvertToCPUSpecificOpset(std::shared_ptr<ngraph::Function> &nGraphFunc) {
+inline void ConvertToCPUSpecificOpset(std::shared_ptr<ngraph::Function> &nGraphFunc,
+                                      const ngraph::element::Type& fcWeightsPrecision = ngraph::element::f32) {
     ngraph::pass::Manager manager;
     manager.register_pass<ngraph::pass::ConstantFolding>();
+    manager.register_pass<KVCacheFusion>();
+    manager.register_pass<ColorConvertFusion>();
     manager.register_pass<Reshape1DConvolution>();
     manager.register_pass<Reshape1DGroupConvolution>();
     manager.register_pass<Reshape1DAvgPool>();
     manager.register_pass<Reshape1DMaxPool>();
     manager.register_pass<ConvertBroadcastToTiles>();
     manager.register_pass<ConvertTileToSeqTiles>();
+    manager.register_pass<ScaledDotProductAttentionFusion>();
     manager.register_pass<ConvertMatMulToFC>();
     manager.register_pass<ConvertMatMulToGemm>();
     manager.register_pass<FullyConnectedBiasFusion>();
@@ -42,6 +50,11 @@ inline void ConvertToCPUSpecificOpset(std::shared_ptr<ngraph::Function> &nGraphF
         manager.register_pass<ReshapeFullyConnectedFusion>();
     }
     manager.register_pass<ngraph::pass::ConstantFolding>();
+    // the weights are compressed once they are folded (e.g. the transposed ones), but before the precisions are
+    // converted: the decompression subgraph must reach the graph as is
+    if (fcWeightsPrecision != ngraph::element::f32) {
+        manager.register_pass<CompressFullyConnectedWeights>(fcWeightsPrecision);
+    }
     manager.register_pass<ngraph::pass::ConvertPrecision>(precisions_array {{ ngraph::element::i64, ngraph::element::i32 }});
     manager.run_passes(nGraphFunc);
 }
@@ -0,0 +1,94 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "kv_cache_fusion.hpp"
+#include "op/kv_cache.hpp"
+#include <algorithm>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/op/assign.hpp>
+#include <ngraph/op/read_value.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/validation_util.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::KVCacheFusion, "KVCacheFusion", 0);
+
+namespace {
+
+bool isMaskSet(const std::vector<int64_t>& mask, size_t axis) {
+    return axis < mask.size() && mask[axis] == 1;
+}
+
+bool isAnyMaskSet(const std::vector<int64_t>& mask) {
+    return std::any_of(mask.begin(), mask.end(), [](int64_t value) { return value == 1; });
+}
+
+// Whether the slice takes the rows [offset, offset + length of the output) along the axis and the other axes as they are
+bool isSliceAlongAxis(const std::shared_ptr<ngraph::opset1::StridedSlice>& slice, size_t axis, int64_t offset) {
+    if (isAnyMaskSet(slice->get_new_axis_mask()) || isAnyMaskSet(slice->get_shrink_axis_mask()) || isAnyMaskSet(slice->get_ellipsis_mask()))
+        return false;
+
+    auto begin = std::dynamic_pointer_cast<ngraph::opset1::Constant>(slice->get_input_node_shared_ptr(1));
+    auto strides = std::dynamic_pointer_cast<ngraph::opset1::Constant>(slice->get_input_node_shared_ptr(3));
+    if (!begin || !strides || isMaskSet(slice->get_begin_mask(), axis))
+        return false;
+    const auto stridesValues = strides->cast_vector<int64_t>();
+    if (std::any_of(stridesValues.begin(), stridesValues.end(), [](int64_t value) { return value != 1; }))
+        return false;
+    const auto beginValues = begin->cast_vector<int64_t>();
+    if (axis >= beginValues.size())
+        return false;
+
+    // the slice with the unit strides keeping the size of the other axes takes them as is
+    const auto inShape = slice->get_input_shape(0);
+    const auto outShape = slice->get_output_shape(0);
+    for (size_t i = 0; i < inShape.size(); i++) {
+        if (i != axis && inShape[i] != outShape[i])
+            return false;
+    }
+    const int64_t first = beginValues[axis] < 0 ? beginValues[axis] + static_cast<int64_t>(inShape[axis]) : beginValues[axis];
+    return first == offset;
+}
+
+}  // namespace
+
+bool MKLDNNPlugin::KVCacheFusion::run_on_function(std::shared_ptr<ngraph::Function> f) {
+    bool rewritten = false;
+    for (const auto& node : f->get_ordered_ops()) {
+        auto assign = std::dynamic_pointer_cast<ngraph::op::AssignBase>(node);
+        if (!assign)
+            continue;
+
+        auto slice = std::dynamic_pointer_cast<ngraph::opset1::StridedSlice>(assign->get_input_node_shared_ptr(0));
+        if (!slice || slice->get_output_partial_shape(0).is_dynamic() || slice->get_output_target_inputs(0).size() != 1)
+            continue;
+        auto concat = std::dynamic_pointer_cast<ngraph::opset1::Concat>(slice->get_input_node_shared_ptr(0));
+        if (!concat || concat->get_input_size() != 2 || concat->get_output_partial_shape(0).is_dynamic())
+            continue;
+        auto readValue = std::dynamic_pointer_cast<ngraph::op::ReadValueBase>(concat->get_input_node_shared_ptr(0));
+        if (!readValue || readValue->get_variable_id() != assign->get_variable_id() || readValue->get_output_target_inputs(0).size() != 1)
+            continue;
+        const auto data = concat->input_value(1);
+        if (ngraph::is_type<ngraph::opset1::Constant>(data.get_node()))
+            continue;
+
+        const auto stateShape = readValue->get_output_shape(0);
+        const auto axis = ngraph::normalize_axis(concat.get(), concat->get_axis(), concat->get_output_partial_shape(0).rank());
+        const auto appended = data.get_shape()[axis];
+        if (slice->get_output_shape(0) != stateShape || !isSliceAlongAxis(slice, axis, static_cast<int64_t>(appended)))
+            continue;
+
+        auto kvCache = std::make_shared<MKLDNNPlugin::KVCacheNode>(data, assign->get_variable_id(), stateShape, static_cast<int64_t>(axis));
+        kvCache->set_friendly_name(concat->get_friendly_name());
+        ngraph::copy_runtime_info({readValue, concat, slice, assign}, kvCache);
+        ngraph::replace_node(concat, kvCache);
+
+        // the state is kept by KVCache, so the variable isn't read and assigned by the separate operations anymore
+        assign->clear_control_dependents();
+        assign->clear_control_dependencies();
+        readValue->clear_control_dependents();
+        f->remove_sink(std::dynamic_pointer_cast<ngraph::op::Sink>(assign));
+        rewritten = true;
+    }
+    return rewritten;
+}
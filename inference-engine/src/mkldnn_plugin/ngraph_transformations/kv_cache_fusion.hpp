@@ -0,0 +1,21 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/pass.hpp>
+
+namespace MKLDNNPlugin {
+
+/*
+ * Fuses ReadValue -> Concat(state, input) -> StridedSlice(the last rows of the state length) -> Assign on the same
+ * variable into KVCache, so the state is appended by the input in place instead of being copied by every inference.
+ */
+class KVCacheFusion : public ngraph::pass::FunctionPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,66 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "color_convert.hpp"
+
+constexpr ngraph::NodeTypeInfo MKLDNNPlugin::ColorConvertNode::type_info;
+
+MKLDNNPlugin::ColorConvertNode::ColorConvertNode(const ngraph::OutputVector &planes, const Attributes &attrs)
+    : Op(planes), m_attrs(attrs) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> MKLDNNPlugin::ColorConvertNode::clone_with_new_inputs(const ngraph::OutputVector &new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<MKLDNNPlugin::ColorConvertNode>(new_args, m_attrs);
+}
+
+void MKLDNNPlugin::ColorConvertNode::validate_and_infer_types() {
+    const size_t planes = get_input_size();
+    NODE_VALIDATION_CHECK(this, planes == 1 || planes == (m_attrs.i420 ? 3 : 2), "Unexpected number of the planes: ", planes);
+    NODE_VALIDATION_CHECK(this, m_attrs.scales.size() == 3 && m_attrs.shifts.size() == 3, "Scales and shifts are expected per channel");
+    for (size_t i = 0; i < planes; i++) {
+        if (get_input_partial_shape(i).is_dynamic()) {
+            set_output_type(0, m_attrs.output_type, ngraph::PartialShape::dynamic(4));
+            return;
+        }
+        NODE_VALIDATION_CHECK(this, get_input_shape(i).size() == 4, "The planes are expected to be 4D NHWC tensors");
+    }
+
+    const auto y = get_input_shape(0);
+    NODE_VALIDATION_CHECK(this, y[3] == 1, "Y plane is expected to have 1 channel");
+    const size_t height = planes == 1 ? y[1] * 2 / 3 : y[1];
+    const size_t width = y[2];
+    NODE_VALIDATION_CHECK(this, height % 2 == 0 && width % 2 == 0 && (planes > 1 || y[1] % 3 == 0),
+                          "Image height and width are expected to be even");
+    for (size_t i = 1; i < planes; i++) {
+        const auto uv = get_input_shape(i);
+        NODE_VALIDATION_CHECK(this, uv[0] == y[0] && uv[1] == height / 2 && uv[2] == width / 2 && uv[3] == (m_attrs.i420 ? 1 : 2),
+                              "Chroma plane shape ", uv, " doesn't match to the image shape");
+    }
+
+    const size_t out_height = m_attrs.resize_mode == ResizeMode::NONE ? height : m_attrs.out_height;
+    const size_t out_width = m_attrs.resize_mode == ResizeMode::NONE ? width : m_attrs.out_width;
+    NODE_VALIDATION_CHECK(this, out_height > 0 && out_width > 0, "Output image is empty");
+    const ngraph::Shape out = m_attrs.planar ? ngraph::Shape{y[0], 3, out_height, out_width} : ngraph::Shape{y[0], out_height, out_width, 3};
+    set_output_type(0, m_attrs.output_type, out);
+}
+
+bool MKLDNNPlugin::ColorConvertNode::visit_attributes(ngraph::AttributeVisitor &visitor) {
+    std::string resize_mode = m_attrs.resize_mode == ResizeMode::NEAREST ? "nearest" :
+                              m_attrs.resize_mode == ResizeMode::LINEAR ? "linear" : "none";
+    visitor.on_attribute("i420", m_attrs.i420);
+    visitor.on_attribute("bgr", m_attrs.bgr);
+    visitor.on_attribute("truncate", m_attrs.truncate);
+    visitor.on_attribute("resize_mode", resize_mode);
+    visitor.on_attribute("out_height", m_attrs.out_height);
+    visitor.on_attribute("out_width", m_attrs.out_width);
+    visitor.on_attribute("scales", m_attrs.scales);
+    visitor.on_attribute("shifts", m_attrs.shifts);
+    visitor.on_attribute("planar", m_attrs.planar);
+    visitor.on_attribute("out-type", m_attrs.output_type);
+    m_attrs.resize_mode = resize_mode == "nearest" ? ResizeMode::NEAREST :
+                          resize_mode == "linear" ? ResizeMode::LINEAR : ResizeMode::NONE;
+    return true;
+}
@@ -0,0 +1,58 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <vector>
+#include <ngraph/op/op.hpp>
+
+namespace MKLDNNPlugin {
+
+/*
+ * NV12/I420 to RGB/BGR conversion followed by the optional resize of the image, the per-channel scale and shift
+ * y = x * scale + shift, and the conversion of the NHWC image to NCHW. The inputs are the planes as of the color
+ * conversion operations: the single plane, Y and UV planes of NV12 or Y, U and V planes of I420.
+ */
+class ColorConvertNode : public ngraph::op::Op {
+public:
+    static constexpr ngraph::NodeTypeInfo type_info{"ColorConvert", 0};
+    static constexpr const ::ngraph::Node::type_info_t& get_type_info_static() { return type_info; }
+    const ngraph::NodeTypeInfo& get_type_info() const override { return type_info; }
+
+    enum class ResizeMode { NONE, NEAREST, LINEAR };
+
+    struct Attributes {
+        bool i420 = false;
+        bool bgr = false;
+        // the converted values are truncated to integers as by the color conversion of the integral type
+        bool truncate = false;
+        // the half-pixel resize to out_height x out_width
+        ResizeMode resize_mode = ResizeMode::NONE;
+        size_t out_height = 0;
+        size_t out_width = 0;
+        // per output channel
+        std::vector<float> scales = {1.f, 1.f, 1.f};
+        std::vector<float> shifts = {0.f, 0.f, 0.f};
+        // NCHW output instead of NHWC
+        bool planar = false;
+        ngraph::element::Type output_type = ngraph::element::f32;
+    };
+
+    ColorConvertNode() = default;
+
+    ColorConvertNode(const ngraph::OutputVector &planes, const Attributes &attrs);
+
+    void validate_and_infer_types() override;
+
+    bool visit_attributes(ngraph::AttributeVisitor &visitor) override;
+
+    std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector &new_args) const override;
+
+    const Attributes& get_attrs() const { return m_attrs; }
+
+private:
+    Attributes m_attrs;
+};
+
+}  // namespace MKLDNNPlugin
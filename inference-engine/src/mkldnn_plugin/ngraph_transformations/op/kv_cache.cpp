@@ -0,0 +1,48 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "kv_cache.hpp"
+
+constexpr ngraph::NodeTypeInfo MKLDNNPlugin::KVCacheNode::type_info;
+
+MKLDNNPlugin::KVCacheNode::KVCacheNode(const ngraph::Output<Node> &data,
+                                       const std::string &variable_id,
+                                       const ngraph::Shape &state_shape,
+                                       int64_t axis)
+    : Op({data}), m_variable_id(variable_id), m_state_shape(state_shape), m_axis(axis) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> MKLDNNPlugin::KVCacheNode::clone_with_new_inputs(const ngraph::OutputVector &new_args) const {
+    check_new_args_count(this, new_args);
+    return std::make_shared<MKLDNNPlugin::KVCacheNode>(new_args.at(0), m_variable_id, m_state_shape, m_axis);
+}
+
+void MKLDNNPlugin::KVCacheNode::validate_and_infer_types() {
+    const auto& data_shape = get_input_partial_shape(0);
+    if (data_shape.is_dynamic()) {
+        set_output_type(0, get_input_element_type(0), ngraph::PartialShape::dynamic());
+        return;
+    }
+
+    const auto data = data_shape.to_shape();
+    const size_t rank = m_state_shape.size();
+    NODE_VALIDATION_CHECK(this, m_axis >= 0 && static_cast<size_t>(m_axis) < rank, "Axis is out of the rank of the state");
+    NODE_VALIDATION_CHECK(this, data.size() == rank, "The input and the state are expected to have the same rank");
+    for (size_t i = 0; i < rank; i++) {
+        NODE_VALIDATION_CHECK(this, i == static_cast<size_t>(m_axis) || data[i] == m_state_shape[i],
+                              "The input and the state have incompatible shapes");
+    }
+
+    ngraph::Shape out = m_state_shape;
+    out[m_axis] += data[m_axis];
+    set_output_type(0, get_input_element_type(0), out);
+}
+
+bool MKLDNNPlugin::KVCacheNode::visit_attributes(ngraph::AttributeVisitor &visitor) {
+    visitor.on_attribute("variable_id", m_variable_id);
+    visitor.on_attribute("state_shape", m_state_shape);
+    visitor.on_attribute("axis", m_axis);
+    return true;
+}
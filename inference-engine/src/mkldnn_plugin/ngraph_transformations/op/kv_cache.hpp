@@ -0,0 +1,44 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+
+namespace MKLDNNPlugin {
+
+/*
+ * The concatenation of the variable state and the input along the axis, the state is the last rows of the concatenation
+ * for the next inference. It is ReadValue -> Concat -> StridedSlice -> Assign on the same variable.
+ */
+class KVCacheNode : public ngraph::op::Op {
+public:
+    static constexpr ngraph::NodeTypeInfo type_info{"KVCache", 0};
+    static constexpr const ::ngraph::Node::type_info_t& get_type_info_static() { return type_info; }
+    const ngraph::NodeTypeInfo& get_type_info() const override { return type_info; }
+
+    KVCacheNode() = default;
+
+    KVCacheNode(const ngraph::Output<ngraph::Node> &data,
+                const std::string &variable_id,
+                const ngraph::Shape &state_shape,
+                int64_t axis);
+
+    void validate_and_infer_types() override;
+
+    bool visit_attributes(ngraph::AttributeVisitor &visitor) override;
+
+    std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector &new_args) const override;
+
+    const std::string& get_variable_id() const { return m_variable_id; }
+    const ngraph::Shape& get_state_shape() const { return m_state_shape; }
+    int64_t get_axis() const { return m_axis; }
+
+private:
+    std::string m_variable_id;
+    ngraph::Shape m_state_shape;
+    int64_t m_axis = 0;
+};
+
+}  // namespace MKLDNNPlugin
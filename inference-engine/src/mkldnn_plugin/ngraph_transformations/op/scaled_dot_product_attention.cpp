@@ -0,0 +1,74 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scaled_dot_product_attention.hpp"
+
+#include <algorithm>
+
+constexpr ngraph::NodeTypeInfo MKLDNNPlugin::ScaledDotProductAttentionNode::type_info;
+
+MKLDNNPlugin::ScaledDotProductAttentionNode::ScaledDotProductAttentionNode(const ngraph::Output<Node> &q,
+                                                                           const ngraph::Output<Node> &k,
+                                                                           const ngraph::Output<Node> &v,
+                                                                           bool transpose_k,
+                                                                           float scale)
+    : Op({q, k, v}), m_transpose_k(transpose_k), m_scale(scale) {
+    validate_and_infer_types();
+}
+
+MKLDNNPlugin::ScaledDotProductAttentionNode::ScaledDotProductAttentionNode(const ngraph::Output<Node> &q,
+                                                                           const ngraph::Output<Node> &k,
+                                                                           const ngraph::Output<Node> &v,
+                                                                           const ngraph::Output<Node> &mask,
+                                                                           bool transpose_k,
+                                                                           float scale)
+    : Op({q, k, v, mask}), m_transpose_k(transpose_k), m_scale(scale) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> MKLDNNPlugin::ScaledDotProductAttentionNode::clone_with_new_inputs(const ngraph::OutputVector &new_args) const {
+    check_new_args_count(this, new_args);
+    if (new_args.size() == 3) {
+        return std::make_shared<MKLDNNPlugin::ScaledDotProductAttentionNode>(new_args.at(0), new_args.at(1), new_args.at(2),
+                                                                             m_transpose_k, m_scale);
+    } else if (new_args.size() == 4) {
+        return std::make_shared<MKLDNNPlugin::ScaledDotProductAttentionNode>(new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3),
+                                                                             m_transpose_k, m_scale);
+    }
+
+    throw ngraph::ngraph_error("Unsupported number of arguments for ScaledDotProductAttention operation");
+}
+
+void MKLDNNPlugin::ScaledDotProductAttentionNode::validate_and_infer_types() {
+    const auto& q_shape = get_input_partial_shape(0);
+    const auto& k_shape = get_input_partial_shape(1);
+    const auto& v_shape = get_input_partial_shape(2);
+    if (q_shape.is_dynamic() || k_shape.is_dynamic() || v_shape.is_dynamic()) {
+        set_output_type(0, get_input_element_type(0), ngraph::PartialShape::dynamic());
+        return;
+    }
+
+    const auto q = q_shape.to_shape();
+    const auto k = k_shape.to_shape();
+    const auto v = v_shape.to_shape();
+    const size_t rank = q.size();
+    NODE_VALIDATION_CHECK(this, rank >= 2 && k.size() == rank && v.size() == rank, "Q, K and V are expected to have the same rank");
+    NODE_VALIDATION_CHECK(this, q[rank - 1] == (m_transpose_k ? k[rank - 1] : k[rank - 2]), "Q and K have incompatible shapes");
+    NODE_VALIDATION_CHECK(this, v[rank - 2] == (m_transpose_k ? k[rank - 2] : k[rank - 1]), "K and V have incompatible shapes");
+
+    ngraph::Shape out = q;
+    for (size_t i = 0; i + 2 < rank; i++) {
+        NODE_VALIDATION_CHECK(this, (k[i] == out[i] || k[i] == 1 || out[i] == 1) && (v[i] == out[i] || v[i] == 1 || out[i] == 1),
+                              "The batch axes of Q, K and V aren't broadcastable");
+        out[i] = std::max(std::max(out[i], k[i]), v[i]);
+    }
+    out[rank - 1] = v[rank - 1];
+    set_output_type(0, get_input_element_type(0), out);
+}
+
+bool MKLDNNPlugin::ScaledDotProductAttentionNode::visit_attributes(ngraph::AttributeVisitor &visitor) {
+    visitor.on_attribute("transpose_k", m_transpose_k);
+    visitor.on_attribute("scale", m_scale);
+    return true;
+}
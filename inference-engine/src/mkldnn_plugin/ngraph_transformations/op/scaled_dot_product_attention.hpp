@@ -0,0 +1,50 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+
+namespace MKLDNNPlugin {
+
+/*
+ * softmax(scale * Q * K' + mask) * V, where K' is K transposed if transpose_k, and the softmax is along the last axis.
+ * The inputs have the same rank, the batch axes are broadcast numpy-style as well as the optional mask.
+ */
+class ScaledDotProductAttentionNode : public ngraph::op::Op {
+public:
+    static constexpr ngraph::NodeTypeInfo type_info{"ScaledDotProductAttention", 0};
+    static constexpr const ::ngraph::Node::type_info_t& get_type_info_static() { return type_info; }
+    const ngraph::NodeTypeInfo& get_type_info() const override { return type_info; }
+
+    ScaledDotProductAttentionNode() = default;
+
+    ScaledDotProductAttentionNode(const ngraph::Output<ngraph::Node> &q,
+                                  const ngraph::Output<ngraph::Node> &k,
+                                  const ngraph::Output<ngraph::Node> &v,
+                                  bool transpose_k,
+                                  float scale);
+
+    ScaledDotProductAttentionNode(const ngraph::Output<ngraph::Node> &q,
+                                  const ngraph::Output<ngraph::Node> &k,
+                                  const ngraph::Output<ngraph::Node> &v,
+                                  const ngraph::Output<ngraph::Node> &mask,
+                                  bool transpose_k,
+                                  float scale);
+
+    void validate_and_infer_types() override;
+
+    bool visit_attributes(ngraph::AttributeVisitor &visitor) override;
+
+    std::shared_ptr<ngraph::Node> clone_with_new_inputs(const ngraph::OutputVector &new_args) const override;
+
+    bool get_transpose_k() const { return m_transpose_k; }
+    float get_scale() const { return m_scale; }
+
+private:
+    bool m_transpose_k = false;
+    float m_scale = 1.f;
+};
+
+}  // namespace MKLDNNPlugin
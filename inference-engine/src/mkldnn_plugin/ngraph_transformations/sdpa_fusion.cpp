@@ -0,0 +1,128 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sdpa_fusion.hpp"
+#include "op/scaled_dot_product_attention.hpp"
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+NGRAPH_RTTI_DEFINITION(MKLDNNPlugin::ScaledDotProductAttentionFusion, "ScaledDotProductAttentionFusion", 0);
+
+namespace {
+
+bool hasSingleConsumer(const std::shared_ptr<ngraph::Node>& node) {
+    return node->get_output_size() == 1 && node->get_output_target_inputs(0).size() == 1;
+}
+
+// The value of the scalar f32 constant on the port if any
+bool getScalar(const std::shared_ptr<ngraph::Node>& node, size_t port, float& value) {
+    auto constant = std::dynamic_pointer_cast<ngraph::opset1::Constant>(node->get_input_node_shared_ptr(port));
+    if (!constant || constant->get_element_type() != ngraph::element::f32 || ngraph::shape_size(constant->get_shape()) != 1)
+        return false;
+    value = constant->cast_vector<float>()[0];
+    return true;
+}
+
+}  // namespace
+
+MKLDNNPlugin::ScaledDotProductAttentionFusion::ScaledDotProductAttentionFusion() {
+    auto m_softmax = ngraph::pattern::wrap_type<ngraph::opset1::Softmax>(ngraph::pattern::consumers_count(1));
+    auto m_v = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
+    auto m_matmul = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({m_softmax, m_v}, ngraph::pattern::has_static_shape());
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher &m) {
+        auto & pattern_to_output = m.get_pattern_value_map();
+
+        auto matmul_v = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(pattern_to_output[m_matmul].get_node_shared_ptr());
+        auto softmax = std::dynamic_pointer_cast<ngraph::opset1::Softmax>(pattern_to_output[m_softmax].get_node_shared_ptr());
+        if (!matmul_v || !softmax || matmul_v->get_transpose_a() || matmul_v->get_transpose_b())
+            return false;
+
+        const size_t rank = matmul_v->get_shape().size();
+        if (rank < 2 || rank > 4 || softmax->get_axis() != rank - 1)
+            return false;
+
+        ngraph::NodeVector fused = {softmax, matmul_v};
+        auto node = softmax->get_input_node_shared_ptr(0);
+
+        // the chain side of the mask addition is the one coming from the scores MatMul
+        auto isScores = [](const std::shared_ptr<ngraph::Node>& n) {
+            return ngraph::is_type<ngraph::opset1::MatMul>(n) || ngraph::is_type<ngraph::opset1::Multiply>(n) ||
+                   ngraph::is_type<ngraph::opset1::Divide>(n);
+        };
+        ngraph::Output<ngraph::Node> mask;
+        if (ngraph::is_type<ngraph::opset1::Add>(node) && hasSingleConsumer(node)) {
+            const size_t scores_port = isScores(node->get_input_node_shared_ptr(0)) ? 0 : 1;
+            mask = node->input_value(1 - scores_port);
+            fused.push_back(node);
+            node = node->get_input_node_shared_ptr(scores_port);
+        }
+
+        float scale = 1.f;
+        if ((ngraph::is_type<ngraph::opset1::Multiply>(node) || ngraph::is_type<ngraph::opset1::Divide>(node)) && hasSingleConsumer(node)) {
+            float value = 0.f;
+            size_t scores_port = 0;
+            if (getScalar(node, 1, value)) {
+                scores_port = 0;
+            } else if (ngraph::is_type<ngraph::opset1::Multiply>(node) && getScalar(node, 0, value)) {
+                scores_port = 1;
+            } else {
+                return false;
+            }
+            if (ngraph::is_type<ngraph::opset1::Divide>(node)) {
+                if (value == 0.f)
+                    return false;
+                value = 1.f / value;
+            }
+            scale = value;
+            fused.push_back(node);
+            node = node->get_input_node_shared_ptr(scores_port);
+        }
+
+        auto matmul_qk = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(node);
+        if (!matmul_qk || matmul_qk->get_transpose_a() || !hasSingleConsumer(matmul_qk))
+            return false;
+        fused.push_back(matmul_qk);
+
+        const auto q = matmul_qk->input_value(0);
+        const auto k = matmul_qk->input_value(1);
+        const auto v = pattern_to_output[m_v];
+        for (const auto& input : {q, k, v}) {
+            if (input.get_partial_shape().is_dynamic() || input.get_shape().size() != rank || input.get_element_type() != ngraph::element::f32)
+                return false;
+        }
+
+        const auto scores_shape = matmul_qk->get_shape();
+        if (mask.get_node()) {
+            if (mask.get_partial_shape().is_dynamic() || mask.get_element_type() != ngraph::element::f32)
+                return false;
+            const auto mask_shape = mask.get_shape();
+            if (mask_shape.size() > rank)
+                return false;
+            for (size_t i = 0; i < mask_shape.size(); i++) {
+                const size_t dim = scores_shape[rank - mask_shape.size() + i];
+                if (mask_shape[i] != dim && mask_shape[i] != 1)
+                    return false;
+            }
+        }
+
+        std::shared_ptr<ngraph::Node> sdpa;
+        if (mask.get_node()) {
+            sdpa = std::make_shared<MKLDNNPlugin::ScaledDotProductAttentionNode>(q, k, v, mask, matmul_qk->get_transpose_b(), scale);
+        } else {
+            sdpa = std::make_shared<MKLDNNPlugin::ScaledDotProductAttentionNode>(q, k, v, matmul_qk->get_transpose_b(), scale);
+        }
+        if (sdpa->get_shape() != matmul_v->get_shape())
+            return false;
+
+        sdpa->set_friendly_name(matmul_v->get_friendly_name());
+        ngraph::copy_runtime_info(fused, sdpa);
+        ngraph::replace_node(matmul_v, sdpa);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(m_matmul, "ScaledDotProductAttentionFusion");
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,21 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace MKLDNNPlugin {
+
+/*
+ * Fuses MatMul(Q, K) -> [Multiply/Divide by scalar] -> [Add mask] -> Softmax -> MatMul(., V) into
+ * ScaledDotProductAttention, so the scores are computed and consumed by the row blocks and never stored as a whole.
+ */
+class ScaledDotProductAttentionFusion : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    ScaledDotProductAttentionFusion();
+};
+
+}  // namespace MKLDNNPlugin
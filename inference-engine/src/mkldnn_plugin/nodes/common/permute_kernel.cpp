@@ -10,6 +10,7 @@
 #include <mkldnn_extension_utils.h>
 #include "cpu_memcpy.h"
 #include "utils/bfloat16.hpp"
+#include "emitters/jit_bf16_emitters.hpp"
 
 #include "cpu/x64/jit_generator.hpp"
 
@@ -22,6 +23,7 @@ using namespace mkldnn::impl::utils;
 using namespace Xbyak;
 
 #define GET_OFF(field) offsetof(jit_args_permute, field)
+#define GET_TILE_OFF(field) offsetof(jit_args_permute_tile, field)
 
 template <cpu_isa_t isa>
 struct jit_uni_permute_kernel_f32 : public jit_uni_permute_kernel, public jit_generator {
@@ -138,6 +140,224 @@ private:
     Xbyak::Xmm xmm = Xbyak::Xmm(1);
 };
 
+/*
+ * Processes the row of the tiles along the source innermost axis. The tile rows are converted to FP32 on load, so the
+ * scale and the shift are applied before the transposition, and converted to the destination precision on store.
+ */
+template <cpu_isa_t isa>
+struct jit_uni_permute_tile_kernel_f32 : public jit_uni_permute_tile_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_permute_tile_kernel_f32)
+
+    explicit jit_uni_permute_tile_kernel_f32(jit_permute_tile_config_params jcp_)
+            : jit_uni_permute_tile_kernel(jcp_, tile_size), jit_generator() {
+        if (jcp.dst_prc == Precision::BF16 && !mayiuse(avx512_core_bf16))
+            emu_vcvtneps2bf16.reset(new jit_emu_vcvtneps2bf16(this, isa, nullptr));
+    }
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_TILE_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_TILE_OFF(dst)]);
+        mov(reg_tiles, ptr[reg_params + GET_TILE_OFF(tiles)]);
+        if (jcp.with_scale_shift)
+            mov(reg_scale_shift, ptr[reg_params + GET_TILE_OFF(scale_shift)]);
+        mov(reg_src_stride, jcp.src_row_stride);
+        mov(reg_dst_stride, jcp.dst_row_stride);
+
+        Xbyak::Label tile_loop_label;
+        Xbyak::Label exit_label;
+
+        L(tile_loop_label); {
+            cmp(reg_tiles, 0);
+            je(exit_label, T_NEAR);
+
+            load_tile();
+            transpose_tile();
+            store_tile();
+
+            // the next tile starts tile_size columns later in the source and tile_size rows later in the destination
+            add(reg_src, tile_size * jcp.src_prc.size());
+            mov(reg_aux, jcp.dst_row_stride * tile_size);
+            add(reg_dst, reg_aux);
+            sub(reg_tiles, 1);
+
+            jmp(tile_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+
+        this->postamble();
+
+        if (emu_vcvtneps2bf16)
+            emu_vcvtneps2bf16->emit_data();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xbyak::Xmm, isa == cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    static constexpr size_t tile_size = cpu_isa_traits<isa>::vlen / sizeof(float);
+
+    // the tile occupies the first tile_size registers, the next ones are the temporaries of the transposition
+    Vmm vmm_row(size_t i) const { return Vmm(i); }
+    Vmm vmm_tmp(size_t i) const { return Vmm(tile_size + i); }
+
+    void load_row(const Vmm &vmm, const Xbyak::Address &addr) {
+        switch (jcp.src_prc) {
+            case Precision::BF16:
+                vpmovzxwd(vmm, addr);
+                uni_vpslld(vmm, vmm, 16);
+                break;
+            case Precision::U8:
+                vpmovzxbd(vmm, addr);
+                uni_vcvtdq2ps(vmm, vmm);
+                break;
+            default:
+                uni_vmovups(vmm, addr);
+                break;
+        }
+    }
+
+    void store_row(const Xbyak::Address &addr, const Vmm &vmm) {
+        switch (jcp.dst_prc) {
+            case Precision::BF16: {
+                Xbyak::Ymm ymm = Xbyak::Ymm(vmm.getIdx());
+                if (mayiuse(avx512_core_bf16))
+                    vcvtneps2bf16(ymm, vmm);
+                else
+                    emu_vcvtneps2bf16->emit_code({static_cast<size_t>(vmm.getIdx())}, {static_cast<size_t>(ymm.getIdx())});
+                vmovdqu(addr, ymm);
+                break;
+            }
+            default:
+                uni_vmovups(addr, vmm);
+                break;
+        }
+    }
+
+    void load_tile() {
+        mov(reg_src_aux, reg_src);
+        for (size_t i = 0; i < tile_size; i++) {
+            load_row(vmm_row(i), ptr[reg_src_aux]);
+            if (i + 1 < tile_size)
+                add(reg_src_aux, reg_src_stride);
+        }
+
+        if (jcp.with_scale_shift) {
+            uni_vbroadcastss(vmm_tmp(0), ptr[reg_scale_shift]);
+            uni_vbroadcastss(vmm_tmp(1), ptr[reg_scale_shift + sizeof(float)]);
+            for (size_t i = 0; i < tile_size; i++)
+                uni_vfmadd213ps(vmm_row(i), vmm_tmp(0), vmm_tmp(1));
+        }
+    }
+
+    // The columns of the tile end up in the registers of the column_reg() indices
+    void transpose_tile();
+    size_t column_reg(size_t j) const;
+
+    void store_tile() {
+        mov(reg_dst_aux, reg_dst);
+        for (size_t j = 0; j < tile_size; j++) {
+            store_row(ptr[reg_dst_aux], Vmm(column_reg(j)));
+            if (j + 1 < tile_size)
+                add(reg_dst_aux, reg_dst_stride);
+        }
+    }
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_tiles = r10;
+    Xbyak::Reg64 reg_src_aux = r11;
+    Xbyak::Reg64 reg_dst_aux = r12;
+    Xbyak::Reg64 reg_src_stride = r13;
+    Xbyak::Reg64 reg_dst_stride = r14;
+    Xbyak::Reg64 reg_scale_shift = r15;
+    Xbyak::Reg64 reg_aux = rbx;
+
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    std::unique_ptr<jit_emu_vcvtneps2bf16> emu_vcvtneps2bf16;
+};
+
+// 8x8: the pairs of the rows are interleaved, then the quads, then the 128-bit halves are exchanged
+template <>
+void jit_uni_permute_tile_kernel_f32<cpu::x64::avx2>::transpose_tile() {
+    for (size_t i = 0; i < 4; i++) {
+        vunpcklps(vmm_tmp(2 * i), vmm_row(2 * i), vmm_row(2 * i + 1));
+        vunpckhps(vmm_tmp(2 * i + 1), vmm_row(2 * i), vmm_row(2 * i + 1));
+    }
+    for (size_t i = 0; i < 2; i++) {
+        vshufps(vmm_row(4 * i), vmm_tmp(4 * i), vmm_tmp(4 * i + 2), 0x44);
+        vshufps(vmm_row(4 * i + 1), vmm_tmp(4 * i), vmm_tmp(4 * i + 2), 0xEE);
+        vshufps(vmm_row(4 * i + 2), vmm_tmp(4 * i + 1), vmm_tmp(4 * i + 3), 0x44);
+        vshufps(vmm_row(4 * i + 3), vmm_tmp(4 * i + 1), vmm_tmp(4 * i + 3), 0xEE);
+    }
+    for (size_t c = 0; c < 4; c++) {
+        vperm2f128(vmm_tmp(c), vmm_row(c), vmm_row(4 + c), 0x20);
+        vperm2f128(vmm_tmp(4 + c), vmm_row(c), vmm_row(4 + c), 0x31);
+    }
+}
+
+template <>
+size_t jit_uni_permute_tile_kernel_f32<cpu::x64::avx2>::column_reg(size_t j) const {
+    return tile_size + j;
+}
+
+// 16x16: as 8x8 within the 128-bit lanes, then the lanes of the quads of the rows are gathered in two steps
+template <>
+void jit_uni_permute_tile_kernel_f32<cpu::x64::avx512_common>::transpose_tile() {
+    for (size_t i = 0; i < 8; i++) {
+        vunpcklps(vmm_tmp(2 * i), vmm_row(2 * i), vmm_row(2 * i + 1));
+        vunpckhps(vmm_tmp(2 * i + 1), vmm_row(2 * i), vmm_row(2 * i + 1));
+    }
+    for (size_t i = 0; i < 4; i++) {
+        vshufps(vmm_row(4 * i), vmm_tmp(4 * i), vmm_tmp(4 * i + 2), 0x44);
+        vshufps(vmm_row(4 * i + 1), vmm_tmp(4 * i), vmm_tmp(4 * i + 2), 0xEE);
+        vshufps(vmm_row(4 * i + 2), vmm_tmp(4 * i + 1), vmm_tmp(4 * i + 3), 0x44);
+        vshufps(vmm_row(4 * i + 3), vmm_tmp(4 * i + 1), vmm_tmp(4 * i + 3), 0xEE);
+    }
+    // the register 4 * q + c keeps the column 4 * lane + c of the rows of the quad q in the lanes
+    for (size_t g = 0; g < 16; g += 8) {
+        for (size_t c = 0; c < 4; c++) {
+            vshuff32x4(vmm_tmp(g + c), vmm_row(g + c), vmm_row(g + 4 + c), 0x88);
+            vshuff32x4(vmm_tmp(g + 4 + c), vmm_row(g + c), vmm_row(g + 4 + c), 0xDD);
+        }
+    }
+    for (size_t c = 0; c < 4; c++) {
+        vshuff32x4(vmm_row(c), vmm_tmp(c), vmm_tmp(8 + c), 0x88);
+        vshuff32x4(vmm_row(8 + c), vmm_tmp(c), vmm_tmp(8 + c), 0xDD);
+        vshuff32x4(vmm_row(4 + c), vmm_tmp(4 + c), vmm_tmp(12 + c), 0x88);
+        vshuff32x4(vmm_row(12 + c), vmm_tmp(4 + c), vmm_tmp(12 + c), 0xDD);
+    }
+}
+
+template <>
+size_t jit_uni_permute_tile_kernel_f32<cpu::x64::avx512_common>::column_reg(size_t j) const {
+    return j;
+}
+
+static inline float load_element(const uint8_t* ptr, Precision prc) {
+    switch (prc) {
+        case Precision::BF16:
+            return bfloat16_t::from_bits(*reinterpret_cast<const uint16_t*>(ptr));
+        case Precision::U8:
+            return static_cast<float>(*ptr);
+        default:
+            return *reinterpret_cast<const float*>(ptr);
+    }
+}
+
+static inline void store_element(uint8_t* ptr, Precision prc, float value) {
+    if (prc == Precision::BF16)
+        *reinterpret_cast<bfloat16_t*>(ptr) = bfloat16_t(value);
+    else
+        *reinterpret_cast<float*>(ptr) = value;
+}
+
 PermuteKernel::PermuteKernel(const PermuteParams& params) : params(params) {
     prepareParams();
 }
@@ -254,6 +474,17 @@ void PermuteKernel::prepareParams() {
     jcp.ndims = sorted_order.size();
     jcp.data_size = params.data_size;
 
+    with_conversion = (params.src_prc != params.dst_prc) || params.scale != 1.f || params.shift != 0.f;
+    if (with_conversion && !isSupportedConversion(params.src_prc, params.dst_prc))
+        IE_THROW() << "PermuteKernel doesn't support conversion from " << params.src_prc << " to " << params.dst_prc;
+    scale_shift[0] = params.scale;
+    scale_shift[1] = params.shift;
+
+    prepareTiledParams();
+    // the generic kernel copies the elements as is
+    if (tile_kernel || with_conversion)
+        return;
+
     if (mayiuse(cpu::x64::avx512_common)) {
         permute_kernel.reset(new jit_uni_permute_kernel_f32<cpu::x64::avx512_common>(jcp));
     } else if (mayiuse(cpu::x64::avx2)) {
@@ -266,7 +497,101 @@ void PermuteKernel::prepareParams() {
         permute_kernel->create_ker();
 }
 
+bool PermuteKernel::isSupportedConversion(Precision src, Precision dst) {
+    return one_of(src, Precision::FP32, Precision::BF16, Precision::U8) && one_of(dst, Precision::FP32, Precision::BF16);
+}
+
+size_t PermuteKernel::getTileSize(Precision dst) {
+    if (dst == Precision::BF16 && !mayiuse(cpu::x64::avx512_core))
+        return 0;
+    if (mayiuse(cpu::x64::avx512_common))
+        return cpu_isa_traits<cpu::x64::avx512_common>::vlen / sizeof(float);
+    if (mayiuse(cpu::x64::avx2))
+        return cpu_isa_traits<cpu::x64::avx2>::vlen / sizeof(float);
+    return 0;
+}
+
+bool PermuteKernel::isTiledPlanarPermutation(const SizeVector& dims, const SizeVector& order, Precision dst) {
+    const size_t ndims = order.size();
+    // the same conditions as in prepareTiledParams(): the source innermost axis is the last one, the destination
+    // innermost one is order.back() and the batch axis is iterated first, so it can't be the destination innermost one
+    if (ndims < 2 || dims.size() != ndims || order.back() == ndims - 1 || order.back() == 0)
+        return false;
+    const size_t tile = getTileSize(dst);
+    return tile != 0 && dims[order.back()] >= tile && dims[ndims - 1] >= tile;
+}
+
+void PermuteKernel::prepareTiledParams() {
+    const size_t ndims = jcp.ndims;
+    // the destination innermost axis is the last one, the source innermost one should be another
+    if (ndims < 2 || jcp.dst_strides[ndims - 1] != 1 || jcp.src_strides[ndims - 1] == 1)
+        return;
+    size_t src_inner = ndims;
+    for (size_t i = 0; i + 1 < ndims; i++) {
+        if (jcp.src_strides[i] == 1 && jcp.dst_block_dims[i] > 1) {
+            src_inner = i;
+            break;
+        }
+    }
+    if (src_inner == ndims)
+        return;
+
+    Precision src_prc, dst_prc;
+    if (with_conversion) {
+        src_prc = params.src_prc;
+        dst_prc = params.dst_prc;
+    } else if (jcp.data_size == sizeof(float)) {
+        // the elements are moved through the FP32 registers bit exactly
+        src_prc = dst_prc = Precision::FP32;
+    } else {
+        return;
+    }
+
+    const size_t tile = getTileSize(dst_prc);
+    if (tile == 0)
+        return;
+
+    tile_rows = jcp.dst_block_dims[ndims - 1];
+    tile_cols = jcp.dst_block_dims[src_inner];
+    if (tile_rows < tile || tile_cols < tile)
+        return;
+    tile_rows_src_stride = jcp.src_strides[ndims - 1];
+    tile_cols_dst_stride = jcp.dst_strides[src_inner];
+
+    outer_dims.clear();
+    outer_src_strides.clear();
+    outer_dst_strides.clear();
+    for (size_t i = 0; i + 1 < ndims; i++) {
+        if (i == src_inner)
+            continue;
+        outer_dims.push_back(jcp.dst_block_dims[i]);
+        outer_src_strides.push_back(jcp.src_strides[i]);
+        outer_dst_strides.push_back(jcp.dst_strides[i]);
+    }
+    // the batch axis is sorted first if the dynamic batch is supported
+    outer_batch = jcp.supported_dynamic_batch && src_inner != 0;
+
+    jit_permute_tile_config_params tile_jcp;
+    tile_jcp.src_row_stride = tile_rows_src_stride * src_prc.size();
+    tile_jcp.dst_row_stride = tile_cols_dst_stride * dst_prc.size();
+    tile_jcp.src_prc = src_prc;
+    tile_jcp.dst_prc = dst_prc;
+    tile_jcp.with_scale_shift = params.scale != 1.f || params.shift != 0.f;
+
+    if (tile == cpu_isa_traits<cpu::x64::avx512_common>::vlen / sizeof(float)) {
+        tile_kernel.reset(new jit_uni_permute_tile_kernel_f32<cpu::x64::avx512_common>(tile_jcp));
+    } else {
+        tile_kernel.reset(new jit_uni_permute_tile_kernel_f32<cpu::x64::avx2>(tile_jcp));
+    }
+    tile_kernel->create_ker();
+}
+
 void PermuteKernel::execute(const uint8_t* src_data, uint8_t* dst_data, const int mb) {
+    if (tile_kernel) {
+        tiledExecute(src_data, dst_data, mb);
+        return;
+    }
+
     if (permute_kernel) {
         optimizedExecute(src_data, dst_data, mb);
         return;
@@ -277,6 +602,11 @@ void PermuteKernel::execute(const uint8_t* src_data, uint8_t* dst_data, const in
 
 void PermuteKernel::execute(const uint8_t* src_data, uint8_t* dst_data) {
     SizeVector dst_dims = jcp.dst_block_dims;
+    if (tile_kernel) {
+        tiledExecute(src_data, dst_data, dst_dims[0]);
+        return;
+    }
+
     if (permute_kernel) {
         optimizedExecute(src_data, dst_data, dst_dims[0]);
         return;
@@ -334,6 +664,56 @@ void PermuteKernel::optimizedExecute(const uint8_t* src_data, uint8_t* dst_data,
     return;
 }
 
+void PermuteKernel::tiledExecute(const uint8_t* src_data, uint8_t* dst_data, const int mb) {
+    SizeVector dims = outer_dims;
+    if (outer_batch && !dims.empty())
+        dims[0] = mb;
+
+    const size_t tile = tile_kernel->tile;
+    const Precision src_prc = tile_kernel->jcp.src_prc;
+    const Precision dst_prc = tile_kernel->jcp.dst_prc;
+    const size_t src_size = src_prc.size();
+    const size_t dst_size = dst_prc.size();
+    const size_t outer_work_amount = std::accumulate(dims.begin(), dims.end(), size_t(1), std::multiplies<size_t>());
+
+    // the panel is split by the rows of the tiles, the tails of the panel are processed element by element
+    parallel_for2d(outer_work_amount, div_up(tile_rows, tile), [&](size_t outer, size_t row_block) {
+        size_t src_off = 0, dst_off = 0;
+        for (size_t d = dims.size(); d-- > 0;) {
+            const size_t coord = outer % dims[d];
+            outer /= dims[d];
+            src_off += coord * outer_src_strides[d];
+            dst_off += coord * outer_dst_strides[d];
+        }
+        const size_t row_begin = row_block * tile;
+        const size_t rows = std::min(tile, tile_rows - row_begin);
+        src_off += row_begin * tile_rows_src_stride;
+        dst_off += row_begin;
+
+        size_t col_begin = 0;
+        if (rows == tile) {
+            auto arg = jit_args_permute_tile();
+            arg.src = &src_data[src_off * src_size];
+            arg.dst = &dst_data[dst_off * dst_size];
+            arg.tiles = tile_cols / tile;
+            arg.scale_shift = scale_shift;
+            (*tile_kernel)(&arg);
+            col_begin = arg.tiles * tile;
+        }
+
+        for (size_t c = col_begin; c < tile_cols; c++) {
+            for (size_t r = 0; r < rows; r++) {
+                const uint8_t* src = &src_data[(src_off + r * tile_rows_src_stride + c) * src_size];
+                uint8_t* dst = &dst_data[(dst_off + r + c * tile_cols_dst_stride) * dst_size];
+                if (with_conversion)
+                    store_element(dst, dst_prc, load_element(src, src_prc) * scale_shift[0] + scale_shift[1]);
+                else
+                    cpu_memcpy(dst, src, src_size);
+            }
+        }
+    });
+}
+
 static inline size_t parallel_init(size_t start, size_t nDims, const SizeVector& dims, SizeVector& indexes) {
     for (int j = nDims - 1; j >= 0; j--) {
         indexes[j] = start % dims[j];
@@ -364,11 +744,13 @@ void PermuteKernel::referenceExecute(const uint8_t* src_data, uint8_t* dst_data,
 
     size_t work_amount = std::accumulate(dst_dims.begin(), dst_dims.end(), 1, std::multiplies<size_t>());
 
-    auto get_idx = [ndims, data_size](const SizeVector& indexes, const SizeVector& strides) {
+    const size_t dst_data_size = with_conversion ? params.dst_prc.size() : data_size;
+
+    auto get_idx = [ndims](const SizeVector& indexes, const SizeVector& strides) {
         size_t idx = 0;
         for (size_t i = 0; i < ndims; ++i)
             idx += indexes[i] * strides[i];
-        return idx * data_size;
+        return idx;
     };
 
     parallel_nt(0, [&](const int ithr, const int nthr) {
@@ -379,9 +761,13 @@ void PermuteKernel::referenceExecute(const uint8_t* src_data, uint8_t* dst_data,
         parallel_init(start, ndims, dst_dims, indexes);
 
         for (size_t iwork = start; iwork < end; ++iwork) {
-            const size_t dst_idx = get_idx(indexes, dst_strides);
-            const size_t src_idx = get_idx(indexes, src_strides);
-            cpu_memcpy(&dst_data[dst_idx], &src_data[src_idx], data_size);
+            const size_t dst_idx = get_idx(indexes, dst_strides) * dst_data_size;
+            const size_t src_idx = get_idx(indexes, src_strides) * data_size;
+            if (with_conversion)
+                store_element(&dst_data[dst_idx], params.dst_prc,
+                              load_element(&src_data[src_idx], params.src_prc) * scale_shift[0] + scale_shift[1]);
+            else
+                cpu_memcpy(&dst_data[dst_idx], &src_data[src_idx], data_size);
 
             parallel_step(ndims, dst_dims, indexes);
         }
@@ -17,6 +17,12 @@ struct PermuteParams {
     InferenceEngine::SizeVector dst_block_order;
     InferenceEngine::SizeVector order;
     size_t data_size;
+    // the elements are converted if the precisions differ, data_size is the size of the source ones then
+    InferenceEngine::Precision src_prc = InferenceEngine::Precision::UNSPECIFIED;
+    InferenceEngine::Precision dst_prc = InferenceEngine::Precision::UNSPECIFIED;
+    // applied to the elements converted to FP32: dst = src * scale + shift
+    float scale = 1.f;
+    float shift = 0.f;
 };
 
 struct jit_permute_config_params {
@@ -51,6 +57,43 @@ struct jit_uni_permute_kernel {
     jit_permute_config_params jcp;
 };
 
+/*
+ * The permutation of the axes which are innermost in the source and in the destination is a transposition of the 2D
+ * panels formed by them. Such panels are processed by the square tiles: the tile rows are loaded along the source
+ * innermost axis, transposed in the registers and stored along the destination innermost axis.
+ */
+struct jit_permute_tile_config_params {
+    size_t src_row_stride;  // in bytes, the stride of the source along the destination innermost axis
+    size_t dst_row_stride;  // in bytes, the stride of the destination along the source innermost axis
+    InferenceEngine::Precision src_prc;
+    InferenceEngine::Precision dst_prc;
+    bool with_scale_shift;
+};
+
+struct jit_args_permute_tile {
+    const void* src;
+    void* dst;
+    size_t tiles;             // the number of the tiles along the source innermost axis
+    const float* scale_shift;
+};
+
+struct jit_uni_permute_tile_kernel {
+    void (*ker_)(const jit_args_permute_tile *);
+
+    void operator()(const jit_args_permute_tile *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    jit_uni_permute_tile_kernel(jit_permute_tile_config_params jcp_, size_t tile_) : ker_(nullptr), jcp(jcp_), tile(tile_) {}
+    virtual ~jit_uni_permute_tile_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_permute_tile_config_params jcp;
+    size_t tile;  // the tile is tile x tile elements
+};
+
 class PermuteKernel {
 public:
     PermuteKernel(const PermuteParams& params);
@@ -58,15 +101,47 @@ public:
     void execute(const uint8_t* src_data, uint8_t* dst_data);
     void execute(const uint8_t* src_data, uint8_t* dst_data, const int mb);
 
+    // Whether the permutation is executed by the tiles
+    bool isTiled() const {
+        return tile_kernel != nullptr;
+    }
+
+    // Whether the conversion of the elements from src to dst can be fused into the permutation
+    static bool isSupportedConversion(InferenceEngine::Precision src, InferenceEngine::Precision dst);
+
+    // The size of the tiles for the destination precision on the current machine, 0 if the tiles aren't supported
+    static size_t getTileSize(InferenceEngine::Precision dst);
+
+    // Whether the permutation of the planar tensor is executed by the tiles, the other permutations convert the
+    // elements one by one, so the conversion should be fused only if this holds
+    static bool isTiledPlanarPermutation(const InferenceEngine::SizeVector& dims, const InferenceEngine::SizeVector& order,
+                                         InferenceEngine::Precision dst);
+
 private:
     void prepareParams();
+    void prepareTiledParams();
 
     void optimizedExecute(const uint8_t* src_data, uint8_t* dst_data, const int mb);
+    void tiledExecute(const uint8_t* src_data, uint8_t* dst_data, const int mb);
     void referenceExecute(const uint8_t* src_data, uint8_t* dst_data, const int mb);
 
     jit_permute_config_params jcp = {};
     std::shared_ptr<jit_uni_permute_kernel> permute_kernel;
     PermuteParams params;
+
+    bool with_conversion = false;
+    float scale_shift[2] = {1.f, 0.f};
+
+    // the tiled execution: the panel axes and the outer axes iterated over in parallel, the strides are in elements
+    std::shared_ptr<jit_uni_permute_tile_kernel> tile_kernel;
+    size_t tile_rows = 0;     // the extent of the panel along the destination innermost axis
+    size_t tile_cols = 0;     // the extent of the panel along the source innermost axis
+    size_t tile_rows_src_stride = 0;
+    size_t tile_cols_dst_stride = 0;
+    InferenceEngine::SizeVector outer_dims;
+    InferenceEngine::SizeVector outer_src_strides;
+    InferenceEngine::SizeVector outer_dst_strides;
+    bool outer_batch = false;  // whether the first outer axis is the batch one limited by the dynamic batch
 };
 
 }  // namespace MKLDNNPlugin
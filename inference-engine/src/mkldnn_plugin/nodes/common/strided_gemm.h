@@ -0,0 +1,86 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+#include "cpu_types.h"
+
+namespace MKLDNNPlugin {
+
+/*
+ * The operand of a batched row-major GEMM viewed through the logical dims and the element strides of a tensor, e.g.
+ * of the dense tensor transposed without the copy. The matrices are the last two axes and one of them should be dense,
+ * then the matrix is passed to BLAS as is or as the transposed one. The batch axes may have any strides.
+ */
+struct StridedGemmOperand {
+    char trans = 'N';
+    int ld = 0;
+    size_t batchStrides[2] = {0, 0};    // of the axes ndims - 3 and ndims - 4 in elements, 0 for the broadcast ones
+};
+
+// The strides of the dense tensor of the dims
+inline VectorDims getDenseStrides(const VectorDims& dims) {
+    VectorDims strides(dims.size(), 1);
+    for (int i = static_cast<int>(dims.size()) - 2; i >= 0; i--)
+        strides[i] = strides[i + 1] * dims[i + 1];
+    return strides;
+}
+
+// The order which reverts the order
+inline std::vector<size_t> getInverseOrder(const std::vector<size_t>& order) {
+    std::vector<size_t> inverse(order.size());
+    for (size_t i = 0; i < order.size(); i++)
+        inverse[order[i]] = i;
+    return inverse;
+}
+
+// The dims and the strides of the dense tensor transposed by the order, the empty order keeps the tensor as is
+inline void getTransposedView(const VectorDims& dims, const std::vector<size_t>& order, VectorDims& viewDims, VectorDims& viewStrides) {
+    const auto strides = getDenseStrides(dims);
+    if (order.empty()) {
+        viewDims = dims;
+        viewStrides = strides;
+        return;
+    }
+    viewDims.resize(order.size());
+    viewStrides.resize(order.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        viewDims[i] = dims[order[i]];
+        viewStrides[i] = strides[order[i]];
+    }
+}
+
+// Whether the view can be passed to BLAS: one of the matrix axes is dense
+inline bool isGemmCompatibleView(const VectorDims& viewDims, const VectorDims& viewStrides) {
+    const size_t rank = viewDims.size();
+    return rank >= 2 && (viewStrides[rank - 1] == 1 || viewDims[rank - 1] == 1 || viewStrides[rank - 2] == 1);
+}
+
+/*
+ * The operand of the logical matrix of the view, transposed by the operation if `transposed`. The batch axes of size 1
+ * are broadcast along the output ones.
+ */
+inline StridedGemmOperand makeGemmOperand(const VectorDims& viewDims, const VectorDims& viewStrides, bool transposed,
+                                          const VectorDims& outDims) {
+    StridedGemmOperand operand;
+    const size_t rank = viewDims.size();
+    const size_t rows = rank - 2, cols = rank - 1;
+    if (viewStrides[cols] == 1 || viewDims[cols] == 1) {
+        operand.trans = transposed ? 'T' : 'N';
+        operand.ld = static_cast<int>(std::max(viewStrides[rows], viewDims[cols]));
+    } else {
+        // the matrix is stored by the columns, i.e. it is the transposed one of the dense rows
+        operand.trans = transposed ? 'N' : 'T';
+        operand.ld = static_cast<int>(std::max(viewStrides[cols], viewDims[rows]));
+    }
+    for (size_t i = 0; i < 2 && i + 3 <= rank; i++) {
+        const size_t axis = rank - 3 - i;
+        operand.batchStrides[i] = viewDims[axis] == outDims[axis] ? viewStrides[axis] : 0;
+    }
+    return operand;
+}
+
+}  // namespace MKLDNNPlugin
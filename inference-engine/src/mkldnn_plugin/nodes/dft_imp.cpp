@@ -0,0 +1,333 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "dft_imp.hpp"
+
+#include <algorithm>
+#include <utility>
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+/*
+ * The batch of sequences is transformed at once: the same butterfly is applied to the neighbouring elements of all the
+ * sequences, so the vector registers are filled along the batch (and along the already split sequences, see fft_stage).
+ * The same code is instantiated for the vectors and for the scalar tails.
+ */
+struct scalar_ops {
+    using type = float;
+    static constexpr size_t width = 1;
+    static type load(const float* ptr) { return *ptr; }
+    static void store(float* ptr, type v) { *ptr = v; }
+    static type set1(float v) { return v; }
+    static type add(type a, type b) { return a + b; }
+    static type sub(type a, type b) { return a - b; }
+    static type mul(type a, type b) { return a * b; }
+};
+
+#if defined(HAVE_AVX512F)
+struct vector_ops {
+    using type = __m512;
+    static constexpr size_t width = 16;
+    static type load(const float* ptr) { return _mm512_loadu_ps(ptr); }
+    static void store(float* ptr, type v) { _mm512_storeu_ps(ptr, v); }
+    static type set1(float v) { return _mm512_set1_ps(v); }
+    static type add(type a, type b) { return _mm512_add_ps(a, b); }
+    static type sub(type a, type b) { return _mm512_sub_ps(a, b); }
+    static type mul(type a, type b) { return _mm512_mul_ps(a, b); }
+};
+#elif defined(HAVE_AVX2)
+struct vector_ops {
+    using type = __m256;
+    static constexpr size_t width = 8;
+    static type load(const float* ptr) { return _mm256_loadu_ps(ptr); }
+    static void store(float* ptr, type v) { _mm256_storeu_ps(ptr, v); }
+    static type set1(float v) { return _mm256_set1_ps(v); }
+    static type add(type a, type b) { return _mm256_add_ps(a, b); }
+    static type sub(type a, type b) { return _mm256_sub_ps(a, b); }
+    static type mul(type a, type b) { return _mm256_mul_ps(a, b); }
+};
+#else
+using vector_ops = scalar_ops;
+#endif
+
+template <typename V>
+struct cvec {
+    typename V::type re;
+    typename V::type im;
+};
+
+template <typename V>
+static inline cvec<V> operator+(const cvec<V>& a, const cvec<V>& b) {
+    return {V::add(a.re, b.re), V::add(a.im, b.im)};
+}
+
+template <typename V>
+static inline cvec<V> operator-(const cvec<V>& a, const cvec<V>& b) {
+    return {V::sub(a.re, b.re), V::sub(a.im, b.im)};
+}
+
+template <typename V>
+static inline cvec<V> scale(const cvec<V>& a, float c) {
+    const auto vc = V::set1(c);
+    return {V::mul(a.re, vc), V::mul(a.im, vc)};
+}
+
+// a * (-i)
+template <typename V>
+static inline cvec<V> mul_neg_i(const cvec<V>& a) {
+    return {a.im, V::sub(V::set1(0.f), a.re)};
+}
+
+template <typename V>
+static inline cvec<V> mul(const cvec<V>& a, float w_re, float w_im) {
+    const auto vw_re = V::set1(w_re);
+    const auto vw_im = V::set1(w_im);
+    return {V::sub(V::mul(a.re, vw_re), V::mul(a.im, vw_im)), V::add(V::mul(a.re, vw_im), V::mul(a.im, vw_re))};
+}
+
+// Forward DFT of the radix size in place
+template <size_t R> struct butterfly;
+
+template <> struct butterfly<2> {
+    template <typename V>
+    static inline void apply(cvec<V>* a) {
+        const cvec<V> t = a[0];
+        a[0] = t + a[1];
+        a[1] = t - a[1];
+    }
+};
+
+template <> struct butterfly<3> {
+    template <typename V>
+    static inline void apply(cvec<V>* a) {
+        const cvec<V> t1 = a[1] + a[2];
+        const cvec<V> t2 = a[0] - scale(t1, 0.5f);
+        const cvec<V> t3 = mul_neg_i(scale(a[1] - a[2], 0.866025403784438647f));  // sin(2 * pi / 3)
+        a[0] = a[0] + t1;
+        a[1] = t2 + t3;
+        a[2] = t2 - t3;
+    }
+};
+
+template <> struct butterfly<4> {
+    template <typename V>
+    static inline void apply(cvec<V>* a) {
+        const cvec<V> s0 = a[0] + a[2];
+        const cvec<V> d0 = a[0] - a[2];
+        const cvec<V> s1 = a[1] + a[3];
+        const cvec<V> d1 = mul_neg_i(a[1] - a[3]);
+        a[0] = s0 + s1;
+        a[1] = d0 + d1;
+        a[2] = s0 - s1;
+        a[3] = d0 - d1;
+    }
+};
+
+template <> struct butterfly<5> {
+    template <typename V>
+    static inline void apply(cvec<V>* a) {
+        const float c1 = 0.309016994374947424f;   // cos(2 * pi / 5)
+        const float c2 = -0.809016994374947424f;  // cos(4 * pi / 5)
+        const float s1 = 0.951056516295153572f;   // sin(2 * pi / 5)
+        const float s2 = 0.587785252292473129f;   // sin(4 * pi / 5)
+        const cvec<V> t1 = a[1] + a[4];
+        const cvec<V> t2 = a[2] + a[3];
+        const cvec<V> t3 = a[1] - a[4];
+        const cvec<V> t4 = a[2] - a[3];
+        const cvec<V> m1 = a[0] + scale(t1, c1) + scale(t2, c2);
+        const cvec<V> m2 = a[0] + scale(t1, c2) + scale(t2, c1);
+        const cvec<V> n1 = mul_neg_i(scale(t3, s1) + scale(t4, s2));
+        const cvec<V> n2 = mul_neg_i(scale(t3, s2) - scale(t4, s1));
+        a[0] = a[0] + t1 + t2;
+        a[1] = m1 + n1;
+        a[2] = m2 + n2;
+        a[3] = m2 - n2;
+        a[4] = m1 - n1;
+    }
+};
+
+/*
+ * The stage reads the sequences of length R * m stored with the stride s and writes R times more sequences of length m
+ * with the stride s * R, so the output of the last stage is in the natural order: x[q + s * (p + j * m)] for j < R
+ * are transformed and twiddled to y[q + s * (R * p + k)] for k < R.
+ */
+template <size_t R, typename V>
+static inline void stage_step(const float* xr, const float* xi, float* yr, float* yi, size_t s, size_t m, size_t p, size_t q,
+                              const float* w_re, const float* w_im) {
+    cvec<V> a[R];
+    for (size_t j = 0; j < R; j++) {
+        const size_t idx = q + s * (p + j * m);
+        a[j] = {V::load(xr + idx), V::load(xi + idx)};
+    }
+    butterfly<R>::apply(a);
+
+    const size_t out = q + s * R * p;
+    V::store(yr + out, a[0].re);
+    V::store(yi + out, a[0].im);
+    for (size_t k = 1; k < R; k++) {
+        const cvec<V> b = p == 0 ? a[k] : mul(a[k], w_re[k - 1], w_im[k - 1]);
+        V::store(yr + out + s * k, b.re);
+        V::store(yi + out + s * k, b.im);
+    }
+}
+
+template <size_t R>
+static void run_stage(const fft_stage &stage, const float* xr, const float* xi, float* yr, float* yi, size_t s) {
+    for (size_t p = 0; p < stage.m; p++) {
+        const float* w_re = stage.twiddles_re.data() + p * (R - 1);
+        const float* w_im = stage.twiddles_im.data() + p * (R - 1);
+        size_t q = 0;
+        for (; q + vector_ops::width <= s; q += vector_ops::width)
+            stage_step<R, vector_ops>(xr, xi, yr, yi, s, stage.m, p, q, w_re, w_im);
+        for (; q < s; q++)
+            stage_step<R, scalar_ops>(xr, xi, yr, yi, s, stage.m, p, q, w_re, w_im);
+    }
+}
+
+static void mixed_radix_fft(const fft_plan &plan, float* re, float* im, size_t batch, float* scratch) {
+    const size_t len = plan.n * batch;
+    float* xr = re;
+    float* xi = im;
+    float* yr = scratch;
+    float* yi = scratch + len;
+    size_t s = batch;
+    for (const auto& stage : plan.stages) {
+        switch (stage.radix) {
+            case 2: run_stage<2>(stage, xr, xi, yr, yi, s); break;
+            case 3: run_stage<3>(stage, xr, xi, yr, yi, s); break;
+            case 4: run_stage<4>(stage, xr, xi, yr, yi, s); break;
+            case 5: run_stage<5>(stage, xr, xi, yr, yi, s); break;
+            default: break;
+        }
+        std::swap(xr, yr);
+        std::swap(xi, yi);
+        s *= stage.radix;
+    }
+    if (xr != re) {
+        std::copy(xr, xr + len, re);
+        std::copy(xi, xi + len, im);
+    }
+}
+
+// dst[i * batch + b] = src[i * batch + b] * w[i] for i < count, src is conjugated if conj_src
+static void mul_by_sequence(float* dst_re, float* dst_im, const float* src_re, const float* src_im,
+                            const float* w_re, const float* w_im, size_t count, size_t batch, bool conj_src) {
+    const float sign = conj_src ? -1.f : 1.f;
+    for (size_t i = 0; i < count; i++) {
+        const size_t offset = i * batch;
+        size_t b = 0;
+        for (; b + vector_ops::width <= batch; b += vector_ops::width) {
+            const cvec<vector_ops> x = {vector_ops::load(src_re + offset + b),
+                                        vector_ops::mul(vector_ops::load(src_im + offset + b), vector_ops::set1(sign))};
+            const cvec<vector_ops> y = mul(x, w_re[i], w_im[i]);
+            vector_ops::store(dst_re + offset + b, y.re);
+            vector_ops::store(dst_im + offset + b, y.im);
+        }
+        for (; b < batch; b++) {
+            const cvec<scalar_ops> y = mul(cvec<scalar_ops>{src_re[offset + b], sign * src_im[offset + b]}, w_re[i], w_im[i]);
+            dst_re[offset + b] = y.re;
+            dst_im[offset + b] = y.im;
+        }
+    }
+}
+
+/*
+ * X[k] = c[k] * sum(x[j] * c[j] * conj(c[k - j])) with the chirp c[k] = exp(-i * pi * k^2 / n). The circular convolution
+ * of the size M >= 2n - 1 is computed as conj(FFT(conj(FFT(a)) * F)) with F = conj(FFT(conj(c))) / M prepared in the plan.
+ */
+static void bluestein_fft(const fft_plan &plan, float* re, float* im, size_t batch, float* scratch) {
+    const fft_plan &conv = *plan.conv;
+    const size_t len = conv.n * batch;
+    float* a_re = scratch;
+    float* a_im = scratch + len;
+    float* work = scratch + 2 * len;
+
+    mul_by_sequence(a_re, a_im, re, im, plan.chirp_re.data(), plan.chirp_im.data(), plan.n, batch, false);
+    std::fill(a_re + plan.n * batch, a_re + len, 0.f);
+    std::fill(a_im + plan.n * batch, a_im + len, 0.f);
+    mixed_radix_fft(conv, a_re, a_im, batch, work);
+    mul_by_sequence(a_re, a_im, a_re, a_im, plan.filter_re.data(), plan.filter_im.data(), conv.n, batch, true);
+    mixed_radix_fft(conv, a_re, a_im, batch, work);
+    mul_by_sequence(re, im, a_re, a_im, plan.chirp_re.data(), plan.chirp_im.data(), plan.n, batch, true);
+}
+
+static void forward_fft(const fft_plan &plan, float* re, float* im, size_t batch, float* scratch) {
+    if (plan.conv)
+        bluestein_fft(plan, re, im, batch, scratch);
+    else
+        mixed_radix_fft(plan, re, im, batch, scratch);
+}
+
+/*
+ * Two real sequences x and y are transformed by one complex transform of z = x + i * y: X[k] = (Z[k] + conj(Z[n - k])) / 2
+ * and Y[k] = (Z[k] - conj(Z[n - k])) / 2i, the same holds for the inverse transform. It halves the work for the real input
+ * (the usual case for the signals padded with zero imaginary parts).
+ */
+static void real_pairs_fft(const fft_plan &plan, float* re, float* im, size_t batch, float* scratch) {
+    const size_t n = plan.n;
+    const size_t pairs = (batch + 1) / 2;
+    float* z_re = scratch;
+    float* z_im = scratch + n * pairs;
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < pairs; j++) {
+            z_re[i * pairs + j] = re[i * batch + 2 * j];
+            z_im[i * pairs + j] = 2 * j + 1 < batch ? re[i * batch + 2 * j + 1] : 0.f;
+        }
+    }
+
+    forward_fft(plan, z_re, z_im, pairs, scratch + 2 * n * pairs);
+
+    for (size_t k = 0; k < n; k++) {
+        const size_t nk = k == 0 ? 0 : n - k;
+        for (size_t j = 0; j < pairs; j++) {
+            const float zr = z_re[k * pairs + j];
+            const float zi = z_im[k * pairs + j];
+            const float znr = z_re[nk * pairs + j];
+            const float zni = z_im[nk * pairs + j];
+            re[k * batch + 2 * j] = 0.5f * (zr + znr);
+            im[k * batch + 2 * j] = 0.5f * (zi - zni);
+            if (2 * j + 1 < batch) {
+                re[k * batch + 2 * j + 1] = 0.5f * (zi + zni);
+                im[k * batch + 2 * j + 1] = 0.5f * (znr - zr);
+            }
+        }
+    }
+}
+
+void fft_exec(const fft_plan &plan, float* re, float* im, size_t batch, float* scratch) {
+    const size_t len = plan.n * batch;
+    const bool real = batch > 1 && std::all_of(im, im + len, [](float v) { return v == 0.f; });
+
+    // the inverse transform is conj(FFT(conj(x))) / n
+    if (plan.inverse && !real) {
+        for (size_t i = 0; i < len; i++)
+            im[i] = -im[i];
+    }
+
+    if (real)
+        real_pairs_fft(plan, re, im, batch, scratch);
+    else
+        forward_fft(plan, re, im, batch, scratch);
+
+    if (plan.inverse) {
+        const float norm = 1.f / plan.n;
+        // the real input is its own conjugate
+        const float im_norm = -norm;
+        for (size_t i = 0; i < len; i++) {
+            re[i] *= norm;
+            im[i] *= im_norm;
+        }
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,50 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+// Radix pass of the self-sorting (Stockham) FFT splitting the sequences of length radix * m
+struct fft_stage {
+    size_t radix;
+    size_t m;
+    // w^(p * k) with w = exp(-2 * pi * i / (radix * m)) for p < m and 0 < k < radix, stored by p
+    std::vector<float> twiddles_re;
+    std::vector<float> twiddles_im;
+};
+
+struct fft_plan {
+    size_t n;
+    bool inverse;
+    // the sizes without prime factors other than 2, 3 and 5 are transformed by the mixed radix stages
+    std::vector<fft_stage> stages;
+    // the other ones are reduced to the convolution with a chirp computed by the forward plan of a bigger size (Bluestein)
+    std::shared_ptr<fft_plan> conv;
+    std::vector<float> chirp_re;   // exp(-i * pi * k^2 / n) for k < n
+    std::vector<float> chirp_im;
+    std::vector<float> filter_re;  // conjugated transform of the conjugated chirp, divided by the convolution size
+    std::vector<float> filter_im;
+};
+
+// Number of floats fft_exec needs for the temporary buffers
+inline size_t fft_scratch_size(const fft_plan &plan, size_t batch) {
+    return (2 * plan.n + (plan.conv ? 4 * plan.conv->n : 2 * plan.n)) * batch;
+}
+
+namespace XARCH {
+
+// Transforms the batch of sequences in place, element i of the sequence b is stored at re/im[i * batch + b]
+void fft_exec(const fft_plan &plan, float* re, float* im, size_t batch, float* scratch);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
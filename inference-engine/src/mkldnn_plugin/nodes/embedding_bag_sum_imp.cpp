@@ -0,0 +1,214 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "embedding_bag_sum_imp.hpp"
+
+#include <algorithm>
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+#include <ie_common.h>
+#include "utils/bfloat16.hpp"
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+using MKLDNNPlugin::bfloat16_t;
+
+// The rows are random accesses to a big table, so they are prefetched this number of rows ahead of the summed one
+static constexpr size_t prefetch_distance = 8;
+
+template <typename T>
+static inline void prefetch_row(const T* row, size_t begin, size_t end) {
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    const char* first = reinterpret_cast<const char*>(row + begin);
+    const char* last = reinterpret_cast<const char*>(row + end);
+    for (const char* ptr = first; ptr < last; ptr += 64)
+        _mm_prefetch(ptr, _MM_HINT_T0);
+#else
+    (void)row;
+    (void)begin;
+    (void)end;
+#endif
+}
+
+// Prefetches the row which follows the summed one j by the distance, going on to the rows of the next bag
+template <typename T>
+static inline void prefetch_ahead(const T* table, size_t depth, const emb_bag_args &args, size_t j) {
+    const size_t ahead = j + prefetch_distance;
+    if (ahead < args.count)
+        prefetch_row(table + args.indices[ahead] * depth, args.begin, args.end);
+    else if (ahead - args.count < args.next_count)
+        prefetch_row(table + args.next_indices[ahead - args.count] * depth, args.begin, args.end);
+}
+
+#if defined(HAVE_AVX512F) || defined(HAVE_AVX2)
+#if defined(HAVE_AVX512F)
+static constexpr size_t vlen = 16;
+using vfloat = __m512;
+using vint = __m512i;
+static constexpr __mmask16 all_lanes = static_cast<__mmask16>(-1);
+
+static inline vfloat vload(const float* p) {
+    return _mm512_loadu_ps(p);
+}
+// the zero masked forms avoid the undefined source operands of the unmasked ones
+static inline vfloat vload(const bfloat16_t* p) {
+    const vint v = _mm512_maskz_cvtepu16_epi32(all_lanes, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)));
+    return _mm512_castsi512_ps(_mm512_maskz_slli_epi32(all_lanes, v, 16));
+}
+static inline void vstore(float* p, vfloat v) {
+    _mm512_storeu_ps(p, v);
+}
+// rounds like bfloat16_t does
+static inline void vstore(bfloat16_t* p, vfloat v) {
+    const vint x = _mm512_castps_si512(v);
+    const vint rounded = _mm512_add_epi32(x, _mm512_maskz_srli_epi32(all_lanes, _mm512_and_si512(x, _mm512_set1_epi32(0x10000)), 1));
+    const __m256i packed = _mm512_maskz_cvtepi32_epi16(all_lanes, _mm512_maskz_srli_epi32(all_lanes, rounded, 16));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), packed);
+}
+static inline vfloat vzero() {
+    return _mm512_setzero_ps();
+}
+static inline vfloat vset1(float v) {
+    return _mm512_set1_ps(v);
+}
+static inline vfloat vadd(vfloat a, vfloat b) {
+    return _mm512_add_ps(a, b);
+}
+static inline vfloat vfmadd(vfloat a, vfloat b, vfloat c) {
+    return _mm512_fmadd_ps(a, b, c);
+}
+#else
+static constexpr size_t vlen = 8;
+using vfloat = __m256;
+using vint = __m256i;
+
+static inline vfloat vload(const float* p) {
+    return _mm256_loadu_ps(p);
+}
+static inline vfloat vload(const bfloat16_t* p) {
+    return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))), 16));
+}
+static inline void vstore(float* p, vfloat v) {
+    _mm256_storeu_ps(p, v);
+}
+// rounds like bfloat16_t does
+static inline void vstore(bfloat16_t* p, vfloat v) {
+    const vint x = _mm256_castps_si256(v);
+    const vint rounded = _mm256_srli_epi32(_mm256_add_epi32(x, _mm256_srli_epi32(_mm256_and_si256(x, _mm256_set1_epi32(0x10000)), 1)), 16);
+    const vint packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(rounded, rounded), 0xd8);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm256_castsi256_si128(packed));
+}
+static inline vfloat vzero() {
+    return _mm256_setzero_ps();
+}
+static inline vfloat vset1(float v) {
+    return _mm256_set1_ps(v);
+}
+static inline vfloat vadd(vfloat a, vfloat b) {
+    return _mm256_add_ps(a, b);
+}
+static inline vfloat vfmadd(vfloat a, vfloat b, vfloat c) {
+    return _mm256_fmadd_ps(a, b, c);
+}
+#endif
+
+/*
+ * Sums the columns [i, i + U * vlen) of the rows, keeping the accumulators in the registers. The rows are prefetched
+ * along with the first columns of the slice.
+ */
+template <size_t U, typename T>
+static inline void sum_vectors(const T* table, size_t depth, const emb_bag_args &args, size_t i) {
+    const T* weights = reinterpret_cast<const T*>(args.weights);
+    const bool prefetch = i == args.begin;
+    vfloat acc[U];
+    for (size_t u = 0; u < U; u++)
+        acc[u] = vzero();
+    for (size_t j = 0; j < args.count; j++) {
+        if (prefetch)
+            prefetch_ahead(table, depth, args, j);
+        const T* row = table + args.indices[j] * depth + i;
+        if (weights) {
+            const vfloat w = vset1(static_cast<float>(weights[j]));
+            for (size_t u = 0; u < U; u++)
+                acc[u] = vfmadd(vload(row + u * vlen), w, acc[u]);
+        } else {
+            for (size_t u = 0; u < U; u++)
+                acc[u] = vadd(vload(row + u * vlen), acc[u]);
+        }
+    }
+    T* dst = reinterpret_cast<T*>(args.dst) + i;
+    for (size_t u = 0; u < U; u++)
+        vstore(dst + u * vlen, acc[u]);
+}
+#endif
+
+/*
+ * Sums the columns [i, end) by the blocks of the scalar accumulators. The integer data is accumulated in its own type,
+ * wrapping around like the reference does.
+ */
+template <typename T, typename Acc>
+static void sum_scalars(const T* table, size_t depth, const emb_bag_args &args, size_t i) {
+    const T* weights = reinterpret_cast<const T*>(args.weights);
+    T* dst = reinterpret_cast<T*>(args.dst);
+    constexpr size_t block = 16;
+    for (; i < args.end; i += block) {
+        const bool prefetch = i == args.begin;
+        const size_t len = std::min(block, args.end - i);
+        Acc acc[block] = {};
+        for (size_t j = 0; j < args.count; j++) {
+            if (prefetch)
+                prefetch_ahead(table, depth, args, j);
+            const T* row = table + args.indices[j] * depth + i;
+            const Acc w = weights ? static_cast<Acc>(weights[j]) : static_cast<Acc>(1);
+            for (size_t t = 0; t < len; t++)
+                acc[t] = static_cast<Acc>(acc[t] + static_cast<Acc>(row[t]) * w);
+        }
+        for (size_t t = 0; t < len; t++)
+            dst[i + t] = static_cast<T>(acc[t]);
+    }
+}
+
+template <typename T>
+static void sum_float_rows(const T* table, size_t depth, const emb_bag_args &args) {
+    size_t i = args.begin;
+#if defined(HAVE_AVX512F) || defined(HAVE_AVX2)
+    constexpr size_t unroll = 4;
+    for (; i + unroll * vlen <= args.end; i += unroll * vlen)
+        sum_vectors<unroll>(table, depth, args, i);
+    for (; i + vlen <= args.end; i += vlen)
+        sum_vectors<1>(table, depth, args, i);
+#endif
+    sum_scalars<T, float>(table, depth, args, i);
+}
+
+void emb_bag_sum_exec(const void* table, const emb_bag_args &args, const emb_bag_conf &conf) {
+    switch (conf.precision) {
+        case Precision::FP32:
+            sum_float_rows(reinterpret_cast<const float*>(table), conf.emb_depth, args);
+            break;
+        case Precision::BF16:
+            sum_float_rows(reinterpret_cast<const bfloat16_t*>(table), conf.emb_depth, args);
+            break;
+        case Precision::I8:
+            sum_scalars<int8_t, int8_t>(reinterpret_cast<const int8_t*>(table), conf.emb_depth, args, args.begin);
+            break;
+        case Precision::U8:
+            sum_scalars<uint8_t, uint8_t>(reinterpret_cast<const uint8_t*>(table), conf.emb_depth, args, args.begin);
+            break;
+        case Precision::I32:
+            sum_scalars<int32_t, int32_t>(reinterpret_cast<const int32_t*>(table), conf.emb_depth, args, args.begin);
+            break;
+        default:
+            IE_THROW() << "EmbeddingBagSum layer does not support precision '" << conf.precision.name() << "'";
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,40 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <ie_precision.hpp>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+struct emb_bag_conf {
+    InferenceEngine::Precision precision;  // of the table, the per sample weights and the output
+    size_t emb_depth;                      // elements in a row of the table
+};
+
+// Sums the [begin, end) slices of the table rows into the output row, the empty bag gives zeros
+struct emb_bag_args {
+    const int32_t* indices;       // rows of the bag
+    size_t count;
+    const void* weights;          // per sample weights of the rows or nullptr
+    const int32_t* next_indices;  // rows of the next processed bag, prefetched while the current one is summed
+    size_t next_count;
+    void* dst;                    // output row
+    size_t begin;
+    size_t end;
+};
+
+namespace XARCH {
+
+void emb_bag_sum_exec(const void* table, const emb_bag_args &args, const emb_bag_conf &conf);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,560 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_color_convert_node.h"
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <mkldnn_types.h>
+#include <mkldnn_extension_utils.h>
+#include "ie_parallel.hpp"
+#include "utils/general_utils.h"
+
+#include "cpu/x64/jit_generator.hpp"
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_color_convert_call_args, field)
+
+namespace {
+
+// BT.601 coefficients as of the reference implementation of NV12toRGB and I420toRGB
+constexpr float kY = 1.164f;
+constexpr float kRV = 1.596f;
+constexpr float kGU = 0.391f;
+constexpr float kGV = 0.813f;
+constexpr float kBU = 2.018f;
+
+// The constants of the kernel table, each one is broadcast to the vector
+enum TableEntry {
+    C16, C128, KY, KRV, KGU, KGV, KBU, HALF, UPPER, V255, ZERO, SCALE0, SHIFT0 = SCALE0 + 3,
+    IDX_DUP = SHIFT0 + 3,   // 0, 0, 1, 1, ... duplicates the chroma of the separate plane
+    IDX_EVEN,               // 0, 0, 2, 2, ... duplicates U of the interleaved plane
+    IDX_ODD                 // 1, 1, 3, 3, ... duplicates V of the interleaved plane
+};
+
+}  // namespace
+
+/*
+ * Converts the row of the pixels by the vectors: the chroma of the pixel pairs is loaded once and duplicated by the
+ * permutation, the channels are computed in FP32, clipped to [0, 255] as by the reference, optionally truncated to
+ * the integers and scaled and shifted.
+ */
+template <cpu_isa_t isa>
+struct jit_uni_color_convert_kernel_f32 : public jit_uni_color_convert_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_color_convert_kernel_f32)
+
+    explicit jit_uni_color_convert_kernel_f32(jit_color_convert_config_params jcp_)
+            : jit_uni_color_convert_kernel(jcp_, vlen / sizeof(float)), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_y, ptr[reg_params + GET_OFF(y)]);
+        mov(reg_u, ptr[reg_params + GET_OFF(u)]);
+        if (jcp.i420)
+            mov(reg_v, ptr[reg_params + GET_OFF(v)]);
+        for (size_t c = 0; c < 3; c++)
+            mov(reg_dst[c], ptr[reg_params + GET_OFF(dst) + c * sizeof(float*)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        mov(reg_table, l_table);
+
+        Xbyak::Label loop_label;
+        Xbyak::Label exit_label;
+
+        L(loop_label); {
+            cmp(reg_work_amount, step);
+            jl(exit_label, T_NEAR);
+
+            load_y();
+            load_chroma();
+            convert();
+
+            const size_t src_size = jcp.src_prc.size();
+            add(reg_y, step * src_size);
+            add(reg_u, (jcp.i420 ? step / 2 : step) * src_size);
+            if (jcp.i420)
+                add(reg_v, step / 2 * src_size);
+            for (size_t c = 0; c < 3; c++)
+                add(reg_dst[c], step * sizeof(float));
+            sub(reg_work_amount, step);
+
+            jmp(loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+
+        this->postamble();
+
+        prepare_table();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xbyak::Xmm, isa == cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    // the chroma of the separate planes takes the half of the vector
+    using VmmHalf = typename conditional<isa == cpu::x64::avx512_common, Xbyak::Ymm, Xbyak::Xmm>::type;
+    static constexpr size_t vlen = cpu_isa_traits<isa>::vlen;
+
+    Xbyak::Address table_val(size_t entry) {
+        return ptr[reg_table + entry * vlen];
+    }
+
+    void load_y() {
+        if (jcp.src_prc == Precision::U8) {
+            vpmovzxbd(vmm_y, ptr[reg_y]);
+            uni_vcvtdq2ps(vmm_y, vmm_y);
+        } else {
+            uni_vmovups(vmm_y, ptr[reg_y]);
+        }
+    }
+
+    void load_chroma() {
+        const bool u8 = jcp.src_prc == Precision::U8;
+        if (jcp.i420) {
+            uni_vmovups(vmm_idx, table_val(IDX_DUP));
+            for (auto& plane : {std::make_pair(vmm_u, reg_u), std::make_pair(vmm_v, reg_v)}) {
+                const Vmm& vmm = plane.first;
+                if (u8) {
+                    vpmovzxbd(VmmHalf(vmm.getIdx()), ptr[plane.second]);
+                    vpermd(vmm, vmm_idx, vmm);
+                    uni_vcvtdq2ps(vmm, vmm);
+                } else {
+                    uni_vmovups(VmmHalf(vmm.getIdx()), ptr[plane.second]);
+                    vpermps(vmm, vmm_idx, vmm);
+                }
+            }
+        } else {
+            // U0, V0, U1, V1, ...
+            if (u8) {
+                vpmovzxbd(vmm_u, ptr[reg_u]);
+                uni_vcvtdq2ps(vmm_u, vmm_u);
+            } else {
+                uni_vmovups(vmm_u, ptr[reg_u]);
+            }
+            uni_vmovups(vmm_idx, table_val(IDX_ODD));
+            vpermps(vmm_v, vmm_idx, vmm_u);
+            uni_vmovups(vmm_idx, table_val(IDX_EVEN));
+            vpermps(vmm_u, vmm_idx, vmm_u);
+        }
+    }
+
+    void convert() {
+        uni_vsubps(vmm_y, vmm_y, table_val(C16));
+        uni_vsubps(vmm_u, vmm_u, table_val(C128));
+        uni_vsubps(vmm_v, vmm_v, table_val(C128));
+        uni_vmulps(vmm_y, vmm_y, table_val(KY));
+
+        uni_vmulps(vmm_r, vmm_v, table_val(KRV));
+        uni_vaddps(vmm_r, vmm_y, vmm_r);
+
+        uni_vmulps(vmm_g, vmm_u, table_val(KGU));
+        uni_vsubps(vmm_g, vmm_y, vmm_g);
+        uni_vmulps(vmm_tmp, vmm_v, table_val(KGV));
+        uni_vsubps(vmm_g, vmm_g, vmm_tmp);
+
+        uni_vmulps(vmm_b, vmm_u, table_val(KBU));
+        uni_vaddps(vmm_b, vmm_y, vmm_b);
+
+        const Vmm channels[3] = {jcp.bgr ? vmm_b : vmm_r, vmm_g, jcp.bgr ? vmm_r : vmm_b};
+        for (size_t c = 0; c < 3; c++) {
+            clip(channels[c]);
+            if (jcp.with_scale_shift) {
+                uni_vmovups(vmm_tmp, table_val(SCALE0 + c));
+                uni_vfmadd213ps(vmm_tmp, vmm_res, table_val(SHIFT0 + c));
+                uni_vmovups(ptr[reg_dst[c]], vmm_tmp);
+            } else {
+                uni_vmovups(ptr[reg_dst[c]], vmm_res);
+            }
+        }
+    }
+
+    // vmm_res = x < 0.5 ? 0 : (x > 254.5 ? 255 : x), x is truncated if required
+    void clip(const Vmm& x) {
+        if (jcp.truncate) {
+            if (isa == cpu::x64::avx512_common)
+                vrndscaleps(vmm_res, x, 0x3);
+            else
+                vroundps(vmm_res, x, 0x3);
+        } else {
+            uni_vmovups(vmm_res, x);
+        }
+        if (isa == cpu::x64::avx512_common) {
+            vcmpps(k_mask, x, table_val(HALF), _cmp_lt_os);
+            vblendmps(vmm_res | k_mask, vmm_res, table_val(ZERO));
+            vcmpps(k_mask, x, table_val(UPPER), _cmp_nle_us);
+            vblendmps(vmm_res | k_mask, vmm_res, table_val(V255));
+        } else {
+            vcmpps(vmm_mask, x, table_val(HALF), _cmp_lt_os);
+            vblendvps(vmm_res, vmm_res, table_val(ZERO), vmm_mask);
+            vcmpps(vmm_mask, x, table_val(UPPER), _cmp_nle_us);
+            vblendvps(vmm_res, vmm_res, table_val(V255), vmm_mask);
+        }
+    }
+
+    void prepare_table() {
+        const size_t elems = vlen / sizeof(float);
+        auto broadcast = [&](float value) {
+            for (size_t i = 0; i < elems; i++)
+                dd(float2int(value));
+        };
+
+        align(64);
+        L(l_table);
+        broadcast(16.f);
+        broadcast(128.f);
+        broadcast(kY);
+        broadcast(kRV);
+        broadcast(kGU);
+        broadcast(kGV);
+        broadcast(kBU);
+        broadcast(0.5f);
+        broadcast(254.5f);
+        broadcast(255.f);
+        broadcast(0.f);
+        for (size_t c = 0; c < 3; c++)
+            broadcast(jcp.scales[c]);
+        for (size_t c = 0; c < 3; c++)
+            broadcast(jcp.shifts[c]);
+        for (size_t i = 0; i < elems; i++)
+            dd(i / 2);
+        for (size_t i = 0; i < elems; i++)
+            dd(i / 2 * 2);
+        for (size_t i = 0; i < elems; i++)
+            dd(i / 2 * 2 + 1);
+    }
+
+    Vmm vmm_y = Vmm(0);
+    Vmm vmm_u = Vmm(1);
+    Vmm vmm_v = Vmm(2);
+    Vmm vmm_r = Vmm(3);
+    Vmm vmm_g = Vmm(4);
+    Vmm vmm_b = Vmm(5);
+    Vmm vmm_res = Vmm(6);
+    Vmm vmm_tmp = Vmm(7);
+    Vmm vmm_mask = Vmm(8);
+    Vmm vmm_idx = Vmm(9);
+    Xbyak::Opmask k_mask = Xbyak::Opmask(1);
+
+    Xbyak::Reg64 reg_y = r8;
+    Xbyak::Reg64 reg_u = r9;
+    Xbyak::Reg64 reg_v = r10;
+    Xbyak::Reg64 reg_dst[3] = {r11, r12, r13};
+    Xbyak::Reg64 reg_work_amount = r14;
+    Xbyak::Reg64 reg_table = r15;
+
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Xbyak::Label l_table;
+};
+
+bool MKLDNNColorConvertNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (isDynamicNgraphNode(op)) {
+            errorMessage = "Doesn't support op with dynamic shapes";
+            return false;
+        }
+        if (!ngraph::is_type<const MKLDNNPlugin::ColorConvertNode>(op)) {
+            errorMessage = "Only CPU plugin ColorConvert operation is supported";
+            return false;
+        }
+        for (size_t i = 0; i < op->get_input_size(); i++) {
+            if (!one_of(op->get_input_element_type(i), ngraph::element::u8, ngraph::element::f32)) {
+                errorMessage = "Unsupported input precision: " + op->get_input_element_type(i).get_type_name();
+                return false;
+            }
+        }
+        if (!one_of(op->get_output_element_type(0), ngraph::element::u8, ngraph::element::f32)) {
+            errorMessage = "Unsupported output precision: " + op->get_output_element_type(0).get_type_name();
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNColorConvertNode::MKLDNNColorConvertNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng,
+                                               MKLDNNWeightsSharing::Ptr &cache) : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "ColorConvert node with name '" + getName() + "'";
+    attrs = ngraph::as_type_ptr<const MKLDNNPlugin::ColorConvertNode>(op)->get_attrs();
+    singlePlane = op->get_input_size() == 1;
+}
+
+void MKLDNNColorConvertNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    srcPrc = getOriginalInputPrecisionAtPort(0) == Precision::U8 ? Precision::U8 : Precision::FP32;
+    dstPrc = getOriginalOutputPrecisionAtPort(0) == Precision::U8 ? Precision::U8 : Precision::FP32;
+
+    std::vector<PortConfigurator> inConfs(getOriginalInputsNumber(), {LayoutType::ncsp, srcPrc});
+    impl_desc_type implType = impl_desc_type::ref;
+    if (mayiuse(cpu::x64::avx512_common)) {
+        implType = impl_desc_type::jit_avx512;
+    } else if (mayiuse(cpu::x64::avx2)) {
+        implType = impl_desc_type::jit_avx2;
+    }
+    addSupportedPrimDesc(inConfs, {{LayoutType::ncsp, dstPrc}}, implType);
+}
+
+void MKLDNNColorConvertNode::createPrimitive() {
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        IE_THROW() << errorPrefix << " did not set preferable primitive descriptor";
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto& srcMemPtr = getParentEdgeAt(i)->getMemoryPtr();
+        if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+            IE_THROW() << errorPrefix << " did not allocate input memory";
+    }
+    auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        IE_THROW() << errorPrefix << " did not allocate destination memory";
+
+    const auto& yDims = getParentEdgeAt(0)->getMemory().getStaticDims();
+    N = yDims[0];
+    H = singlePlane ? yDims[1] * 2 / 3 : yDims[1];
+    W = yDims[2];
+    const auto& dstDims = dstMemPtr->getStaticDims();
+    OH = attrs.planar ? dstDims[2] : dstDims[1];
+    OW = attrs.planar ? dstDims[3] : dstDims[2];
+
+    const bool withResize = attrs.resize_mode != ColorConvertNode::ResizeMode::NONE;
+    if (withResize) {
+        // the half-pixel coordinates as of Interpolate
+        auto prepareAxis = [&](size_t in, size_t out, std::vector<size_t>& idx0, std::vector<size_t>& idx1, std::vector<float>& weights) {
+            const float scale = static_cast<float>(out) / static_cast<float>(in);
+            idx0.resize(out);
+            idx1.resize(out);
+            weights.resize(out);
+            for (size_t o = 0; o < out; o++) {
+                float coord = (static_cast<float>(o) + 0.5f) / scale - 0.5f;
+                if (attrs.resize_mode == ColorConvertNode::ResizeMode::NEAREST) {
+                    // round_prefer_floor
+                    float nearest = coord == std::floor(coord) + 0.5f ? std::floor(coord) : std::round(coord);
+                    nearest = std::max(0.f, std::min(nearest, static_cast<float>(in - 1)));
+                    idx0[o] = idx1[o] = static_cast<size_t>(nearest);
+                    weights[o] = 0.f;
+                } else {
+                    coord = std::max(0.f, std::min(coord, static_cast<float>(in - 1)));
+                    idx0[o] = static_cast<size_t>(coord);
+                    idx1[o] = std::min(idx0[o] + 1, in - 1);
+                    weights[o] = coord - static_cast<float>(idx0[o]);
+                }
+            }
+        };
+        prepareAxis(H, OH, yIdx0, yIdx1, yWeights);
+        prepareAxis(W, OW, xIdx0, xIdx1, xWeights);
+    }
+
+    // the converted rows are stored in place for FP32 NCHW output without the resize
+    threadBufferSize = withResize ? 2 * 3 * W : (attrs.planar && dstPrc == Precision::FP32 ? 0 : 3 * W);
+    buffers.resize(parallel_get_max_threads() * threadBufferSize);
+
+    jit_color_convert_config_params jcp = {};
+    jcp.i420 = attrs.i420;
+    jcp.bgr = attrs.bgr;
+    jcp.truncate = attrs.truncate;
+    jcp.src_prc = srcPrc;
+    jcp.with_scale_shift = false;
+    for (size_t c = 0; c < 3; c++) {
+        jcp.scales[c] = attrs.scales[c];
+        jcp.shifts[c] = attrs.shifts[c];
+        jcp.with_scale_shift |= attrs.scales[c] != 1.f || attrs.shifts[c] != 0.f;
+    }
+
+    if (mayiuse(cpu::x64::avx512_common)) {
+        kernel.reset(new jit_uni_color_convert_kernel_f32<cpu::x64::avx512_common>(jcp));
+    } else if (mayiuse(cpu::x64::avx2)) {
+        kernel.reset(new jit_uni_color_convert_kernel_f32<cpu::x64::avx2>(jcp));
+    }
+    if (kernel)
+        kernel->create_ker();
+}
+
+void MKLDNNColorConvertNode::getRows(size_t n, size_t row, const uint8_t*& y, const uint8_t*& u, const uint8_t*& v) const {
+    const size_t size = srcPrc.size();
+    const size_t chromaRow = row / 2;
+    if (singlePlane) {
+        // Y plane, then the interleaved UV plane or U and V planes
+        const uint8_t* image = planesData[0] + n * H * 3 / 2 * W * size;
+        const uint8_t* chroma = image + H * W * size;
+        y = image + row * W * size;
+        if (attrs.i420) {
+            u = chroma + chromaRow * (W / 2) * size;
+            v = chroma + (H / 2) * (W / 2) * size + chromaRow * (W / 2) * size;
+        } else {
+            u = chroma + chromaRow * W * size;
+            v = nullptr;
+        }
+    } else {
+        y = planesData[0] + (n * H + row) * W * size;
+        if (attrs.i420) {
+            u = planesData[1] + (n * (H / 2) + chromaRow) * (W / 2) * size;
+            v = planesData[2] + (n * (H / 2) + chromaRow) * (W / 2) * size;
+        } else {
+            u = planesData[1] + (n * (H / 2) + chromaRow) * W * size;
+            v = nullptr;
+        }
+    }
+}
+
+void MKLDNNColorConvertNode::convertPixels(const uint8_t* y, const uint8_t* u, const uint8_t* v, float* dst[3],
+                                           size_t begin, size_t end) const {
+    const bool u8 = srcPrc == Precision::U8;
+    auto load = [u8](const uint8_t* data, size_t i) {
+        return u8 ? static_cast<float>(data[i]) : reinterpret_cast<const float*>(data)[i];
+    };
+    auto clip = [&](float a) {
+        return a < 0.5f ? 0.f : (a > 254.5f ? 255.f : (attrs.truncate ? std::trunc(a) : a));
+    };
+    for (size_t x = begin; x < end; x++) {
+        const float c = load(y, x) - 16.f;
+        const float d = (attrs.i420 ? load(u, x / 2) : load(u, x / 2 * 2)) - 128.f;
+        const float e = (attrs.i420 ? load(v, x / 2) : load(u, x / 2 * 2 + 1)) - 128.f;
+        const float r = clip(kY * c + kRV * e);
+        const float g = clip(kY * c - kGU * d - kGV * e);
+        const float b = clip(kY * c + kBU * d);
+        const float values[3] = {attrs.bgr ? b : r, g, attrs.bgr ? r : b};
+        for (size_t ch = 0; ch < 3; ch++)
+            dst[ch][x] = values[ch] * attrs.scales[ch] + attrs.shifts[ch];
+    }
+}
+
+void MKLDNNColorConvertNode::convertRow(size_t n, size_t row, float* dst[3]) const {
+    const uint8_t *y, *u, *v;
+    getRows(n, row, y, u, v);
+    size_t done = 0;
+    if (kernel) {
+        jit_color_convert_call_args args;
+        args.y = y;
+        args.u = u;
+        args.v = v;
+        for (size_t c = 0; c < 3; c++)
+            args.dst[c] = dst[c];
+        args.work_amount = W / kernel->step * kernel->step;
+        (*kernel)(&args);
+        done = args.work_amount;
+    }
+    convertPixels(y, u, v, dst, done, W);
+}
+
+void MKLDNNColorConvertNode::executeDirect(uint8_t* dstData) {
+    parallel_for2d(N, H, [&](size_t n, size_t row) {
+        if (threadBufferSize == 0) {
+            float* out = reinterpret_cast<float*>(dstData);
+            float* dst[3];
+            for (size_t c = 0; c < 3; c++)
+                dst[c] = out + ((n * 3 + c) * H + row) * W;
+            convertRow(n, row, dst);
+            return;
+        }
+
+        float* buffer = &buffers[parallel_get_thread_num() * threadBufferSize];
+        float* dst[3] = {buffer, buffer + W, buffer + 2 * W};
+        convertRow(n, row, dst);
+        // the strides of the channels and of the pixels in the output
+        const size_t channelStride = attrs.planar ? H * W : 1;
+        const size_t pixelStride = attrs.planar ? 1 : 3;
+        const size_t offset = attrs.planar ? n * 3 * H * W + row * W : (n * H + row) * W * 3;
+        for (size_t c = 0; c < 3; c++) {
+            if (dstPrc == Precision::U8) {
+                uint8_t* out = dstData + offset + c * channelStride;
+                for (size_t x = 0; x < W; x++)
+                    out[x * pixelStride] = static_cast<uint8_t>(dst[c][x]);
+            } else {
+                float* out = reinterpret_cast<float*>(dstData) + offset + c * channelStride;
+                for (size_t x = 0; x < W; x++)
+                    out[x * pixelStride] = dst[c][x];
+            }
+        }
+    });
+}
+
+void MKLDNNColorConvertNode::executeResize(float* dstData) {
+    // the output rows are split to the blocks per thread, so the converted source rows are reused by the next output rows
+    const size_t blocks = std::min(OH, std::max<size_t>(1, div_up(static_cast<size_t>(parallel_get_max_threads()), N)));
+    const size_t rowsBlock = div_up(OH, blocks);
+    const bool nearest = attrs.resize_mode == ColorConvertNode::ResizeMode::NEAREST;
+
+    parallel_for2d(N, blocks, [&](size_t n, size_t block) {
+        float* buffer = &buffers[parallel_get_thread_num() * threadBufferSize];
+        float* slots[2] = {buffer, buffer + 3 * W};
+        size_t cached[2] = {H, H};
+
+        // the slot of the converted source row, the other row needed by the output row is kept
+        auto getRow = [&](size_t row, size_t keep) {
+            for (size_t s = 0; s < 2; s++) {
+                if (cached[s] == row)
+                    return slots[s];
+            }
+            const size_t s = cached[0] == keep ? 1 : 0;
+            float* dst[3] = {slots[s], slots[s] + W, slots[s] + 2 * W};
+            convertRow(n, row, dst);
+            cached[s] = row;
+            return slots[s];
+        };
+
+        const size_t channelStride = attrs.planar ? OH * OW : 1;
+        const size_t pixelStride = attrs.planar ? 1 : 3;
+        for (size_t oy = block * rowsBlock; oy < std::min(OH, (block + 1) * rowsBlock); oy++) {
+            const float* row0 = getRow(yIdx0[oy], yIdx1[oy]);
+            const float* row1 = nearest ? row0 : getRow(yIdx1[oy], yIdx0[oy]);
+            const float wy = yWeights[oy];
+            float* out = dstData + (attrs.planar ? n * 3 * OH * OW + oy * OW : (n * OH + oy) * OW * 3);
+            for (size_t c = 0; c < 3; c++) {
+                const float* src0 = row0 + c * W;
+                const float* src1 = row1 + c * W;
+                float* outChannel = out + c * channelStride;
+                if (nearest) {
+                    for (size_t ox = 0; ox < OW; ox++)
+                        outChannel[ox * pixelStride] = src0[xIdx0[ox]];
+                    continue;
+                }
+                for (size_t ox = 0; ox < OW; ox++) {
+                    const size_t x0 = xIdx0[ox], x1 = xIdx1[ox];
+                    const float wx = xWeights[ox];
+                    const float top = src0[x0] + (src0[x1] - src0[x0]) * wx;
+                    const float bottom = src1[x0] + (src1[x1] - src1[x0]) * wx;
+                    outChannel[ox * pixelStride] = top + (bottom - top) * wy;
+                }
+            }
+        }
+    });
+}
+
+void MKLDNNColorConvertNode::execute(mkldnn::stream strm) {
+    planesData.resize(getParentEdges().size());
+    for (size_t i = 0; i < planesData.size(); i++)
+        planesData[i] = reinterpret_cast<const uint8_t*>(getParentEdgeAt(i)->getMemoryPtr()->GetPtr());
+    auto dstData = reinterpret_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    if (attrs.resize_mode == ColorConvertNode::ResizeMode::NONE) {
+        executeDirect(dstData);
+    } else {
+        executeResize(reinterpret_cast<float*>(dstData));
+    }
+}
+
+bool MKLDNNColorConvertNode::created() const {
+    return getType() == ColorConvert;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNColorConvertNode, ColorConvert);
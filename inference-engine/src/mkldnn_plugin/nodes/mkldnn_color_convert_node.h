@@ -0,0 +1,97 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <memory>
+#include <vector>
+#include "ngraph_transformations/op/color_convert.hpp"
+
+namespace MKLDNNPlugin {
+
+struct jit_color_convert_config_params {
+    bool i420;    // separate U and V planes, otherwise the interleaved UV plane
+    bool bgr;
+    bool truncate;
+    bool with_scale_shift;
+    InferenceEngine::Precision src_prc;  // U8 or FP32
+    float scales[3];
+    float shifts[3];
+};
+
+struct jit_color_convert_call_args {
+    const void* y;
+    const void* u;      // the UV plane row for NV12
+    const void* v;
+    float* dst[3];      // the rows of the output channels
+    size_t work_amount; // the number of the pixels, a multiple of the vector length
+};
+
+struct jit_uni_color_convert_kernel {
+    void (*ker_)(const jit_color_convert_call_args *);
+
+    void operator()(const jit_color_convert_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    jit_uni_color_convert_kernel(jit_color_convert_config_params jcp_, size_t step_) : ker_(nullptr), jcp(jcp_), step(step_) {}
+    virtual ~jit_uni_color_convert_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_color_convert_config_params jcp;
+    size_t step;  // the pixels per iteration
+};
+
+/*
+ * Converts the rows of NV12/I420 image to the planar FP32 rows of R, G and B (or B, G, R) with the per-channel scale
+ * and shift applied. Without the resize the rows of NCHW FP32 output are written in place, otherwise two source rows
+ * are kept converted per thread and blended into the output rows, so the frame is read once in any case.
+ */
+class MKLDNNColorConvertNode : public MKLDNNNode {
+public:
+    MKLDNNColorConvertNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    void getRows(size_t n, size_t row, const uint8_t*& y, const uint8_t*& u, const uint8_t*& v) const;
+    void convertRow(size_t n, size_t row, float* dst[3]) const;
+    void convertPixels(const uint8_t* y, const uint8_t* u, const uint8_t* v, float* dst[3], size_t begin, size_t end) const;
+
+    void executeDirect(uint8_t* dstData);
+    void executeResize(float* dstData);
+
+    ColorConvertNode::Attributes attrs;
+    InferenceEngine::Precision srcPrc;
+    InferenceEngine::Precision dstPrc;
+    bool singlePlane = true;
+    size_t N = 0, H = 0, W = 0, OH = 0, OW = 0;
+
+    std::vector<const uint8_t*> planesData;
+
+    // the source coordinates of the output columns and rows, the weight is the one of the second source pixel
+    std::vector<size_t> xIdx0, xIdx1, yIdx0, yIdx1;
+    std::vector<float> xWeights, yWeights;
+
+    // per thread: the rows of the channels converted before the resize or the layout conversion
+    size_t threadBufferSize = 0;
+    std::vector<float> buffers;
+
+    std::shared_ptr<jit_uni_color_convert_kernel> kernel;
+
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
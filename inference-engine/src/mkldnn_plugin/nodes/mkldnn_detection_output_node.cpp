@@ -10,10 +10,12 @@
 #include <ngraph/op/detection_output.hpp>
 #include "ie_parallel.hpp"
 #include "mkldnn_detection_output_node.h"
+#include "nms_imp.hpp"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace InferenceEngine::Extensions::Cpu;
 
 template <typename T>
 bool SortScorePairDescend(const std::pair<float, T>& pair1,
@@ -137,6 +139,8 @@ void MKLDNNDetectionOutputNode::initSupportedPrimitiveDescriptors() {
 
     std::vector<PortConfigurator> inDataConf;
     inDataConf.reserve(inputShapes.size());
+    // The kernels read FP32 only, so the BF16 predictions are converted by the reorders in front of the node.
+    // The inputs are 2D (the prior boxes are [N, 1|2, X]), so the channels last and blocked layouts have no use here.
     for (int i = 0; i < inputShapes.size(); ++i)
         inDataConf.emplace_back(LayoutType::ncsp, Precision::FP32);
 
@@ -256,8 +260,10 @@ void MKLDNNDetectionOutputNode::execute(mkldnn::stream strm) {
     // NMS
     for (int n = 0; n < imgNum; ++n) {
         if (!decreaseClassId) {
-            // Caffe style
-            parallel_for(classesNum, [&](int c) {
+            // Caffe style, the classes of many detections are taken first
+            std::vector<size_t> costs(detectionsData + n * classesNum, detectionsData + (n + 1) * classesNum);
+            nms_parallel_tasks(costs, [&](size_t task) {
+                const int c = static_cast<int>(task);
                 if (c != backgroundClassId) {  // Ignore background class
                     int *pindices    = indicesData + n * classesNum * priorsNum + c * priorsNum;
                     int *pbuffer     = indicesBufData + n * classesNum * priorsNum + c * priorsNum;
@@ -714,41 +720,32 @@ inline void MKLDNNDetectionOutputNode::topk(const int *indicesIn, int *indicesOu
                            ConfidenceComparatorDO(conf));
 }
 
-static inline float JaccardOverlap(const float *decodedBbox,
-                                   const float *bboxSizes,
-                                   const int idx1,
-                                   const int idx2) {
-    float xmin1 = decodedBbox[idx1 * 4 + 0];
-    float ymin1 = decodedBbox[idx1 * 4 + 1];
-    float xmax1 = decodedBbox[idx1 * 4 + 2];
-    float ymax1 = decodedBbox[idx1 * 4 + 3];
-
-    float xmin2 = decodedBbox[idx2 * 4 + 0];
-    float ymin2 = decodedBbox[idx2 * 4 + 1];
-    float xmax2 = decodedBbox[idx2 * 4 + 2];
-    float ymax2 = decodedBbox[idx2 * 4 + 3];
-
-    if (xmin2 > xmax1 || xmax2 < xmin1 || ymin2 > ymax1 || ymax2 < ymin1) {
-        return 0.0f;
-    }
-
-    float intersectXMin = (std::max)(xmin1, xmin2);
-    float intersectYMin = (std::max)(ymin1, ymin2);
-    float intersectXMax = (std::min)(xmax1, xmax2);
-    float intersectYMax = (std::min)(ymax1, ymax2);
-
-    float intersectWidth  = intersectXMax - intersectXMin;
-    float intersectHeight = intersectYMax - intersectYMin;
-
-    if (intersectWidth <= 0 || intersectHeight <= 0) {
-        return 0.0f;
+// Greedily keeps the candidates whose overlap with every kept one doesn't exceed the threshold, kept may be the candidates
+static int suppressCandidates(const int* candidates, int count, int* kept, const float* bboxes, const float* bboxSizes, float threshold) {
+    const iou_conf conf{iou_kind::positive, 0.f};
+    // the kept boxes, compared with every candidate at once
+    nms_box_pool keptBoxes;
+    iou_args args{};
+    args.threshold = threshold;
+    args.inclusive = false;
+
+    int detections = 0;
+    for (int i = 0; i < count; ++i) {
+        const int prior = candidates[i];
+        const float *bbox = bboxes + prior * 4;
+        args.boxes = keptBoxes.boxes();
+        args.count = keptBoxes.size();
+        args.box[0] = bbox[0];
+        args.box[1] = bbox[1];
+        args.box[2] = bbox[2];
+        args.box[3] = bbox[3];
+        args.box[4] = bboxSizes[prior];
+        if (!XARCH::iou_exec(conf, args)) {
+            keptBoxes.push(bbox[0], bbox[1], bbox[2], bbox[3], bboxSizes[prior]);
+            kept[detections++] = prior;
+        }
     }
-
-    float intersectSize = intersectWidth * intersectHeight;
-    float bbox1Size = bboxSizes[idx1];
-    float bbox2Size = bboxSizes[idx2];
-
-    return intersectSize / (bbox1Size + bbox2Size - intersectSize);
+    return detections;
 }
 
 inline void MKLDNNDetectionOutputNode::NMSCF(int* indicesIn,
@@ -757,25 +754,7 @@ inline void MKLDNNDetectionOutputNode::NMSCF(int* indicesIn,
                                         const float* bboxes,
                                         const float* boxSizes) {
     // nms for this class
-    int countIn = detections;
-    detections = 0;
-    for (int i = 0; i < countIn; ++i) {
-        const int prior = indicesIn[i];
-
-        bool keep = true;
-        for (int k = 0; k < detections; ++k) {
-            const int keptPrior = indicesOut[k];
-            float overlap = JaccardOverlap(bboxes, boxSizes, prior, keptPrior);
-            if (overlap > NMSThreshold) {
-                keep = false;
-                break;
-            }
-        }
-        if (keep) {
-            indicesOut[detections] = prior;
-            detections++;
-        }
-    }
+    detections = suppressCandidates(indicesIn, detections, indicesOut, bboxes, boxSizes, NMSThreshold);
 }
 
 inline void MKLDNNDetectionOutputNode::NMSMX(int* indicesIn,
@@ -787,34 +766,21 @@ inline void MKLDNNDetectionOutputNode::NMSMX(int* indicesIn,
     int countIn = detections[0];
     detections[0] = 0;
 
+    // the candidates of every class keep their order, so the classes are suppressed independently and in place
     for (int i = 0; i < countIn; ++i) {
         const int idx = indicesIn[i];
         const int cls = idx / priorsNum;
         const int prior = idx % priorsNum;
+        indicesOut[cls * priorsNum + detections[cls]++] = prior;
+    }
 
+    std::vector<size_t> costs(detections, detections + classesNum);
+    nms_parallel_tasks(costs, [&](size_t cls) {
         // nms within this class
-        int &ndetection = detections[cls];
         int *pindices = indicesOut + cls * priorsNum;
-
-        bool keep = true;
-        for (int k = 0; k < ndetection; ++k) {
-            const int keptPrior = pindices[k];
-            float overlap = 0.0f;
-            if (isShareLoc) {
-                overlap = JaccardOverlap(bboxes, sizes, prior, keptPrior);
-            } else {
-                overlap = JaccardOverlap(bboxes, sizes, cls * priorsNum + prior, cls * priorsNum + keptPrior);
-            }
-            if (overlap > NMSThreshold) {
-                keep = false;
-                break;
-            }
-        }
-
-        if (keep) {
-            pindices[ndetection++] = prior;
-        }
-    }
+        const size_t boxOffset = isShareLoc ? 0 : cls * priorsNum;
+        detections[cls] = suppressCandidates(pindices, detections[cls], pindices, bboxes + boxOffset * 4, sizes + boxOffset, NMSThreshold);
+    });
 }
 
 inline void MKLDNNDetectionOutputNode::generateOutput(float* reorderedConfData, int* indicesData, int* detectionsData, float* decodedBboxesData,
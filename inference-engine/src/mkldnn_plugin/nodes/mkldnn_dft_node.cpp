@@ -18,6 +18,7 @@
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace InferenceEngine::Extensions::Cpu;
 
 bool MKLDNNDFTNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
@@ -106,40 +107,15 @@ void MKLDNNDFTNode::initSupportedPrimitiveDescriptors() {
 }
 
 namespace {
-inline float getRealFromComplexProd(float lhsReal, float lhsImag, float rhsReal, float rhsImag) {
-    return lhsReal * rhsReal - lhsImag * rhsImag;
-}
-
-inline float getImaginaryFromComplexProd(float lhsReal, float lhsImag, float rhsReal, float rhsImag) {
-    return lhsReal * rhsImag + lhsImag * rhsReal;
-}
+// The lines of the same axis are transformed together, it fills the vector registers of the FFT kernels
+constexpr size_t linesBatch = 16;
 
-/*
-    Returns true while we can iterate
-    Specified axis is skipped in counters   
-*/
-inline bool nextIterationStep(std::vector<size_t>& counters, const std::vector<size_t>& iterationRange, size_t axis) {
-    auto itCounter = counters.rbegin();
-    auto itWork = iterationRange.rbegin();
-
-    while (itCounter != counters.rend() && itWork != iterationRange.rend()) {
-        if (std::distance(itCounter, counters.rend()) == axis + 1) {
-            ++itCounter;
-            ++itWork;
-            continue;
-        }
-        *itCounter = (*itCounter + 1) % *itWork;
-        if (*itCounter != 0) {
-            return true;
-        }
-        ++itCounter;
-        ++itWork;
+bool isSmoothSize(size_t n) {
+    for (size_t radix : {2, 3, 5}) {
+        while (n % radix == 0)
+            n /= radix;
     }
-    return false;
-}
-
-inline bool IsPowerOfTwo(size_t n) {
-    return (n != 0) && (n & (n - 1)) == 0;
+    return n == 1;
 }
 
 inline bool copyStep(std::vector<size_t>& counters, const std::vector<size_t>& iterationRange) {
@@ -165,30 +141,6 @@ size_t calculateOffsetFromStrides(const std::vector<size_t>& coords, const std::
     return offset;
 }
 
-void gatherToBufferND(float* buffer, const float* data, size_t axis, const std::vector<size_t>& dimIndexes,
-                                     const std::vector<size_t>& shape, const std::vector<size_t>& strides) {
-    size_t numberOfComplex = shape[axis];
-    size_t offset = calculateOffsetFromStrides(dimIndexes, strides);
-
-    for (size_t bufferIndex = 0; bufferIndex < 2 * numberOfComplex; bufferIndex += 2) {
-        buffer[bufferIndex] = data[offset];
-        buffer[bufferIndex + 1] = data[offset + 1];
-        offset += strides[axis];
-    }
-}
-
-void applyBufferND(const float* buffer, float* output, size_t axis, const std::vector<size_t>& dimIndexes,
-                                  const std::vector<size_t>& shape, const std::vector<size_t>& strides) {
-    size_t numberOfComplex = shape[axis];
-    size_t offset = calculateOffsetFromStrides(dimIndexes, strides);
-
-    for (size_t bufferIndex = 0; bufferIndex < 2 * numberOfComplex; bufferIndex += 2) {
-        output[offset] = buffer[bufferIndex];
-        output[offset + 1] = buffer[bufferIndex + 1];
-        offset += strides[axis];
-    }
-}
-
 void copyDataToOutputWithSignalSize(const float* input, const std::vector<size_t>& inputShape, const std::vector<size_t>& inputStrides,
                                     float* output, const std::vector<size_t>& outputShape, const std::vector<size_t>& outputStrides) {
     auto totalInput = std::accumulate(inputShape.begin(), inputShape.end(), 1, std::multiplies<size_t>());
@@ -240,9 +192,8 @@ void MKLDNNDFTNode::execute(mkldnn::stream strm) {
     outputShape = getChildEdgesAtPort(0)[0]->getMemory().getStaticDims();
     for (size_t axis : axes) {
         size_t nComplex = outputShape[axis];
-        // FFT uses different twiddle factors
-        if (twiddlesMap.find(nComplex) == twiddlesMap.end() && !IsPowerOfTwo(nComplex)) {
-            twiddlesMap[nComplex] = generateTwiddles(nComplex);
+        if (plans.find(nComplex) == plans.end()) {
+            plans[nComplex] = createPlan(nComplex, inverse);
         }
     }
 
@@ -260,158 +211,131 @@ void MKLDNNDFTNode::execute(mkldnn::stream strm) {
         cpu_memcpy(output, input, totalElements * sizeof(float));
     }
 
-    // 1d case
-    if (inputDataEdge->getMemory().GetShape().getRank() == 2) {
-        size_t nComplex = outputShape[0];
-        if (IsPowerOfTwo(nComplex)) {
-            fft(output, nComplex * 2, true);
-        } else {
-            naiveDFT(output, nComplex * 2);
-        }
-    } else {
-        dftNd(output, outputStrides);
-    }
+    dftNd(output, outputStrides);
 }
 
 void MKLDNNDFTNode::dftNd(float* output, const std::vector<size_t>& outputStrides) const {
-    const std::vector<size_t> iterationRange(outputShape.begin(), outputShape.end() - 1);
-    const size_t lastDimIndex = iterationRange.size() - 1;
-    for (size_t axisIndex = 0; axisIndex < axes.size(); ++axisIndex) {
-        const size_t currentAxis = axes[axisIndex];
-        const size_t outputComplexLen = outputShape[currentAxis];
-        const size_t outputLen = outputComplexLen * 2;
-
-        std::vector<size_t> iterationCounter(iterationRange.size(), 0);
-        if (IsPowerOfTwo(outputComplexLen)) {
-            size_t parallelDimIndex = lastDimIndex == currentAxis ? lastDimIndex - 1 : lastDimIndex;
-            do {
-                parallel_for(iterationRange[parallelDimIndex], [&](size_t dim) {
-                    std::vector<float> gatheredData(outputLen);
-                    auto parallelIterationCounter = iterationCounter;
-                    parallelIterationCounter[parallelDimIndex] = dim;
-                    gatherToBufferND(gatheredData.data(), output, currentAxis, parallelIterationCounter, outputShape, outputStrides);
-                    fft(gatheredData.data(), outputLen);
-                    applyBufferND(gatheredData.data(), output, currentAxis, parallelIterationCounter, outputShape, outputStrides);
-                });
-                iterationCounter[parallelDimIndex] = iterationRange[parallelDimIndex] - 1;
-            } while (nextIterationStep(iterationCounter, iterationRange, currentAxis));
-        } else {
-            std::vector<float> gatheredData(outputLen);
-            do {
-                gatherToBufferND(gatheredData.data(), output, currentAxis, iterationCounter, outputShape, outputStrides);
-                naiveDFT(gatheredData.data(), outputLen);
-                applyBufferND(gatheredData.data(), output, currentAxis, iterationCounter, outputShape, outputStrides);
-            } while (nextIterationStep(iterationCounter, iterationRange, currentAxis));
+    const size_t complexRank = outputShape.size() - 1;
+    for (size_t currentAxis : axes) {
+        const auto& plan = *plans.at(outputShape[currentAxis]);
+        const size_t nComplex = plan.n;
+        const size_t axisStride = outputStrides[currentAxis];
+
+        // the transformed lines are enumerated by the coordinates along the other dimensions
+        std::vector<size_t> lineDims, lineStrides;
+        for (size_t dim = 0; dim < complexRank; ++dim) {
+            if (dim != currentAxis) {
+                lineDims.push_back(outputShape[dim]);
+                lineStrides.push_back(outputStrides[dim]);
+            }
         }
+        const size_t linesNum = std::accumulate(lineDims.begin(), lineDims.end(), size_t(1), std::multiplies<size_t>());
+        const size_t batchesNum = div_up(linesNum, linesBatch);
+
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(batchesNum, nthr, ithr, start, end);
+            if (start >= end)
+                return;
+
+            const size_t maxBatch = std::min(linesNum, linesBatch);
+            std::vector<float> buffer(2 * nComplex * maxBatch + fft_scratch_size(plan, maxBatch));
+            float* re = buffer.data();
+            float* im = re + nComplex * maxBatch;
+            float* scratch = im + nComplex * maxBatch;
+            std::vector<size_t> offsets(maxBatch);
+
+            for (size_t batchIdx = start; batchIdx < end; ++batchIdx) {
+                const size_t firstLine = batchIdx * linesBatch;
+                const size_t batch = std::min(linesBatch, linesNum - firstLine);
+                for (size_t b = 0; b < batch; ++b) {
+                    size_t line = firstLine + b;
+                    offsets[b] = 0;
+                    for (size_t dim = lineDims.size(); dim > 0; --dim) {
+                        offsets[b] += (line % lineDims[dim - 1]) * lineStrides[dim - 1];
+                        line /= lineDims[dim - 1];
+                    }
+                }
+
+                for (size_t i = 0; i < nComplex; ++i) {
+                    for (size_t b = 0; b < batch; ++b) {
+                        const float* src = output + offsets[b] + i * axisStride;
+                        re[i * batch + b] = src[0];
+                        im[i * batch + b] = src[1];
+                    }
+                }
+                XARCH::fft_exec(plan, re, im, batch, scratch);
+                for (size_t i = 0; i < nComplex; ++i) {
+                    for (size_t b = 0; b < batch; ++b) {
+                        float* dst = output + offsets[b] + i * axisStride;
+                        dst[0] = re[i * batch + b];
+                        dst[1] = im[i * batch + b];
+                    }
+                }
+            }
+        });
     }
 }
 
-/* Cooley Tukey implementation of FFT */
-void MKLDNNDFTNode::fft(float* data, int64_t dataLength, bool parallelize) const {
-    static int cacheSizeL3 = utils::get_cache_size(3, false);
-    static int elementsPerCacheLine = cacheSizeL3 / sizeof(float);
-    std::vector<float> bufferVector(dataLength * 2, 0);
-    float* buffer = bufferVector.data();
-    cpu_memcpy(buffer, data, dataLength * sizeof(float));
-
-    size_t nComplex = dataLength / 2;
-    float* inBufferStart = buffer + dataLength;
-    float* outBufferStart = buffer;
-
-    auto blockIteration = [&] (const size_t block, const size_t blockSize, const size_t nextIterationBlockSize, const float anglePart) {
-        float* curInpBufferPtr = inBufferStart + block * blockSize;
-        float* curOutBufferPtr = outBufferStart + block * nextIterationBlockSize;
-
-        const float angle = anglePart * block;
-        const float twiddleReal = std::cos(angle);
-        const float twiddleImag = -std::sin(angle);
-        for (int64_t pair = 0; pair < blockSize / 2; pair += 2) {
-            const float evenReal = curInpBufferPtr[pair];
-            const float evenImag = curInpBufferPtr[pair + 1];
-
-            const float oddReal = curInpBufferPtr[(blockSize / 2 + pair)];
-            const float oddImag = curInpBufferPtr[(blockSize / 2 + pair) + 1];
-
-            const float twiddledOddReal = getRealFromComplexProd(twiddleReal, twiddleImag, oddReal, oddImag);
-            const float twiddledOddImag = getImaginaryFromComplexProd(twiddleReal, twiddleImag, oddReal, oddImag);
-
-            curOutBufferPtr[pair] = evenReal + twiddledOddReal;
-            curOutBufferPtr[pair + 1] = evenImag + twiddledOddImag;
-
-            curOutBufferPtr[nComplex + pair] = evenReal - twiddledOddReal;
-            curOutBufferPtr[nComplex + pair + 1] = evenImag - twiddledOddImag;
-        }
-    };
-
-    for (int64_t numBlocks = 1; numBlocks < nComplex; numBlocks *= 2) {
-        const float anglePart = PI / numBlocks * (inverse ? -1 : 1);
-
-        std::swap(inBufferStart, outBufferStart);
-        const int64_t blockSize = dataLength / numBlocks;
-        const int64_t nextIterationBlockSize = blockSize / 2;
-        if (parallelize && blockSize >= 4 * elementsPerCacheLine) {
-            parallel_for(numBlocks, [&] (const size_t block) {
-                blockIteration(block, blockSize, nextIterationBlockSize, anglePart);
-            });
-        } else {
-            for (int64_t block = 0; block < numBlocks; ++block) {
-                blockIteration(block, blockSize, nextIterationBlockSize, anglePart);
+std::shared_ptr<fft_plan> MKLDNNDFTNode::createPlan(size_t nComplex, bool inversePlan) const {
+    const double pi = 3.141592653589793238462643;
+    auto plan = std::make_shared<fft_plan>();
+    plan->n = nComplex;
+    plan->inverse = inversePlan;
+
+    if (isSmoothSize(nComplex)) {
+        size_t length = nComplex;
+        for (size_t radix : {4, 2, 3, 5}) {
+            while (length % radix == 0) {
+                fft_stage stage;
+                stage.radix = radix;
+                stage.m = length / radix;
+                for (size_t p = 0; p < stage.m; ++p) {
+                    for (size_t k = 1; k < radix; ++k) {
+                        const double phase = -2.0 * pi * static_cast<double>(p * k) / static_cast<double>(length);
+                        stage.twiddles_re.push_back(static_cast<float>(std::cos(phase)));
+                        stage.twiddles_im.push_back(static_cast<float>(std::sin(phase)));
+                    }
+                }
+                plan->stages.push_back(std::move(stage));
+                length /= radix;
             }
         }
+        return plan;
     }
 
-    for (int64_t k = 0; k < dataLength; k++) {
-        if (inverse) {
-            outBufferStart[k] /= nComplex;
-        }
-        data[k] = outBufferStart[k];
+    size_t convSize = 2 * nComplex - 1;
+    while (!isSmoothSize(convSize))
+        ++convSize;
+    plan->conv = createPlan(convSize, false);
+
+    plan->chirp_re.resize(nComplex);
+    plan->chirp_im.resize(nComplex);
+    for (size_t k = 0; k < nComplex; ++k) {
+        // k^2 is reduced modulo 2n to keep the precision of the phase
+        const double phase = -pi * static_cast<double>((k * k) % (2 * nComplex)) / static_cast<double>(nComplex);
+        plan->chirp_re[k] = static_cast<float>(std::cos(phase));
+        plan->chirp_im[k] = static_cast<float>(std::sin(phase));
     }
-}
-
-void MKLDNNDFTNode::naiveDFT(float* data, size_t dataLength) const {
-    std::vector<float> outputBuffer(dataLength);
-    const size_t nComplex = dataLength / 2;
-    const auto& twiddles = twiddlesMap.find(nComplex)->second;
-
-    parallel_for(nComplex, [&](size_t k) {
-        float sumReal = 0.0f;
-        float sumImag = 0.0f;
-        for (size_t n = 0; n < nComplex; ++n) {
-            auto it = twiddles[k * nComplex + n];
-            float complexReal = it.first;
-            float complexImag = it.second;
-
-            if (inverse) {
-                complexImag *= -1; // conjugate
-            }
-            float complexProdReal = getRealFromComplexProd(data[2 * n], data[2 * n + 1], complexReal, complexImag);
-            float complexProdImag = getImaginaryFromComplexProd(data[2 * n], data[2 * n + 1], complexReal, complexImag);
-
-            sumReal += complexProdReal;
-            sumImag += complexProdImag;
-        }
-
-        if (inverse) {
-            sumReal /= nComplex;
-            sumImag /= nComplex;
-        }
-        outputBuffer[k * 2] = sumReal;
-        outputBuffer[k * 2 + 1] = sumImag;
-    });
-    cpu_memcpy(data, outputBuffer.data(), dataLength * sizeof(float));
-}
 
-std::vector<std::pair<float, float>> MKLDNNDFTNode::generateTwiddles(size_t n_complex) const {
-    std::vector<std::pair<float, float>> twiddles(n_complex * n_complex);
-    parallel_for(n_complex, [&](const size_t k) {
-        for (size_t n = 0; n < n_complex; ++n) {
-            float phase =  2.0f * PI * static_cast<float>(n * k) / static_cast<float>(n_complex);
-            auto complexReal = std::cos(phase);
-            auto complexImag = -std::sin(phase);
-            twiddles[k * n_complex + n] = std::make_pair(complexReal, complexImag);
+    std::vector<float> filterRe(convSize, 0.f), filterIm(convSize, 0.f);
+    for (size_t k = 0; k < nComplex; ++k) {
+        filterRe[k] = plan->chirp_re[k];
+        filterIm[k] = -plan->chirp_im[k];
+        if (k > 0) {
+            filterRe[convSize - k] = filterRe[k];
+            filterIm[convSize - k] = filterIm[k];
         }
-    });
-    return twiddles;
+    }
+    std::vector<float> scratch(fft_scratch_size(*plan->conv, 1));
+    XARCH::fft_exec(*plan->conv, filterRe.data(), filterIm.data(), 1, scratch.data());
+    for (size_t k = 0; k < convSize; ++k) {
+        filterRe[k] /= convSize;
+        filterIm[k] /= -static_cast<float>(convSize);
+    }
+    plan->filter_re = std::move(filterRe);
+    plan->filter_im = std::move(filterIm);
+    return plan;
 }
 
 bool MKLDNNDFTNode::created() const {
@@ -38,6 +38,7 @@
 #include <map>
 #include <functional>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
+#include <common/utils.hpp>
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -61,24 +62,133 @@ struct EltwiseEmitterContext {
     std::shared_ptr<jit_emitter> emitter;
     jit_generator *host;
     cpu_isa_t host_isa;
-    const MKLDNNNode *node;
+    const MKLDNNEltwiseNode::EltwiseData& opData;
     InferenceEngine::Precision exec_prc;
 };
 
 template<typename T>
 struct EltwiseEmitter {
     void operator()(EltwiseEmitterContext & ctx) {
-        ctx.emitter = std::make_shared<T>(ctx.host, ctx.host_isa, ctx.node, ctx.exec_prc);
+        // the emitters of the operations without attributes don't refer the node
+        ctx.emitter = std::make_shared<T>(ctx.host, ctx.host_isa, static_cast<const MKLDNNNode*>(nullptr), ctx.exec_prc);
     }
 };
 
+template<>
+struct EltwiseEmitter<jit_mkldnn_aux_emitter> {
+    void operator()(EltwiseEmitterContext & ctx) {
+        auto algKind = static_cast<mkldnn_alg_kind_t>(ctx.opData.mkldnnAlgo);
+        ctx.emitter = std::make_shared<jit_mkldnn_aux_emitter>(ctx.host, ctx.host_isa, algKind, ctx.opData.alpha, ctx.opData.beta,
+                                                               ctx.exec_prc);
+    }
+};
+
+template<>
+struct EltwiseEmitter<jit_power_static_emitter> {
+    void operator()(EltwiseEmitterContext & ctx) {
+        ctx.emitter = std::make_shared<jit_power_static_emitter>(ctx.host, ctx.host_isa, ctx.opData.alpha, ctx.opData.beta, ctx.opData.gamma,
+                                                                 ctx.exec_prc);
+    }
+};
+
+/**
+ * Implements the runtime cache key for the Eltwise executors. The key describes everything the kernel code generation depends on:
+ * the operations chain (the node itself and the fused Eltwise nodes), the types of the fused nodes, the prepared jit params
+ * and the scheduling parameters.
+ */
+struct EltwiseKey {
+    std::vector<MKLDNNEltwiseNode::EltwiseData> eltwiseData;
+    std::vector<Type> opsList;
+    jit_eltwise_params jep;
+    size_t schedulerWorkAmount;
+    size_t fullWorkAmount;
+    size_t batchDimIdx;
+    bool useJit;
+
+    size_t hash() const;
+    bool operator==(const EltwiseKey& rhs) const;
+};
+
+size_t EltwiseKey::hash() const {
+    using namespace mkldnn::impl;
+
+    auto combineVector = [](size_t seed, const VectorDims& vec) {
+        for (const auto& val : vec)
+            seed = hash_combine(seed, val);
+        return seed;
+    };
+
+    size_t seed = 0;
+    for (const auto& data : eltwiseData) {
+        seed = hash_combine(seed, static_cast<int>(data.algo));
+        seed = hash_combine(seed, static_cast<int>(data.mkldnnAlgo));
+        seed = hash_combine(seed, data.alpha);
+        seed = hash_combine(seed, data.beta);
+        seed = hash_combine(seed, data.gamma);
+    }
+    for (const auto& type : opsList)
+        seed = hash_combine(seed, static_cast<int>(type));
+
+    seed = hash_combine(seed, jep.inputs_number);
+    seed = hash_combine(seed, jep.input_size);
+    for (size_t i = 0; i < jep.inputs_number; i++) {
+        seed = hash_combine(seed, static_cast<int>(jep.src_prc[i]));
+        seed = hash_combine(seed, jep.src_size[i]);
+        seed = combineVector(seed, jep.src_offsets[i]);
+    }
+    seed = hash_combine(seed, static_cast<int>(jep.dst_prc));
+    seed = combineVector(seed, jep.dims);
+    seed = combineVector(seed, jep.dst_offsets);
+    seed = combineVector(seed, jep.oc_offsets);
+    seed = hash_combine(seed, jep.dst_size);
+    seed = hash_combine(seed, jep.oc_size);
+    seed = hash_combine(seed, jep.work_amount);
+
+    seed = hash_combine(seed, schedulerWorkAmount);
+    seed = hash_combine(seed, fullWorkAmount);
+    seed = hash_combine(seed, batchDimIdx);
+    seed = hash_combine(seed, useJit);
+    return seed;
+}
+
+bool EltwiseKey::operator==(const EltwiseKey& rhs) const {
+    if (eltwiseData != rhs.eltwiseData ||
+        opsList != rhs.opsList ||
+        schedulerWorkAmount != rhs.schedulerWorkAmount ||
+        fullWorkAmount != rhs.fullWorkAmount ||
+        batchDimIdx != rhs.batchDimIdx ||
+        useJit != rhs.useJit)
+        return false;
+
+    if (jep.inputs_number != rhs.jep.inputs_number ||
+        jep.input_size != rhs.jep.input_size ||
+        jep.dst_prc != rhs.jep.dst_prc ||
+        jep.dims != rhs.jep.dims ||
+        jep.dst_offsets != rhs.jep.dst_offsets ||
+        jep.oc_offsets != rhs.jep.oc_offsets ||
+        jep.dst_size != rhs.jep.dst_size ||
+        jep.oc_size != rhs.jep.oc_size ||
+        jep.work_amount != rhs.jep.work_amount)
+        return false;
+
+    for (size_t i = 0; i < jep.inputs_number; i++) {
+        if (jep.src_prc[i] != rhs.jep.src_prc[i] ||
+            jep.src_size[i] != rhs.jep.src_size[i] ||
+            jep.src_offsets[i] != rhs.jep.src_offsets[i])
+            return false;
+    }
+    return true;
+}
+
 }   // namespace
 
 template <cpu_isa_t isa>
 struct jit_uni_eltwise_generic : public MKLDNNPlugin::jit_uni_eltwise_kernel, public jit_generator {
     DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_eltwise_generic)
 
-    explicit jit_uni_eltwise_generic(jit_eltwise_params jep, MKLDNNEltwiseNode& eltwiseNode) : jit_uni_eltwise_kernel(jep, eltwiseNode), jit_generator() {}
+    jit_uni_eltwise_generic(const jit_eltwise_params& jep, const std::vector<MKLDNNEltwiseNode::EltwiseData>& eltwise_data,
+                            const std::vector<Type>& ops_list, const mkldnn::post_ops& post_ops)
+        : jit_uni_eltwise_kernel(jep), jit_generator(), eltwise_data_(eltwise_data), ops_list_(ops_list), post_ops_(post_ops) {}
 
     void create_ker() override {
         jit_generator::create_kernel();
@@ -88,17 +198,15 @@ struct jit_uni_eltwise_generic : public MKLDNNPlugin::jit_uni_eltwise_kernel, pu
     void generate() override {
         Precision exec_prc = Precision::UNSPECIFIED;
 
-        std::set<Precision> supported_precision_intersection = get_supported_precisions(eltwiseNode);
-        for (int i = 0; i < eltwiseNode.getFusedWith().size(); i++) {
-            if (eltwiseNode.getFusedWith()[i].get()->getType() == Eltwise) {
-                std::set<Precision> prcs = get_supported_precisions(*eltwiseNode.getFusedWith()[i].get());
-                std::set<Precision> prcs_intersect = {};
+        std::set<Precision> supported_precision_intersection = get_supported_precisions(eltwise_data_.front().algo);
+        for (size_t i = 1; i < eltwise_data_.size(); i++) {
+            std::set<Precision> prcs = get_supported_precisions(eltwise_data_[i].algo);
+            std::set<Precision> prcs_intersect = {};
 
-                std::set_intersection(supported_precision_intersection.begin(), supported_precision_intersection.end(),
-                                      prcs.begin(), prcs.end(), std::inserter(prcs_intersect, prcs_intersect.begin()));
+            std::set_intersection(supported_precision_intersection.begin(), supported_precision_intersection.end(),
+                                  prcs.begin(), prcs.end(), std::inserter(prcs_intersect, prcs_intersect.begin()));
 
-                supported_precision_intersection = prcs_intersect;
-            }
+            supported_precision_intersection = prcs_intersect;
         }
 
         for (auto prc : exec_precisions_priority) {
@@ -116,21 +224,19 @@ struct jit_uni_eltwise_generic : public MKLDNNPlugin::jit_uni_eltwise_kernel, pu
         }
 
         if (exec_prc == Precision::UNSPECIFIED) {
-            IE_THROW() << "Eltwise jitter failed to specify execution precision for Eltwise node with name `" << eltwiseNode.getName() << "`";
+            IE_THROW() << "Eltwise jitter failed to specify execution precision";
         }
 
-        eltwise_emitter = create_eltwise_emitter(eltwiseNode, exec_prc);
+        eltwise_emitter = create_eltwise_emitter(eltwise_data_.front(), exec_prc);
 
-        mkldnn::post_ops post_ops;
-        for (int i = 0; i < eltwiseNode.getFusedWith().size(); i++) {
-            if (eltwiseNode.getFusedWith()[i].get()->getType() == Eltwise) {
-                post_op_emitters.push_back(create_eltwise_emitter(*eltwiseNode.getFusedWith()[i].get(), exec_prc));
-            } else if (eltwiseNode.getFusedWith()[i].get()->getType() == FakeQuantize) {
-               auto fakeQuantizeNode = dynamic_cast<MKLDNNFakeQuantizeNode*>(eltwiseNode.getFusedWith()[i].get());
-               fakeQuantizeNode->appendPostOps(post_ops);
-
-               quantization_injectors.push_back(std::make_shared<jit_uni_quantization_injector_f32<isa>>(
-                       this, post_ops.get()->entry_[post_ops.len() - 1], vmm_d_weights, vmm_d_bias, reg_d_weights, reg_d_bias));
+        size_t eltwise_post_op_idx = 1;
+        size_t quantization_post_op_idx = 0;
+        for (const auto& type : ops_list_) {
+            if (type == Eltwise) {
+                post_op_emitters.push_back(create_eltwise_emitter(eltwise_data_[eltwise_post_op_idx++], exec_prc));
+            } else if (type == FakeQuantize) {
+                quantization_injectors.push_back(std::make_shared<jit_uni_quantization_injector_f32<isa>>(
+                        this, post_ops_.get()->entry_[quantization_post_op_idx++], vmm_d_weights, vmm_d_bias, reg_d_weights, reg_d_bias));
             }
         }
 
@@ -204,7 +310,7 @@ struct jit_uni_eltwise_generic : public MKLDNNPlugin::jit_uni_eltwise_kernel, pu
                 is_valid_configuration = false;
 
             if (!is_valid_configuration)
-                IE_THROW() << "Eltwise jitter has invalid configuration for Eltwise node with name `" << eltwiseNode.getName() << "`";
+                IE_THROW() << "Eltwise jitter has invalid configuration";
 
             L(unroll_loop_label);
             {
@@ -375,6 +481,11 @@ private:
 
     std::shared_ptr<jit_emu_vcvtneps2bf16> emu_vcvtneps2bf16;
 
+    // the operations chain is copied, so the kernel shared by the runtime cache doesn't refer the node
+    std::vector<MKLDNNEltwiseNode::EltwiseData> eltwise_data_;
+    std::vector<Type> ops_list_;
+    mkldnn::post_ops post_ops_;
+
     std::shared_ptr<jit_emitter> eltwise_emitter = nullptr;
     std::vector<std::shared_ptr<jit_emitter>> post_op_emitters = {};
 
@@ -390,10 +501,10 @@ private:
         Precision::FP32
     };
 
-    std::set<Precision> get_supported_precisions(MKLDNNNode& node) {
+    std::set<Precision> get_supported_precisions(Algorithm algo) {
         std::set<Precision> precisions;
 
-        OV_SWITCH(MKLDNNPlugin, SupportedPrecisions, precisions, node.getAlgorithm(),
+        OV_SWITCH(MKLDNNPlugin, SupportedPrecisions, precisions, algo,
         OV_CASE(EltwiseRelu, jit_mkldnn_aux_emitter),
         OV_CASE(EltwiseGelu, jit_mkldnn_aux_emitter),
         OV_CASE(EltwiseElu, jit_mkldnn_aux_emitter),
@@ -441,18 +552,16 @@ private:
         return precisions;
     }
 
-    std::shared_ptr<jit_emitter> create_eltwise_emitter(MKLDNNNode& node, Precision exec_prec) {
-        const auto& eltwiseNode = dynamic_cast<const MKLDNNEltwiseNode&>(node);
-
+    std::shared_ptr<jit_emitter> create_eltwise_emitter(const MKLDNNEltwiseNode::EltwiseData& data, Precision exec_prec) {
         EltwiseEmitterContext ctx = {
             nullptr,
             this,
             isa,
-            &node,
+            data,
             exec_prec
         };
 
-        OV_SWITCH(MKLDNNPlugin, EltwiseEmitter, ctx, eltwiseNode.getAlgorithm(),
+        OV_SWITCH(MKLDNNPlugin, EltwiseEmitter, ctx, data.algo,
         OV_CASE(EltwiseRelu, jit_mkldnn_aux_emitter),
         OV_CASE(EltwiseGelu, jit_mkldnn_aux_emitter),
         OV_CASE(EltwiseElu, jit_mkldnn_aux_emitter),
@@ -518,8 +627,8 @@ private:
         int input_idx = eltwise_emitter->get_inputs_num();
         int eltwise_post_op_idx = 0;
         int quantization_post_op_idx = 0;
-        for (int i = 0; i < eltwiseNode.getFusedWith().size(); i++) {
-            if (eltwiseNode.getFusedWith()[i].get()->getType() == Eltwise) {
+        for (int i = 0; i < ops_list_.size(); i++) {
+            if (ops_list_[i] == Eltwise) {
                 std::vector<size_t> in_idxs;
                 std::vector<size_t> aux_idxs;
                 in_idxs.push_back(vmm_dst.getIdx());
@@ -535,8 +644,9 @@ private:
 
                 eltwise_post_op_idx++;
             } else {
-                bool do_dequantization = eltwiseNode.getFusedWith()[i]->getAlgorithm() == FQCommon;
-                bool do_rounding = do_dequantization || jep_.dst_prc == Precision::FP32 || i != eltwiseNode.getFusedWith().size() - 1;
+                const auto& post_op = post_ops_.get()->entry_[quantization_post_op_idx];
+                bool do_dequantization = post_op.quantization.alg == mkldnn::impl::alg_kind::quantization_quantize_dequantize;
+                bool do_rounding = do_dequantization || jep_.dst_prc == Precision::FP32 || i != ops_list_.size() - 1;
                 int s_idx = vmm_dst.getIdx();
 
                 quantization_injectors[quantization_post_op_idx]->init_crop_ptrs(reg_oc_off);
@@ -1441,10 +1551,35 @@ void MKLDNNEltwiseNode::prepareParams() {
     std::transform(jep.oc_offsets.begin(), jep.oc_offsets.end(), jep.oc_offsets.begin(),
                    [](size_t& offset) { return offset * sizeof(float);});
 
-    if (canUseOptimizedImpl) {
-        execPtr = std::make_shared<EltwiseJitExecutor>(jep, *this, schedulerWorkAmount, batchDimIdx);
+    EltwiseKey key = {{}, {}, jep, schedulerWorkAmount, fullWorkAmount, batchDimIdx, canUseOptimizedImpl};
+    key.eltwiseData.push_back({getAlgorithm(), getMKLDNNAlgorithm(), getAlpha(), getBeta(), getGamma()});
+    mkldnn::post_ops postOps;
+    for (const auto& fusedNode : fusedWith) {
+        if (auto eltwiseNode = std::dynamic_pointer_cast<MKLDNNEltwiseNode>(fusedNode)) {
+            key.eltwiseData.push_back({eltwiseNode->getAlgorithm(), eltwiseNode->getMKLDNNAlgorithm(),
+                                       eltwiseNode->getAlpha(), eltwiseNode->getBeta(), eltwiseNode->getGamma()});
+            key.opsList.push_back(Eltwise);
+        } else if (auto fakeQuantizeNode = std::dynamic_pointer_cast<MKLDNNFakeQuantizeNode>(fusedNode)) {
+            fakeQuantizeNode->appendPostOps(postOps);
+            key.opsList.push_back(FakeQuantize);
+        }
+    }
+
+    auto builder = [&postOps](const EltwiseKey& key) -> executorPtr {
+        if (key.useJit) {
+            return std::make_shared<EltwiseJitExecutor>(key.jep, key.eltwiseData, key.opsList, postOps, key.schedulerWorkAmount,
+                                                        key.batchDimIdx);
+        } else {
+            return std::make_shared<EltwiseRefExecutor>(key.jep, key.fullWorkAmount, key.batchDimIdx);
+        }
+    };
+
+    // The kernel with fused FakeQuantize refers to the quantization data of the particular node, so it can't be shared
+    auto cache = getRuntimeCache();
+    if (cache && !isFusedWith(FakeQuantize)) {
+        execPtr = cache->getOrCreate(key, builder).first;
     } else {
-        execPtr = std::make_shared<EltwiseRefExecutor>(jep, fullWorkAmount, batchDimIdx);
+        execPtr = builder(key);
     }
 }
 
@@ -1856,14 +1991,16 @@ InferenceEngine::Precision MKLDNNEltwiseNode::getRuntimePrecision() const {
     return getMaxPrecision(inputPrecisions);
 }
 
-MKLDNNEltwiseNode::EltwiseJitExecutor::EltwiseJitExecutor(const jit_eltwise_params &_jep, MKLDNNEltwiseNode& node, const size_t schedWA, const size_t batch)
+MKLDNNEltwiseNode::EltwiseJitExecutor::EltwiseJitExecutor(const jit_eltwise_params &_jep, const std::vector<EltwiseData>& eltwiseData,
+                                                          const std::vector<Type>& opsList, const mkldnn::post_ops& postOps,
+                                                          const size_t schedWA, const size_t batch)
                                                     : schedulerWorkAmount(schedWA), EltwiseExecutor(batch) {
     if (mayiuse(x64::avx512_common)) {
-        pKernel.reset(new jit_uni_eltwise_generic<x64::avx512_common>(_jep, node));
+        pKernel.reset(new jit_uni_eltwise_generic<x64::avx512_common>(_jep, eltwiseData, opsList, postOps));
     } else if (mayiuse(x64::avx2)) {
-        pKernel.reset(new jit_uni_eltwise_generic<x64::avx2>(_jep, node));
+        pKernel.reset(new jit_uni_eltwise_generic<x64::avx2>(_jep, eltwiseData, opsList, postOps));
     } else if (mayiuse(x64::sse41)) {
-        pKernel.reset(new jit_uni_eltwise_generic<x64::sse41>(_jep, node));
+        pKernel.reset(new jit_uni_eltwise_generic<x64::sse41>(_jep, eltwiseData, opsList, postOps));
     } else {
         IE_THROW() << "Can't create jit eltwise kernel";
     }
@@ -44,8 +44,6 @@ struct jit_eltwise_call_args_indexes {
     size_t indexes[MAX_ELTWISE_DIM_RANK];
 };
 
-class MKLDNNEltwiseNode;
-
 struct jit_uni_eltwise_kernel {
     void (*ker_)(const jit_eltwise_call_args_ptrs*, const jit_eltwise_call_args_indexes*);
 
@@ -54,13 +52,12 @@ struct jit_uni_eltwise_kernel {
         ker_(const_args, indexes);
     }
 
-    explicit jit_uni_eltwise_kernel(jit_eltwise_params jep, MKLDNNEltwiseNode& node) : ker_(nullptr), jep_(jep), eltwiseNode(node) {}
+    explicit jit_uni_eltwise_kernel(const jit_eltwise_params& jep) : ker_(nullptr), jep_(jep) {}
     virtual ~jit_uni_eltwise_kernel() {}
 
     virtual void create_ker() = 0;
 
     jit_eltwise_params jep_;
-    MKLDNNEltwiseNode& eltwiseNode;
 };
 
 class MKLDNNEltwiseNode : public MKLDNNNode {
@@ -98,6 +95,20 @@ public:
 
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
 
+    // parameters of the operation the kernel code depends on
+    struct EltwiseData {
+        Algorithm algo;
+        mkldnn::algorithm mkldnnAlgo;
+        float alpha;
+        float beta;
+        float gamma;
+
+        bool operator==(const EltwiseData& rhs) const {
+            return algo == rhs.algo && mkldnnAlgo == rhs.mkldnnAlgo &&
+                   alpha == rhs.alpha && beta == rhs.beta && gamma == rhs.gamma;
+        }
+    };
+
 private:
     struct EltwiseExecutor {
         EltwiseExecutor(size_t batch) : batchDimIdx(batch) {}
@@ -111,7 +122,8 @@ private:
     executorPtr execPtr = nullptr;
 
     struct EltwiseJitExecutor : public EltwiseExecutor {
-        EltwiseJitExecutor(const jit_eltwise_params &_jep, MKLDNNEltwiseNode& node, const size_t schedWA, const size_t batch);
+        EltwiseJitExecutor(const jit_eltwise_params &_jep, const std::vector<EltwiseData>& eltwiseData, const std::vector<Type>& opsList,
+                           const mkldnn::post_ops& postOps, const size_t schedWA, const size_t batch);
         void exec(const MKLDNNEltwiseNode& node, const jit_eltwise_call_args_ptrs &args_ptrs, const VectorDims &dims_out) override;
         const jit_eltwise_params& getJep() const override;
 
@@ -10,6 +10,7 @@
 #include "mkldnn_embedding_bag_sum_node.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include "utils/general_utils.h"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -42,72 +43,72 @@ MKLDNNEmbeddingBagSumNode::MKLDNNEmbeddingBagSumNode(
     }
 }
 
-template<typename T>
-void MKLDNNEmbeddingBagSumNode::processData(const T* srcData, const T* weightsData, T* dstData,
+void MKLDNNEmbeddingBagSumNode::processData(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData, const InferenceEngine::Precision &srcPrc,
                                             const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims) {
     std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
 
     initFromInputs();
 
     const size_t outputBagsNum = outDataDims[0];
+    const size_t elemSize = srcPrc.size();
+    const Extensions::Cpu::emb_bag_conf conf{srcPrc, _embDepth};
+
+    // A few bags don't load all the threads, so their rows are split to the chunks as well. The chunks are multiples of
+    // the cache line to keep the threads off the same lines of the output.
+    const size_t threadsNum = parallel_get_max_threads();
+    const size_t minChunk = 64;
+    size_t chunksNum = 1lu;
+    if (outputBagsNum < 2 * threadsNum)
+        chunksNum = std::min(div_up(2 * threadsNum, outputBagsNum), div_up(_embDepth, minChunk));
+    const size_t chunkSize = rnd_up(div_up(_embDepth, chunksNum), minChunk);
+    chunksNum = div_up(_embDepth, chunkSize);
+    const size_t workAmount = outputBagsNum * chunksNum;
+
+    auto prepareBag = [&](size_t item, Extensions::Cpu::emb_bag_args& args) {
+        const size_t obi = item / chunksNum;
+        const size_t chunk = item % chunksNum;
+
+        size_t indicesSize = 0lu;
+        const int* indices = nullptr;
+        int weightsIdx = 0;
+        bool withWeights = _withWeights;
+        getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+        if (indices == nullptr)
+            indicesSize = 0lu;
+
+        for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+            if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
+                IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
+            }
+        }
+
+        args.indices = indices;
+        args.count = indicesSize;
+        args.weights = withWeights && _withWeights ? weightsData + weightsIdx * elemSize : nullptr;
+        args.dst = dstData + obi * _embDepth * elemSize;
+        args.begin = chunk * chunkSize;
+        args.end = std::min(_embDepth, args.begin + chunkSize);
+    };
 
     auto threadBody = [&](const int ithr, const int nthr) {
         size_t start(0lu), end(0lu);
-        splitter(outputBagsNum, nthr, ithr, start, end);
+        splitter(workAmount, nthr, ithr, start, end);
         if (start >= end)
             return;
 
-        size_t indicesSize = 0lu;
-        const int* indices = nullptr;
-        int weightsIdx = 0lu;
-        bool withWeights = _withWeights;
-
-        for (size_t obi = start; obi < end; obi++) {
-            size_t dstIndex = obi * _embDepth;
-            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
-
-            if (indices != nullptr) {
-                withWeights = withWeights & _withWeights;
-
-                size_t inIdx = 0lu;
-                if (indices[inIdx] >= inDataDims[0]) {
-                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
-                }
-                size_t srcIndex = indices[inIdx] * _embDepth;
-
-                if (withWeights) {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
-                    }
-                    weightsIdx++;
-                } else {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i];
-                    }
-                }
-
-                for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
-                    if (indices[inIdx] >= inDataDims[0]) {
-                        IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
-                    }
-                    size_t srcIndex = indices[inIdx] * _embDepth;
-
-                    if (withWeights) {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
-                        }
-                        weightsIdx++;
-                    } else {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i];
-                        }
-                    }
-                }
+        Extensions::Cpu::emb_bag_args args{}, nextArgs{};
+        prepareBag(start, args);
+        for (size_t item = start; item < end; item++) {
+            if (item + 1 < end) {
+                prepareBag(item + 1, nextArgs);
+                args.next_indices = nextArgs.indices;
+                args.next_count = nextArgs.count;
             } else {
-                for (size_t i = 0lu; i < _embDepth; i++) {
-                    dstData[dstIndex + i] = 0;
-                }
+                args.next_indices = nullptr;
+                args.next_count = 0lu;
             }
+            Extensions::Cpu::XARCH::emb_bag_sum_exec(srcData, args, conf);
+            args = nextArgs;
         }
     };
 
@@ -117,21 +118,12 @@ void MKLDNNEmbeddingBagSumNode::processData(const T* srcData, const T* weightsDa
 void MKLDNNEmbeddingBagSumNode::execute(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData, const InferenceEngine::Precision &srcPrc,
                                         const InferenceEngine::SizeVector& inDims, const InferenceEngine::SizeVector& outDims) {
     switch (srcPrc) {
-        case Precision::FP32: {
-            return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
-                    reinterpret_cast<const float*>(weightsData), reinterpret_cast<float*>(dstData), inDims, outDims);
-        }
-        case Precision::I8: {
-            return processData<PrecisionTrait<Precision::I8>::value_type>(reinterpret_cast<const int8_t*>(srcData),
-                    reinterpret_cast<const int8_t*>(weightsData), reinterpret_cast<int8_t*>(dstData), inDims, outDims);
-        }
-        case Precision::U8: {
-            return processData<PrecisionTrait<Precision::U8>::value_type>(srcData, weightsData, dstData, inDims, outDims);
-        }
-        case Precision::I32: {
-            return processData<PrecisionTrait<Precision::I32>::value_type>(reinterpret_cast<const int32_t*>(srcData),
-                    reinterpret_cast<const int32_t*>(weightsData), reinterpret_cast<int32_t*>(dstData), inDims, outDims);
-        }
+        case Precision::FP32:
+        case Precision::BF16:
+        case Precision::I8:
+        case Precision::U8:
+        case Precision::I32:
+            return processData(srcData, weightsData, dstData, srcPrc, inDims, outDims);
         default: {
             IE_THROW() << "EmbeddingBagSum layer does not support precision '"
                         + std::string(srcPrc.name()) + "'";
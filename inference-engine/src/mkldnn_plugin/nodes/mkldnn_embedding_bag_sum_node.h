@@ -9,6 +9,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include "embedding_bag_sum_imp.hpp"
 
 namespace MKLDNNPlugin {
 
@@ -35,8 +36,7 @@ protected:
             int& weightsIdx,
             bool& withWeights) = 0;
 
-    template<typename T>
-    void processData(const T* srcData, const T* weightsData, T* dstData,
+    void processData(const uint8_t* srcData, const uint8_t* weightsData, uint8_t* dstData, const InferenceEngine::Precision &srcPrc,
                      const InferenceEngine::SizeVector& inDataDims, const InferenceEngine::SizeVector& outDataDims);
 
     const size_t EMB_TABLE_IDX = 0lu;
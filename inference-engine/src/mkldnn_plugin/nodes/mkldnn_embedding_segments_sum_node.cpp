@@ -51,11 +51,9 @@ void MKLDNNEmbeddingSegmentsSumNode::initSupportedPrimitiveDescriptors() {
 
     std::string logPrefix = std::string("Layer EmbeddingBagSum with name '") + _layerName + "' ";
     static const std::set<Precision> supportedPrecisions =
-            {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
+            {Precision::FP32, Precision::BF16, Precision::I8, Precision::U8, Precision::I32};
 
     auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (inDataPrecision == Precision::BF16)
-        inDataPrecision = Precision::FP32;
     if (!supportedPrecisions.empty()) {
         if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end())
             IE_THROW() << logPrefix << "has unsupported precision: " << inDataPrecision.name();
@@ -91,6 +89,16 @@ void MKLDNNEmbeddingSegmentsSumNode::initFromInputs() {
     if (getParentEdges().size() > DEFAULT_INDEX_IDX) {
         defaultIndices_ = reinterpret_cast<const int *>(getParentEdgeAt(DEFAULT_INDEX_IDX)->getMemoryPtr()->GetPtr());
     }
+
+    segmentsStart_.assign(numSegments_, 0);
+    segmentsSize_.assign(numSegments_, 0lu);
+    for (size_t si = 0; si < indicesSize_; si++) {
+        const int segment = segmentIds_[si];
+        if (segment < 0 || segment >= numSegments_)
+            continue;
+        if (segmentsSize_[segment]++ == 0lu)
+            segmentsStart_[segment] = static_cast<int>(si);
+    }
 }
 
 void MKLDNNEmbeddingSegmentsSumNode::getIndices(int embIndex, const int*& indices, size_t& size, int& weightsIdx, bool& withWeight) {
@@ -98,19 +106,9 @@ void MKLDNNEmbeddingSegmentsSumNode::getIndices(int embIndex, const int*& indice
         IE_THROW() << "Invalid embedding bag index.";
 
     indices = nullptr;
-    size = 0;
+    size = segmentsSize_[embIndex];
     withWeight = true;
 
-    for (int si = 0; si < indicesSize_; si++) {
-        if (segmentIds_[si] == embIndex) {
-            size++;
-            if (indices == nullptr) {
-                indices = indices_ + si;
-                weightsIdx = si;
-            }
-        }
-    }
-
     // Empty bag
     if (size == 0) {
         size = 1lu;
@@ -119,6 +117,9 @@ void MKLDNNEmbeddingSegmentsSumNode::getIndices(int embIndex, const int*& indice
             indices = defaultIndices_;
         return;
     }
+
+    indices = indices_ + segmentsStart_[embIndex];
+    weightsIdx = segmentsStart_[embIndex];
 }
 
 void MKLDNNEmbeddingSegmentsSumNode::execute(mkldnn::stream strm) {
@@ -39,6 +39,10 @@ private:
     const int* defaultIndices_ = nullptr;
 
     size_t indicesSize_ = 0;
+
+    // the first index and the number of indices of every segment, the segment ids are sorted
+    std::vector<int> segmentsStart_;
+    std::vector<size_t> segmentsSize_;
 };
 
 }  // namespace MKLDNNPlugin
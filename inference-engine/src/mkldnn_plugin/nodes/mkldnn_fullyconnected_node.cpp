@@ -7,6 +7,8 @@
 #include "mkldnn_fake_quantize_node.h"
 #include "ngraph_transformations/op/fully_connected.hpp"
 #include <ngraph/opsets/opset1.hpp>
+#include <functional>
+#include <numeric>
 #include <string>
 #include <vector>
 #include <mkldnn_extension_utils.h>
@@ -14,10 +16,173 @@
 #include "utils/general_utils.h"
 #include <memory_desc/cpu_memory_desc_utils.h>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
+#include "ie_parallel.hpp"
+#include <ngraph/type/float16.hpp>
+#include <cpu/x64/jit_generator.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu::x64;
+
+#define GET_OFF(field) offsetof(jit_fc_decompression_call_args, field)
+
+// Computes jcp.oc_block outputs of one src row. Each src vector is loaded once and multiplied by all the weights rows
+// of the block, the weights are converted to FP32 in registers so only the compressed values are read from memory.
+template <cpu_isa_t isa>
+struct jit_uni_fc_decompression_kernel_f32 : public jit_uni_fc_decompression_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_fc_decompression_kernel_f32)
+
+    explicit jit_uni_fc_decompression_kernel_f32(jit_fc_decompression_config_params jcp)
+        : jit_uni_fc_decompression_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_ic, ptr[reg_params + GET_OFF(ic)]);
+        mov(reg_tmp, ptr[reg_params + GET_OFF(weights_stride)]);
+        mov(reg_weights[0], ptr[reg_params + GET_OFF(weights)]);
+        for (size_t oc = 1; oc < jcp_.oc_block; oc++)
+            lea(reg_weights[oc], ptr[reg_weights[oc - 1] + reg_tmp]);
+        if (jcp_.with_scales)
+            mov(reg_scales, ptr[reg_params + GET_OFF(scales)]);
+        if (jcp_.with_bias)
+            mov(reg_bias, ptr[reg_params + GET_OFF(bias)]);
+
+        for (size_t oc = 0; oc < jcp_.oc_block; oc++)
+            uni_vpxor(get_acc(oc), get_acc(oc), get_acc(oc));
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label reduce_label;
+        Xbyak::Label tail_loop_label;
+        Xbyak::Label exit_label;
+
+        const int step = vlen / sizeof(float);
+        const int weights_size = jcp_.weights_prc.size();
+        L(main_loop_label); {
+            cmp(reg_ic, step);
+            jl(reduce_label, T_NEAR);
+
+            uni_vmovups(vmm_src, ptr[reg_src]);
+            for (size_t oc = 0; oc < jcp_.oc_block; oc++) {
+                load_weights(vmm_weights, ptr[reg_weights[oc]]);
+                vfmadd231ps(get_acc(oc), vmm_src, vmm_weights);
+                add(reg_weights[oc], step * weights_size);
+            }
+
+            add(reg_src, step * sizeof(float));
+            sub(reg_ic, step);
+            jmp(main_loop_label, T_NEAR);
+        }
+
+        L(reduce_label);
+        for (size_t oc = 0; oc < jcp_.oc_block; oc++)
+            reduce(get_acc(oc));
+
+        L(tail_loop_label); {
+            cmp(reg_ic, 1);
+            jl(exit_label, T_NEAR);
+
+            vmovss(xmm_src, ptr[reg_src]);
+            for (size_t oc = 0; oc < jcp_.oc_block; oc++) {
+                load_weights_scalar(xmm_weights, reg_weights[oc]);
+                vfmadd231ss(Xbyak::Xmm(get_acc(oc).getIdx()), xmm_src, xmm_weights);
+                add(reg_weights[oc], weights_size);
+            }
+
+            add(reg_src, sizeof(float));
+            sub(reg_ic, 1);
+            jmp(tail_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+        for (size_t oc = 0; oc < jcp_.oc_block; oc++) {
+            Xbyak::Xmm xmm_acc = Xbyak::Xmm(get_acc(oc).getIdx());
+            if (jcp_.with_scales)
+                vmulss(xmm_acc, xmm_acc, ptr[reg_scales + oc * sizeof(float)]);
+            if (jcp_.with_bias)
+                vaddss(xmm_acc, xmm_acc, ptr[reg_bias + oc * sizeof(float)]);
+            vmovss(ptr[reg_dst + oc * sizeof(float)], xmm_acc);
+        }
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename mkldnn::impl::utils::conditional3<isa == sse41, Xbyak::Xmm, isa == avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const size_t vlen = cpu_isa_traits<isa>::vlen;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_weights[4] = {r10, r11, r12, r13};
+    Xbyak::Reg64 reg_ic = r14;
+    Xbyak::Reg64 reg_tmp = r15;
+    Xbyak::Reg64 reg_scales = rax;
+    Xbyak::Reg64 reg_bias = rbx;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    // Vmm(0) .. Vmm(oc_block - 1) are the accumulators
+    Vmm vmm_src = Vmm(4);
+    Xbyak::Xmm xmm_src = Xbyak::Xmm(4);
+    Vmm vmm_weights = Vmm(5);
+    Xbyak::Xmm xmm_weights = Xbyak::Xmm(5);
+    Xbyak::Xmm xmm_aux = Xbyak::Xmm(6);
+
+    Vmm get_acc(size_t oc) const {
+        return Vmm(static_cast<int>(oc));
+    }
+
+    void load_weights(const Vmm& vmm, const Xbyak::Address& addr) {
+        if (jcp_.weights_prc == Precision::FP16) {
+            vcvtph2ps(vmm, addr);
+        } else {
+            vpmovsxbd(vmm, addr);
+            vcvtdq2ps(vmm, vmm);
+        }
+    }
+
+    void load_weights_scalar(const Xbyak::Xmm& xmm, const Xbyak::Reg64& reg) {
+        if (jcp_.weights_prc == Precision::FP16) {
+            movzx(reg_tmp.cvt32(), word[reg]);
+            vmovd(xmm, reg_tmp.cvt32());
+            vcvtph2ps(xmm, xmm);
+        } else {
+            movsx(reg_tmp.cvt32(), byte[reg]);
+            vcvtsi2ss(xmm, xmm, reg_tmp.cvt32());
+        }
+    }
+
+    // sums up the vector elements to the lowest one
+    void reduce(const Vmm& vmm) {
+        if (isa == avx512_core) {
+            vextractf64x4(Xbyak::Ymm(xmm_aux.getIdx()), Xbyak::Zmm(vmm.getIdx()), 1);
+            vaddps(Xbyak::Ymm(vmm.getIdx()), Xbyak::Ymm(vmm.getIdx()), Xbyak::Ymm(xmm_aux.getIdx()));
+        }
+        Xbyak::Xmm xmm = Xbyak::Xmm(vmm.getIdx());
+        vextractf128(xmm_aux, Xbyak::Ymm(vmm.getIdx()), 1);
+        vaddps(xmm, xmm, xmm_aux);
+        vhaddps(xmm, xmm, xmm);
+        vhaddps(xmm, xmm, xmm);
+    }
+};
+
+// vcvtph2ps of the FP16 weights belongs to F16C, which isn't implied by AVX2, the reference code is used without it
+static cpu_isa_t getDecompressionKernelIsa(const Precision& weightsPrc) {
+    if (weightsPrc == Precision::FP16 && !cpu().has(Xbyak::util::Cpu::tF16C))
+        return isa_any;
+    if (mayiuse(avx512_core))
+        return avx512_core;
+    if (mayiuse(avx2))
+        return avx2;
+    return isa_any;
+}
 
 bool MKLDNNFullyConnectedNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
@@ -119,6 +284,10 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
     biasesDims.push_back(weightsDims[0]);
 
+    // the node is executed by the own kernel, see initSupportedPrimitiveDescriptors
+    if (decompressionPrecision != Precision::UNSPECIFIED)
+        return;
+
     for (auto format : getAvailableFormatsForDims(getInputShapeAtPort(0))) {
         auto in_candidate = mkldnn::memory::desc(MKLDNNExtensionUtils::convertToDnnlDims(inDims), inputDataType, format);
         auto out_candidate = mkldnn::memory::desc(MKLDNNExtensionUtils::convertToDnnlDims(outDims), outputDataType, mkldnn::memory::format_tag::any);
@@ -127,10 +296,74 @@ void MKLDNNFullyConnectedNode::getSupportedDescriptors() {
     }
 }
 
+void MKLDNNFullyConnectedNode::initSupportedPrimitiveDescriptors() {
+    if (decompressionPrecision == Precision::UNSPECIFIED) {
+        MKLDNNNode::initSupportedPrimitiveDescriptors();
+        return;
+    }
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    impl_desc_type implType = impl_desc_type::ref;
+    const auto kernelIsa = getDecompressionKernelIsa(decompressionPrecision);
+    if (kernelIsa == avx512_core) {
+        implType = impl_desc_type::jit_avx512;
+    } else if (kernelIsa == avx2) {
+        implType = impl_desc_type::jit_avx2;
+    }
+
+    std::vector<PortConfigurator> inConfs = {{LayoutType::ncsp, Precision::FP32},
+                                             {LayoutType::ncsp, decompressionPrecision}};
+    if (withBiases)
+        inConfs.push_back({LayoutType::ncsp, Precision::FP32});
+    addSupportedPrimDesc(inConfs, {{LayoutType::ncsp, Precision::FP32}}, implType);
+}
+
+void MKLDNNFullyConnectedNode::setWeightsDecompression(const InferenceEngine::Precision& precision, const std::vector<float>& scales) {
+    if (!one_of(precision, Precision::FP16, Precision::I8) || (precision == Precision::I8) == scales.empty())
+        IE_THROW() << errorPrefix << " doesn't support decompression of " << precision << " weights";
+    decompressionPrecision = precision;
+    decompressionScales = scales;
+}
+
+bool MKLDNNFullyConnectedNode::canApplyWeightsDecompression() const {
+    // the dynamic batch is checked by the upper bound, the unbounded one is considered big
+    const auto& inputShape = getInputShapeAtPort(DATA_ID);
+    if (!inputShape.hasDefinedUpperBounds())
+        return false;
+    const auto& maxDims = inputShape.getMaxDims();
+    const size_t batch = std::accumulate(maxDims.begin(), maxDims.end() - 1, size_t(1), std::multiplies<size_t>());
+    return batch <= maxDecompressionBatch;
+}
+
 void MKLDNNFullyConnectedNode::createPrimitive() {
-    if (prim)
+    if (prim || decompressionKernel)
         return;
 
+    if (decompressionPrecision != Precision::UNSPECIFIED) {
+        jit_fc_decompression_config_params jcp;
+        jcp.weights_prc = decompressionPrecision;
+        jcp.with_scales = !decompressionScales.empty();
+        jcp.with_bias = withBiases;
+        jcp.oc_block = 4;
+        const auto kernelIsa = getDecompressionKernelIsa(decompressionPrecision);
+        auto createKernel = [kernelIsa](const jit_fc_decompression_config_params& jcp) -> std::shared_ptr<jit_uni_fc_decompression_kernel> {
+            std::shared_ptr<jit_uni_fc_decompression_kernel> kernel;
+            if (kernelIsa == avx512_core) {
+                kernel.reset(new jit_uni_fc_decompression_kernel_f32<avx512_core>(jcp));
+            } else if (kernelIsa == avx2) {
+                kernel.reset(new jit_uni_fc_decompression_kernel_f32<avx2>(jcp));
+            }
+            if (kernel)
+                kernel->create_ker();
+            return kernel;
+        };
+        decompressionKernel = createKernel(jcp);
+        jcp.oc_block = 1;
+        decompressionTailKernel = createKernel(jcp);
+        return;
+    }
+
     std::shared_ptr<mkldnn::primitive_attr> attr = initPrimitiveAttr();
     std::shared_ptr<inner_product_forward::primitive_desc> prim_desc;
     prim_desc = std::make_shared<inner_product_forward::primitive_desc>(
@@ -156,7 +389,9 @@ void MKLDNNFullyConnectedNode::createPrimitive() {
 }
 
 void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
-    if (prim) {
+    if (decompressionPrecision != Precision::UNSPECIFIED) {
+        executeWithDecompression();
+    } else if (prim) {
         auto reshapeMemory = [this](int argType) {
             auto param = primArgs.find(argType);
             if (param != primArgs.end()) {
@@ -178,7 +413,65 @@ void MKLDNNFullyConnectedNode::execute(mkldnn::stream strm) {
     }
 }
 
+void MKLDNNFullyConnectedNode::executeWithDecompression() {
+    const auto src = reinterpret_cast<const float*>(getParentEdgeAt(DATA_ID)->getMemoryPtr()->GetPtr());
+    const auto weights = reinterpret_cast<const uint8_t*>(getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr()->GetPtr());
+    const auto bias = withBiases ? reinterpret_cast<const float*>(getParentEdgeAt(BIAS_ID)->getMemoryPtr()->GetPtr()) : nullptr;
+    const auto scales = decompressionScales.empty() ? nullptr : decompressionScales.data();
+    auto dst = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    const size_t OC = weightsDims[0];
+    const size_t IC = std::accumulate(weightsDims.begin() + 1, weightsDims.end(), size_t(1), std::multiplies<size_t>());
+    const size_t MB = getParentEdgeAt(DATA_ID)->getMemory().GetShape().getElementsCount() / IC;
+    const size_t weightsStride = IC * decompressionPrecision.size();
+
+    auto computeRef = [&](size_t mb, size_t oc) {
+        const float* srcRow = src + mb * IC;
+        const uint8_t* weightsRow = weights + oc * weightsStride;
+        float acc = 0.f;
+        for (size_t ic = 0; ic < IC; ic++) {
+            const float w = decompressionPrecision == Precision::FP16
+                    ? static_cast<float>(reinterpret_cast<const ngraph::float16*>(weightsRow)[ic])
+                    : static_cast<float>(reinterpret_cast<const int8_t*>(weightsRow)[ic]);
+            acc += srcRow[ic] * w;
+        }
+        if (scales)
+            acc *= scales[oc];
+        if (bias)
+            acc += bias[oc];
+        dst[mb * OC + oc] = acc;
+    };
+
+    auto callKernel = [&](jit_uni_fc_decompression_kernel& kernel, size_t mb, size_t oc) {
+        jit_fc_decompression_call_args args;
+        args.src = src + mb * IC;
+        args.weights = weights + oc * weightsStride;
+        args.weights_stride = weightsStride;
+        args.scales = scales ? scales + oc : nullptr;
+        args.bias = bias ? bias + oc : nullptr;
+        args.dst = dst + mb * OC + oc;
+        args.ic = IC;
+        kernel(&args);
+    };
+
+    const size_t ocBlock = decompressionKernel ? decompressionKernel->jcp_.oc_block : 1;
+    parallel_for2d(MB, div_up(OC, ocBlock), [&](size_t mb, size_t ocb) {
+        const size_t ocStart = ocb * ocBlock;
+        if (!decompressionKernel) {
+            computeRef(mb, ocStart);
+        } else if (ocStart + ocBlock <= OC) {
+            callKernel(*decompressionKernel, mb, ocStart);
+        } else {
+            for (size_t oc = ocStart; oc < OC; oc++)
+                callKernel(*decompressionTailKernel, mb, oc);
+        }
+    });
+}
+
 bool MKLDNNFullyConnectedNode::canFuse(const MKLDNNNodePtr& node) const {
+    // the decompression kernel doesn't support post ops
+    if (decompressionPrecision != Precision::UNSPECIFIED)
+        return false;
     return canFuseSimpleOperation(node);
 }
 
@@ -320,6 +613,8 @@ void MKLDNNFullyConnectedNode::createDescriptorInternal(const mkldnn::memory::de
 
 void MKLDNNFullyConnectedNode::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
                                                 const std::vector<MemoryDescPtr> &outputDesc) {
+    if (decompressionPrecision != Precision::UNSPECIFIED)
+        return;
     createDescriptorInternal(MemoryDescUtils::convertToDnnlMemoryDesc(inputDesc[0])->getDnnlDesc(),
                              MemoryDescUtils::convertToDnnlMemoryDesc(outputDesc[0])->getDnnlDesc());
 }
@@ -12,12 +12,43 @@
 
 namespace MKLDNNPlugin {
 
+struct jit_fc_decompression_call_args {
+    const float* src;
+    const void* weights;
+    size_t weights_stride;  // in bytes
+    const float* scales;
+    const float* bias;
+    float* dst;
+    size_t ic;
+};
+
+struct jit_fc_decompression_config_params {
+    InferenceEngine::Precision weights_prc;
+    bool with_scales;
+    bool with_bias;
+    size_t oc_block;
+};
+
+struct jit_uni_fc_decompression_kernel {
+    void (*ker_)(const jit_fc_decompression_call_args *);
+
+    void operator()(const jit_fc_decompression_call_args *args) { assert(ker_); ker_(args); }
+
+    virtual void create_ker() = 0;
+
+    explicit jit_uni_fc_decompression_kernel(jit_fc_decompression_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_fc_decompression_kernel() {}
+
+    jit_fc_decompression_config_params jcp_;
+};
+
 class MKLDNNFullyConnectedNode : public MKLDNNNode {
 public:
     MKLDNNFullyConnectedNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
 
     std::vector<mkldnn::memory::format_tag> getAvailableFormatsForDims(const Shape &dims) const override;
     void getSupportedDescriptors() override;
+    void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override;
     void execute(mkldnn::stream strm) override;
     bool created() const override;
@@ -43,6 +74,19 @@ public:
 
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
 
+    /**
+     * @brief Makes the node consume the compressed weights and decompress them on the fly instead of the inner product primitive
+     * @param precision precision of the weights: FP16, or I8 quantized symmetrically per output channel
+     * @param scales dequantization scales per output channel for I8 weights, empty for FP16
+     */
+    void setWeightsDecompression(const InferenceEngine::Precision& precision, const std::vector<float>& scales);
+    /**
+     * @brief Checks the batch of the node is small enough for the decompression kernel, which computes one src row
+     * at a time (GEMV) and reads all the weights for each row. The bigger batches are executed by the inner product
+     * primitive with the weights decompressed once by the constant nodes.
+     */
+    bool canApplyWeightsDecompression() const;
+
 protected:
     std::shared_ptr<mkldnn::primitive_attr> initPrimitiveAttr();
 
@@ -58,6 +102,15 @@ private:
 
     bool withBiases = false;
 
+    void executeWithDecompression();
+
+    static const size_t maxDecompressionBatch = 8;
+
+    InferenceEngine::Precision decompressionPrecision = InferenceEngine::Precision::UNSPECIFIED;
+    std::vector<float> decompressionScales;
+    std::shared_ptr<jit_uni_fc_decompression_kernel> decompressionKernel;
+    std::shared_ptr<jit_uni_fc_decompression_kernel> decompressionTailKernel;
+
     std::string errorPrefix;
     static const size_t DATA_ID = 0;
     static const size_t WEIGHTS_ID = 1;
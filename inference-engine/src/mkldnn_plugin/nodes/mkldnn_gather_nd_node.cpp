@@ -93,10 +93,24 @@ void MKLDNNGatherNDNode::initSupportedPrimitiveDescriptors() {
 
     _dataTypeSize = inDataPrecision.size();
 
-    addSupportedPrimDesc({{LayoutType::ncsp, inDataPrecision},
-                          {LayoutType::ncsp, Precision::I32}},
-                         {{LayoutType::ncsp, inDataPrecision}},
-                         impl_desc_type::ref_any);
+    auto pushDesc = [&](LayoutType dataLayout) {
+        addSupportedPrimDesc({{dataLayout, inDataPrecision},
+                              {LayoutType::ncsp, Precision::I32}},
+                             {{dataLayout, inDataPrecision}},
+                             impl_desc_type::ref_any);
+    };
+
+    pushDesc(LayoutType::ncsp);
+
+    // When only the outermost dim is indexed, the output has the same rank and the same dims order as the data and
+    // every slice is a whole contiguous image of any layout, so the slices are copied as is
+    const auto dataRank = getInputShapeAtPort(_dataIndex).getRank();
+    const auto indicesRank = getInputShapeAtPort(_indicesIndex).getRank();
+    if ((dataRank == 4 || dataRank == 5) && indicesRank == 2 && _sliceRank == 1 && _batchDims == 0) {
+        pushDesc(LayoutType::nspc);
+        pushDesc(LayoutType::nCsp8c);
+        pushDesc(LayoutType::nCsp16c);
+    }
 }
 
 template <typename dataType>
@@ -152,12 +166,14 @@ void MKLDNNGatherNDNode::gatherBlocks() {
     const int* indices = reinterpret_cast<const int *>(getParentEdgeAt(_indicesIndex)->getMemoryPtr()->GetPtr());
     uint8_t* dstData = reinterpret_cast<uint8_t *>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
 
+    const auto strides = getParentEdgeAt(_dataIndex)->getMemory().GetDescWithType<BlockedMemoryDesc>()->getStrides();
     std::vector<size_t> srcMultipliers(_sliceRank);
     for (size_t i = 0; i < _sliceRank ; i++)
-        srcMultipliers[i] = _dataTypeSize * getParentEdgeAt(_dataIndex)->getMemory().GetDescWithType<BlockedMemoryDesc>()->getStrides()[i + _batchDims];
+        srcMultipliers[i] = _dataTypeSize * strides[i + _batchDims];
 
     const size_t batchStep = _batchStep * _dataTypeSize;
-    const size_t dataStep = _blockSize * _dataTypeSize;
+    // the stride of the last indexed dim also counts the padded channels of the blocked layouts
+    const size_t dataStep = strides[_sliceRank + _batchDims - 1] * _dataTypeSize;
     const size_t cycles = getChildEdgeAt(0)->getMemory().GetSize() / (dataStep * _batchNum);
     const size_t CS = cycles * _sliceRank;
     const size_t CB = cycles * dataStep;
@@ -2,16 +2,321 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <numeric>
 #include <vector>
 #include <string>
 #include <mkldnn_types.h>
+#include "mkldnn/ie_mkldnn.h"
 #include "ie_parallel.hpp"
 #include "mkldnn_gather_node.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include <cpu/x64/jit_generator.hpp>
+#include "utils/general_utils.h"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace mkldnn::impl::cpu::x64;
+
+#define GET_OFF(field) offsetof(jit_gather_call_args, field)
+
+// Gathers single elements: dst[i] = src[indices[i]]. The negative indices are counted from the end of the axis,
+// the out of range ones produce zeros. The elements narrower than 4 bytes are gathered as the aligned dwords containing
+// them and shifted to the lowest bytes, so the loads never cross a page boundary.
+template <cpu_isa_t isa>
+struct jit_uni_gather_kernel_f32 : public jit_uni_gather_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_gather_kernel_f32)
+
+    explicit jit_uni_gather_kernel_f32(jit_gather_config_params jcp) : jit_uni_gather_kernel(jcp), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_src_shift, ptr[reg_params + GET_OFF(src_shift)]);
+        mov(reg_idx, ptr[reg_params + GET_OFF(indices)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+
+        broadcast(vmm_range, jcp_.index_range);
+        vmovd(xmm_aux, reg_src_shift.cvt32());
+        vpbroadcastd(vmm_src_shift, xmm_aux);
+        broadcast(vmm_three, 3);
+        uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+
+        Xbyak::Label main_loop_label;
+        Xbyak::Label tail_loop_label;
+        Xbyak::Label exit_label;
+
+        const int step = vlen / sizeof(int32_t);
+        const int data_size = static_cast<int>(jcp_.data_size);
+        L(main_loop_label); {
+            cmp(reg_work_amount, step);
+            jl(tail_loop_label, T_NEAR);
+
+            uni_vmovdqu(vmm_idx, ptr[reg_idx]);
+            compute_offsets();
+            gather();
+            store();
+
+            add(reg_idx, step * sizeof(int32_t));
+            add(reg_dst, step * data_size);
+            sub(reg_work_amount, step);
+            jmp(main_loop_label, T_NEAR);
+        }
+
+        L(tail_loop_label); {
+            cmp(reg_work_amount, 1);
+            jl(exit_label, T_NEAR);
+
+            Xbyak::Label non_negative_label;
+            Xbyak::Label zero_label;
+            Xbyak::Label next_label;
+
+            movsxd(reg_tmp, dword[reg_idx]);
+            test(reg_tmp, reg_tmp);
+            jge(non_negative_label, T_NEAR);
+            add(reg_tmp, jcp_.index_range);
+            L(non_negative_label);
+            // the unsigned comparison rejects the indices which are still negative as well
+            cmp(reg_tmp, jcp_.index_range);
+            jae(zero_label, T_NEAR);
+
+            if (data_size > 1)
+                shl(reg_tmp, data_size == 2 ? 1 : 2);
+            add(reg_tmp, reg_src_shift);
+            switch (data_size) {
+            case 4:
+                mov(reg_val.cvt32(), dword[reg_src + reg_tmp]);
+                mov(dword[reg_dst], reg_val.cvt32());
+                break;
+            case 2:
+                mov(reg_val.cvt16(), word[reg_src + reg_tmp]);
+                mov(word[reg_dst], reg_val.cvt16());
+                break;
+            default:
+                mov(reg_val.cvt8(), byte[reg_src + reg_tmp]);
+                mov(byte[reg_dst], reg_val.cvt8());
+                break;
+            }
+            jmp(next_label, T_NEAR);
+
+            L(zero_label);
+            switch (data_size) {
+            case 4: mov(dword[reg_dst], 0); break;
+            case 2: mov(word[reg_dst], 0); break;
+            default: mov(byte[reg_dst], 0); break;
+            }
+
+            L(next_label);
+            add(reg_idx, sizeof(int32_t));
+            add(reg_dst, data_size);
+            sub(reg_work_amount, 1);
+            jmp(tail_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename mkldnn::impl::utils::conditional3<isa == sse41, Xbyak::Xmm, isa == avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const size_t vlen = cpu_isa_traits<isa>::vlen;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_idx = r9;
+    Xbyak::Reg64 reg_dst = r10;
+    Xbyak::Reg64 reg_work_amount = r11;
+    Xbyak::Reg64 reg_src_shift = r12;
+    Xbyak::Reg64 reg_tmp = r13;
+    Xbyak::Reg64 reg_val = r14;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_range = Vmm(0);
+    Vmm vmm_zero = Vmm(1);
+    Vmm vmm_src_shift = Vmm(2);
+    Vmm vmm_three = Vmm(3);
+    Vmm vmm_idx = Vmm(4);
+    Vmm vmm_mask = Vmm(5);
+    Vmm vmm_aux = Vmm(6);
+    Xbyak::Xmm xmm_aux = Xbyak::Xmm(6);
+    Vmm vmm_dst = Vmm(7);
+    Xbyak::Xmm xmm_dst = Xbyak::Xmm(7);
+    Vmm vmm_shift = Vmm(8);
+
+    const Xbyak::Opmask k_mask = Xbyak::Opmask(1);
+    const Xbyak::Opmask k_aux = Xbyak::Opmask(2);
+
+    void broadcast(const Vmm& vmm, int value) {
+        mov(reg_tmp.cvt32(), value);
+        vmovd(xmm_aux, reg_tmp.cvt32());
+        vpbroadcastd(vmm, xmm_aux);
+    }
+
+    // converts the indices to the byte offsets from reg_src and computes the mask of the indices in range
+    void compute_offsets() {
+        if (isa == avx512_common) {
+            vpcmpgtd(k_mask, vmm_zero, vmm_idx);
+            vpaddd(vmm_idx | k_mask, vmm_idx, vmm_range);
+            vpcmpgtd(k_mask, vmm_range, vmm_idx);
+            vpcmpgtd(k_aux, vmm_zero, vmm_idx);
+            kandnw(k_mask, k_aux, k_mask);
+        } else {
+            vpcmpgtd(vmm_mask, vmm_zero, vmm_idx);
+            vpand(vmm_mask, vmm_mask, vmm_range);
+            vpaddd(vmm_idx, vmm_idx, vmm_mask);
+            vpcmpgtd(vmm_mask, vmm_range, vmm_idx);
+            vpcmpgtd(vmm_aux, vmm_zero, vmm_idx);
+            vpandn(vmm_mask, vmm_aux, vmm_mask);
+        }
+
+        if (jcp_.data_size > 1)
+            vpslld(vmm_idx, vmm_idx, jcp_.data_size == 2 ? 1 : 2);
+        vpaddd(vmm_idx, vmm_idx, vmm_src_shift);
+        if (jcp_.data_size < 4) {
+            // the offset of the aligned dword and the shift of the element within it in bits
+            if (isa == avx512_common) {
+                vpandd(vmm_shift, vmm_idx, vmm_three);
+                vpandnd(vmm_idx, vmm_three, vmm_idx);
+            } else {
+                vpand(vmm_shift, vmm_idx, vmm_three);
+                vpandn(vmm_idx, vmm_three, vmm_idx);
+            }
+            vpslld(vmm_shift, vmm_shift, 3);
+        }
+    }
+
+    void gather() {
+        uni_vpxor(vmm_dst, vmm_dst, vmm_dst);
+        if (isa == avx512_common) {
+            vpgatherdd(vmm_dst | k_mask, ptr[reg_src + vmm_idx]);
+        } else {
+            vpgatherdd(vmm_dst, ptr[reg_src + vmm_idx], vmm_mask);
+        }
+        if (jcp_.data_size < 4)
+            vpsrlvd(vmm_dst, vmm_dst, vmm_shift);
+    }
+
+    void store() {
+        if (jcp_.data_size == 4) {
+            uni_vmovdqu(ptr[reg_dst], vmm_dst);
+        } else if (isa == avx512_common) {
+            if (jcp_.data_size == 2)
+                vpmovdw(ptr[reg_dst], vmm_dst);
+            else
+                vpmovdb(ptr[reg_dst], vmm_dst);
+        } else {
+            // the packs work within the 128-bit lanes, so the halves of the result are joined afterwards
+            const int bits = jcp_.data_size == 2 ? 16 : 24;
+            vpslld(vmm_dst, vmm_dst, bits);
+            vpsrld(vmm_dst, vmm_dst, bits);
+            vpackusdw(vmm_dst, vmm_dst, vmm_dst);
+            if (jcp_.data_size == 2) {
+                vextracti128(xmm_aux, vmm_dst, 1);
+                vpunpcklqdq(xmm_dst, xmm_dst, xmm_aux);
+                vmovdqu(ptr[reg_dst], xmm_dst);
+            } else {
+                vpackuswb(vmm_dst, vmm_dst, vmm_dst);
+                vextracti128(xmm_aux, vmm_dst, 1);
+                vpunpckldq(xmm_dst, xmm_dst, xmm_aux);
+                vmovq(ptr[reg_dst], xmm_dst);
+            }
+        }
+    }
+};
+
+#undef GET_OFF
+#define GET_OFF(field) offsetof(jit_stream_copy_call_args, field)
+
+// Copies a row with the non-temporal stores, the head and the tail not aligned to the vector length are copied by bytes
+template <cpu_isa_t isa>
+struct jit_uni_stream_copy_kernel_f32 : public jit_uni_stream_copy_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_stream_copy_kernel_f32)
+
+    jit_uni_stream_copy_kernel_f32() : jit_uni_stream_copy_kernel(), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_size, ptr[reg_params + GET_OFF(size)]);
+
+        Xbyak::Label head_loop_label;
+        Xbyak::Label main_loop_label;
+        Xbyak::Label tail_loop_label;
+        Xbyak::Label exit_label;
+
+        L(head_loop_label); {
+            test(reg_dst, vlen - 1);
+            jz(main_loop_label, T_NEAR);
+            cmp(reg_size, 1);
+            jl(exit_label, T_NEAR);
+            copy_byte();
+            jmp(head_loop_label, T_NEAR);
+        }
+
+        L(main_loop_label); {
+            cmp(reg_size, vlen);
+            jl(tail_loop_label, T_NEAR);
+
+            vmovups(vmm_val, ptr[reg_src]);
+            vmovntps(ptr[reg_dst], vmm_val);
+
+            add(reg_src, vlen);
+            add(reg_dst, vlen);
+            sub(reg_size, vlen);
+            jmp(main_loop_label, T_NEAR);
+        }
+
+        L(tail_loop_label); {
+            cmp(reg_size, 1);
+            jl(exit_label, T_NEAR);
+            copy_byte();
+            jmp(tail_loop_label, T_NEAR);
+        }
+
+        L(exit_label);
+        // the non-temporal stores are weakly ordered, so they are made visible before the consumers read the row
+        sfence();
+
+        this->postamble();
+    }
+
+private:
+    using Vmm = typename mkldnn::impl::utils::conditional3<isa == sse41, Xbyak::Xmm, isa == avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    const size_t vlen = cpu_isa_traits<isa>::vlen;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_size = r10;
+    Xbyak::Reg64 reg_val = r11;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Vmm vmm_val = Vmm(0);
+
+    void copy_byte() {
+        mov(reg_val.cvt8(), byte[reg_src]);
+        mov(byte[reg_dst], reg_val.cvt8());
+        add(reg_src, 1);
+        add(reg_dst, 1);
+        sub(reg_size, 1);
+    }
+};
 
 bool MKLDNNGatherNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
@@ -79,11 +384,43 @@ void MKLDNNGatherNode::initSupportedPrimitiveDescriptors() {
         return;
 
     Precision dataPrecision = getOriginalInputPrecisionAtPort(GATHER_DATA);
-    addSupportedPrimDesc({{LayoutType::ncsp, dataPrecision},
-                          {LayoutType::ncsp, Precision::I32},
-                          {LayoutType::ncsp, Precision::I32}},
-                         {{LayoutType::ncsp, dataPrecision}},
-                         impl_desc_type::ref_any);
+    // The JIT kernel gathers single elements (see createPrimitive), the longer rows are copied by the reference code
+    const auto& dataDims = getInputShapeAtPort(GATHER_DATA).getStaticDims();
+    const size_t dataBytes = std::accumulate(dataDims.begin(), dataDims.end(), dataPrecision.size(), std::multiplies<size_t>());
+    const size_t innerSize = std::accumulate(dataDims.begin() + axis + 1, dataDims.end(), size_t(1), std::multiplies<size_t>());
+    const bool jitSupported = one_of(dataPrecision.size(), 1u, 2u, 4u) && mayiuse(avx2) &&
+                              dataBytes < static_cast<size_t>(INT_MAX) - sizeof(int32_t);
+    auto pushDesc = [&](LayoutType dataLayout) {
+        // the channels are the innermost dim of nspc, so they belong to the row of any spatial axis
+        size_t rowLength = innerSize;
+        if (dataLayout == LayoutType::nspc && axis > 1)
+            rowLength *= dataDims[1];
+        else if (dataLayout == LayoutType::nspc && axis == 1)
+            rowLength = 1;
+        impl_desc_type implType = impl_desc_type::ref_any;
+        if (jitSupported && rowLength == 1 && one_of(dataLayout, LayoutType::ncsp, LayoutType::nspc))
+            implType = mayiuse(avx512_common) ? impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2;
+
+        addSupportedPrimDesc({{dataLayout, dataPrecision},
+                              {LayoutType::ncsp, Precision::I32},
+                              {LayoutType::ncsp, Precision::I32}},
+                             {{dataLayout, dataPrecision}},
+                             implType);
+    };
+
+    pushDesc(LayoutType::ncsp);
+
+    // With 1D indices and no batch the output has the same rank and the same dims order as the data, so Gather is
+    // performed over the physical dims of any layout. The channel blocks are kept as is if the channels aren't gathered.
+    const auto dataRank = getInputShapeAtPort(GATHER_DATA).getRank();
+    const auto idxRank = getInputShapeAtPort(GATHER_INDEXES).getRank();
+    if ((dataRank == 4 || dataRank == 5) && idxRank == 1 && batchDims == 0) {
+        pushDesc(LayoutType::nspc);
+        if (axis != 1) {
+            pushDesc(LayoutType::nCsp8c);
+            pushDesc(LayoutType::nCsp16c);
+        }
+    }
 }
 
 void MKLDNNGatherNode::createPrimitive() {
@@ -96,15 +433,20 @@ void MKLDNNGatherNode::createPrimitive() {
     if (getSelectedPrimitiveDescriptor() == nullptr)
         IE_THROW() << errorPrefix_ << " has unidentified preferable primitive descriptor.";
 
-    const SizeVector srcDims = getParentEdgeAt(GATHER_DATA)->getMemory().getStaticDims();
+    const auto srcBlkDesc = getParentEdgeAt(GATHER_DATA)->getMemory().GetDescWithType<BlockedMemoryDesc>();
+    const SizeVector srcDims = srcBlkDesc->getBlockDims();
     const SizeVector idxDims = getParentEdgeAt(GATHER_INDEXES)->getMemory().getStaticDims();
-    const SizeVector dstDims = getChildEdgesAtPort(0)[0]->getMemory().getStaticDims();
+    const SizeVector dstDims = getChildEdgeAt(0)->getMemory().GetDescWithType<BlockedMemoryDesc>()->getBlockDims();
     dataSize = getParentEdgeAt(GATHER_DATA)->getMemory().getDesc().getPrecision().size();
 
-    indexRange = srcDims[axis];
+    // the position of the axis among the physical dims (differs from the logical one for nspc)
+    const auto& order = srcBlkDesc->getOrder();
+    const int physicalAxis = static_cast<int>(std::distance(order.begin(), std::find(order.begin(), order.end(), axis)));
+
+    indexRange = srcDims[physicalAxis];
     batchSize = std::accumulate(srcDims.begin(), srcDims.begin() + batchDims, 1, std::multiplies<size_t>());
-    outerSize = std::accumulate(srcDims.begin() + batchDims, srcDims.begin() + axis, 1, std::multiplies<size_t>());
-    dataLength = std::accumulate(srcDims.begin() + axis + 1, srcDims.end(), 1, std::multiplies<size_t>());
+    outerSize = std::accumulate(srcDims.begin() + batchDims, srcDims.begin() + physicalAxis, 1, std::multiplies<size_t>());
+    dataLength = std::accumulate(srcDims.begin() + physicalAxis + 1, srcDims.end(), 1, std::multiplies<size_t>());
     srcBatchStride = std::accumulate(srcDims.begin() + batchDims, srcDims.end(), 1, std::multiplies<size_t>());
     idxBatchStride = std::accumulate(idxDims.begin() + batchDims, idxDims.end(), 1, std::multiplies<size_t>());
     dstBatchStride = std::accumulate(dstDims.begin() + batchDims, dstDims.end(), 1, std::multiplies<size_t>());
@@ -112,6 +454,53 @@ void MKLDNNGatherNode::createPrimitive() {
 
     if (dataLength == 0)
         IE_THROW() << errorPrefix_ << "had incorrect input parameters dimension!";
+
+    // the kernel addresses the data with 32-bit offsets
+    const bool offsetsFit = batchSize * srcBatchStride * dataSize < static_cast<size_t>(INT_MAX) - sizeof(int32_t);
+    if (dataLength == 1 && one_of(dataSize, 1u, 2u, 4u) && offsetsFit) {
+        jit_gather_config_params jcp;
+        jcp.data_size = dataSize;
+        jcp.index_range = static_cast<int>(indexRange);
+        if (mayiuse(avx512_common)) {
+            gatherKernel.reset(new jit_uni_gather_kernel_f32<avx512_common>(jcp));
+        } else if (mayiuse(avx2)) {
+            gatherKernel.reset(new jit_uni_gather_kernel_f32<avx2>(jcp));
+        }
+        if (gatherKernel)
+            gatherKernel->create_ker();
+    }
+
+    // The rows written with the non-temporal stores were measured 1.2x-1.7x faster to gather from 4 KB on, but slower
+    // for the short rows, and they would evict the output from the cache if it fit there
+    const size_t dstBytes = batchSize * dstBatchStride * dataSize;
+    const size_t cacheBytes = static_cast<size_t>(mkldnn::utils::get_cache_size(3, true)) * parallel_get_max_threads();
+    if (len >= streamCopyMinRowBytes && dstBytes > cacheBytes) {
+        if (mayiuse(avx512_common)) {
+            streamCopyKernel.reset(new jit_uni_stream_copy_kernel_f32<avx512_common>());
+        } else if (mayiuse(avx2)) {
+            streamCopyKernel.reset(new jit_uni_stream_copy_kernel_f32<avx2>());
+        }
+        if (streamCopyKernel)
+            streamCopyKernel->create_ker();
+    }
+}
+
+void MKLDNNGatherNode::executeElementwise(const int32_t* srcIndexes, const uint8_t* srcData, uint8_t* dstData) {
+    // each thread takes a chunk of the indices, so the work is split well even for a single row of the data
+    const size_t chunkSize = 4096;
+    const size_t chunksNum = div_up(idxBatchStride, chunkSize);
+    const size_t misalignment = reinterpret_cast<uintptr_t>(srcData) % sizeof(int32_t);
+
+    parallel_for3d(batchSize, outerSize, chunksNum, [&](const size_t i, const size_t k, const size_t c) {
+        const size_t start = c * chunkSize;
+        jit_gather_call_args args;
+        args.src = srcData - misalignment;
+        args.src_shift = misalignment + (i * srcBatchStride + k * indexRange) * dataSize;
+        args.indices = srcIndexes + i * idxBatchStride + start;
+        args.dst = dstData + (i * dstBatchStride + k * idxBatchStride + start) * dataSize;
+        args.work_amount = std::min(chunkSize, idxBatchStride - start);
+        (*gatherKernel)(&args);
+    });
 }
 
 void MKLDNNGatherNode::execute(mkldnn::stream strm) {
@@ -119,16 +508,32 @@ void MKLDNNGatherNode::execute(mkldnn::stream strm) {
     const uint8_t* srcData = reinterpret_cast<const uint8_t*>(getParentEdgeAt(GATHER_DATA)->getMemoryPtr()->GetPtr());
     uint8_t* dstData = reinterpret_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
 
+    // an element mustn't span two dwords, so the kernel needs the data aligned to the element size
+    if (gatherKernel && reinterpret_cast<uintptr_t>(srcData) % dataSize == 0) {
+        executeElementwise(srcIndexes, srcData, dstData);
+        return;
+    }
+
     parallel_for2d(batchSize, idxBatchStride, [&](const size_t i, const size_t j) {
-        const unsigned int idx = static_cast<uint32_t>(srcIndexes[i * idxBatchStride + j]);
+        int idx = srcIndexes[i * idxBatchStride + j];
+        // negative indices are counted from the end of the axis
+        if (idx < 0)
+            idx += static_cast<int>(indexRange);
 
-        // while negative indices are not supported, should set zero
-        if (idx < indexRange) {
+        if (static_cast<unsigned int>(idx) < indexRange) {
             for (size_t k = 0; k < outerSize; ++k) {
                 const size_t srcStride = (i * srcBatchStride + k * dataLength * indexRange) * dataSize;
                 const size_t dstStride = (i * dstBatchStride + k * dataLength * idxBatchStride) * dataSize;
 
-                cpu_memcpy(&dstData[dstStride + j * len], &srcData[srcStride + idx * len], len);
+                if (streamCopyKernel) {
+                    jit_stream_copy_call_args args;
+                    args.src = &srcData[srcStride + idx * len];
+                    args.dst = &dstData[dstStride + j * len];
+                    args.size = len;
+                    (*streamCopyKernel)(&args);
+                } else {
+                    cpu_memcpy(&dstData[dstStride + j * len], &srcData[srcStride + idx * len], len);
+                }
             }
         } else {
             for (size_t k = 0; k < outerSize; ++k) {
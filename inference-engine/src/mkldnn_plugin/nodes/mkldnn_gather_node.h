@@ -12,6 +12,49 @@
 
 namespace MKLDNNPlugin {
 
+struct jit_gather_call_args {
+    const void* src;        // aligned down to 4 bytes, so the dwords containing the elements can be gathered
+    size_t src_shift;       // in bytes, is added to the offsets of all the elements
+    const int32_t* indices;
+    void* dst;
+    size_t work_amount;
+};
+
+struct jit_gather_config_params {
+    size_t data_size;
+    int index_range;
+};
+
+struct jit_uni_gather_kernel {
+    void (*ker_)(const jit_gather_call_args *);
+
+    void operator()(const jit_gather_call_args *args) { assert(ker_); ker_(args); }
+
+    virtual void create_ker() = 0;
+
+    explicit jit_uni_gather_kernel(jit_gather_config_params jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_gather_kernel() {}
+
+    jit_gather_config_params jcp_;
+};
+
+struct jit_stream_copy_call_args {
+    const void* src;
+    void* dst;
+    size_t size;            // in bytes
+};
+
+struct jit_uni_stream_copy_kernel {
+    void (*ker_)(const jit_stream_copy_call_args *);
+
+    void operator()(const jit_stream_copy_call_args *args) { assert(ker_); ker_(args); }
+
+    virtual void create_ker() = 0;
+
+    jit_uni_stream_copy_kernel() : ker_(nullptr) {}
+    virtual ~jit_uni_stream_copy_kernel() {}
+};
+
 class MKLDNNGatherNode : public MKLDNNNode {
 public:
     MKLDNNGatherNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
@@ -25,6 +68,8 @@ public:
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
 
 private:
+    void executeElementwise(const int32_t* srcIndexes, const uint8_t* srcData, uint8_t* dstData);
+
     int axis = 0;
     int batchDims = 0;
 
@@ -38,9 +83,15 @@ private:
     size_t dataSize = 1;
     size_t len = 1;
 
+    // gathers single elements (dataLength == 1) instead of rows
+    std::shared_ptr<jit_uni_gather_kernel> gatherKernel;
+    // copies the rows bypassing the cache, if the rows are long and the output doesn't fit the cache anyway
+    std::shared_ptr<jit_uni_stream_copy_kernel> streamCopyKernel;
+
     static const size_t GATHER_DATA = 0;
     static const size_t GATHER_INDEXES = 1;
     static const size_t GATHER_AXIS = 2;
+    static const size_t streamCopyMinRowBytes = 4096;
 
     std::string errorPrefix_;
 };
@@ -0,0 +1,114 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_kv_cache_node.h"
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <mkldnn_types.h>
+#include <mkldnn_extension_utils.h>
+#include "mkldnn_concat_node.h"
+#include "mkldnn_split_node.h"
+#include "ngraph_transformations/op/kv_cache.hpp"
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+bool MKLDNNKVCacheNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (isDynamicNgraphNode(op)) {
+            errorMessage = "Doesn't support op with dynamic shapes";
+            return false;
+        }
+        if (!ngraph::is_type<const MKLDNNPlugin::KVCacheNode>(op)) {
+            errorMessage = "Only CPU plugin KVCache operation is supported";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNKVCacheNode::MKLDNNKVCacheNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng,
+                                     MKLDNNWeightsSharing::Ptr &cache) : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "KVCache node with name '" + getName() + "'";
+    const auto kvCache = ngraph::as_type_ptr<const MKLDNNPlugin::KVCacheNode>(op);
+    variableId = kvCache->get_variable_id();
+    stateDims = kvCache->get_state_shape();
+    axis = static_cast<size_t>(kvCache->get_axis());
+}
+
+void MKLDNNKVCacheNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    const auto precision = getOriginalInputPrecisionAtPort(0);
+    addSupportedPrimDesc({{LayoutType::ncsp, precision}}, {{LayoutType::ncsp, precision}}, impl_desc_type::ref_any);
+}
+
+void MKLDNNKVCacheNode::createPrimitive() {
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        IE_THROW() << errorPrefix << " did not set preferable primitive descriptor";
+    auto& srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
+    if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+        IE_THROW() << errorPrefix << " did not allocate input memory";
+    auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        IE_THROW() << errorPrefix << " did not allocate destination memory";
+
+    // The output may be pointed to the state buffer if the concatenation is dense there, i.e. there are no outer axes,
+    // and no consumer keeps the view of the output memory or the pointer of it
+    const auto outerCount = std::accumulate(stateDims.begin(), stateDims.begin() + axis, size_t(1), std::multiplies<size_t>());
+    inPlaceOutput = outerCount == 1;
+    for (const auto& edge : getChildEdgesAtPort(0)) {
+        const auto child = edge->getChild();
+        auto* concat = dynamic_cast<MKLDNNConcatNode *>(child.get());
+        auto* split = dynamic_cast<MKLDNNSplitNode *>(child.get());
+        if (child->getType() == Output || child->isInplace() || (concat && concat->isOptimized()) || split)
+            inPlaceOutput = false;
+    }
+}
+
+std::string MKLDNNKVCacheNode::getStateName() const {
+    // Remove suffix with pair ID. Internal information.
+    auto suffix_idx = variableId.find("/id=");
+    return suffix_idx != std::string::npos ? variableId.substr(0, suffix_idx) : variableId;
+}
+
+std::shared_ptr<MKLDNNVariableStateKVCache> MKLDNNKVCacheNode::createState() const {
+    const auto precision = getParentEdgeAt(0)->getMemory().getDesc().getPrecision();
+    const TensorDesc desc(precision, stateDims, TensorDesc::getLayoutByDims(stateDims));
+    return std::make_shared<MKLDNNVariableStateKVCache>(getStateName(), desc, axis, getInputShapeAtPort(0).getStaticDims()[axis]);
+}
+
+void MKLDNNKVCacheNode::execute(mkldnn::stream strm) {
+    if (!state)
+        IE_THROW() << errorPrefix << " has no state bound";
+
+    state->append(getParentEdgeAt(0)->getMemory().GetPtr());
+    if (inPlaceOutput) {
+        auto concatenation = state->getConcatenation();
+        for (const auto& edge : getChildEdgesAtPort(0))
+            edge->getMemory().GetPrimitivePtr()->set_data_handle(concatenation);
+    } else {
+        state->copyConcatenation(getChildEdgeAt(0)->getMemory().GetPtr());
+    }
+    state->commit();
+}
+
+bool MKLDNNKVCacheNode::created() const {
+    return getType() == KVCache;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNKVCacheNode, KVCache);
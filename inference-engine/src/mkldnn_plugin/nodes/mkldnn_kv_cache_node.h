@@ -0,0 +1,50 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <memory>
+#include "mkldnn_memory_state.h"
+
+namespace MKLDNNPlugin {
+
+/*
+ * Appends the input to the KV cache state in place and outputs the concatenation of the state and the input. The output
+ * is the view of the state buffer if the consumers allow to change the data pointer of the edge, otherwise it is copied.
+ * The state is owned by the infer request and is bound to the node before the inference.
+ */
+class MKLDNNKVCacheNode : public MKLDNNNode {
+public:
+    MKLDNNKVCacheNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+    // The name of the variable without the internal suffix
+    std::string getStateName() const;
+    std::shared_ptr<MKLDNNVariableStateKVCache> createState() const;
+    void setState(const std::shared_ptr<MKLDNNVariableStateKVCache>& newState) {
+        state = newState;
+    }
+
+private:
+    std::string variableId;
+    VectorDims stateDims;
+    size_t axis = 0;
+
+    bool inPlaceOutput = false;
+    std::shared_ptr<MKLDNNVariableStateKVCache> state;
+
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
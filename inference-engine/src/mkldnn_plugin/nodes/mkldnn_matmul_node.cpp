@@ -76,9 +76,12 @@ void MKLDNNMatMulNode::getSupportedDescriptors() {
     if (getChildEdges().empty())
         IE_THROW()  << errorPrefix << " has incorrect number of output edges for layer " << getName();
 
-    auto inDims0 = getInputShapeAtPort(0).getStaticDims();
-    auto inDims1 = getInputShapeAtPort(1).getStaticDims();
-    auto outDims = getOutputShapeAtPort(0).getStaticDims();
+    // the shapes of the ports are the ones before the folded transpositions, the logical dims are checked
+    VectorDims inDims0, inDims1, outDims, strides;
+    getTransposedView(getInputShapeAtPort(0).getStaticDims(), inputOrders[0], inDims0, strides);
+    getTransposedView(getInputShapeAtPort(1).getStaticDims(), inputOrders[1], inDims1, strides);
+    getTransposedView(getOutputShapeAtPort(0).getStaticDims(), outputOrder.empty() ? outputOrder : getInverseOrder(outputOrder),
+                      outDims, strides);
 
     if (inDims0.size() != inDims1.size() || inDims0.size() != outDims.size())
         IE_THROW()  << errorPrefix << " has invalid dims count";
@@ -101,24 +104,7 @@ void MKLDNNMatMulNode::getSupportedDescriptors() {
             (inDims1[dim_idx] != outDims[dim_idx] && inDims1[dim_idx] != 1)) {
             IE_THROW()  << errorPrefix << " has incorrect input batch dimensions";
         }
-
-        int aOffset = 1;
-        for (int i = dim_idx + 1; i < nDims; i++)
-            aOffset *= inDims0[i];
-        aOffsets.push_back(inDims0[dim_idx] == outDims[dim_idx] ? aOffset : 0);
-
-        int bOffset = 1;
-        for (int i = dim_idx + 1; i < nDims; i++)
-            bOffset *= inDims1[i];
-        bOffsets.push_back(inDims1[dim_idx] == outDims[dim_idx] ? bOffset : 0);
     }
-
-    for (unsigned long dim_idx = aOffsets.size(); dim_idx < 2; dim_idx++)
-        aOffsets.push_back(0);
-    for (unsigned long dim_idx = bOffsets.size(); dim_idx < 2; dim_idx++)
-        bOffsets.push_back(0);
-    for (unsigned long dim_idx = cOffsets.size(); dim_idx < 2; dim_idx++)
-        cOffsets.push_back(0);
 }
 
 void MKLDNNMatMulNode::initSupportedPrimitiveDescriptors() {
@@ -185,8 +171,11 @@ void MKLDNNMatMulNode::createPrimitive() {
     if (getSelectedPrimitiveDescriptor() == nullptr)
         IE_THROW()  << errorPrefix << " did not set preferable primitive descriptor";
 
-    auto inDims0 = src0MemPtr->getStaticDims();
-    auto outDims = dstMemPtr->getStaticDims();
+    // the logical dims of the operands, the memory keeps the tensors before the folded transpositions
+    VectorDims inDims0, inStrides0, inDims1, inStrides1, outDims, outStrides;
+    getTransposedView(src0MemPtr->getStaticDims(), inputOrders[0], inDims0, inStrides0);
+    getTransposedView(src1MemPtr->getStaticDims(), inputOrders[1], inDims1, inStrides1);
+    getTransposedView(dstMemPtr->getStaticDims(), outputOrder.empty() ? outputOrder : getInverseOrder(outputOrder), outDims, outStrides);
 
     params.src0_mem_ptr = src0MemPtr;
     params.src1_mem_ptr = src1MemPtr;
@@ -194,22 +183,16 @@ void MKLDNNMatMulNode::createPrimitive() {
 
     params.ndims = outDims.size();
 
-    params.MB1 = 1;
-    params.MB2 = outDims.size() > 3 ? outDims[params.ndims - 3] : 1;
+    params.MB1 = params.ndims > 3 ? outDims[params.ndims - 4] : 1;
+    params.MB2 = params.ndims > 2 ? outDims[params.ndims - 3] : 1;
 
     params.M = outDims[yAxis];
     params.N = outDims[xAxis];
     params.K = transposeA ? inDims0[yAxis] : inDims0[xAxis];
 
-    params.transa = transposeA ? 'T' : 'N';
-    params.transb = transposeB ? 'T' : 'N';
-
-    params.lda = transposeA ? params.M : params.K;
-    params.ldb = transposeB ? params.K : params.N;
-    params.ldc = params.N;
-
-    params.shift1 = params.M * params.N * params.MB2;
-    params.shift2 = params.M * params.N;
+    params.a = makeGemmOperand(inDims0, inStrides0, transposeA, outDims);
+    params.b = makeGemmOperand(inDims1, inStrides1, transposeB, outDims);
+    params.c = makeGemmOperand(outDims, outStrides, false, outDims);
 
     runtimePrecision = getParentEdgeAt(0)->getMemory().getDesc().getPrecision();
 }
@@ -229,8 +212,8 @@ inline void process_gemm(char transa, char transb, int M, int N, int K, float al
     const int32_t co = 0;
     int32_t *Ci = reinterpret_cast<int32_t *>(C);
     mkldnn_gemm_u8s8s32(transa, transb, 'F', M, N, K, alpha, A, lda, 0, B, ldb, 0, beta, Ci, ldc, &co);
-    parallel_for(M * N, [&](size_t i) {
-        C[i] = Ci[i];
+    parallel_for2d(M, N, [&](size_t m, size_t n) {
+        C[m * ldc + n] = Ci[m * ldc + n];
     });
 }
 
@@ -239,8 +222,8 @@ inline void process_gemm(char transa, char transb, int M, int N, int K, float al
     const int32_t co = 0;
     int32_t *Ci = reinterpret_cast<int32_t *>(C);
     mkldnn_gemm_s8s8s32(transa, transb, 'F', M, N, K, alpha, A, lda, 0, B, ldb, 0, beta, Ci, ldc, &co);
-    parallel_for(M * N, [&](size_t i) {
-        C[i] = Ci[i];
+    parallel_for2d(M, N, [&](size_t m, size_t n) {
+        C[m * ldc + n] = Ci[m * ldc + n];
     });
 }
 
@@ -250,31 +233,20 @@ inline void MKLDNNMatMulNode::process_data() {
     const T1* src1_ptr = reinterpret_cast<const T1*>(params.src1_mem_ptr->GetPtr());
     float* dst_ptr = reinterpret_cast<float*>(params.dst_mem_ptr->GetPtr());
 
+    // the dynamic batch limits the outermost batch axis
     const int MB = batchToProcess();
-    if (params.ndims == 4) {
-        params.MB1 = MB;
-    } else if (params.ndims == 3) {
-        params.shift1 = params.shift1 * MB / params.MB2;
-        params.MB2 = MB;
-    }
+    const int MB1 = params.ndims == 4 ? MB : params.MB1;
+    const int MB2 = params.ndims == 3 ? MB : params.MB2;
 
-    for (int b1 = 0; b1 < params.MB1; ++b1) {
-        const T0 *a_ptr = src0_ptr;
-        const T1 *b_ptr = src1_ptr;
-        float *d_ptr = dst_ptr;
+    for (int b1 = 0; b1 < MB1; ++b1) {
+        for (int b2 = 0; b2 < MB2; ++b2) {
+            const T0 *a_ptr = src0_ptr + b1 * params.a.batchStrides[1] + b2 * params.a.batchStrides[0];
+            const T1 *b_ptr = src1_ptr + b1 * params.b.batchStrides[1] + b2 * params.b.batchStrides[0];
+            float *d_ptr = dst_ptr + b1 * params.c.batchStrides[1] + b2 * params.c.batchStrides[0];
 
-        for (int b2 = 0; b2 < params.MB2; ++b2) {
-            process_gemm(params.transa, params.transb, params.M, params.N, params.K,
-                         alpha, a_ptr, params.lda, b_ptr, params.ldb, beta, d_ptr, params.ldc);
-
-            a_ptr += aOffsets[0];
-            b_ptr += bOffsets[0];
-            d_ptr += params.shift2;
+            process_gemm(params.a.trans, params.b.trans, params.M, params.N, params.K,
+                         alpha, a_ptr, params.a.ld, b_ptr, params.b.ld, beta, d_ptr, params.c.ld);
         }
-
-        src0_ptr += aOffsets[1];
-        src1_ptr += bOffsets[1];
-        dst_ptr += params.shift1;
     }
 }
 
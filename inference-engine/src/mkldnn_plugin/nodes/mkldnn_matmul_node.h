@@ -8,6 +8,7 @@
 #include <mkldnn_node.h>
 #include <string>
 #include <vector>
+#include "common/strided_gemm.h"
 
 namespace MKLDNNPlugin {
 
@@ -27,6 +28,10 @@ public:
 
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
 
+    // The transpositions of the inputs and of the output folded into the strides of the GEMM operands
+    void setInputOrder(size_t port, const std::vector<size_t>& order) { inputOrders[port] = order; }
+    void setOutputOrder(const std::vector<size_t>& order) { outputOrder = order; }
+
 private:
     float alpha = 1.f;
     float beta = 0.f;
@@ -36,9 +41,8 @@ private:
     int xAxis = 0;
     int yAxis = 0;
 
-    std::vector<int> aOffsets;
-    std::vector<int> bOffsets;
-    std::vector<int> cOffsets;
+    std::vector<std::vector<size_t>> inputOrders = {{}, {}};
+    std::vector<size_t> outputOrder;
 
     InferenceEngine::Precision runtimePrecision;
 
@@ -51,8 +55,9 @@ private:
         MKLDNNMemoryPtr src1_mem_ptr = nullptr;
         MKLDNNMemoryPtr dst_mem_ptr = nullptr;
 
-        char transa = 'N';
-        char transb = 'N';
+        StridedGemmOperand a;
+        StridedGemmOperand b;
+        StridedGemmOperand c;
 
         int MB1 = 1;
         int MB2 = 1;
@@ -61,13 +66,6 @@ private:
         int N = 0;
         int K = 0;
 
-        int lda = 0;
-        int ldb = 0;
-        int ldc = 0;
-
-        int shift1 = 0;
-        int shift2 = 0;
-
         size_t ndims = 0;
     } params;
 };
@@ -17,6 +17,7 @@
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace InferenceEngine::Extensions::Cpu;
 using MatrixNmsIEInternal = ngraph::op::internal::NmsStaticShapeIE<ngraph::op::v8::MatrixNms>;
 
 using ngNmsSortResultType = ngraph::op::util::NmsBase::SortResultType;
@@ -187,23 +188,6 @@ static inline float boxArea(const float* bbox, const bool normalized) {
     }
 }
 
-static inline float intersectionOverUnion(const float* bbox1, const float* bbox2, const bool normalized) {
-    if (bbox2[0] > bbox1[2] || bbox2[2] < bbox1[0] || bbox2[1] > bbox1[3] || bbox2[3] < bbox1[1]) {
-        return static_cast<float>(0.);
-    } else {
-        const float xMin = std::max(bbox1[0], bbox2[0]);
-        const float yMin = std::max(bbox1[1], bbox2[1]);
-        const float xMax = std::min(bbox1[2], bbox2[2]);
-        const float yMax = std::min(bbox1[3], bbox2[3]);
-        float norm = normalized ? static_cast<float>(0.) : static_cast<float>(1.);
-        float width = xMax - xMin + norm;
-        float height = yMax - yMin + norm;
-        const float interArea = width * height;
-        const float bbox1Area = boxArea(bbox1, normalized);
-        const float bbox2Area = boxArea(bbox2, normalized);
-        return interArea / (bbox1Area + bbox2Area - interArea);
-    }
-}
 }  // namespace
 
 size_t MKLDNNMatrixNmsNode::nmsMatrix(const float* boxesData, const float* scoresData, BoxInfo* filterBoxes, const int64_t batchIdx, const int64_t classIdx) {
@@ -225,20 +209,33 @@ size_t MKLDNNMatrixNmsNode::nmsMatrix(const float* boxesData, const float* score
         return scoresData[a] > scoresData[b];
     });
 
+    // the candidates in the order of the scores, by coordinate
+    nms_box_pool candidates;
+    candidates.reserve(originalSize);
+    for (int64_t i = 0; i < originalSize; i++) {
+        const float* box = boxesData + candidateIndex[i] * 4;
+        candidates.push(box[0], box[1], box[2], box[3], boxArea(box, m_normalized));
+    }
+    const nms_boxes sortedBoxes = candidates.boxes();
+    const iou_conf conf{iou_kind::overlapped, m_normalized ? 0.f : 1.f};
+
     std::vector<float> iouMatrix((originalSize * (originalSize - 1)) >> 1);
     std::vector<float> iouMax(originalSize);
 
     iouMax[0] = 0.;
     InferenceEngine::parallel_for(originalSize - 1, [&](size_t i) {
-        float max_iou = 0.;
         size_t actual_index = i + 1;
-        auto idx_a = candidateIndex[actual_index];
-        for (int64_t j = 0; j < actual_index; j++) {
-            auto idx_b = candidateIndex[j];
-            auto iou = intersectionOverUnion(boxesData + idx_a * 4, boxesData + idx_b * 4, m_normalized);
-            max_iou = std::max(max_iou, iou);
-            iouMatrix[actual_index * (actual_index - 1) / 2 + j] = iou;
-        }
+        // the row of the candidate against all the preceding ones, the threshold is not used
+        iou_args args{};
+        args.boxes = sortedBoxes;
+        args.count = actual_index;
+        args.set_box(sortedBoxes, actual_index);
+        args.threshold = 1.f;
+        args.iou = iouMatrix.data() + actual_index * (actual_index - 1) / 2;
+        XARCH::iou_exec(conf, args);
+        float max_iou = 0.;
+        for (size_t j = 0; j < actual_index; j++)
+            max_iou = std::max(max_iou, args.iou[j]);
         iouMax[actual_index] = max_iou;
     });
 
@@ -286,7 +283,23 @@ void MKLDNNMatrixNmsNode::execute(mkldnn::stream strm) {
     const float* boxes = reinterpret_cast<const float*>(getParentEdgeAt(NMS_BOXES)->getMemoryPtr()->GetPtr());
     const float* scores = reinterpret_cast<const float*>(getParentEdgeAt(NMS_SCORES)->getMemoryPtr()->GetPtr());
 
+    // the classes take the time quadratic by the number of their candidates
+    std::vector<size_t> costs(m_numBatches * m_numClasses, 0);
     InferenceEngine::parallel_for2d(m_numBatches, m_numClasses, [&](size_t batchIdx, size_t classIdx) {
+        if (classIdx == m_backgroundClass)
+            return;
+        const float* scoresPtr = scores + batchIdx * (m_numClasses * m_numBoxes) + classIdx * m_numBoxes;
+        size_t count = std::count_if(scoresPtr, scoresPtr + m_numBoxes, [this](float score) {
+            return score > m_scoreThreshold;
+        });
+        if (m_nmsTopk > -1)
+            count = std::min(count, static_cast<size_t>(m_nmsTopk));
+        costs[batchIdx * m_numClasses + classIdx] = count * count;
+    });
+
+    nms_parallel_tasks(costs, [&](size_t task) {
+        const size_t batchIdx = task / m_numClasses;
+        const size_t classIdx = task % m_numClasses;
         if (classIdx == m_backgroundClass) {
             m_numPerBatchClass[batchIdx][classIdx] = 0;
             return;
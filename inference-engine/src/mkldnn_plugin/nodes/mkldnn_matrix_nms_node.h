@@ -11,6 +11,8 @@
 #include <string>
 #include <vector>
 
+#include "nms_imp.hpp"
+
 namespace MKLDNNPlugin {
 
 enum MatrixNmsSortResultType {
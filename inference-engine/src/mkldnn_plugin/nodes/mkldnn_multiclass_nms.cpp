@@ -20,6 +20,7 @@
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace InferenceEngine::Extensions::Cpu;
 
 using ngNmsSortResultType = ngraph::op::util::NmsBase::SortResultType;
 using MulticlassNmsIEInternal = ngraph::op::internal::NmsStaticShapeIE<ngraph::op::v8::MulticlassNms>;
@@ -153,10 +154,11 @@ void MKLDNNMultiClassNmsNode::execute(mkldnn::stream strm) {
     auto boxesStrides = getParentEdgeAt(NMS_BOXES)->getMemory().GetDescWithType<BlockedMemoryDesc>()->getStrides();
     auto scoresStrides = getParentEdgeAt(NMS_SCORES)->getMemory().GetDescWithType<BlockedMemoryDesc>()->getStrides();
 
+    prepareBoxes(boxes, boxesStrides);
     if ((nms_eta >= 0) && (nms_eta < 1)) {
-        nmsWithEta(boxes, scores, boxesStrides, scoresStrides);
+        nmsWithEta(scores, scoresStrides);
     } else {
-        nmsWithoutEta(boxes, scores, boxesStrides, scoresStrides);
+        nmsWithoutEta(scores, scoresStrides);
     }
 
     size_t startOffset = numFiltBox[0][0];
@@ -276,31 +278,36 @@ bool MKLDNNMultiClassNmsNode::created() const {
     return getType() == MulticlassNms;
 }
 
-float MKLDNNMultiClassNmsNode::intersectionOverUnion(const float* boxesI, const float* boxesJ, const bool normalized) {
-    float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
+void MKLDNNMultiClassNmsNode::prepareBoxes(const float* boxes, const SizeVector& boxesStrides) {
     const float norm = static_cast<float>(normalized == false);
+    imageBoxes.resize(num_batches);
+    parallel_for(num_batches, [&](size_t batch_idx) {
+        const float* boxesPtr = boxes + batch_idx * boxesStrides[0];
+        auto& pool = imageBoxes[batch_idx];
+        pool.clear();
+        pool.reserve(num_boxes);
+        // to align with reference, the corners are taken as is
+        for (size_t box_idx = 0; box_idx < num_boxes; box_idx++) {
+            const float* box = boxesPtr + box_idx * 4;
+            pool.push(box[0], box[1], box[2], box[3], (box[2] - box[0] + norm) * (box[3] - box[1] + norm));
+        }
+    });
+}
 
-    // to align with reference
-    yminI = boxesI[0];
-    xminI = boxesI[1];
-    ymaxI = boxesI[2];
-    xmaxI = boxesI[3];
-    yminJ = boxesJ[0];
-    xminJ = boxesJ[1];
-    ymaxJ = boxesJ[2];
-    xmaxJ = boxesJ[3];
-
-    float areaI = (ymaxI - yminI + norm) * (xmaxI - xminI + norm);
-    float areaJ = (ymaxJ - yminJ + norm) * (xmaxJ - xminJ + norm);
-    if (areaI <= 0.f || areaJ <= 0.f)
-        return 0.f;
-
-    float intersection_area = (std::max)((std::min)(ymaxI, ymaxJ) - (std::max)(yminI, yminJ) + norm, 0.f) *
-                              (std::max)((std::min)(xmaxI, xmaxJ) - (std::max)(xminI, xminJ) + norm, 0.f);
-    return intersection_area / (areaI + areaJ - intersection_area);
+std::vector<size_t> MKLDNNMultiClassNmsNode::countCandidates(const float* scores, const SizeVector& scoresStrides) {
+    std::vector<size_t> counts(num_batches * num_classes, 0);
+    parallel_for2d(num_batches, num_classes, [&](size_t batch_idx, size_t class_idx) {
+        if (static_cast<int>(class_idx) == background_class)
+            return;
+        const float* scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
+        counts[batch_idx * num_classes + class_idx] = std::count_if(scoresPtr, scoresPtr + num_boxes, [&](float score) {
+            return score >= score_threshold;
+        });
+    });
+    return counts;
 }
 
-void MKLDNNMultiClassNmsNode::nmsWithEta(const float* boxes, const float* scores, const SizeVector& boxesStrides, const SizeVector& scoresStrides) {
+void MKLDNNMultiClassNmsNode::nmsWithEta(const float* scores, const SizeVector& scoresStrides) {
     auto less = [](const boxInfo& l, const boxInfo& r) {
         return l.score < r.score || ((l.score == r.score) && (l.idx > r.idx));
     };
@@ -309,10 +316,13 @@ void MKLDNNMultiClassNmsNode::nmsWithEta(const float* boxes, const float* scores
         return iou <= adaptive_threshold ? 1.0f : 0.0f;
     };
 
-    parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
+    const iou_conf conf{iou_kind::clamped, static_cast<float>(normalized == false)};
+    nms_parallel_tasks(countCandidates(scores, scoresStrides), [&](size_t task) {
+        const int batch_idx = static_cast<int>(task / num_classes);
+        const int class_idx = static_cast<int>(task % num_classes);
         if (class_idx != background_class) {
             std::vector<filteredBoxes> fb;
-            const float* boxesPtr = boxes + batch_idx * boxesStrides[0];
+            const nms_boxes boxes = imageBoxes[batch_idx].boxes();
             const float* scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
             std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less);
@@ -324,17 +334,30 @@ void MKLDNNMultiClassNmsNode::nmsWithEta(const float* boxes, const float* scores
             if (sorted_boxes.size() > 0) {
                 auto adaptive_threshold = iou_threshold;
                 int max_out_box = (max_output_boxes_per_class > sorted_boxes.size()) ? sorted_boxes.size() : max_output_boxes_per_class;
+                // the selected boxes, compared with every candidate at once
+                nms_box_pool selected;
+                std::vector<float> ious;
+                iou_args args{};
+                args.inclusive = true;
                 while (max_out_box && !sorted_boxes.empty()) {
                     boxInfo currBox = sorted_boxes.top();
                     float origScore = currBox.score;
                     sorted_boxes.pop();
                     max_out_box--;
 
+                    // the score decays by the boxes selected after the candidate was put back, the latest ones first
+                    args.boxes = selected.boxes(currBox.suppress_begin_index);
+                    args.count = fb.size() - currBox.suppress_begin_index;
+                    args.threshold = adaptive_threshold;
+                    args.set_box(boxes, currBox.idx);
+                    ious.resize(args.count);
+                    args.iou = ious.data();
+                    XARCH::iou_exec(conf, args);
+
                     bool box_is_selected = true;
-                    for (int idx = static_cast<int>(fb.size()) - 1; idx >= currBox.suppress_begin_index; idx--) {
-                        float iou = intersectionOverUnion(&boxesPtr[currBox.idx * 4], &boxesPtr[fb[idx].box_index * 4], normalized);
-                        currBox.score *= func(iou, adaptive_threshold);
-                        if (iou >= adaptive_threshold) {
+                    for (int idx = static_cast<int>(args.count) - 1; idx >= 0; idx--) {
+                        currBox.score *= func(ious[idx], adaptive_threshold);
+                        if (ious[idx] >= adaptive_threshold) {
                             box_is_selected = false;
                             break;
                         }
@@ -349,6 +372,7 @@ void MKLDNNMultiClassNmsNode::nmsWithEta(const float* boxes, const float* scores
                         }
                         if (currBox.score == origScore) {
                             fb.push_back({currBox.score, batch_idx, class_idx, currBox.idx});
+                            selected.push(boxes, currBox.idx);
                             continue;
                         }
                         if (currBox.score > score_threshold) {
@@ -366,10 +390,13 @@ void MKLDNNMultiClassNmsNode::nmsWithEta(const float* boxes, const float* scores
     });
 }
 
-void MKLDNNMultiClassNmsNode::nmsWithoutEta(const float* boxes, const float* scores, const SizeVector& boxesStrides, const SizeVector& scoresStrides) {
-    parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
+void MKLDNNMultiClassNmsNode::nmsWithoutEta(const float* scores, const SizeVector& scoresStrides) {
+    const iou_conf conf{iou_kind::clamped, static_cast<float>(normalized == false)};
+    nms_parallel_tasks(countCandidates(scores, scoresStrides), [&](size_t task) {
+        const int batch_idx = static_cast<int>(task / num_classes);
+        const int class_idx = static_cast<int>(task % num_classes);
         if (class_idx != background_class) {
-            const float* boxesPtr = boxes + batch_idx * boxesStrides[0];
+            const nms_boxes boxes = imageBoxes[batch_idx].boxes();
             const float* scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
             std::vector<std::pair<float, int>> sorted_boxes;
@@ -380,26 +407,27 @@ void MKLDNNMultiClassNmsNode::nmsWithoutEta(const float* boxes, const float* sco
 
             int io_selection_size = 0;
             if (sorted_boxes.size() > 0) {
-                parallel_sort(sorted_boxes.begin(), sorted_boxes.end(), [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+                std::sort(sorted_boxes.begin(), sorted_boxes.end(), [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
                     return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
                 });
                 int offset = batch_idx * num_classes * max_output_boxes_per_class + class_idx * max_output_boxes_per_class;
                 filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
                 io_selection_size++;
                 int max_out_box = (max_output_boxes_per_class > sorted_boxes.size()) ? sorted_boxes.size() : max_output_boxes_per_class;
+                // the selected boxes, compared with every candidate at once
+                nms_box_pool selected;
+                selected.reserve(max_out_box);
+                selected.push(boxes, sorted_boxes[0].second);
+                iou_args args{};
+                args.threshold = iou_threshold;
+                args.inclusive = true;
                 for (size_t box_idx = 1; box_idx < max_out_box; box_idx++) {
-                    bool box_is_selected = true;
-                    for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                        float iou =
-                            intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4], &boxesPtr[filtBoxes[offset + idx].box_index * 4], normalized);
-                        if (iou >= iou_threshold) {
-                            box_is_selected = false;
-                            break;
-                        }
-                    }
-
-                    if (box_is_selected) {
+                    args.boxes = selected.boxes();
+                    args.count = selected.size();
+                    args.set_box(boxes, sorted_boxes[box_idx].second);
+                    if (!XARCH::iou_exec(conf, args)) {
                         filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx, sorted_boxes[box_idx].second);
+                        selected.push(boxes, sorted_boxes[box_idx].second);
                         io_selection_size++;
                     }
                 }
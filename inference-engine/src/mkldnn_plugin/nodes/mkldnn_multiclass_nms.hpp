@@ -8,6 +8,9 @@
 #include <mkldnn_node.h>
 
 #include <string>
+#include <vector>
+
+#include "nms_imp.hpp"
 
 namespace MKLDNNPlugin {
 
@@ -82,12 +85,16 @@ private:
     void checkPrecision(const InferenceEngine::Precision prec, const std::vector<InferenceEngine::Precision> precList, const std::string name,
                         const std::string type);
 
-    float intersectionOverUnion(const float* boxesI, const float* boxesJ, const bool normalized);
+    // the corners of the boxes of every image, by coordinate
+    std::vector<InferenceEngine::Extensions::Cpu::nms_box_pool> imageBoxes;
+
+    void prepareBoxes(const float* boxes, const InferenceEngine::SizeVector& boxesStrides);
+
+    std::vector<size_t> countCandidates(const float* scores, const InferenceEngine::SizeVector& scoresStrides);
 
-    void nmsWithEta(const float* boxes, const float* scores, const InferenceEngine::SizeVector& boxesStrides, const InferenceEngine::SizeVector& scoresStrides);
+    void nmsWithEta(const float* scores, const InferenceEngine::SizeVector& scoresStrides);
 
-    void nmsWithoutEta(const float* boxes, const float* scores, const InferenceEngine::SizeVector& boxesStrides,
-                       const InferenceEngine::SizeVector& scoresStrides);
+    void nmsWithoutEta(const float* scores, const InferenceEngine::SizeVector& scoresStrides);
 };
 
 }  // namespace MKLDNNPlugin
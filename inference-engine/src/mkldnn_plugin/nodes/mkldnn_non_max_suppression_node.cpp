@@ -17,6 +17,7 @@
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
+using namespace InferenceEngine::Extensions::Cpu;
 
 bool MKLDNNNonMaxSuppressionNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
@@ -181,10 +182,11 @@ void MKLDNNNonMaxSuppressionNode::execute(mkldnn::stream strm) {
     const auto maxNumberOfBoxes = max_output_boxes_per_class * num_batches * num_classes;
     std::vector<filteredBoxes> filtBoxes(maxNumberOfBoxes);
 
+    prepareBoxes(boxes, boxesStrides);
     if (soft_nms_sigma == 0.0f) {
-        nmsWithoutSoftSigma(boxes, scores, boxesStrides, scoresStrides, filtBoxes);
+        nmsWithoutSoftSigma(scores, scoresStrides, filtBoxes);
     } else {
-        nmsWithSoftSigma(boxes, scores, boxesStrides, scoresStrides, filtBoxes);
+        nmsWithSoftSigma(scores, scoresStrides, filtBoxes);
     }
 
     size_t startOffset = numFiltBox[0][0];
@@ -253,43 +255,46 @@ bool MKLDNNNonMaxSuppressionNode::created() const {
     return getType() == NonMaxSuppression;
 }
 
-float MKLDNNNonMaxSuppressionNode::intersectionOverUnion(const float *boxesI, const float *boxesJ) {
-    float yminI, xminI, ymaxI, xmaxI, yminJ, xminJ, ymaxJ, xmaxJ;
-    if (boxEncodingType == boxEncoding::CENTER) {
-        //  box format: x_center, y_center, width, height
-        yminI = boxesI[1] - boxesI[3] / 2.f;
-        xminI = boxesI[0] - boxesI[2] / 2.f;
-        ymaxI = boxesI[1] + boxesI[3] / 2.f;
-        xmaxI = boxesI[0] + boxesI[2] / 2.f;
-        yminJ = boxesJ[1] - boxesJ[3] / 2.f;
-        xminJ = boxesJ[0] - boxesJ[2] / 2.f;
-        ymaxJ = boxesJ[1] + boxesJ[3] / 2.f;
-        xmaxJ = boxesJ[0] + boxesJ[2] / 2.f;
-    } else {
-        //  box format: y1, x1, y2, x2
-        yminI = (std::min)(boxesI[0], boxesI[2]);
-        xminI = (std::min)(boxesI[1], boxesI[3]);
-        ymaxI = (std::max)(boxesI[0], boxesI[2]);
-        xmaxI = (std::max)(boxesI[1], boxesI[3]);
-        yminJ = (std::min)(boxesJ[0], boxesJ[2]);
-        xminJ = (std::min)(boxesJ[1], boxesJ[3]);
-        ymaxJ = (std::max)(boxesJ[0], boxesJ[2]);
-        xmaxJ = (std::max)(boxesJ[1], boxesJ[3]);
-    }
-
-    float areaI = (ymaxI - yminI) * (xmaxI - xminI);
-    float areaJ = (ymaxJ - yminJ) * (xmaxJ - xminJ);
-    if (areaI <= 0.f || areaJ <= 0.f)
-        return 0.f;
+void MKLDNNNonMaxSuppressionNode::prepareBoxes(const float *boxes, const VectorDims &boxesStrides) {
+    imageBoxes.resize(num_batches);
+    parallel_for(num_batches, [&](size_t batch_idx) {
+        const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
+        auto &pool = imageBoxes[batch_idx];
+        pool.clear();
+        pool.reserve(num_boxes);
+        for (size_t box_idx = 0; box_idx < num_boxes; box_idx++) {
+            const float *box = boxesPtr + box_idx * 4;
+            float ymin, xmin, ymax, xmax;
+            if (boxEncodingType == boxEncoding::CENTER) {
+                //  box format: x_center, y_center, width, height
+                ymin = box[1] - box[3] / 2.f;
+                xmin = box[0] - box[2] / 2.f;
+                ymax = box[1] + box[3] / 2.f;
+                xmax = box[0] + box[2] / 2.f;
+            } else {
+                //  box format: y1, x1, y2, x2
+                ymin = (std::min)(box[0], box[2]);
+                xmin = (std::min)(box[1], box[3]);
+                ymax = (std::max)(box[0], box[2]);
+                xmax = (std::max)(box[1], box[3]);
+            }
+            pool.push(xmin, ymin, xmax, ymax, (ymax - ymin) * (xmax - xmin));
+        }
+    });
+}
 
-    float intersection_area =
-            (std::max)((std::min)(ymaxI, ymaxJ) - (std::max)(yminI, yminJ), 0.f) *
-            (std::max)((std::min)(xmaxI, xmaxJ) - (std::max)(xminI, xminJ), 0.f);
-    return intersection_area / (areaI + areaJ - intersection_area);
+std::vector<size_t> MKLDNNNonMaxSuppressionNode::countCandidates(const float *scores, const VectorDims &scoresStrides) {
+    std::vector<size_t> counts(num_batches * num_classes);
+    parallel_for2d(num_batches, num_classes, [&](size_t batch_idx, size_t class_idx) {
+        const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
+        counts[batch_idx * num_classes + class_idx] = std::count_if(scoresPtr, scoresPtr + num_boxes, [&](float score) {
+            return score > score_threshold;
+        });
+    });
+    return counts;
 }
 
-void MKLDNNNonMaxSuppressionNode::nmsWithSoftSigma(const float *boxes, const float *scores, const VectorDims &boxesStrides,
-                                                             const VectorDims &scoresStrides, std::vector<filteredBoxes> &filtBoxes) {
+void MKLDNNNonMaxSuppressionNode::nmsWithSoftSigma(const float *scores, const VectorDims &scoresStrides, std::vector<filteredBoxes> &filtBoxes) {
     auto less = [](const boxInfo& l, const boxInfo& r) {
         return l.score < r.score || ((l.score == r.score) && (l.idx > r.idx));
     };
@@ -299,9 +304,12 @@ void MKLDNNNonMaxSuppressionNode::nmsWithSoftSigma(const float *boxes, const flo
         return iou <= iou_threshold ? weight : 0.0f;
     };
 
-    parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
+    const iou_conf conf{iou_kind::clamped, 0.f};
+    nms_parallel_tasks(countCandidates(scores, scoresStrides), [&](size_t task) {
+        const int batch_idx = static_cast<int>(task / num_classes);
+        const int class_idx = static_cast<int>(task % num_classes);
         std::vector<filteredBoxes> fb;
-        const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
+        const nms_boxes boxes = imageBoxes[batch_idx].boxes();
         const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
         std::priority_queue<boxInfo, std::vector<boxInfo>, decltype(less)> sorted_boxes(less);
@@ -311,33 +319,45 @@ void MKLDNNNonMaxSuppressionNode::nmsWithSoftSigma(const float *boxes, const flo
         }
 
         fb.reserve(sorted_boxes.size());
-        if (sorted_boxes.size() > 0) {
-            while (fb.size() < max_output_boxes_per_class && !sorted_boxes.empty()) {
-                boxInfo currBox = sorted_boxes.top();
-                float origScore = currBox.score;
-                sorted_boxes.pop();
-
-                bool box_is_selected = true;
-                for (int idx = static_cast<int>(fb.size()) - 1; idx >= currBox.suppress_begin_index; idx--) {
-                    float iou = intersectionOverUnion(&boxesPtr[currBox.idx * 4], &boxesPtr[fb[idx].box_index * 4]);
-                    currBox.score *= coeff(iou);
-                    if (iou >= iou_threshold) {
-                        box_is_selected = false;
-                        break;
-                    }
-                    if (currBox.score <= score_threshold)
-                        break;
+        // the selected boxes, compared with every candidate at once
+        nms_box_pool selected;
+        std::vector<float> ious;
+        iou_args args{};
+        args.threshold = iou_threshold;
+        args.inclusive = true;
+        while (fb.size() < max_output_boxes_per_class && !sorted_boxes.empty()) {
+            boxInfo currBox = sorted_boxes.top();
+            float origScore = currBox.score;
+            sorted_boxes.pop();
+
+            // the score decays by the boxes selected after the candidate was put back, the latest ones first
+            args.boxes = selected.boxes(currBox.suppress_begin_index);
+            args.count = fb.size() - currBox.suppress_begin_index;
+            args.set_box(boxes, currBox.idx);
+            ious.resize(args.count);
+            args.iou = ious.data();
+            XARCH::iou_exec(conf, args);
+
+            bool box_is_selected = true;
+            for (int idx = static_cast<int>(args.count) - 1; idx >= 0; idx--) {
+                currBox.score *= coeff(ious[idx]);
+                if (ious[idx] >= iou_threshold) {
+                    box_is_selected = false;
+                    break;
                 }
+                if (currBox.score <= score_threshold)
+                    break;
+            }
 
-                currBox.suppress_begin_index = fb.size();
-                if (box_is_selected) {
-                    if (currBox.score == origScore) {
-                        fb.push_back({ currBox.score, batch_idx, class_idx, currBox.idx });
-                        continue;
-                    }
-                    if (currBox.score > score_threshold) {
-                        sorted_boxes.push(currBox);
-                    }
+            currBox.suppress_begin_index = fb.size();
+            if (box_is_selected) {
+                if (currBox.score == origScore) {
+                    fb.push_back({ currBox.score, batch_idx, class_idx, currBox.idx });
+                    selected.push(boxes, currBox.idx);
+                    continue;
+                }
+                if (currBox.score > score_threshold) {
+                    sorted_boxes.push(currBox);
                 }
             }
         }
@@ -349,11 +369,13 @@ void MKLDNNNonMaxSuppressionNode::nmsWithSoftSigma(const float *boxes, const flo
     });
 }
 
-void MKLDNNNonMaxSuppressionNode::nmsWithoutSoftSigma(const float *boxes, const float *scores, const VectorDims &boxesStrides,
-                                                                const VectorDims &scoresStrides, std::vector<filteredBoxes> &filtBoxes) {
+void MKLDNNNonMaxSuppressionNode::nmsWithoutSoftSigma(const float *scores, const VectorDims &scoresStrides, std::vector<filteredBoxes> &filtBoxes) {
     int max_out_box = static_cast<int>(max_output_boxes_per_class);
-    parallel_for2d(num_batches, num_classes, [&](int batch_idx, int class_idx) {
-        const float *boxesPtr = boxes + batch_idx * boxesStrides[0];
+    const iou_conf conf{iou_kind::clamped, 0.f};
+    nms_parallel_tasks(countCandidates(scores, scoresStrides), [&](size_t task) {
+        const int batch_idx = static_cast<int>(task / num_classes);
+        const int class_idx = static_cast<int>(task % num_classes);
+        const nms_boxes boxes = imageBoxes[batch_idx].boxes();
         const float *scoresPtr = scores + batch_idx * scoresStrides[0] + class_idx * scoresStrides[1];
 
         std::vector<std::pair<float, int>> sorted_boxes;
@@ -364,25 +386,24 @@ void MKLDNNNonMaxSuppressionNode::nmsWithoutSoftSigma(const float *boxes, const
 
         int io_selection_size = 0;
         if (sorted_boxes.size() > 0) {
-            parallel_sort(sorted_boxes.begin(), sorted_boxes.end(),
-                          [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
-                              return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
-                          });
+            std::sort(sorted_boxes.begin(), sorted_boxes.end(),
+                      [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+                          return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
+                      });
             int offset = batch_idx*num_classes*max_output_boxes_per_class + class_idx*max_output_boxes_per_class;
-            filtBoxes[offset + 0] = filteredBoxes(sorted_boxes[0].first, batch_idx, class_idx, sorted_boxes[0].second);
-            io_selection_size++;
-            for (size_t box_idx = 1; (box_idx < sorted_boxes.size()) && (io_selection_size < max_out_box); box_idx++) {
-                bool box_is_selected = true;
-                for (int idx = io_selection_size - 1; idx >= 0; idx--) {
-                    float iou = intersectionOverUnion(&boxesPtr[sorted_boxes[box_idx].second * 4], &boxesPtr[filtBoxes[offset + idx].box_index * 4]);
-                    if (iou >= iou_threshold) {
-                        box_is_selected = false;
-                        break;
-                    }
-                }
-
-                if (box_is_selected) {
+            // the selected boxes, compared with every candidate at once
+            nms_box_pool selected;
+            selected.reserve(std::min(sorted_boxes.size(), max_output_boxes_per_class));
+            iou_args args{};
+            args.threshold = iou_threshold;
+            args.inclusive = true;
+            for (size_t box_idx = 0; (box_idx < sorted_boxes.size()) && (io_selection_size < max_out_box); box_idx++) {
+                args.boxes = selected.boxes();
+                args.count = selected.size();
+                args.set_box(boxes, sorted_boxes[box_idx].second);
+                if (!XARCH::iou_exec(conf, args)) {
                     filtBoxes[offset + io_selection_size] = filteredBoxes(sorted_boxes[box_idx].first, batch_idx, class_idx, sorted_boxes[box_idx].second);
+                    selected.push(boxes, sorted_boxes[box_idx].second);
                     io_selection_size++;
                 }
             }
@@ -9,6 +9,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include "nms_imp.hpp"
 
 using namespace InferenceEngine;
 
@@ -42,13 +43,13 @@ public:
         int suppress_begin_index;
     };
 
-    float intersectionOverUnion(const float *boxesI, const float *boxesJ);
+    void prepareBoxes(const float *boxes, const SizeVector &boxesStrides);
 
-    void nmsWithSoftSigma(const float *boxes, const float *scores, const SizeVector &boxesStrides,
-                          const SizeVector &scoresStrides, std::vector<filteredBoxes> &filtBoxes);
+    std::vector<size_t> countCandidates(const float *scores, const SizeVector &scoresStrides);
 
-    void nmsWithoutSoftSigma(const float *boxes, const float *scores, const SizeVector &boxesStrides,
-                             const SizeVector &scoresStrides, std::vector<filteredBoxes> &filtBoxes);
+    void nmsWithSoftSigma(const float *scores, const SizeVector &scoresStrides, std::vector<filteredBoxes> &filtBoxes);
+
+    void nmsWithoutSoftSigma(const float *scores, const SizeVector &scoresStrides, std::vector<filteredBoxes> &filtBoxes);
 
     void executeDynamicImpl(mkldnn::stream strm) override { execute(strm); }
 
@@ -94,6 +95,8 @@ private:
     std::string errorPrefix;
 
     std::vector<std::vector<size_t>> numFiltBox;
+    // the corners of the boxes of every image, by coordinate
+    std::vector<InferenceEngine::Extensions::Cpu::nms_box_pool> imageBoxes;
     const std::string inType = "input", outType = "output";
 
     void checkPrecision(const Precision& prec, const std::vector<Precision>& precList, const std::string& name, const std::string& type);
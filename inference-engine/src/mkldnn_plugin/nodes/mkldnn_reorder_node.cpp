@@ -6,6 +6,7 @@
 #include <memory>
 #include <string>
 #include <algorithm>
+#include <numeric>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
 #include "ie_parallel.hpp"
@@ -14,11 +15,36 @@
 #include "nodes/common/cpu_memcpy.h"
 #include "nodes/common/cpu_convert.h"
 #include "mkldnn_convert_node.h"
+#include <common/primitive_hashing.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
 
+namespace {
+struct ReorderKey {
+    mkldnn::memory::desc src;
+    mkldnn::memory::desc dest;
+
+    size_t hash() const;
+    bool operator==(const ReorderKey& rhs) const;
+};
+
+size_t ReorderKey::hash() const {
+    using namespace mkldnn::impl;
+    using namespace mkldnn::impl::primitive_hashing;
+
+    size_t seed = 0;
+    seed = hash_combine(seed, get_md_hash(src.data));
+    seed = hash_combine(seed, get_md_hash(dest.data));
+    return seed;
+}
+
+bool ReorderKey::operator==(const ReorderKey& rhs) const {
+    return src == rhs.src && dest == rhs.dest;
+}
+}  // namespace
+
 MKLDNNReorderNode::MKLDNNReorderNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &w_cache) :
         MKLDNNNode(op, eng, w_cache) {
     IE_THROW() << "Can't create reorder node from ngraph node";
@@ -74,6 +100,17 @@ void MKLDNNReorderNode::initSupportedPrimitiveDescriptors() {
 
     if (!isOptimized) {
         const auto &inShape = getInputShapeAtPort(0);
+        const auto inPrc = config.inConfs[0].desc->getPrecision();
+        const auto outPrc = config.outConfs[0].desc->getPrecision();
+        if (!isDynamic && impl::cpu::x64::mayiuse(impl::cpu::x64::avx2) &&
+                MKLDNNPlugin::one_of(inShape.getRank(), 3, 4, 5) &&
+                ((config.inConfs[0].desc->hasLayoutType(LayoutType::nspc) && config.outConfs[0].desc->hasLayoutType(LayoutType::ncsp)) ||
+                 (config.inConfs[0].desc->hasLayoutType(LayoutType::ncsp) && config.outConfs[0].desc->hasLayoutType(LayoutType::nspc))) &&
+                (inPrc == outPrc || PermuteKernel::isSupportedConversion(inPrc, outPrc))) {
+            // the permute kernel is tried first, the cases below are the fallback if the shape isn't suitable for the tiles
+            isTransposeCase = true;
+        }
+
         if (MKLDNNPlugin::one_of(inShape.getRank(), 4, 5) &&
                 config.inConfs[0].desc->hasLayoutType(LayoutType::nspc) &&
                 config.outConfs[0].desc->hasLayoutType(LayoutType::ncsp) &&
@@ -116,6 +153,29 @@ void MKLDNNReorderNode::prepareParams() {
         if (getSelectedPrimitiveDescriptor() == nullptr)
             IE_THROW() << "Preferable primitive descriptor is not set.";
 
+        if (isTransposeCase) {
+            PermuteParams params;
+            auto srcDesc = srcMemPtr->GetDescWithType<BlockedMemoryDesc>();
+            auto dstDesc = dstMemPtr->GetDescWithType<BlockedMemoryDesc>();
+            params.src_block_dims = srcDesc->getBlockDims();
+            params.src_block_order = srcDesc->getOrder();
+            params.dst_block_dims = dstDesc->getBlockDims();
+            params.dst_block_order = dstDesc->getOrder();
+            params.order.resize(params.src_block_dims.size());
+            std::iota(params.order.begin(), params.order.end(), 0);
+            params.data_size = srcDesc->getPrecision().size();
+            params.src_prc = srcDesc->getPrecision();
+            params.dst_prc = dstDesc->getPrecision();
+
+            permuteKernel = std::unique_ptr<PermuteKernel>(new PermuteKernel(params));
+            if (permuteKernel->isTiled()) {
+                supportedPrimitiveDescriptors[0].setImplementationType(impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_common) ?
+                                                                       impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2);
+                return;
+            }
+            permuteKernel.reset();
+        }
+
         if (isNspc2NcspCase) {
             const auto &inDims = srcMemPtr->getStaticDims();
             canUseNspc2Ncsp = inDims[1] <= 64 && inDims[1] >= 16 &&
@@ -144,23 +204,26 @@ void MKLDNNReorderNode::createReorderPrimitive(const mkldnn::memory::desc &srcDe
     dst_blocked = std::make_shared<MKLDNNMemory>(getEngine());
     dst_blocked->Create(MKLDNNExtensionUtils::makeDescriptor(dstDesc), dstPtr, false);
 
-    mkldnn::primitive_attr attr;
-    auto createReorder = [&]() -> bool {
+    auto engine = getEngine();
+    auto builder = [&engine](const ReorderKey& key) -> std::shared_ptr<mkldnn::primitive> {
+        mkldnn::primitive_attr attr;
         // No autoblocking. Reorder can be applied as is
-        reorder::primitive_desc pd = mkldnn::reorder::primitive_desc(src_blocked->GetPrimitive(), dst_blocked->GetPrimitive(), attr, true);
+        reorder::primitive_desc pd = mkldnn::reorder::primitive_desc(engine, key.src, engine, key.dest, attr, true);
 
         if (!pd)
-            return false;
+            return nullptr;
 
-        auto info = pd.impl_info_str();
-        supportedPrimitiveDescriptors[0].setImplementationType(parse_impl_name(info));
+        return std::make_shared<mkldnn::reorder>(pd);
+    };
 
-        prim.reset(new mkldnn::reorder(pd));
-        return true;
+    auto cache = getRuntimeCache();
+    auto createReorder = [&]() -> std::shared_ptr<mkldnn::primitive> {
+        ReorderKey key = {src_blocked->GetPrimitive().get_desc(), dst_blocked->GetPrimitive().get_desc()};
+        return cache ? cache->getOrCreate(key, builder).first : builder(key);
     };
 
-    auto success = createReorder();
-    if (!success) {
+    auto reorderPrim = createReorder();
+    if (!reorderPrim) {
         // TODO: We should keep shape consistency for const and expected shape for node.
         //       If it requires reshape operation it should explicitly injected into graph.
         //
@@ -180,14 +243,20 @@ void MKLDNNReorderNode::createReorderPrimitive(const mkldnn::memory::desc &srcDe
             auto newDesc = mkldnn::memory::desc(MKLDNNExtensionUtils::convertToDnnlDims(newDims), src_blocked->GetDataType(), newFormat);
             src_blocked->Create(MKLDNNExtensionUtils::makeDescriptor(newDesc), srcPtr, false);
 
-            success = createReorder();
+            reorderPrim = createReorder();
         }
     }
 
-    if (!success) {
+    if (!reorderPrim) {
         IE_THROW() << "Cannot create reorder primitive: unsupported reorder case";
     }
 
+    const char *info = nullptr;
+    if (dnnl_primitive_desc_query(reorderPrim->get_primitive_desc(), dnnl_query_impl_info_str, 0, &info) == dnnl_success && info)
+        supportedPrimitiveDescriptors[0].setImplementationType(parse_impl_name(info));
+
+    prim = reorderPrim;
+
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}};
@@ -265,7 +334,15 @@ void MKLDNNReorderNode::execute(mkldnn::stream strm) {
     if (isOptimized)
         return;
 
-    if (canUseNspc2Ncsp) {
+    if (!batchItems.empty()) {
+        executeBatchItems(strm);
+        return;
+    }
+
+    if (permuteKernel) {
+        permuteKernel->execute(reinterpret_cast<const uint8_t *>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr()),
+                               reinterpret_cast<uint8_t *>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr()), batchToProcess());
+    } else if (canUseNspc2Ncsp) {
         optimizedNspc2Ncsp();
     } else if (canUseNcsp2Nspc) {
         optimizedNcsp2Nspc();
@@ -297,6 +374,63 @@ void MKLDNNReorderNode::setDynamicBatchLim(int lim) {
     }
 }
 
+bool MKLDNNReorderNode::setBatchItems(const std::vector<const void*>& items) {
+    if (items.empty()) {
+        batchItems.clear();
+        return true;
+    }
+    if (isOptimized || isDynamic || getParentEdges().size() != 1)
+        return false;
+
+    auto &srcMemPtr = getParentEdgeAt(0)->getMemoryPtr();
+    auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    if (!srcMemPtr || !dstMemPtr || srcMemPtr->getStaticDims().empty() || srcMemPtr->getStaticDims()[0] != items.size())
+        return false;
+
+    // the batch axis is the outer one and it isn't blocked, so the item is the contiguous part of the tensor
+    auto isOuterBatch = [](const BlockedMemoryDesc& desc) {
+        const auto& order = desc.getOrder();
+        return !order.empty() && order[0] == 0 && std::count(order.begin(), order.end(), 0) == 1 &&
+               desc.getOffsetPaddingToData()[0] == 0;
+    };
+    auto srcDesc = srcMemPtr->GetDescWithType<BlockedMemoryDesc>();
+    auto dstDesc = dstMemPtr->GetDescWithType<BlockedMemoryDesc>();
+    if (!isOuterBatch(*srcDesc) || !isOuterBatch(*dstDesc) || dstDesc->getBlockDims()[0] != items.size())
+        return false;
+
+    if (!itemPrim) {
+        memory::desc src_d = srcMemPtr->GetDescWithType<DnnlMemoryDesc>()->getDnnlDesc();
+        memory::desc dst_d = dstMemPtr->GetDescWithType<DnnlMemoryDesc>()->getDnnlDesc();
+        src_d.data.dims[0] = 1;
+        src_d.data.padded_dims[0] = 1;
+        dst_d.data.dims[0] = 1;
+        dst_d.data.padded_dims[0] = 1;
+
+        reorder::primitive_desc pd = mkldnn::reorder::primitive_desc(getEngine(), src_d, getEngine(), dst_d, primitive_attr(), true);
+        if (!pd)
+            return false;
+        itemPrim = std::make_shared<mkldnn::reorder>(pd);
+
+        itemSrc = std::make_shared<MKLDNNMemory>(getEngine());
+        itemSrc->Create(MKLDNNExtensionUtils::makeDescriptor(src_d), srcMemPtr->GetData(), false);
+        itemDst = std::make_shared<MKLDNNMemory>(getEngine());
+        itemDst->Create(MKLDNNExtensionUtils::makeDescriptor(dst_d), dstMemPtr->GetData(), false);
+        itemDstSize = dstDesc->getStrides()[0] * dstDesc->getPrecision().size();
+    }
+
+    batchItems = items;
+    return true;
+}
+
+void MKLDNNReorderNode::executeBatchItems(mkldnn::stream strm) {
+    auto dst = static_cast<uint8_t*>(getChildEdgeAt(0)->getMemory().GetData());
+    for (size_t i = 0; i < batchItems.size(); i++) {
+        itemSrc->GetPrimitivePtr()->set_data_handle(const_cast<void*>(batchItems[i]));
+        itemDst->GetPrimitivePtr()->set_data_handle(dst + i * itemDstSize);
+        itemPrim->execute(strm, {{DNNL_ARG_SRC, itemSrc->GetPrimitive()}, {DNNL_ARG_DST, itemDst->GetPrimitive()}});
+    }
+}
+
 std::string MKLDNNReorderNode::getReorderArgs(const MemoryDesc &parentDesc, const MemoryDesc &childDesc) {
     std::string inArgs, outArgs;
     if (parentDesc.getPrecision() != childDesc.getPrecision()) {
@@ -364,8 +498,10 @@ void MKLDNNReorderNode::reorderData(const MKLDNNMemory &input, const MKLDNNMemor
     }
 }
 
-std::vector<VectorDims> MKLDNNReorderNode::shapeInfer() const {
-    return {getParentEdgesAtPort(0)[0]->getMemory().getStaticDims()};
+const std::vector<VectorDims>& MKLDNNReorderNode::shapeInfer() const {
+    lastOutputShapes.resize(1);
+    lastOutputShapes[0] = getParentEdgesAtPort(0)[0]->getMemory().getStaticDims();
+    return lastOutputShapes;
 }
 
 REG_MKLDNN_PRIM_FOR(MKLDNNReorderNode, Reorder);
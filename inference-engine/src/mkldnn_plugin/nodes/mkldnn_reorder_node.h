@@ -10,6 +10,7 @@
 #include <memory>
 #include <vector>
 #include <utils/general_utils.h>
+#include "common/permute_kernel.h"
 
 namespace MKLDNNPlugin {
 
@@ -30,7 +31,7 @@ public:
 
     void createPrimitive() override;
 
-    std::vector<VectorDims> shapeInfer() const override;
+    const std::vector<VectorDims>& shapeInfer() const override;
 
     void prepareParams() override;
 
@@ -63,6 +64,12 @@ public:
 
     static void reorderData(const MKLDNNMemory &input, const MKLDNNMemory &output, size_t size = 0);
 
+    /**
+     * Makes the reorder read the batch items from the separate buffers instead of the parent memory, the empty vector
+     * restores the parent one. Returns false if the items can't be reordered one by one.
+     */
+    bool setBatchItems(const std::vector<const void*>& items);
+
 private:
     std::shared_ptr<MemoryDesc> input;
     std::shared_ptr<MemoryDesc> output;
@@ -76,8 +83,20 @@ private:
     bool canUseNspc2Ncsp = false;
     bool canUseNcsp2Nspc = false;
 
+    // the planar <-> channels last reorder is the transposition of the channels and the spatial axes
+    bool isTransposeCase = false;
+    std::unique_ptr<PermuteKernel> permuteKernel;
+
+    // the reorder of one batch item, the items are the outer blocks of the source and of the destination
+    std::vector<const void*> batchItems;
+    std::shared_ptr<mkldnn::primitive> itemPrim;
+    MKLDNNMemoryPtr itemSrc;
+    MKLDNNMemoryPtr itemDst;
+    size_t itemDstSize = 0;
+
     void optimizedNspc2Ncsp();
     void optimizedNcsp2Nspc();
+    void executeBatchItems(mkldnn::stream strm);
     void createReorderPrimitive(const mkldnn::memory::desc &srcDesc, void* srcPtr, const mkldnn::memory::desc &dstDesc, void* dstPtr);
 };
 
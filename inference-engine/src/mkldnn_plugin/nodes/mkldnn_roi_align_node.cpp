@@ -14,6 +14,7 @@
 #include "ie_parallel.hpp"
 #include <mkldnn_selective_build.h>
 #include <ngraph/opsets/opset3.hpp>
+#include "common/cpu_convert.h"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -110,12 +111,17 @@ void MKLDNNROIAlignNode::initSupportedPrimitiveDescriptors() {
         return;
 
     Precision inputPrec0 = getOriginalInputPrecisionAtPort(0);
+    Precision inputPrec1 = getOriginalInputPrecisionAtPort(1);
     Precision outputPrec = getOriginalOutputPrecisionAtPort(0);
 
     if (!mayiuse(avx512_core)) {
         if (outputPrec == Precision::BF16 || inputPrec0 == Precision::BF16)
             outputPrec = inputPrec0 = Precision::FP32;
+        inputPrec1 = Precision::FP32;
     }
+    // the coordinates are read in place or converted once per inference, so BF16 proposals don't need a reorder
+    if (inputPrec1 != Precision::BF16)
+        inputPrec1 = Precision::FP32;
 
     NodeConfig config;
     config.dynBatchSupport = false;
@@ -131,7 +137,7 @@ void MKLDNNROIAlignNode::initSupportedPrimitiveDescriptors() {
 
     for (auto fmts : supportedFormats) {
         addSupportedPrimDesc({{fmts.first, inputPrec0},
-                              {LayoutType::ncsp, Precision::FP32},
+                              {LayoutType::ncsp, inputPrec1},
                               {LayoutType::ncsp, Precision::I32}},
                              {{fmts.second, outputPrec}},
                               impl_desc_type::unknown);
@@ -186,6 +192,11 @@ void MKLDNNROIAlignNode::executeSpecified() {
 
     const auto *srcData = reinterpret_cast<const inputType *>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
     const auto *srcRoi = reinterpret_cast<const float *>(getParentEdgeAt(1)->getMemoryPtr()->GetPtr());
+    if (srcMemory1.getDesc().getPrecision() == Precision::BF16) {
+        roisBuffer.resize(srcMemory1.GetShape().getElementsCount());
+        cpu_convert(srcRoi, roisBuffer.data(), Precision::BF16, Precision::FP32, roisBuffer.size());
+        srcRoi = roisBuffer.data();
+    }
     const auto *srcRoiIdx = reinterpret_cast<const int *>(getParentEdgeAt(2)->getMemoryPtr()->GetPtr());
     auto *dst = reinterpret_cast<outputType *>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
 
@@ -341,12 +352,37 @@ void MKLDNNROIAlignNode::executeSpecified() {
             dst[dstIndex] = pooledValue;
         };
         if (isNhwcFmt) {
-            parallel_for2d(pooledH, pooledW, [&](int yBinInd, int xBinInd) {
-                for (int c = 0; c < C; c++) {
-                    size_t binOffsetInput = roiBatchInd * C * H * W + c;
-                    size_t binOffsetOutput = n * C * binCount + c;
-                    pool(xBinInd, yBinInd, binOffsetInput, binOffsetOutput, 0);
-                }
+            // The channels are contiguous, so every sample is interpolated for all of them at once
+            const size_t threadsNum = parallel_get_max_threads();
+            if (channelsBuffer.size() < threadsNum * C)
+                channelsBuffer.resize(threadsNum * C);
+            const bool isMax = getAlgorithm() == Algorithm::ROIAlignMax;
+            const inputType* batchData = srcData + static_cast<size_t>(roiBatchInd) * C * H * W;
+            parallel_nt(0, [&](const int ithr, const int nthr) {
+                float* pooled = &channelsBuffer[ithr * C];
+                for_2d(ithr, nthr, pooledH, pooledW, [&](int yBinInd, int xBinInd) {
+                    std::fill(pooled, pooled + C, 0.f);
+                    size_t sampleIndex = 4 * (yBinInd * pooledW + xBinInd) * numSamplesInBin;
+                    for (uint64_t binSampleInd = 0; binSampleInd < numSamplesInBin; binSampleInd++, sampleIndex += 4) {
+                        const inputType* parts[4];
+                        for (int i = 0; i < 4; i++)
+                            parts[i] = batchData + pointVector[sampleIndex + i].first * hInputStride +
+                                       pointVector[sampleIndex + i].second * wInputStride;
+                        const float w1 = weightVector[sampleIndex], w2 = weightVector[sampleIndex + 1];
+                        const float w3 = weightVector[sampleIndex + 2], w4 = weightVector[sampleIndex + 3];
+                        for (int c = 0; c < C; c++) {
+                            const float sampleValue = w1 * static_cast<float>(parts[0][c]) + w2 * static_cast<float>(parts[1][c]) +
+                                                      w3 * static_cast<float>(parts[2][c]) + w4 * static_cast<float>(parts[3][c]);
+                            if (isMax)
+                                pooled[c] = sampleValue > pooled[c] ? sampleValue : pooled[c];
+                            else
+                                pooled[c] += sampleValue / numSamplesInBin;
+                        }
+                    }
+                    outputType* dstBin = dst + static_cast<size_t>(n) * C * binCount + yBinInd * hOutputStride + xBinInd * wOutputStride;
+                    for (int c = 0; c < C; c++)
+                        dstBin[c] = pooled[c];
+                });
             });
         } else {  // nchw, nChw16c, nChw8c
             parallel_for3d(blockCount, pooledH, pooledW, [&](int blkIdx, int yBinInd, int xBinInd) {
@@ -35,6 +35,9 @@ private:
     template<typename T>
     struct ROIAlignExecute;
 
+    std::vector<float> roisBuffer;      // BF16 proposals converted to FP32
+    std::vector<float> channelsBuffer;  // per thread accumulators of the channels of the nspc bins
+
     std::string errorPrefix;
 };
 
@@ -45,6 +45,16 @@ MKLDNNScatterUpdateNode::MKLDNNScatterUpdateNode(const std::shared_ptr<ngraph::N
     std::string errorMessage;
     if (isSupportedOperation(op, errorMessage)) {
         errorPrefix = std::string(op->get_type_name()) + " node with name '" + getName() + "'";
+        // the axis is needed to choose the layouts, so it is taken from the constant input when possible
+        if (std::dynamic_pointer_cast<const ngraph::opset3::ScatterUpdate>(op) && op->get_input_size() > AXIS_ID) {
+            const auto axisConst = ngraph::as_type_ptr<const ngraph::op::Constant>(op->get_input_node_shared_ptr(AXIS_ID));
+            if (axisConst) {
+                const auto rank = static_cast<int64_t>(op->get_input_shape(DATA_ID).size());
+                const int64_t axisValue = axisConst->cast_vector<int64_t>()[0];
+                if (axisValue >= -rank && axisValue < rank)
+                    constAxis = static_cast<int>(axisValue < 0 ? axisValue + rank : axisValue);
+            }
+        }
     } else {
         IE_THROW(NotImplemented) << errorMessage;
     }
@@ -202,12 +212,26 @@ void MKLDNNScatterUpdateNode::initSupportedPrimitiveDescriptors() {
         config.inConfs[AXIS_ID].inPlace = -1;
     }
 
-    std::vector<PortConfigurator> inPortConfig{{LayoutType::ncsp, dataPrec}, {LayoutType::ncsp, indicesPrec}, {LayoutType::ncsp, dataPrec}};
-    if (axisRelaxed)
-        inPortConfig.emplace_back(LayoutType::ncsp, axisPrec);
-    addSupportedPrimDesc(inPortConfig,
-                         {{LayoutType::ncsp, dataPrec}},
-                          impl_desc_type::unknown);
+    auto pushDesc = [&](LayoutType dataLayout) {
+        std::vector<PortConfigurator> inPortConfig{{dataLayout, dataPrec}, {LayoutType::ncsp, indicesPrec}, {dataLayout, dataPrec}};
+        if (axisRelaxed)
+            inPortConfig.emplace_back(LayoutType::ncsp, axisPrec);
+        addSupportedPrimDesc(inPortConfig,
+                             {{dataLayout, dataPrec}},
+                              impl_desc_type::unknown);
+    };
+
+    pushDesc(LayoutType::ncsp);
+
+    // With 1D indices the updates have the same rank and the same dims order as the data, so ScatterUpdate is
+    // performed over the physical dims of any layout. The channel blocks are kept as is if the channels aren't updated.
+    if (scatterUpdateMode == ScatterUpdateMode::ScatterUpdate && indicesRank == 1 && (srcRank == 4 || srcRank == 5)) {
+        pushDesc(LayoutType::nspc);
+        if (constAxis >= 0 && constAxis != 1) {
+            pushDesc(LayoutType::nCsp8c);
+            pushDesc(LayoutType::nCsp16c);
+        }
+    }
 }
 
 void MKLDNNScatterUpdateNode::createPrimitive() {
@@ -328,7 +352,7 @@ void MKLDNNScatterUpdateNode::execute(mkldnn::stream strm) {
     }
 
     if (srcPtr != dstPtr) {
-        std::vector<size_t> srcBlockND = getBlockND(srcDataDim);
+        std::vector<size_t> srcBlockND = getBlockND(srcMemPtr->GetDescWithType<BlockedMemoryDesc>()->getBlockDims());
         parallel_nt(0, [&](const int ithr, const int nthr) {
             size_t start = 0, end = 0;
             splitter(srcBlockND[0], nthr, ithr, start, end);
@@ -362,11 +386,16 @@ void MKLDNNScatterUpdateNode::execute(mkldnn::stream strm) {
 // and indices tensor of shape [i_0, i_1, ..., i_k].
 // Updates tensor shape should be [d_0, d_1, ... d_(axis - 1), i_0, i_1, ..., i_k, d_(axis + 1), ..., d_n].
 void MKLDNNScatterUpdateNode::scatterUpdate(uint8_t *indices, uint8_t *update, int axis, uint8_t *dstData) {
-    SizeVector srcDataDim = getParentEdgeAt(DATA_ID)->getMemory().getStaticDims();
+    const auto srcBlkDesc = getParentEdgeAt(DATA_ID)->getMemory().GetDescWithType<BlockedMemoryDesc>();
+    SizeVector srcDataDim = srcBlkDesc->getBlockDims();
     SizeVector indicesDim = getParentEdgeAt(INDICES_ID)->getMemory().getStaticDims();
-    SizeVector updateDim = getParentEdgeAt(UPDATE_ID)->getMemory().getStaticDims();
+    SizeVector updateDim = getParentEdgeAt(UPDATE_ID)->getMemory().GetDescWithType<BlockedMemoryDesc>()->getBlockDims();
     size_t indicesRank = indicesDim.size();
 
+    // the updates are written over the physical dims, where the axis position differs from the logical one for nspc
+    const auto& order = srcBlkDesc->getOrder();
+    axis = static_cast<int>(std::distance(order.begin(), std::find(order.begin(), order.end(), static_cast<size_t>(axis))));
+
     std::vector<size_t> srcBlockND = getBlockND(srcDataDim);
     std::vector<size_t> updateBlockND = getBlockND(updateDim);
 
@@ -47,6 +47,8 @@ private:
 
     // if axis can be set other than default 0.
     bool axisRelaxed = false;
+    // the normalized value of the constant ScatterUpdate axis or -1 if it is known at the execution only
+    int constAxis = -1;
     size_t dataSize, indicesSize, axisSize;
     InferenceEngine::Precision dataPrec, indicesPrec, axisPrec;
 
@@ -0,0 +1,179 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_sdpa_node.h"
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <mkldnn_types.h>
+#include <mkldnn_extension_utils.h>
+#include "ie_parallel.hpp"
+#include "mkldnn/ie_mkldnn.h"
+#include "utils/general_utils.h"
+#include "ngraph_transformations/op/scaled_dot_product_attention.hpp"
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+bool MKLDNNScaledDotProductAttentionNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (isDynamicNgraphNode(op)) {
+            errorMessage = "Doesn't support op with dynamic shapes";
+            return false;
+        }
+        if (!ngraph::is_type<const MKLDNNPlugin::ScaledDotProductAttentionNode>(op)) {
+            errorMessage = "Only CPU plugin ScaledDotProductAttention operation is supported";
+            return false;
+        }
+        const auto rank = op->get_output_shape(0).size();
+        if (rank < 2 || rank > 4) {
+            errorMessage = "Unsupported rank: " + std::to_string(rank);
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNScaledDotProductAttentionNode::MKLDNNScaledDotProductAttentionNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng,
+                                                                         MKLDNNWeightsSharing::Ptr &cache) : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    errorPrefix = "ScaledDotProductAttention node with name '" + getName() + "'";
+    const auto sdpa = ngraph::as_type_ptr<const MKLDNNPlugin::ScaledDotProductAttentionNode>(op);
+    transposeK = sdpa->get_transpose_k();
+    scale = sdpa->get_scale();
+    withMask = op->get_input_size() > MASK_ID;
+}
+
+void MKLDNNScaledDotProductAttentionNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    std::vector<PortConfigurator> inConfs(getOriginalInputsNumber(), {LayoutType::ncsp, Precision::FP32});
+    addSupportedPrimDesc(inConfs, {{LayoutType::ncsp, Precision::FP32}}, impl_desc_type::gemm_any);
+}
+
+void MKLDNNScaledDotProductAttentionNode::createPrimitive() {
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        IE_THROW() << errorPrefix << " did not set preferable primitive descriptor";
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        auto& srcMemPtr = getParentEdgeAt(i)->getMemoryPtr();
+        if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+            IE_THROW() << errorPrefix << " did not allocate input memory";
+    }
+    auto& dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
+    if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+        IE_THROW() << errorPrefix << " did not allocate destination memory";
+
+    // the logical dims of the operands, the memory keeps the tensors before the folded transpositions
+    VectorDims qDims, qStrides, kDims, kStrides, vDims, vStrides, outDims, outStrides;
+    getTransposedView(getParentEdgeAt(Q_ID)->getMemory().getStaticDims(), inputOrders[Q_ID], qDims, qStrides);
+    getTransposedView(getParentEdgeAt(K_ID)->getMemory().getStaticDims(), inputOrders[K_ID], kDims, kStrides);
+    getTransposedView(getParentEdgeAt(V_ID)->getMemory().getStaticDims(), inputOrders[V_ID], vDims, vStrides);
+    getTransposedView(dstMemPtr->getStaticDims(), outputOrder.empty() ? outputOrder : getInverseOrder(outputOrder), outDims, outStrides);
+
+    const size_t rank = outDims.size();
+    MB1 = rank > 3 ? outDims[rank - 4] : 1;
+    MB2 = rank > 2 ? outDims[rank - 3] : 1;
+    M = qDims[rank - 2];
+    D = qDims[rank - 1];
+    N = transposeK ? kDims[rank - 2] : kDims[rank - 1];
+    DV = vDims[rank - 1];
+
+    q = makeGemmOperand(qDims, qStrides, false, outDims);
+    k = makeGemmOperand(kDims, kStrides, transposeK, outDims);
+    v = makeGemmOperand(vDims, vStrides, false, outDims);
+    out = makeGemmOperand(outDims, outStrides, false, outDims);
+    qRowStride = qStrides[rank - 2];
+    outRowStride = outStrides[rank - 2];
+
+    if (withMask) {
+        // the mask is aligned to the scores by the last axes
+        VectorDims maskDims = getParentEdgeAt(MASK_ID)->getMemory().getStaticDims();
+        maskDims.insert(maskDims.begin(), rank - maskDims.size(), 1);
+        const auto maskStrides = getDenseStrides(maskDims);
+        auto broadcastStride = [&](size_t axis) { return maskDims[axis] == 1 ? 0 : maskStrides[axis]; };
+        for (size_t i = 0; i < 2 && i + 3 <= rank; i++)
+            maskBatchStrides[i] = broadcastStride(rank - 3 - i);
+        maskRowStride = broadcastStride(rank - 2);
+        maskColStride = broadcastStride(rank - 1);
+    }
+
+    // the scores of the block of the rows are kept in the half of L2
+    const size_t cacheSize = static_cast<size_t>(mkldnn::utils::get_cache_size(2, true)) / 2;
+    rowsBlock = std::max<size_t>(1, std::min(M, cacheSize / (N * sizeof(float))));
+    scores.resize(parallel_get_max_threads() * rowsBlock * N);
+}
+
+void MKLDNNScaledDotProductAttentionNode::execute(mkldnn::stream strm) {
+    const auto qData = reinterpret_cast<const float*>(getParentEdgeAt(Q_ID)->getMemoryPtr()->GetPtr());
+    const auto kData = reinterpret_cast<const float*>(getParentEdgeAt(K_ID)->getMemoryPtr()->GetPtr());
+    const auto vData = reinterpret_cast<const float*>(getParentEdgeAt(V_ID)->getMemoryPtr()->GetPtr());
+    const auto maskData = withMask ? reinterpret_cast<const float*>(getParentEdgeAt(MASK_ID)->getMemoryPtr()->GetPtr()) : nullptr;
+    auto dstData = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+
+    auto processBlock = [&](float* s, size_t b1, size_t b2, size_t block) {
+        const size_t row0 = block * rowsBlock;
+        const size_t rows = std::min(rowsBlock, M - row0);
+
+        const float* qPtr = qData + b1 * q.batchStrides[1] + b2 * q.batchStrides[0] + row0 * qRowStride;
+        const float* kPtr = kData + b1 * k.batchStrides[1] + b2 * k.batchStrides[0];
+        const float* vPtr = vData + b1 * v.batchStrides[1] + b2 * v.batchStrides[0];
+        float* dstPtr = dstData + b1 * out.batchStrides[1] + b2 * out.batchStrides[0] + row0 * outRowStride;
+
+        mkldnn_sgemm(q.trans, k.trans, rows, N, D, scale, qPtr, q.ld, kPtr, k.ld, 0.f, s, N);
+
+        for (size_t r = 0; r < rows; r++) {
+            float* row = s + r * N;
+            if (maskData) {
+                const float* maskRow = maskData + b1 * maskBatchStrides[1] + b2 * maskBatchStrides[0] + (row0 + r) * maskRowStride;
+                for (size_t n = 0; n < N; n++)
+                    row[n] += maskRow[n * maskColStride];
+            }
+
+            float max = row[0];
+            for (size_t n = 1; n < N; n++)
+                max = std::max(max, row[n]);
+            float sum = 0.f;
+            for (size_t n = 0; n < N; n++) {
+                row[n] = std::exp(row[n] - max);
+                sum += row[n];
+            }
+            const float norm = 1.f / sum;
+            for (size_t n = 0; n < N; n++)
+                row[n] *= norm;
+        }
+
+        mkldnn_sgemm('N', v.trans, rows, DV, N, 1.f, s, N, vPtr, v.ld, 0.f, dstPtr, out.ld);
+    };
+
+    // the scores buffer is indexed by the index of the work part rather than by the thread number: a thread waiting
+    // in the nested parallel region of the gemm may take another part of the work under TBB
+    const size_t blocks = div_up(M, rowsBlock);
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(MB1 * MB2 * blocks, nthr, ithr, start, end);
+        size_t b1 = 0, b2 = 0, block = 0;
+        parallel_it_init(start, b1, MB1, b2, MB2, block, blocks);
+        float* s = &scores[ithr * rowsBlock * N];
+        for (size_t iwork = start; iwork < end; iwork++) {
+            processBlock(s, b1, b2, block);
+            parallel_it_step(b1, MB1, b2, MB2, block, blocks);
+        }
+    });
+}
+
+bool MKLDNNScaledDotProductAttentionNode::created() const {
+    return getType() == ScaledDotProductAttention;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNScaledDotProductAttentionNode, ScaledDotProductAttention);
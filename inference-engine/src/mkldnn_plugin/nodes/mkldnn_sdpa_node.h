@@ -0,0 +1,67 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <memory>
+#include <vector>
+#include "common/strided_gemm.h"
+
+namespace MKLDNNPlugin {
+
+/*
+ * Computes softmax(scale * Q * K' + mask) * V by the blocks of the rows of Q. The scores of a block are computed into
+ * the thread buffer fitting the L2 cache, normalized there and multiplied by V at once, so the whole scores matrix is
+ * never stored. Q, K, V and the output may be transposed by the strides like the operands of MatMul.
+ */
+class MKLDNNScaledDotProductAttentionNode : public MKLDNNNode {
+public:
+    MKLDNNScaledDotProductAttentionNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+    // The transpositions of Q, K, V and of the output folded into the strides of the GEMM operands
+    void setInputOrder(size_t port, const std::vector<size_t>& order) { inputOrders[port] = order; }
+    void setOutputOrder(const std::vector<size_t>& order) { outputOrder = order; }
+
+private:
+    static constexpr size_t Q_ID = 0;
+    static constexpr size_t K_ID = 1;
+    static constexpr size_t V_ID = 2;
+    static constexpr size_t MASK_ID = 3;
+
+    bool transposeK = false;
+    float scale = 1.f;
+    bool withMask = false;
+
+    std::vector<std::vector<size_t>> inputOrders = {{}, {}, {}};
+    std::vector<size_t> outputOrder;
+
+    StridedGemmOperand q, k, v, out;
+    size_t qRowStride = 0;
+    size_t outRowStride = 0;
+    // the strides of the mask broadcast to the scores in elements: the batch axes as in the operands, the rows and the columns
+    size_t maskBatchStrides[2] = {0, 0};
+    size_t maskRowStride = 0;
+    size_t maskColStride = 0;
+
+    size_t MB1 = 1, MB2 = 1;
+    size_t M = 0, N = 0, D = 0, DV = 0;
+
+    size_t rowsBlock = 1;
+    std::vector<float> scores;
+
+    std::string errorPrefix;
+};
+
+}  // namespace MKLDNNPlugin
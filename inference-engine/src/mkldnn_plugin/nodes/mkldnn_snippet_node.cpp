@@ -0,0 +1,286 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mkldnn_snippet_node.h"
+
+#include <ie_parallel.hpp>
+#include <mkldnn_extension_utils.h>
+#include <cpu/x64/jit_generator.hpp>
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/graph_util.hpp>
+#include "emitters/cpu_generator.hpp"
+#include "utils/general_utils.h"
+
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <numeric>
+
+#define THROW_SNIPPET_ERROR IE_THROW() << "Subgraph node with name '" << getName() << "' "
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+
+namespace {
+
+// The inner block is split between the threads only if there are too few outer iterations to load them
+constexpr size_t minInnerChunk = 1024;
+
+cpu_isa_t getHostIsa() {
+    if (mayiuse(avx512_common))
+        return avx512_common;
+    if (mayiuse(avx2))
+        return avx2;
+    return sse41;
+}
+
+}  // namespace
+
+bool MKLDNNSnippetNode::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (isDynamicNgraphNode(op)) {
+            errorMessage = "Doesn't support op with dynamic shapes";
+            return false;
+        }
+        if (!ngraph::is_type<const ngraph::snippets::op::Subgraph>(op)) {
+            errorMessage = "Only snippets Subgraph operation is supported";
+            return false;
+        }
+        if (!mayiuse(sse41)) {
+            errorMessage = "Requires at least SSE4.1";
+            return false;
+        }
+        if (op->get_input_size() > SNIPPETS_MAX_NUM_PTRS || op->get_output_size() > SNIPPETS_MAX_NUM_PTRS) {
+            errorMessage = "Supports up to " + std::to_string(SNIPPETS_MAX_NUM_PTRS) + " inputs and outputs";
+            return false;
+        }
+        for (const auto& input : op->inputs()) {
+            if (input.get_element_type() != ngraph::element::f32) {
+                errorMessage = "Supports only FP32 inputs";
+                return false;
+            }
+        }
+        for (const auto& output : op->outputs()) {
+            if (output.get_element_type() != ngraph::element::f32) {
+                errorMessage = "Supports only FP32 outputs";
+                return false;
+            }
+            // every output is written once per element of the iteration space
+            if (output.get_shape() != op->get_output_shape(0)) {
+                errorMessage = "Supports only outputs of the same shape";
+                return false;
+            }
+        }
+        for (const auto& input : op->inputs()) {
+            if (input.get_shape().size() > op->get_output_shape(0).size()) {
+                errorMessage = "Doesn't support inputs of the rank bigger than the output one";
+                return false;
+            }
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MKLDNNSnippetNode::MKLDNNSnippetNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache)
+        : MKLDNNNode(op, eng, cache) {
+    std::string errorMessage;
+    if (!isSupportedOperation(op, errorMessage)) {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+
+    const auto original = ngraph::as_type_ptr<ngraph::snippets::op::Subgraph>(op);
+    // the node keeps its own copy of the subgraph detached from the network, the code is generated for it later
+    ngraph::OutputVector subgraphInputs;
+    for (const auto& input : op->inputs()) {
+        inputShapes.push_back(input.get_shape());
+        subgraphInputs.push_back(std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_shape()));
+    }
+    outputShape = op->get_output_shape(0);
+    snippet = std::make_shared<ngraph::snippets::op::Subgraph>(subgraphInputs, ngraph::clone_function(*original->get_body()));
+    snippet->set_friendly_name(original->get_friendly_name());
+
+    for (const auto& bodyOp : original->get_body()->get_ops()) {
+        if (!ngraph::is_type<ngraph::opset1::Parameter>(bodyOp) && !ngraph::is_type<ngraph::opset1::Result>(bodyOp) &&
+            !ngraph::is_type<ngraph::opset1::Constant>(bodyOp))
+            fusedOpsCount++;
+    }
+}
+
+void MKLDNNSnippetNode::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    impl_desc_type impl_type;
+    if (mayiuse(cpu::x64::avx512_common)) {
+        impl_type = impl_desc_type::jit_avx512;
+    } else if (mayiuse(cpu::x64::avx2)) {
+        impl_type = impl_desc_type::jit_avx2;
+    } else {
+        impl_type = impl_desc_type::jit_sse42;
+    }
+
+    std::vector<PortConfigurator> inConfs(getOriginalInputsNumber(), {LayoutType::ncsp, Precision::FP32});
+    std::vector<PortConfigurator> outConfs(getOriginalOutputsNumber(), {LayoutType::ncsp, Precision::FP32});
+    addSupportedPrimDesc(inConfs, outConfs, impl_type);
+}
+
+void MKLDNNSnippetNode::prepareSchedule() {
+    const size_t rank = outputShape.size();
+    const size_t inputsNum = inputShapes.size();
+
+    // the input dims aligned to the output rank, the axes of the output dim 1 don't take part in the iteration
+    std::vector<size_t> dims;
+    std::vector<std::vector<size_t>> srcDims(inputsNum);
+    for (size_t d = 0; d < rank; d++) {
+        if (outputShape[d] == 1)
+            continue;
+        dims.push_back(outputShape[d]);
+        for (size_t i = 0; i < inputsNum; i++) {
+            const auto& shape = inputShapes[i];
+            const size_t offset = rank - shape.size();
+            srcDims[i].push_back(d < offset ? 1 : shape[d - offset]);
+        }
+    }
+    if (dims.empty()) {
+        dims.push_back(1);
+        for (auto& src : srcDims)
+            src.push_back(1);
+    }
+
+    // the input follows the output along the innermost axis or is broadcast along it, the innermost block is extended
+    // while all the inputs keep the same behaviour
+    const size_t iterRank = dims.size();
+    srcAdvances.resize(inputsNum);
+    for (size_t i = 0; i < inputsNum; i++)
+        srcAdvances[i] = srcDims[i].back() == dims.back();
+
+    size_t innerRank = 1;
+    innerWorkAmount = dims.back();
+    for (; innerRank < iterRank; innerRank++) {
+        const size_t d = iterRank - innerRank - 1;
+        bool collapsible = true;
+        for (size_t i = 0; i < inputsNum; i++)
+            collapsible = collapsible && srcDims[i][d] == (srcAdvances[i] ? dims[d] : 1);
+        if (!collapsible)
+            break;
+        innerWorkAmount *= dims[d];
+    }
+
+    // the strides of the outer axes, zero for the broadcast ones
+    const size_t outerRank = iterRank - innerRank;
+    outerDims.assign(dims.begin(), dims.begin() + outerRank);
+    outerWorkAmount = std::accumulate(outerDims.begin(), outerDims.end(), size_t(1), std::multiplies<size_t>());
+    srcOuterStrides.assign(inputsNum, std::vector<size_t>(outerRank, 0));
+    for (size_t i = 0; i < inputsNum; i++) {
+        size_t stride = srcAdvances[i] ? innerWorkAmount : 1;
+        for (size_t d = outerRank; d-- > 0;) {
+            if (srcDims[i][d] != 1)
+                srcOuterStrides[i][d] = stride;
+            stride *= srcDims[i][d];
+        }
+    }
+    dstOuterStrides.assign(getOriginalOutputsNumber(), std::vector<size_t>(outerRank, 0));
+    for (auto& strides : dstOuterStrides) {
+        size_t stride = innerWorkAmount;
+        for (size_t d = outerRank; d-- > 0;) {
+            strides[d] = stride;
+            stride *= outerDims[d];
+        }
+    }
+}
+
+void MKLDNNSnippetNode::createPrimitive() {
+    if (kernel)
+        return;
+    for (size_t i = 0; i < getParentEdges().size(); i++) {
+        const auto& srcMemPtr = getParentEdgeAt(i)->getMemoryPtr();
+        if (!srcMemPtr || !srcMemPtr->GetPrimitivePtr())
+            THROW_SNIPPET_ERROR << "has not allocated input memory";
+    }
+    for (size_t i = 0; i < getChildEdges().size(); i++) {
+        const auto& dstMemPtr = getChildEdgeAt(i)->getMemoryPtr();
+        if (!dstMemPtr || !dstMemPtr->GetPrimitivePtr())
+            THROW_SNIPPET_ERROR << "has not allocated destination memory";
+    }
+    if (getSelectedPrimitiveDescriptor() == nullptr)
+        THROW_SNIPPET_ERROR << "has unidentified preferable primitive descriptor";
+
+    prepareSchedule();
+
+    // the kernel is generated for the innermost block only, the tensors broadcast along it are passed as of size 1
+    const ngraph::AxisVector order{0, 1, 2, 3};
+    ngraph::snippets::op::Subgraph::BlockedShapeVector inBlockedShapes, outBlockedShapes;
+    for (size_t i = 0; i < inputShapes.size(); i++)
+        inBlockedShapes.emplace_back(ngraph::Shape{1, 1, 1, srcAdvances[i] ? innerWorkAmount : 1}, order, ngraph::element::f32);
+    for (size_t i = 0; i < getOriginalOutputsNumber(); i++)
+        outBlockedShapes.emplace_back(ngraph::Shape{1, 1, 1, innerWorkAmount}, order, ngraph::element::f32);
+
+    const auto isa = getHostIsa();
+    auto generator = std::make_shared<CPUGenerator>(isa);
+    lanes = (isa == avx512_common ? cpu_isa_traits<avx512_common>::vlen :
+             isa == avx2 ? cpu_isa_traits<avx2>::vlen : cpu_isa_traits<sse41>::vlen) / sizeof(float);
+    snippet->set_generator(generator);
+    const auto schedule = snippet->generate(outBlockedShapes, inBlockedShapes);
+    kernel = schedule.get_callable<void(*)(const jit_snippets_call_args*)>();
+    if (!kernel)
+        THROW_SNIPPET_ERROR << "failed to generate the kernel";
+}
+
+void MKLDNNSnippetNode::execute(mkldnn::stream strm) {
+    const size_t inputsNum = inputShapes.size();
+    const size_t outputsNum = getOriginalOutputsNumber();
+    std::vector<const float*> srcPtrs(inputsNum);
+    std::vector<float*> dstPtrs(outputsNum);
+    for (size_t i = 0; i < inputsNum; i++)
+        srcPtrs[i] = reinterpret_cast<const float*>(getParentEdgeAt(i)->getMemoryPtr()->GetPtr());
+    for (size_t i = 0; i < outputsNum; i++)
+        dstPtrs[i] = reinterpret_cast<float*>(getChildEdgesAtPort(i)[0]->getMemoryPtr()->GetPtr());
+
+    // the innermost block is split into the chunks of whole vectors if the outer iterations don't load all the threads
+    const size_t nthr = static_cast<size_t>(parallel_get_max_threads());
+    size_t chunk = innerWorkAmount;
+    if (outerWorkAmount < nthr && innerWorkAmount >= 2 * minInnerChunk) {
+        const size_t chunksPerRow = std::min(div_up(nthr, outerWorkAmount), innerWorkAmount / minInnerChunk);
+        chunk = rnd_up(div_up(innerWorkAmount, chunksPerRow), lanes);
+    }
+    const size_t chunksNum = div_up(innerWorkAmount, chunk);
+    const size_t outerRank = outerDims.size();
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(outerWorkAmount * chunksNum, nthr, ithr, start, end);
+        jit_snippets_call_args args;
+        for (size_t idx = start; idx < end; idx++) {
+            const size_t outer = idx / chunksNum;
+            const size_t innerBegin = (idx % chunksNum) * chunk;
+            for (size_t i = 0; i < inputsNum; i++)
+                args.src_ptrs[i] = srcPtrs[i] + (srcAdvances[i] ? innerBegin : 0);
+            for (size_t i = 0; i < outputsNum; i++)
+                args.dst_ptrs[i] = dstPtrs[i] + innerBegin;
+
+            size_t rest = outer;
+            for (size_t d = outerRank; d-- > 0;) {
+                const size_t coord = rest % outerDims[d];
+                rest /= outerDims[d];
+                for (size_t i = 0; i < inputsNum; i++)
+                    args.src_ptrs[i] = static_cast<const float*>(args.src_ptrs[i]) + coord * srcOuterStrides[i][d];
+                for (size_t i = 0; i < outputsNum; i++)
+                    args.dst_ptrs[i] = static_cast<float*>(args.dst_ptrs[i]) + coord * dstOuterStrides[i][d];
+            }
+            args.work_amount = std::min(chunk, innerWorkAmount - innerBegin);
+            kernel(&args);
+        }
+    });
+}
+
+bool MKLDNNSnippetNode::created() const {
+    return getType() == Subgraph;
+}
+
+REG_MKLDNN_PRIM_FOR(MKLDNNSnippetNode, Subgraph);
@@ -0,0 +1,61 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_common.h>
+#include <mkldnn_node.h>
+#include <string>
+#include <memory>
+#include <vector>
+
+#include <snippets/op/subgraph.hpp>
+#include "emitters/jit_snippets_emitters.hpp"
+
+namespace MKLDNNPlugin {
+
+/*
+ * Executes the subgraph of the eltwise operations collapsed by the snippets tokenization. The body is compiled
+ * by the snippets generator into a single kernel, so all the operations are computed in one pass over the memory.
+ * The dimensions are collapsed to the longest innermost block which every input either follows or is broadcast along,
+ * the kernel processes such a block per call and the outer dimensions are iterated over here.
+ */
+class MKLDNNSnippetNode : public MKLDNNNode {
+public:
+    MKLDNNSnippetNode(const std::shared_ptr<ngraph::Node>& op, const mkldnn::engine& eng, MKLDNNWeightsSharing::Ptr &cache);
+    ~MKLDNNSnippetNode() override = default;
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
+    bool created() const override;
+
+    // The number of the original operations computed by the node
+    size_t getFusedOpsCount() const { return fusedOpsCount; }
+
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+private:
+    void prepareSchedule();
+
+    std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
+    size_t fusedOpsCount = 0;
+
+    std::vector<ngraph::Shape> inputShapes;
+    ngraph::Shape outputShape;
+
+    // the schedule: the outer dimensions with the strides of all the tensors in elements and the innermost block
+    std::vector<size_t> outerDims;
+    std::vector<std::vector<size_t>> srcOuterStrides;
+    std::vector<std::vector<size_t>> dstOuterStrides;
+    std::vector<bool> srcAdvances;
+    size_t outerWorkAmount = 1;
+    size_t innerWorkAmount = 1;
+    size_t lanes = 1;
+
+    void (*kernel)(const jit_snippets_call_args*) = nullptr;
+};
+
+}  // namespace MKLDNNPlugin
@@ -12,6 +12,7 @@
 #include "utils/bfloat16.hpp"
 #include <utils/general_utils.h>
 #include "utils/ngraph_utils.hpp"
+#include "mkldnn_eltwise_node.h"
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -63,11 +64,42 @@ MKLDNNTransposeNode::MKLDNNTransposeNode(const std::shared_ptr<ngraph::Node>& op
 void MKLDNNTransposeNode::getSupportedDescriptors() {
 }
 
+/*
+ * The scale and the shift (the PowerStatic without the power) and the conversion of the precision are applied by
+ * the permute kernel on the fly. The conversion ends the chain, since it defines the output precision.
+ * The ops are fused only if the permutation is executed by the tiles, the other paths of the kernel convert
+ * the elements one by one and are slower than the separate nodes. The fused transpose keeps the planar layout.
+ */
+bool MKLDNNTransposeNode::canFuse(const MKLDNNNodePtr& node) const {
+    if ((!fusedWith.empty() && fusedWith.back()->getType() == Convert) || !node->getFusedWith().empty())
+        return false;
+
+    const auto inputPrec = getOriginalInputPrecisionAtPort(0);
+    Precision outputPrec;
+    if (node->getType() == Eltwise) {
+        const auto eltwise = std::dynamic_pointer_cast<MKLDNNEltwiseNode>(node);
+        if (!eltwise || eltwise->getAlgorithm() != EltwisePowerStatic || eltwise->getAlpha() != 1.0f)
+            return false;
+        outputPrec = Precision::FP32;
+    } else if (node->getType() == Convert) {
+        outputPrec = node->getOriginalOutputPrecisionAtPort(0);
+    } else {
+        return false;
+    }
+    return PermuteKernel::isSupportedConversion(inputPrec, outputPrec) &&
+           PermuteKernel::isTiledPlanarPermutation(getInputShapeAtPort(0).getStaticDims(), order, outputPrec);
+}
+
 void MKLDNNTransposeNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
     prec = getOriginalInputPrecisionAtPort(0);
+    outputPrec = prec;
+    if (!fusedWith.empty()) {
+        // the scale and the shift are computed in FP32, the precision is defined by the fused conversion if any
+        outputPrec = fusedWith.back()->getType() == Convert ? fusedWith.back()->getOriginalOutputPrecisionAtPort(0) : Precision::FP32;
+    }
 
     auto& creatorsMap = BlockedDescCreator::getCommonCreators();
 
@@ -81,9 +113,9 @@ void MKLDNNTransposeNode::initSupportedPrimitiveDescriptors() {
     config.outConfs[0].constant = false;
     config.inConfs[1].desc = creatorsMap.at(LayoutType::ncsp)->createSharedDesc(getOriginalInputPrecisionAtPort(1), getInputShapeAtPort(1));
 
-    if (getInputShapeAtPort(0).getRank() == 4 || getInputShapeAtPort(0).getRank() == 5) {
+    if ((getInputShapeAtPort(0).getRank() == 4 || getInputShapeAtPort(0).getRank() == 5) && fusedWith.empty()) {
         config.inConfs[0].desc = creatorsMap.at(LayoutType::ncsp)->createSharedDesc(prec, getInputShapeAtPort(0));
-        config.outConfs[0].desc = creatorsMap.at(LayoutType::ncsp)->createSharedDesc(prec, getOutputShapeAtPort(0));
+        config.outConfs[0].desc = creatorsMap.at(LayoutType::ncsp)->createSharedDesc(outputPrec, getOutputShapeAtPort(0));
         supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown});
 
         auto srcDims = getInputShapeAtPort(0).getStaticDims();
@@ -99,13 +131,13 @@ void MKLDNNTransposeNode::initSupportedPrimitiveDescriptors() {
 
         if (prec == Precision::FP32 || prec == Precision::I8 || prec == Precision::U8) {
             config.inConfs[0].desc = creatorsMap.at(LayoutType::nspc)->createSharedDesc(prec, getInputShapeAtPort(0));
-            config.outConfs[0].desc = creatorsMap.at(LayoutType::nspc)->createSharedDesc(prec, getOutputShapeAtPort(0));
+            config.outConfs[0].desc = creatorsMap.at(LayoutType::nspc)->createSharedDesc(outputPrec, getOutputShapeAtPort(0));
             supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown});
         }
     } else {
-        // general plain case
+        // general plain case, the only one for the fused transpose
         config.inConfs[0].desc = creatorsMap.at(LayoutType::ncsp)->createSharedDesc(prec, getInputShapeAtPort(0));
-        config.outConfs[0].desc = creatorsMap.at(LayoutType::ncsp)->createSharedDesc(prec, getOutputShapeAtPort(0));
+        config.outConfs[0].desc = creatorsMap.at(LayoutType::ncsp)->createSharedDesc(outputPrec, getOutputShapeAtPort(0));
         supportedPrimitiveDescriptors.push_back({config, impl_desc_type::unknown});
     }
 }
@@ -120,14 +152,9 @@ void MKLDNNTransposeNode::createPrimitive() {
     if (getSelectedPrimitiveDescriptor() == nullptr)
         IE_THROW() << "Preferable primitive descriptor is not set.";
 
-    if (getParentEdgeAt(0)->getMemory().getDesc().hasLayoutType(LayoutType::ncsp) &&
-        std::find(optimizedOrders.begin(), optimizedOrders.end(), order) != optimizedOrders.end()) {
-        isOptimized = true;
-        return;
-    }
-
+    const auto& config = getSelectedPrimitiveDescriptor()->getConfig();
     PermuteParams params;
-    params.data_size = getSelectedPrimitiveDescriptor()->getConfig().inConfs[0].desc->getPrecision().size();
+    params.data_size = config.inConfs[0].desc->getPrecision().size();
     params.order = order;
     auto srcDesc = getParentEdgeAt(0)->getMemory().GetDescWithType<BlockedMemoryDesc>();
     params.src_block_dims = srcDesc->getBlockDims();
@@ -137,7 +164,26 @@ void MKLDNNTransposeNode::createPrimitive() {
     params.dst_block_dims = dstDesc->getBlockDims();
     params.dst_block_order = dstDesc->getOrder();
 
+    params.src_prc = config.inConfs[0].desc->getPrecision();
+    params.dst_prc = config.outConfs[0].desc->getPrecision();
+    // the fused scale and shift are composed into the single pair
+    for (const auto& node : fusedWith) {
+        const auto eltwise = std::dynamic_pointer_cast<MKLDNNEltwiseNode>(node);
+        if (!eltwise)
+            continue;
+        params.scale *= eltwise->getBeta();
+        params.shift = params.shift * eltwise->getBeta() + eltwise->getGamma();
+    }
+
     permuteKernel = std::unique_ptr<PermuteKernel>(new PermuteKernel(params));
+
+    // the tiled kernel outperforms the element-wise loops of the optimized orders
+    if (fusedWith.empty() && !permuteKernel->isTiled() &&
+        getParentEdgeAt(0)->getMemory().getDesc().hasLayoutType(LayoutType::ncsp) &&
+        std::find(optimizedOrders.begin(), optimizedOrders.end(), order) != optimizedOrders.end()) {
+        isOptimized = true;
+        permuteKernel.reset();
+    }
 }
 
 template <typename T>
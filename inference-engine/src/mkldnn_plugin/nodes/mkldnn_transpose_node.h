@@ -28,6 +28,7 @@ public:
     bool canBeInPlace() const override {
         return false;
     }
+    bool canFuse(const MKLDNNNodePtr& node) const override;
 
     const InferenceEngine::SizeVector& getOrder() const {
         return order;
@@ -38,6 +39,7 @@ private:
 
     InferenceEngine::SizeVector order;
     InferenceEngine::Precision prec;
+    InferenceEngine::Precision outputPrec;
     bool isOptimized = false;
 
     const std::vector<std::vector<size_t>> optimizedOrders = {
@@ -0,0 +1,190 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nms_imp.hpp"
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+/*
+ * The box is compared with a vector of the boxes at once. The same code is instantiated for the vectors and for the
+ * scalar tails, the masks are the lanes where the condition holds.
+ */
+struct scalar_ops {
+    using type = float;
+    using mask = bool;
+    static constexpr size_t width = 1;
+    static type load(const float* ptr) { return *ptr; }
+    static void store(float* ptr, type v) { *ptr = v; }
+    static type set1(float v) { return v; }
+    static type add(type a, type b) { return a + b; }
+    static type sub(type a, type b) { return a - b; }
+    static type mul(type a, type b) { return a * b; }
+    static type div(type a, type b) { return a / b; }
+    static type min(type a, type b) { return (std::min)(a, b); }
+    static type max(type a, type b) { return (std::max)(a, b); }
+    static mask gt(type a, type b) { return a > b; }
+    static mask ge(type a, type b) { return a >= b; }
+    static mask le(type a, type b) { return a <= b; }
+    static mask lt(type a, type b) { return a < b; }
+    static mask lor(mask a, mask b) { return a || b; }
+    static type zero_if(mask m, type v) { return m ? 0.f : v; }
+    static bool any(mask m) { return m; }
+};
+
+#if defined(HAVE_AVX512F)
+struct vector_ops {
+    using type = __m512;
+    using mask = __mmask16;
+    static constexpr size_t width = 16;
+    static constexpr mask all_lanes = static_cast<mask>(-1);
+    static type load(const float* ptr) { return _mm512_loadu_ps(ptr); }
+    static void store(float* ptr, type v) { _mm512_storeu_ps(ptr, v); }
+    static type set1(float v) { return _mm512_set1_ps(v); }
+    static type add(type a, type b) { return _mm512_add_ps(a, b); }
+    static type sub(type a, type b) { return _mm512_sub_ps(a, b); }
+    static type mul(type a, type b) { return _mm512_mul_ps(a, b); }
+    static type div(type a, type b) { return _mm512_div_ps(a, b); }
+    // the second operand is returned for NaN like std::min/std::max do it with the swapped operands, the zero masked forms
+    // avoid the undefined source operands of the unmasked ones
+    static type min(type a, type b) { return _mm512_maskz_min_ps(all_lanes, b, a); }
+    static type max(type a, type b) { return _mm512_maskz_max_ps(all_lanes, b, a); }
+    static mask gt(type a, type b) { return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ); }
+    static mask ge(type a, type b) { return _mm512_cmp_ps_mask(a, b, _CMP_GE_OQ); }
+    static mask le(type a, type b) { return _mm512_cmp_ps_mask(a, b, _CMP_LE_OQ); }
+    static mask lt(type a, type b) { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+    static mask lor(mask a, mask b) { return static_cast<mask>(a | b); }
+    static type zero_if(mask m, type v) { return _mm512_maskz_mov_ps(static_cast<mask>(~m), v); }
+    static bool any(mask m) { return m != 0; }
+};
+#elif defined(HAVE_AVX2)
+struct vector_ops {
+    using type = __m256;
+    using mask = __m256;
+    static constexpr size_t width = 8;
+    static type load(const float* ptr) { return _mm256_loadu_ps(ptr); }
+    static void store(float* ptr, type v) { _mm256_storeu_ps(ptr, v); }
+    static type set1(float v) { return _mm256_set1_ps(v); }
+    static type add(type a, type b) { return _mm256_add_ps(a, b); }
+    static type sub(type a, type b) { return _mm256_sub_ps(a, b); }
+    static type mul(type a, type b) { return _mm256_mul_ps(a, b); }
+    static type div(type a, type b) { return _mm256_div_ps(a, b); }
+    // the second operand is returned for NaN like std::min/std::max do it with the swapped operands
+    static type min(type a, type b) { return _mm256_min_ps(b, a); }
+    static type max(type a, type b) { return _mm256_max_ps(b, a); }
+    static mask gt(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+    static mask ge(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+    static mask le(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+    static mask lt(type a, type b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    static mask lor(mask a, mask b) { return _mm256_or_ps(a, b); }
+    static type zero_if(mask m, type v) { return _mm256_andnot_ps(m, v); }
+    static bool any(mask m) { return _mm256_movemask_ps(m) != 0; }
+};
+#else
+using vector_ops = scalar_ops;
+#endif
+
+// The compared box broadcast over the vector
+template <typename V>
+struct ref_box {
+    explicit ref_box(const float* box)
+        : x1(V::set1(box[0])), y1(V::set1(box[1])), x2(V::set1(box[2])), y2(V::set1(box[3])), area(V::set1(box[4])) {}
+
+    typename V::type x1, y1, x2, y2, area;
+};
+
+template <iou_kind kind, typename V>
+static inline typename V::type compute_iou(const ref_box<V>& a, const nms_boxes& b, size_t i, typename V::type offset) {
+    const auto zero = V::set1(0.f);
+    const auto x1 = V::load(b.x1 + i);
+    const auto y1 = V::load(b.y1 + i);
+    const auto x2 = V::load(b.x2 + i);
+    const auto y2 = V::load(b.y2 + i);
+    const auto area = V::load(b.area + i);
+    auto width = V::sub(V::min(a.x2, x2), V::max(a.x1, x1));
+    auto height = V::sub(V::min(a.y2, y2), V::max(a.y1, y1));
+
+    typename V::mask empty;
+    switch (kind) {
+        case iou_kind::clamped:
+            width = V::max(V::add(width, offset), zero);
+            height = V::max(V::add(height, offset), zero);
+            empty = V::lor(V::le(a.area, zero), V::le(area, zero));
+            break;
+        case iou_kind::overlapped:
+            width = V::add(width, offset);
+            height = V::add(height, offset);
+            empty = V::lor(V::lor(V::gt(x1, a.x2), V::lt(x2, a.x1)), V::lor(V::gt(y1, a.y2), V::lt(y2, a.y1)));
+            break;
+        case iou_kind::positive:
+        default:
+            empty = V::lor(V::le(width, zero), V::le(height, zero));
+            break;
+    }
+    const auto intersection = V::mul(width, height);
+    return V::zero_if(empty, V::div(intersection, V::sub(V::add(a.area, area), intersection)));
+}
+
+template <typename V>
+static inline typename V::mask passes(typename V::type iou, typename V::type threshold, bool inclusive) {
+    return inclusive ? V::ge(iou, threshold) : V::gt(iou, threshold);
+}
+
+template <iou_kind kind>
+static bool compare_boxes(const iou_conf &conf, const iou_args &args) {
+    bool found = false;
+    size_t i = 0;
+#if defined(HAVE_AVX512F) || defined(HAVE_AVX2)
+    {
+        const ref_box<vector_ops> box(args.box);
+        const auto offset = vector_ops::set1(conf.offset);
+        const auto threshold = vector_ops::set1(args.threshold);
+        for (; i + vector_ops::width <= args.count; i += vector_ops::width) {
+            const auto iou = compute_iou<kind>(box, args.boxes, i, offset);
+            const bool suppressed = vector_ops::any(passes<vector_ops>(iou, threshold, args.inclusive));
+            if (args.iou) {
+                vector_ops::store(args.iou + i, iou);
+                found = found || suppressed;
+            } else if (suppressed) {
+                return true;
+            }
+        }
+    }
+#endif
+    const ref_box<scalar_ops> box(args.box);
+    for (; i < args.count; i++) {
+        const float iou = compute_iou<kind>(box, args.boxes, i, conf.offset);
+        const bool suppressed = passes<scalar_ops>(iou, args.threshold, args.inclusive);
+        if (args.iou) {
+            args.iou[i] = iou;
+            found = found || suppressed;
+        } else if (suppressed) {
+            return true;
+        }
+    }
+    return found;
+}
+
+bool iou_exec(const iou_conf &conf, const iou_args &args) {
+    switch (conf.kind) {
+        case iou_kind::clamped:
+            return compare_boxes<iou_kind::clamped>(conf, args);
+        case iou_kind::overlapped:
+            return compare_boxes<iou_kind::overlapped>(conf, args);
+        case iou_kind::positive:
+        default:
+            return compare_boxes<iou_kind::positive>(conf, args);
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,124 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+#include "ie_parallel.hpp"
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+// The flavours of IoU the NMS family nodes follow, the union is always the sum of the given areas minus the intersection
+enum class iou_kind {
+    clamped,     // the intersection extents are clamped by zero, the boxes of non positive areas don't overlap anything
+    overlapped,  // the boxes which neither overlap nor touch have zero IoU, the others take the extents as is
+    positive     // the boxes whose intersection has no positive extents have zero IoU
+};
+
+struct iou_conf {
+    iou_kind kind;
+    float offset;  // added to the intersection extents, 1 for the boxes in pixels
+};
+
+// The boxes stored by coordinate, so a vector of them is loaded at once
+struct nms_boxes {
+    const float* x1;
+    const float* y1;
+    const float* x2;
+    const float* y2;
+    const float* area;
+};
+
+// Compares the box with the boxes [0, count) of the set
+struct iou_args {
+    nms_boxes boxes;
+    size_t count;
+    float box[5];     // x1, y1, x2, y2 and area of the compared box
+    float threshold;
+    bool inclusive;   // whether IoU equal to the threshold suppresses the box
+    float* iou;       // receives all the IoUs if set, otherwise the comparison stops at the first suppressing box
+
+    void set_box(const nms_boxes& from, size_t i) {
+        box[0] = from.x1[i];
+        box[1] = from.y1[i];
+        box[2] = from.x2[i];
+        box[3] = from.y2[i];
+        box[4] = from.area[i];
+    }
+};
+
+// The growing set of boxes, e.g. the boxes of an image or the already selected ones
+class nms_box_pool {
+public:
+    void reserve(size_t n) {
+        for (auto coord : {&x1_, &y1_, &x2_, &y2_, &area_})
+            coord->reserve(n);
+    }
+
+    void clear() {
+        for (auto coord : {&x1_, &y1_, &x2_, &y2_, &area_})
+            coord->clear();
+    }
+
+    void push(float x1, float y1, float x2, float y2, float area) {
+        x1_.push_back(x1);
+        y1_.push_back(y1);
+        x2_.push_back(x2);
+        y2_.push_back(y2);
+        area_.push_back(area);
+    }
+
+    void push(const nms_boxes& from, size_t i) {
+        push(from.x1[i], from.y1[i], from.x2[i], from.y2[i], from.area[i]);
+    }
+
+    size_t size() const {
+        return area_.size();
+    }
+
+    // The boxes starting from the given one, valid until the next push
+    nms_boxes boxes(size_t from = 0) const {
+        return {x1_.data() + from, y1_.data() + from, x2_.data() + from, y2_.data() + from, area_.data() + from};
+    }
+
+private:
+    std::vector<float> x1_, y1_, x2_, y2_, area_;
+};
+
+/*
+ * Runs func(task) for all the tasks, the ones of the biggest costs first, every thread taking the next task as soon as it
+ * is done with the previous one. The (image, class) pairs of NMS have very different numbers of candidates, so the static
+ * split of them leaves most of the threads waiting for the few heavy classes.
+ */
+template <typename F>
+inline void nms_parallel_tasks(const std::vector<size_t>& costs, const F& func) {
+    std::vector<size_t> order(costs.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t l, size_t r) {
+        return costs[l] > costs[r];
+    });
+
+    std::atomic<size_t> next(0);
+    parallel_nt(0, [&](const int, const int) {
+        for (size_t i = next++; i < order.size(); i = next++)
+            func(order[i]);
+    });
+}
+
+namespace XARCH {
+
+// Returns whether IoU of the box with some of the boxes passes the threshold.
+bool iou_exec(const iou_conf &conf, const iou_args &args);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,594 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "topk_imp.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <limits>
+#include <utility>
+#include <vector>
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+#include <ie_common.h>
+#include "ie_parallel.hpp"
+#include "utils/bfloat16.hpp"
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+using MKLDNNPlugin::bfloat16_t;
+
+/*
+ * All the algorithms compare keys, for which the greater one always wins: the values themselves in the max mode
+ * and their order reversing transform in the min mode. Equal keys are ordered by the index, like the reference does.
+ * The keys are floats except for I32 data, which doesn't fit the float mantissa.
+ */
+template <typename T> struct topk_key { using type = float; };
+template <> struct topk_key<int32_t> { using type = int32_t; };
+
+static inline float to_key(float value, bool mode_max) {
+    return mode_max ? value : -value;
+}
+
+static inline int32_t to_key(int32_t value, bool mode_max) {
+    return mode_max ? value : ~value;
+}
+
+template <typename T>
+static inline typename topk_key<T>::type make_key(T value, bool mode_max) {
+    return to_key(static_cast<typename topk_key<T>::type>(value), mode_max);
+}
+
+template <typename K>
+static inline bool precedes(K lkey, int32_t lidx, K rkey, int32_t ridx) {
+    return lkey > rkey || (lkey == rkey && lidx < ridx);
+}
+
+// The tensor is viewed as [before_num, dim, after_num], the positions enumerate its [before_num, after_num] part.
+struct topk_positions {
+    explicit topk_positions(const topk_conf &conf) : dim(conf.dim), after(conf.after_num), top_k(conf.top_k),
+                                                    count(conf.before_num * conf.after_num) {}
+
+    size_t src_offset(size_t p) const { return (p / after) * dim * after + p % after; }
+    size_t dst_offset(size_t p) const { return (p / after) * top_k * after + p % after; }
+
+    const size_t dim;
+    const size_t after;
+    const size_t top_k;
+    const size_t count;
+};
+
+template <typename T>
+static inline void store_result(const T* src, T* dst_data, int32_t* dst_idx, size_t stride, size_t rank, int32_t idx) {
+    if (dst_data)
+        dst_data[rank * stride] = src[idx * stride];
+    if (dst_idx)
+        dst_idx[rank * stride] = idx;
+}
+
+#if defined(HAVE_AVX512F) || defined(HAVE_AVX2)
+#if defined(HAVE_AVX512F)
+static constexpr size_t vlen = 16;
+using vfloat = __m512;
+using vint = __m512i;
+using vmask = __mmask16;
+static constexpr vmask all_lanes = static_cast<vmask>(-1);
+
+static inline vfloat vload(const float* p) {
+    return _mm512_loadu_ps(p);
+}
+// the zero masked forms avoid the undefined source operands of the unmasked ones
+static inline vfloat vload(const bfloat16_t* p) {
+    const vint v = _mm512_maskz_cvtepu16_epi32(all_lanes, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)));
+    return _mm512_castsi512_ps(_mm512_maskz_slli_epi32(all_lanes, v, 16));
+}
+static inline vfloat vload(const int8_t* p) {
+    const vint v = _mm512_maskz_cvtepi8_epi32(all_lanes, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+    return _mm512_maskz_cvtepi32_ps(all_lanes, v);
+}
+static inline vfloat vload(const uint8_t* p) {
+    const vint v = _mm512_maskz_cvtepu8_epi32(all_lanes, _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+    return _mm512_maskz_cvtepi32_ps(all_lanes, v);
+}
+static inline vint vload(const int32_t* p) {
+    return _mm512_loadu_si512(p);
+}
+static inline void vstore(float* p, vfloat v) {
+    _mm512_storeu_ps(p, v);
+}
+static inline void vstore(int32_t* p, vint v) {
+    _mm512_storeu_si512(p, v);
+}
+static inline vfloat vneg(vfloat v) {
+    return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(v), _mm512_set1_epi32(INT_MIN)));
+}
+static inline vint vset1(int32_t v) {
+    return _mm512_set1_epi32(v);
+}
+static inline vfloat vset1(float v) {
+    return _mm512_set1_ps(v);
+}
+static inline vint vadd(vint a, vint b) {
+    return _mm512_add_epi32(a, b);
+}
+static inline vmask vgreater(vfloat a, vfloat b) {
+    return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ);
+}
+static inline vmask vprecedes(vfloat akey, vint aidx, vfloat bkey, vint bidx) {
+    return _mm512_cmp_ps_mask(akey, bkey, _CMP_GT_OQ) |
+           (_mm512_cmp_ps_mask(akey, bkey, _CMP_EQ_OQ) & _mm512_cmplt_epi32_mask(aidx, bidx));
+}
+static inline vmask vless(vint a, vint b) {
+    return _mm512_cmplt_epi32_mask(a, b);
+}
+static inline vfloat vblend(vmask m, vfloat a, vfloat b) {
+    return _mm512_mask_blend_ps(m, a, b);
+}
+static inline vint vblend(vmask m, vint a, vint b) {
+    return _mm512_mask_blend_epi32(m, a, b);
+}
+static inline vmask vor(vmask a, vmask b) {
+    return a | b;
+}
+static inline vmask vnone() {
+    return 0;
+}
+static inline bool vany(vmask m) {
+    return m != 0;
+}
+#else
+static constexpr size_t vlen = 8;
+using vfloat = __m256;
+using vint = __m256i;
+using vmask = __m256;
+
+static inline vfloat vload(const float* p) {
+    return _mm256_loadu_ps(p);
+}
+static inline vfloat vload(const bfloat16_t* p) {
+    return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))), 16));
+}
+static inline vfloat vload(const int8_t* p) {
+    return _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p))));
+}
+static inline vfloat vload(const uint8_t* p) {
+    return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p))));
+}
+static inline vint vload(const int32_t* p) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+}
+static inline void vstore(float* p, vfloat v) {
+    _mm256_storeu_ps(p, v);
+}
+static inline void vstore(int32_t* p, vint v) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+}
+static inline vfloat vneg(vfloat v) {
+    return _mm256_xor_ps(v, _mm256_set1_ps(-0.f));
+}
+static inline vint vset1(int32_t v) {
+    return _mm256_set1_epi32(v);
+}
+static inline vfloat vset1(float v) {
+    return _mm256_set1_ps(v);
+}
+static inline vint vadd(vint a, vint b) {
+    return _mm256_add_epi32(a, b);
+}
+static inline vmask vgreater(vfloat a, vfloat b) {
+    return _mm256_cmp_ps(a, b, _CMP_GT_OQ);
+}
+static inline vmask vprecedes(vfloat akey, vint aidx, vfloat bkey, vint bidx) {
+    return _mm256_or_ps(_mm256_cmp_ps(akey, bkey, _CMP_GT_OQ),
+                        _mm256_and_ps(_mm256_cmp_ps(akey, bkey, _CMP_EQ_OQ), _mm256_castsi256_ps(_mm256_cmpgt_epi32(bidx, aidx))));
+}
+static inline vmask vless(vint a, vint b) {
+    return _mm256_castsi256_ps(_mm256_cmpgt_epi32(b, a));
+}
+static inline vfloat vblend(vmask m, vfloat a, vfloat b) {
+    return _mm256_blendv_ps(a, b, m);
+}
+static inline vint vblend(vmask m, vint a, vint b) {
+    return _mm256_castps_si256(_mm256_blendv_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), m));
+}
+static inline vmask vor(vmask a, vmask b) {
+    return _mm256_or_ps(a, b);
+}
+static inline vmask vnone() {
+    return _mm256_setzero_ps();
+}
+static inline bool vany(vmask m) {
+    return _mm256_movemask_ps(m) != 0;
+}
+#endif
+
+static const int32_t lane_iota[16] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+
+template <typename T>
+static inline vfloat vload_key(const T* p, bool mode_max) {
+    const vfloat v = vload(p);
+    return mode_max ? v : vneg(v);
+}
+
+static constexpr size_t heap_block = vlen;
+
+// whether none of the heap_block keys starting from p beats the threshold
+template <typename T>
+static inline bool heap_block_loses(const T* p, float threshold, bool mode_max) {
+    return !vany(vgreater(vload_key(p, mode_max), vset1(threshold)));
+}
+#endif
+
+#if !defined(HAVE_AVX512F) && !defined(HAVE_AVX2)
+static constexpr size_t heap_block = 1;
+
+template <typename T>
+static inline bool heap_block_loses(const T*, float, bool) {
+    return false;
+}
+#endif
+
+static inline bool heap_block_loses(const int32_t*, int32_t, bool) {
+    return false;
+}
+
+/*
+ * The heap path: the k best elements seen so far are kept in a heap with the worst one on the top,
+ * so an element which doesn't beat it costs a single comparison. This is O(N log k) at worst
+ * and close to O(N) for k << N, which is the common case of long axes (e.g. logits over a vocabulary).
+ */
+template <typename T>
+static void topk_heap(const T* src, T* dst_data, int32_t* dst_idx, const topk_conf &conf) {
+    using K = typename topk_key<T>::type;
+    using entry = std::pair<K, int32_t>;
+    const topk_positions pos(conf);
+    const size_t stride = conf.after_num;
+    const auto heap_cmp = [](const entry& l, const entry& r) {
+        return precedes(l.first, l.second, r.first, r.second);
+    };
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(pos.count, nthr, ithr, start, end);
+
+        std::vector<entry> heap(conf.top_k);
+        for (size_t p = start; p < end; p++) {
+            const T* s = src + pos.src_offset(p);
+            for (size_t j = 0; j < conf.top_k; j++)
+                heap[j] = {make_key(s[j * stride], conf.mode_max), static_cast<int32_t>(j)};
+            std::make_heap(heap.begin(), heap.end(), heap_cmp);
+            size_t j = conf.top_k;
+            while (j < conf.dim) {
+                size_t end = conf.dim;
+                // the contiguous elements are checked against the worst kept one by vectors first
+                if (stride == 1 && heap_block > 1 && j + heap_block <= conf.dim) {
+                    if (heap_block_loses(s + j, heap.front().first, conf.mode_max)) {
+                        j += heap_block;
+                        continue;
+                    }
+                    end = j + heap_block;
+                }
+                for (; j < end; j++) {
+                    const K key = make_key(s[j * stride], conf.mode_max);
+                    // the index is greater than the ones in the heap, so only a greater key wins
+                    if (key > heap.front().first) {
+                        std::pop_heap(heap.begin(), heap.end(), heap_cmp);
+                        heap.back() = {key, static_cast<int32_t>(j)};
+                        std::push_heap(heap.begin(), heap.end(), heap_cmp);
+                    }
+                }
+            }
+            if (conf.sort_index) {
+                std::sort(heap.begin(), heap.end(), [](const entry& l, const entry& r) { return l.second < r.second; });
+            } else {
+                std::sort_heap(heap.begin(), heap.end(), heap_cmp);
+            }
+
+            const size_t dst_off = pos.dst_offset(p);
+            for (size_t j = 0; j < conf.top_k; j++)
+                store_result(s, dst_data ? dst_data + dst_off : nullptr, dst_idx ? dst_idx + dst_off : nullptr,
+                             stride, j, heap[j].second);
+        }
+    });
+}
+
+#if defined(HAVE_AVX512F) || defined(HAVE_AVX2)
+/*
+ * The top-1 path: the vector lanes run over vlen positions adjacent in memory when the axis isn't the innermost one,
+ * or over the axis itself otherwise. The strict comparison keeps the first of the equal elements.
+ */
+template <typename T>
+static void top1_vec(const T* src, T* dst_data, int32_t* dst_idx, const topk_conf &conf) {
+    const topk_positions pos(conf);
+    const size_t stride = conf.after_num;
+    const bool mode_max = conf.mode_max;
+
+    const auto top1_scalar = [&](size_t p) {
+        const T* s = src + pos.src_offset(p);
+        float best = make_key(s[0], mode_max);
+        int32_t best_idx = 0;
+        for (size_t j = 1; j < conf.dim; j++) {
+            const float key = make_key(s[j * stride], mode_max);
+            if (key > best) {
+                best = key;
+                best_idx = static_cast<int32_t>(j);
+            }
+        }
+        const size_t dst_off = pos.dst_offset(p);
+        store_result(s, dst_data ? dst_data + dst_off : nullptr, dst_idx ? dst_idx + dst_off : nullptr, stride, 0, best_idx);
+    };
+
+    if (stride == 1) {
+        if (conf.dim < vlen) {
+            parallel_for(pos.count, top1_scalar);
+            return;
+        }
+        parallel_for(pos.count, [&](size_t p) {
+            const T* s = src + p * conf.dim;
+            vfloat best = vload_key(s, mode_max);
+            vint best_idx = vload(lane_iota);
+            vint cur_idx = best_idx;
+            const vint step = vset1(static_cast<int32_t>(vlen));
+            size_t j = vlen;
+            for (; j + vlen <= conf.dim; j += vlen) {
+                cur_idx = vadd(cur_idx, step);
+                const vfloat cur = vload_key(s + j, mode_max);
+                const vmask m = vgreater(cur, best);
+                best = vblend(m, best, cur);
+                best_idx = vblend(m, best_idx, cur_idx);
+            }
+            float keys[vlen];
+            int32_t idxs[vlen];
+            vstore(keys, best);
+            vstore(idxs, best_idx);
+            float best_key = keys[0];
+            int32_t best_i = idxs[0];
+            for (size_t l = 1; l < vlen; l++) {
+                if (precedes(keys[l], idxs[l], best_key, best_i)) {
+                    best_key = keys[l];
+                    best_i = idxs[l];
+                }
+            }
+            for (; j < conf.dim; j++) {
+                const float key = make_key(s[j], mode_max);
+                if (key > best_key) {
+                    best_key = key;
+                    best_i = static_cast<int32_t>(j);
+                }
+            }
+            store_result(s, dst_data ? dst_data + p : nullptr, dst_idx ? dst_idx + p : nullptr, 1, 0, best_i);
+        });
+        return;
+    }
+
+    const size_t blocks = stride / vlen;
+    const size_t tail = stride - blocks * vlen;
+    parallel_for2d(conf.before_num, blocks + tail, [&](size_t b, size_t ib) {
+        if (ib >= blocks) {
+            top1_scalar(b * stride + blocks * vlen + (ib - blocks));
+            return;
+        }
+        const T* s = src + b * conf.dim * stride + ib * vlen;
+        vfloat best = vload_key(s, mode_max);
+        vint best_idx = vset1(0);
+        for (size_t j = 1; j < conf.dim; j++) {
+            const vfloat cur = vload_key(s + j * stride, mode_max);
+            const vmask m = vgreater(cur, best);
+            best = vblend(m, best, cur);
+            best_idx = vblend(m, best_idx, vset1(static_cast<int32_t>(j)));
+        }
+        const size_t dst_off = b * stride + ib * vlen;
+        int32_t idxs[vlen];
+        vstore(idxs, best_idx);
+        if (dst_idx)
+            vstore(dst_idx + dst_off, best_idx);
+        if (dst_data) {
+            for (size_t l = 0; l < vlen; l++)
+                dst_data[dst_off + l] = s[idxs[l] * stride + l];
+        }
+    });
+}
+
+/*
+ * The bitonic path for a moderate k: the vector lanes process vlen positions independently, the rows of a tile keep
+ * the keys and the indices of one element of the axis for each of them. The n >= k best elements are kept sorted,
+ * the axis is consumed by chunks of n elements: a chunk is sorted the other way round, the pairwise best of both
+ * sequences form a bitonic sequence with the n best elements, which is merged back. The chunks without an element
+ * better than the current n-th one are skipped.
+ */
+class bitonic_tile {
+public:
+    explicit bitonic_tile(size_t rows) : keys(rows * vlen), idx(rows * vlen) {}
+
+    float* key_row(size_t r) { return keys.data() + r * vlen; }
+    int32_t* idx_row(size_t r) { return idx.data() + r * vlen; }
+
+    // puts the preceding element of the rows i and j to the row i
+    template <bool by_index>
+    void compare_exchange(size_t i, size_t j) {
+        const vfloat ki = vload(key_row(i));
+        const vfloat kj = vload(key_row(j));
+        const vint ii = vload(idx_row(i));
+        const vint ij = vload(idx_row(j));
+        const vmask m = by_index ? vless(ij, ii) : vprecedes(kj, ij, ki, ii);
+        vstore(key_row(i), vblend(m, ki, kj));
+        vstore(key_row(j), vblend(m, kj, ki));
+        vstore(idx_row(i), vblend(m, ii, ij));
+        vstore(idx_row(j), vblend(m, ij, ii));
+    }
+
+    // sorts the rows [first, first + n), n is a power of two
+    template <bool by_index>
+    void sort(size_t first, size_t n, bool best_first) {
+        for (size_t size = 2; size <= n; size <<= 1) {
+            for (size_t stride = size / 2; stride > 0; stride >>= 1) {
+                for (size_t i = 0; i < n; i++) {
+                    const size_t j = i ^ stride;
+                    if (j <= i)
+                        continue;
+                    if (((i & size) == 0) == best_first)
+                        compare_exchange<by_index>(first + i, first + j);
+                    else
+                        compare_exchange<by_index>(first + j, first + i);
+                }
+            }
+        }
+    }
+
+    // sorts the bitonic sequence in the rows [0, n) best first
+    void merge(size_t n) {
+        for (size_t stride = n / 2; stride > 0; stride >>= 1) {
+            for (size_t i = 0; i < n; i++) {
+                const size_t j = i ^ stride;
+                if (j > i)
+                    compare_exchange<false>(i, j);
+            }
+        }
+    }
+
+private:
+    std::vector<float> keys;
+    std::vector<int32_t> idx;
+};
+
+static inline size_t pow2_ceil(size_t v) {
+    size_t p = 1;
+    while (p < v)
+        p <<= 1;
+    return p;
+}
+
+template <typename T>
+static void topk_bitonic(const T* src, T* dst_data, int32_t* dst_idx, const topk_conf &conf, size_t n) {
+    const topk_positions pos(conf);
+    const size_t stride = conf.after_num;
+    const size_t blocks = (pos.count + vlen - 1) / vlen;
+    // the padding loses to any element including the infinite ones
+    const float sentinel = -std::numeric_limits<float>::infinity();
+    const vfloat sentinel_key = vset1(sentinel);
+    const vint sentinel_idx = vset1(INT_MAX);
+
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(blocks, nthr, ithr, start, end);
+
+        bitonic_tile tile(2 * n);
+        size_t src_off[vlen];
+        for (size_t blk = start; blk < end; blk++) {
+            const size_t p0 = blk * vlen;
+            const size_t lanes = std::min(vlen, pos.count - p0);
+            for (size_t l = 0; l < lanes; l++)
+                src_off[l] = pos.src_offset(p0 + l);
+            // the lanes are adjacent in memory, so a row is a single vector load
+            const bool contiguous = lanes == vlen && stride > 1 && (p0 % stride) + vlen <= stride;
+
+            const auto load_row = [&](size_t r, size_t j) {
+                if (j >= conf.dim) {
+                    vstore(tile.key_row(r), sentinel_key);
+                    vstore(tile.idx_row(r), sentinel_idx);
+                    return;
+                }
+                if (contiguous) {
+                    vstore(tile.key_row(r), vload_key(src + src_off[0] + j * stride, conf.mode_max));
+                } else {
+                    float* keys = tile.key_row(r);
+                    for (size_t l = 0; l < lanes; l++)
+                        keys[l] = make_key(src[src_off[l] + j * stride], conf.mode_max);
+                    for (size_t l = lanes; l < vlen; l++)
+                        keys[l] = sentinel;
+                }
+                vstore(tile.idx_row(r), vset1(static_cast<int32_t>(j)));
+            };
+
+            for (size_t r = 0; r < n; r++)
+                load_row(r, r);
+            tile.sort<false>(0, n, true);
+
+            for (size_t j0 = n; j0 < conf.dim; j0 += n) {
+                const vfloat worst_key = vload(tile.key_row(n - 1));
+                const vint worst_idx = vload(tile.idx_row(n - 1));
+                vmask better = vnone();
+                for (size_t r = 0; r < n; r++) {
+                    load_row(n + r, j0 + r);
+                    better = vor(better, vprecedes(vload(tile.key_row(n + r)), vload(tile.idx_row(n + r)), worst_key, worst_idx));
+                }
+                if (!vany(better))
+                    continue;
+                tile.sort<false>(n, n, false);
+                for (size_t r = 0; r < n; r++)
+                    tile.compare_exchange<false>(r, n + r);
+                tile.merge(n);
+            }
+
+            if (conf.sort_index) {
+                for (size_t r = conf.top_k; r < n; r++)
+                    vstore(tile.idx_row(r), sentinel_idx);
+                tile.sort<true>(0, n, true);
+            }
+
+            for (size_t l = 0; l < lanes; l++) {
+                const size_t dst_off = pos.dst_offset(p0 + l);
+                for (size_t r = 0; r < conf.top_k; r++)
+                    store_result(src + src_off[l], dst_data ? dst_data + dst_off : nullptr, dst_idx ? dst_idx + dst_off : nullptr,
+                                 stride, r, tile.idx_row(r)[l]);
+            }
+        }
+    });
+}
+#endif
+
+template <typename T>
+static void topk_dispatch(const T* src, T* dst_data, int32_t* dst_idx, const topk_conf &conf) {
+#if defined(HAVE_AVX512F) || defined(HAVE_AVX2)
+    if (conf.top_k == 1) {
+        top1_vec(src, dst_data, dst_idx, conf);
+        return;
+    }
+    // the bitonic network costs O(N log^2 n) per vlen positions, while the heap costs O(N) per position for k << N
+    // and degrades to O(N log k) as k approaches N
+    const size_t max_bitonic_rows = 256;
+    const size_t n = pow2_ceil(conf.top_k);
+    if (n <= max_bitonic_rows && conf.top_k * 8 > conf.dim && conf.before_num * conf.after_num >= vlen) {
+        topk_bitonic(src, dst_data, dst_idx, conf, n);
+        return;
+    }
+#endif
+    topk_heap(src, dst_data, dst_idx, conf);
+}
+
+// the vector paths operate on float keys
+static void topk_dispatch(const int32_t* src, int32_t* dst_data, int32_t* dst_idx, const topk_conf &conf) {
+    topk_heap(src, dst_data, dst_idx, conf);
+}
+
+void topk_exec(const void* src, void* dst_data, int32_t* dst_idx, const topk_conf &conf) {
+    switch (conf.precision) {
+        case Precision::FP32:
+            topk_dispatch(reinterpret_cast<const float*>(src), reinterpret_cast<float*>(dst_data), dst_idx, conf);
+            break;
+        case Precision::BF16:
+            topk_dispatch(reinterpret_cast<const bfloat16_t*>(src), reinterpret_cast<bfloat16_t*>(dst_data), dst_idx, conf);
+            break;
+        case Precision::I8:
+            topk_dispatch(reinterpret_cast<const int8_t*>(src), reinterpret_cast<int8_t*>(dst_data), dst_idx, conf);
+            break;
+        case Precision::U8:
+            topk_dispatch(reinterpret_cast<const uint8_t*>(src), reinterpret_cast<uint8_t*>(dst_data), dst_idx, conf);
+            break;
+        case Precision::I32:
+            topk_dispatch(reinterpret_cast<const int32_t*>(src), reinterpret_cast<int32_t*>(dst_data), dst_idx, conf);
+            break;
+        default:
+            IE_THROW() << "TopK doesn't support precision " << conf.precision;
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
@@ -0,0 +1,34 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <ie_precision.hpp>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+
+struct topk_conf {
+    InferenceEngine::Precision precision;  // of the data and of the output values
+    // the tensor is viewed as [before_num, dim, after_num] in its physical layout
+    size_t before_num;
+    size_t dim;
+    size_t after_num;
+    size_t top_k;
+    bool mode_max;
+    bool sort_index;
+};
+
+namespace XARCH {
+
+void topk_exec(const void* src, void* dst_data, int32_t* dst_idx, const topk_conf &conf);
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
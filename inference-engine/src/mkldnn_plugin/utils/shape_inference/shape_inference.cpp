@@ -0,0 +1,185 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shape_inference.hpp"
+
+#include <openvino/op/ops.hpp>
+#include <openvino/op/util/binary_elementwise_arithmetic.hpp>
+#include <openvino/op/util/binary_elementwise_comparison.hpp>
+#include <openvino/op/util/binary_elementwise_logical.hpp>
+#include <openvino/op/util/unary_elementwise_arithmetic.hpp>
+#include <broadcast_shape_inference.hpp>
+#include <concat_shape_inference.hpp>
+#include <convolution_shape_inference.hpp>
+#include <eltwise_shape_inference.hpp>
+#include <gather_shape_inference.hpp>
+#include <matmul_shape_inference.hpp>
+#include <pooling_shape_inference.hpp>
+#include <reduce_shape_inference.hpp>
+#include <reshape_shape_inference.hpp>
+#include <strided_slice_shape_inference.hpp>
+#include <tile_shape_inference.hpp>
+#include <transpose_shape_inference.hpp>
+
+using namespace ov;
+
+namespace {
+
+bool is_copy_shape_op(const ov::Node* node) {
+    return dynamic_cast<const op::util::UnaryElementwiseArithmetic*>(node) ||
+           ov::is_type<op::v0::Convert>(node) || ov::is_type<op::v0::Clamp>(node) ||
+           ov::is_type<op::v0::Elu>(node) || ov::is_type<op::v0::Gelu>(node) ||
+           ov::is_type<op::v7::Gelu>(node) || ov::is_type<op::v4::HSwish>(node) ||
+           ov::is_type<op::v5::HSigmoid>(node) || ov::is_type<op::v4::Mish>(node) ||
+           ov::is_type<op::v4::SoftPlus>(node) || ov::is_type<op::v4::Swish>(node) ||
+           ov::is_type<op::v0::PRelu>(node) || ov::is_type<op::v0::Selu>(node) ||
+           ov::is_type<op::v0::HardSigmoid>(node) || ov::is_type<op::v5::Round>(node) ||
+           ov::is_type<op::v1::Softmax>(node) || ov::is_type<op::v5::LogSoftmax>(node) ||
+           ov::is_type<op::v0::MVN>(node) || ov::is_type<op::v6::MVN>(node) ||
+           ov::is_type<op::v0::NormalizeL2>(node) || ov::is_type<op::v0::LRN>(node);
+}
+
+bool is_eltwise_op(const ov::Node* node) {
+    return dynamic_cast<const op::util::BinaryElementwiseArithmetic*>(node) ||
+           dynamic_cast<const op::util::BinaryElementwiseComparison*>(node) ||
+           dynamic_cast<const op::util::BinaryElementwiseLogical*>(node) || ov::is_type<op::v0::FakeQuantize>(node);
+}
+
+class CopyShapeInfer : public IStaticShapeInfer {
+public:
+    explicit CopyShapeInfer(std::shared_ptr<ov::Node> op) : IStaticShapeInfer(std::move(op), {}) {}
+
+protected:
+    void infer_shapes(const std::vector<StaticShape>& input_shapes, std::vector<StaticShape>& output_shapes) override {
+        op::copy_shape_infer(m_op.get(), input_shapes, output_shapes);
+    }
+};
+
+class EltwiseShapeInfer : public IStaticShapeInfer {
+public:
+    EltwiseShapeInfer(std::shared_ptr<ov::Node> op, const op::AutoBroadcastSpec& autob)
+        : IStaticShapeInfer(std::move(op), {}),
+          m_autob(autob) {}
+
+protected:
+    void infer_shapes(const std::vector<StaticShape>& input_shapes, std::vector<StaticShape>& output_shapes) override {
+        op::eltwise_shape_infer(m_op.get(), m_autob, input_shapes, output_shapes);
+    }
+
+private:
+    op::AutoBroadcastSpec m_autob;
+};
+
+/// \brief Operations whose output shapes are defined by the input shapes only
+template <class OP>
+class ShapeInferByShapes : public IStaticShapeInfer {
+public:
+    explicit ShapeInferByShapes(std::shared_ptr<ov::Node> op) : IStaticShapeInfer(std::move(op), {}) {}
+
+protected:
+    void infer_shapes(const std::vector<StaticShape>& input_shapes, std::vector<StaticShape>& output_shapes) override {
+        // the overload is found by ADL in the namespace of the operation
+        shape_infer(static_cast<OP*>(m_op.get()), input_shapes, output_shapes);
+    }
+};
+
+/// \brief Operations whose output shapes are defined by the values of some inputs too
+template <class OP>
+class ShapeInferWithData : public IStaticShapeInfer {
+public:
+    ShapeInferWithData(std::shared_ptr<ov::Node> op, const std::vector<size_t>& data_ports)
+        : IStaticShapeInfer(std::move(op), data_ports) {}
+
+protected:
+    void infer_shapes(const std::vector<StaticShape>& input_shapes, std::vector<StaticShape>& output_shapes) override {
+        shape_infer(static_cast<OP*>(m_op.get()), input_shapes, output_shapes, m_values);
+    }
+};
+
+template <class OP>
+std::shared_ptr<IStaticShapeInfer> make_by_shapes(const std::shared_ptr<ov::Node>& op) {
+    return std::make_shared<ShapeInferByShapes<OP>>(op);
+}
+
+template <class OP>
+std::shared_ptr<IStaticShapeInfer> make_with_data(const std::shared_ptr<ov::Node>& op,
+                                                  const std::vector<size_t>& data_ports) {
+    return std::make_shared<ShapeInferWithData<OP>>(op, data_ports);
+}
+
+}  // namespace
+
+IStaticShapeInfer::IStaticShapeInfer(std::shared_ptr<ov::Node> op, const std::vector<size_t>& data_ports)
+    : m_op(std::move(op)) {
+    for (const auto port : data_ports) {
+        if (const auto constant = ov::as_type_ptr<op::v0::Constant>(m_op->get_input_node_shared_ptr(port))) {
+            m_values[port] = constant->cast_vector<int64_t>();
+        } else {
+            m_data_ports.push_back(port);
+        }
+    }
+}
+
+bool IStaticShapeInfer::infer(const std::vector<StaticShape>& input_shapes,
+                              std::vector<StaticShape>& output_shapes,
+                              const DataGetter& get_data) {
+    for (const auto port : m_data_ports) {
+        // the vectors of the map are reused between calls
+        if (!get_data || !get_data(port, m_values[port]))
+            return false;
+    }
+    infer_shapes(input_shapes, output_shapes);
+    return true;
+}
+
+std::shared_ptr<IStaticShapeInfer> ov::make_shape_inference(const std::shared_ptr<ov::Node>& op) {
+    const auto node = op.get();
+    if (is_copy_shape_op(node)) {
+        return std::make_shared<CopyShapeInfer>(op);
+    } else if (is_eltwise_op(node)) {
+        const auto fq = ov::as_type<op::v0::FakeQuantize>(node);
+        return std::make_shared<EltwiseShapeInfer>(op, fq ? fq->get_auto_broadcast() : node->get_autob());
+    } else if (ov::is_type<op::v1::Reshape>(node)) {
+        return make_with_data<op::v1::Reshape>(op, {1});
+    } else if (ov::is_type<op::v0::Concat>(node)) {
+        return make_by_shapes<op::v0::Concat>(op);
+    } else if (ov::is_type<op::v0::MatMul>(node)) {
+        return make_by_shapes<op::v0::MatMul>(op);
+    } else if (ov::is_type<op::v1::Convolution>(node)) {
+        return make_by_shapes<op::v1::Convolution>(op);
+    } else if (ov::is_type<op::v1::MaxPool>(node)) {
+        return make_by_shapes<op::v1::MaxPool>(op);
+    } else if (ov::is_type<op::v8::MaxPool>(node)) {
+        return make_by_shapes<op::v8::MaxPool>(op);
+    } else if (ov::is_type<op::v1::AvgPool>(node)) {
+        return make_by_shapes<op::v1::AvgPool>(op);
+    } else if (dynamic_cast<const op::util::GatherBase*>(node)) {
+        return make_with_data<op::util::GatherBase>(op, {2});
+    } else if (ov::is_type<op::v1::Transpose>(node)) {
+        return make_with_data<op::v1::Transpose>(op, {1});
+    } else if (ov::is_type<op::v1::StridedSlice>(node)) {
+        // the strides are optional
+        return node->get_input_size() > 3 ? make_with_data<op::v1::StridedSlice>(op, {1, 2, 3})
+                                          : make_with_data<op::v1::StridedSlice>(op, {1, 2});
+    } else if (dynamic_cast<const op::util::ArithmeticReductionKeepDims*>(node)) {
+        return make_with_data<op::util::ArithmeticReductionKeepDims>(op, {1});
+    } else if (dynamic_cast<const op::util::LogicalReductionKeepDims*>(node)) {
+        return make_with_data<op::util::LogicalReductionKeepDims>(op, {1});
+    } else if (const auto broadcast = ov::as_type<op::v3::Broadcast>(node)) {
+        const auto mode = broadcast->get_broadcast_spec().m_type;
+        if (mode == op::BroadcastType::EXPLICIT)
+            return make_with_data<op::v3::Broadcast>(op, {1, 2});
+        if (mode == op::BroadcastType::NUMPY || mode == op::BroadcastType::BIDIRECTIONAL)
+            return make_with_data<op::v3::Broadcast>(op, {1});
+    } else if (const auto broadcast = ov::as_type<op::v1::Broadcast>(node)) {
+        const auto mode = broadcast->get_broadcast_spec().m_type;
+        if (mode == op::AutoBroadcastType::NONE)
+            return make_with_data<op::v1::Broadcast>(op, {1, 2});
+        if (mode == op::AutoBroadcastType::NUMPY)
+            return make_with_data<op::v1::Broadcast>(op, {1});
+    } else if (ov::is_type<op::v0::Tile>(node)) {
+        return make_with_data<op::v0::Tile>(op, {1});
+    }
+    return nullptr;
+}
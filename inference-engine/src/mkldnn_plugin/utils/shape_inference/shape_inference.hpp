@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <openvino/core/node.hpp>
+#include <utils.hpp>
+#include "static_shape.hpp"
+
+namespace ov {
+
+/// \brief Infers output shapes of an operation for fully defined input shapes.
+///
+/// The implementations dispatch to the shape_infer() templates of the operations (ngraph/core/shape_inference),
+/// so the rules are shared with the ngraph ops. In contrast to Node::validate_and_infer_types() the node's
+/// input/output descriptors are not touched and the output shapes are written into the caller provided vectors
+/// without reallocations as long as their ranks don't grow.
+class IStaticShapeInfer {
+public:
+    /// \brief Callback that provides integer values of a shape-defining input (e.g. Reshape target shape)
+    /// \return false if the values of the port are not available
+    using DataGetter = std::function<bool(size_t port, std::vector<int64_t>& values)>;
+
+    virtual ~IStaticShapeInfer() = default;
+
+    /// \return non-constant input ports whose values (not only shapes) define the output shapes
+    const std::vector<size_t>& get_data_ports() const {
+        return m_data_ports;
+    }
+
+    /// \brief Calculates output shapes
+    /// \param input_shapes shapes of all the operation inputs
+    /// \param output_shapes vector of the operation outputs size, the shapes are overwritten
+    /// \param get_data values provider for the ports listed by get_data_ports()
+    /// \return false if the values of a data port are unknown
+    bool infer(const std::vector<StaticShape>& input_shapes,
+               std::vector<StaticShape>& output_shapes,
+               const DataGetter& get_data);
+
+protected:
+    /// \param data_ports all the shape-defining input ports, the values of the constant ones are read here once
+    IStaticShapeInfer(std::shared_ptr<ov::Node> op, const std::vector<size_t>& data_ports);
+
+    virtual void infer_shapes(const std::vector<StaticShape>& input_shapes,
+                              std::vector<StaticShape>& output_shapes) = 0;
+
+    std::shared_ptr<ov::Node> m_op;
+    op::ShapeInferData m_values;
+
+private:
+    std::vector<size_t> m_data_ports;
+};
+
+/// \return the static shape inference of the operation or nullptr if the operation type isn't supported
+std::shared_ptr<IStaticShapeInfer> make_shape_inference(const std::shared_ptr<ov::Node>& op);
+
+}  // namespace ov
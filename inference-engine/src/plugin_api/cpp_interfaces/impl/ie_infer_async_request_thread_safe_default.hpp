@@ -238,6 +238,11 @@ public:
         _syncRequest->SetBlob(name, data);
     }
 
+    void SetBlobs(const std::string& name, const std::vector<Blob::Ptr>& blobs) override {
+        CheckState();
+        _syncRequest->SetBlobs(name, blobs);
+    }
+
     void SetBlob(const std::string& name, const Blob::Ptr& data, const PreProcessInfo& info) override {
         CheckState();
         _syncRequest->SetBlob(name, data, info);
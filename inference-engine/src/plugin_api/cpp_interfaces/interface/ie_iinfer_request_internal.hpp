@@ -7,10 +7,12 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "cpp/ie_infer_request.hpp"
 #include "ie_blob.h"
 #include "ie_common.h"
+#include "ie_compound_blob.h"
 #include "ie_input_info.hpp"
 #include "ie_preprocess_data.hpp"
 
@@ -86,6 +88,23 @@ public:
      */
     virtual Blob::Ptr GetBlob(const std::string& name);
 
+    /**
+     * @brief Sets the batch of the input data as the separate blobs
+     * @note Memory allocation doesn't happen, the blobs are read at the inference time. GetBlob() returns the
+     * BatchedBlob of the items until another blob is set.
+     * @param name - a name of input blob.
+     * @param blobs - the blobs of the batch items. The count of the blobs must correspond to the batch of the network
+     * input and every blob must have the shape of the network input with the batch equal to 1.
+     */
+    virtual void SetBlobs(const std::string& name, const std::vector<Blob::Ptr>& blobs);
+
+    /**
+     * @brief Sets the validated batch of the input blobs, to be implemented by the plugins which support it
+     * @param name - a name of input blob.
+     * @param batchedBlob - the blobs of the batch items
+     */
+    virtual void SetBlobsImpl(const std::string& name, const BatchedBlob::Ptr& batchedBlob);
+
     /**
      * @brief Sets pre-process for input data
      * @param name Name of input blob.
@@ -38,6 +38,14 @@ public:
      */
     virtual void Reset();
 
+    /**
+     * @brief Trims a growing variable state to the first `length` entries along the axis it grows on, i.e. drops
+     * the most recent ones. The storage of the state is kept, so the next inferences may grow it again without
+     * reallocation
+     * @param length A number of the entries to keep
+     */
+    virtual void Trim(size_t length);
+
     /**
      * @brief Sets the new state for the next inference
      * @param newState A new state
@@ -75,6 +75,12 @@ static const char LAYER_TYPE[] = "layerType";
  */
 static const char RUNTIME_PRECISION[] = "runtimePrecision";
 
+/**
+ * @ingroup ie_dev_exec_graph
+ * @brief Used to get a number of the original operations fused into the executable primitive.
+ */
+static const char FUSED_OPS_COUNT[] = "fusedOpsCount";
+
 /**
  * @ingroup ie_dev_exec_graph
  * @brief The Execution node which is used to represent node in execution graph.
@@ -88,6 +94,7 @@ static const char RUNTIME_PRECISION[] = "runtimePrecision";
  * - ExecGraphInfoSerialization::EXECUTION_ORDER
  * - ExecGraphInfoSerialization::LAYER_TYPE
  * - ExecGraphInfoSerialization::RUNTIME_PRECISION
+ * - ExecGraphInfoSerialization::FUSED_OPS_COUNT (optional)
  */
 class INFERENCE_ENGINE_API_CLASS(ExecutionNode) : public ngraph::Node {
 public:
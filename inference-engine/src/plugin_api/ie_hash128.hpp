@@ -0,0 +1,165 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for the streaming 128-bit hash used by the model caching and the plugins to identify data
+ *
+ * @file ie_hash128.hpp
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+namespace InferenceEngine {
+namespace details {
+
+constexpr uint64_t PRIME32_1 = 0x9E3779B1ULL;
+constexpr uint64_t PRIME64_1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t PRIME64_2 = 0xC2B2AE3D27D4EB4FULL;
+
+inline uint64_t splitmix64(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+// The low and the high halves of the 128-bit product folded into 64 bits
+inline uint64_t mul128_fold64(uint64_t a, uint64_t b) {
+    const uint64_t aLo = a & 0xFFFFFFFFULL, aHi = a >> 32;
+    const uint64_t bLo = b & 0xFFFFFFFFULL, bHi = b >> 32;
+    const uint64_t loLo = aLo * bLo, hiLo = aHi * bLo, loHi = aLo * bHi, hiHi = aHi * bHi;
+    const uint64_t cross = (loLo >> 32) + (hiLo & 0xFFFFFFFFULL) + loHi;
+    const uint64_t upper = (hiLo >> 32) + (cross >> 32) + hiHi;
+    const uint64_t lower = (cross << 32) | (loLo & 0xFFFFFFFFULL);
+    return lower ^ upper;
+}
+
+inline uint64_t avalanche(uint64_t h) {
+    h ^= h >> 37;
+    h *= 0x165667919E3779F9ULL;
+    return h ^ (h >> 32);
+}
+
+/**
+ * @brief Streaming 128-bit non-cryptographic hash of the xxh3 family
+ *
+ * The data is consumed by 64-byte stripes into 8 independent 64-bit lanes (the loop over the lanes is vectorized by
+ * the compiler), the lanes are scrambled after every 1 KB block and merged into two 64-bit halves at the end.
+ */
+class Hash128 {
+public:
+    static constexpr size_t LANES = 8;
+    static constexpr size_t STRIPE_SIZE = LANES * sizeof(uint64_t);
+    static constexpr size_t STRIPES_PER_BLOCK = 16;
+
+    Hash128() {
+        std::copy(keys().begin(), keys().begin() + LANES, m_acc);
+    }
+
+    void update(const void* data, size_t size) {
+        auto ptr = static_cast<const uint8_t*>(data);
+        m_total += size;
+        if (m_buffered) {
+            const size_t toBuffer = std::min(size, STRIPE_SIZE - m_buffered);
+            std::memcpy(m_buffer + m_buffered, ptr, toBuffer);
+            m_buffered += toBuffer;
+            ptr += toBuffer;
+            size -= toBuffer;
+            if (m_buffered < STRIPE_SIZE)
+                return;
+            consumeStripe(m_buffer);
+            m_buffered = 0;
+        }
+        for (; size >= STRIPE_SIZE; ptr += STRIPE_SIZE, size -= STRIPE_SIZE)
+            consumeStripe(ptr);
+        std::memcpy(m_buffer, ptr, size);
+        m_buffered = size;
+    }
+
+    template <typename T, typename std::enable_if<std::is_arithmetic<T>::value, bool>::type = true>
+    Hash128& add(T value) {
+        update(&value, sizeof(value));
+        return *this;
+    }
+
+    Hash128& add(const std::string& value) {
+        add(static_cast<uint64_t>(value.size()));
+        update(value.data(), value.size());
+        return *this;
+    }
+
+    void finish(uint64_t& low, uint64_t& high) const {
+        Hash128 tail(*this);
+        if (tail.m_buffered || !tail.m_total) {
+            std::memset(tail.m_buffer + tail.m_buffered, 0, STRIPE_SIZE - tail.m_buffered);
+            tail.consumeStripe(tail.m_buffer);
+        }
+        const auto& k = keys();
+        low = m_total * PRIME64_1;
+        high = ~(m_total * PRIME64_2);
+        for (size_t i = 0; i < LANES; i += 2) {
+            low += mul128_fold64(tail.m_acc[i] ^ k[i], tail.m_acc[i + 1] ^ k[i + 1]);
+            high += mul128_fold64(tail.m_acc[i] ^ k[i + 7], tail.m_acc[i + 1] ^ k[i + 8]);
+        }
+        low = avalanche(low);
+        high = avalanche(high);
+    }
+
+    std::string hex() const {
+        uint64_t low = 0, high = 0;
+        finish(low, high);
+        std::ostringstream result;
+        result << std::hex << std::setfill('0') << std::setw(16) << high << std::setw(16) << low;
+        return result.str();
+    }
+
+private:
+    static const std::array<uint64_t, LANES + STRIPES_PER_BLOCK>& keys() {
+        static const std::array<uint64_t, LANES + STRIPES_PER_BLOCK> secret = [] {
+            std::array<uint64_t, LANES + STRIPES_PER_BLOCK> result;
+            uint64_t state = 0x243F6A8885A308D3ULL;
+            for (auto& key : result)
+                key = splitmix64(state);
+            return result;
+        }();
+        return secret;
+    }
+
+    void consumeStripe(const uint8_t* stripe) {
+        const uint64_t* k = keys().data() + m_stripes;
+        uint64_t values[LANES];
+        std::memcpy(values, stripe, STRIPE_SIZE);
+        for (size_t i = 0; i < LANES; i++) {
+            const uint64_t keyed = values[i] ^ k[i];
+            m_acc[i ^ 1] += values[i];
+            m_acc[i] += (keyed & 0xFFFFFFFFULL) * (keyed >> 32);
+        }
+        if (++m_stripes == STRIPES_PER_BLOCK) {
+            const uint64_t* scrambleKeys = keys().data() + STRIPES_PER_BLOCK;
+            for (size_t i = 0; i < LANES; i++) {
+                m_acc[i] ^= m_acc[i] >> 47;
+                m_acc[i] ^= scrambleKeys[i];
+                m_acc[i] *= PRIME32_1;
+            }
+            m_stripes = 0;
+        }
+    }
+
+    uint64_t m_acc[LANES];
+    uint8_t m_buffer[STRIPE_SIZE];
+    size_t m_buffered = 0;
+    size_t m_stripes = 0;
+    uint64_t m_total = 0;
+};
+
+}  // namespace details
+}  // namespace InferenceEngine
@@ -20,7 +20,8 @@ namespace InferenceEngine {
  * @ingroup ie_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        Every stream thread pulls tasks from own bounded lock-free queue and steals them from the queues of
+ *        other streams when its queue is empty.
  */
 class INFERENCE_ENGINE_API_CLASS(CPUStreamsExecutor) : public IStreamsExecutor {
 public:
@@ -103,6 +103,8 @@ public:
                          // (for large #streams)
         } _threadPreferredCoreType =
             PreferredCoreType::ANY;  //!< In case of @ref HYBRID_AWARE hints the TBB to affinitize
+        int _threadSpinBudget = 20;  //!< Time in microseconds an idle stream thread polls the task queues
+                                     //!< before it goes to sleep. 0 means no spinning
 
         /**
          * @brief      A constructor with arguments
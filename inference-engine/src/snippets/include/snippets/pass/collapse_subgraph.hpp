@@ -18,17 +18,21 @@ namespace pass {
 /**
  * @interface StartSubgraph
  * @brief Matches multiple output loyout-oblivious operations to start a new subgraph
+ * The single output operations start a subgraph too if single_output_start is set, so the chains of the operations
+ * which are not fed by a multiple output one are tokenized as well
+ * The operations for which the transformation callback returns true are left as is
  * @ingroup snippets
  */
 class TRANSFORMATIONS_API StartSubgraph: public ngraph::pass::MatcherPass {
 public:
     NGRAPH_RTTI_DECLARATION;
-    explicit StartSubgraph(bool tokenize_by_node = false);
+    explicit StartSubgraph(bool tokenize_by_node = false, bool single_output_start = false);
 };
 
 /**
  * @interface AttachToSubgraph
  * @brief Matches loyout-oblivious operations with subgraph operation as an input to attech this node into it
+ * The operations for which the transformation callback returns true are left as is
  * @ingroup snippets
  */
 class TRANSFORMATIONS_API AttachToSubgraph: public ngraph::pass::MatcherPass {
@@ -63,8 +67,8 @@ public:
 class TRANSFORMATIONS_API TokenizeSnippets: public ngraph::pass::GraphRewrite {
 public:
     NGRAPH_RTTI_DECLARATION;
-    TokenizeSnippets(bool tokenize_by_node = false) {
-        add_matcher<ngraph::snippets::pass::StartSubgraph>(tokenize_by_node);
+    TokenizeSnippets(bool tokenize_by_node = false, bool single_output_start = false) {
+        add_matcher<ngraph::snippets::pass::StartSubgraph>(tokenize_by_node, single_output_start);
         add_matcher<ngraph::snippets::pass::AttachToSubgraph>(tokenize_by_node);
     }
 };
@@ -167,17 +167,19 @@ void snippets::op::Subgraph::canonicalize(const BlockedShapeVector& output_shape
 
     // it should be in subgraph node to be aligned with internal and external parameter list, but adding this for testing
     // TODO: store blocking into to Parameter's rt_info for future propagation
+    // the passed shapes are taken for all the parameters, so the plugin may pass the shapes with collapsed dimensions
     for (size_t i = 0; i < m_body->get_parameters().size(); i++) {
         auto param = m_body->get_parameters()[i];
-        if (param->get_shape().size() < 4) {
+        if (param->get_element_type() != std::get<2>(input_shapes[i])) {
+            throw ngraph::ngraph_error("changes in presision. Is it legal??");
+        }
+        const auto& passed_shape = std::get<0>(input_shapes[i]);
+        if (passed_shape.size() < 4) {
             std::vector<size_t> shape(4, 1);
-            std::copy(param->get_shape().begin(), param->get_shape().end(), &shape.at(4 - (param->get_shape().size() == 0 ? 1 : param->get_shape().size())) );
+            std::copy(passed_shape.begin(), passed_shape.end(), &shape.at(4 - (passed_shape.size() == 0 ? 1 : passed_shape.size())) );
             m_body->replace_parameter(i, std::make_shared<opset1::Parameter>(param->get_element_type(), ngraph::Shape(shape)));
-        } else if (param->get_shape().size() >= 4) {
-            if (param->get_element_type() != std::get<2>(input_shapes[i])) {
-                throw ngraph::ngraph_error("changes in presision. Is it legal??");
-            }
-            m_body->replace_parameter(i, std::make_shared<opset1::Parameter>(std::get<2>(input_shapes[i]), std::get<0>(input_shapes[i])));
+        } else {
+            m_body->replace_parameter(i, std::make_shared<opset1::Parameter>(std::get<2>(input_shapes[i]), passed_shape));
         }
     }
 
@@ -161,6 +161,7 @@ public:
     ~MkDirGuard() {
         if (!m_dir.empty()) {
             CommonTestUtils::removeFilesWithExt(m_dir, "blob");
+            CommonTestUtils::removeFilesWithExt(m_dir, "lock");
             CommonTestUtils::removeDir(m_dir);
         }
     }
@@ -722,6 +723,29 @@ TEST_P(CachingTest, TestClearCacheDir) {
     }
 }
 
+TEST_P(CachingTest, TestCacheMaxSize) {
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_METRICS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(DEVICE_ARCHITECTURE), _)).Times(AnyNumber());
+    // the blobs don't fit the cache, so they are evicted right after the export
+    for (int i = 0; i < 2; i++) {
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(!m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(0);
+        EXPECT_CALL(*net, Export(_)).Times(1);
+        testLoad([&](Core &ie) {
+            ie.SetConfig({{CONFIG_KEY(CACHE_DIR), m_cacheDir}, {CONFIG_KEY(CACHE_MAX_SIZE), "1"}});
+            m_testFunction(ie);
+        });
+        EXPECT_EQ(CommonTestUtils::listFilesWithExt(m_cacheDir, "blob").size(), 0);
+    }
+    testLoad([&](Core &ie) {
+        EXPECT_ANY_THROW(ie.SetConfig({{CONFIG_KEY(CACHE_MAX_SIZE), "-1"}}));
+        EXPECT_ANY_THROW(ie.SetConfig({{CONFIG_KEY(CACHE_MAX_SIZE), "1GB"}}));
+    });
+}
+
 TEST_P(CachingTest, TestChangeOtherConfig) {
     EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_METRICS), _)).Times(AnyNumber());
     EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), _)).Times(AnyNumber());
@@ -19,6 +19,11 @@ TEST(InferRequestOVTests, throwsOnUninitializedSetTensor) {
     ASSERT_THROW(req.set_tensor({}, {}), ov::Exception);
 }
 
+TEST(InferRequestOVTests, throwsOnUninitializedSetTensors) {
+    ov::runtime::InferRequest req;
+    ASSERT_THROW(req.set_tensors({}, {}), ov::Exception);
+}
+
 TEST(InferRequestOVTests, throwsOnUninitializedGetTensor) {
     ov::runtime::InferRequest req;
     ASSERT_THROW(req.get_tensor({}), ov::Exception);
@@ -81,6 +81,73 @@ TEST(TransformationTests, DontStartSubgraphSingleOuptut) {
     ASSERT_TRUE(res.first) << res.second;
 }
 
+TEST(TransformationTests, StartSubgraphSingleOutput) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto data0 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3});
+        auto data1 = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 3});
+        auto add = std::make_shared<opset1::Add>(data0, data1);
+        auto sub = std::make_shared<opset1::Subtract>(add, data1);
+        auto mul = std::make_shared<opset1::Multiply>(data0, sub);
+        f = std::make_shared<Function>(NodeVector{mul}, ParameterVector{data0, data1});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<snippets::pass::StartSubgraph>(false, true);
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto data0 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3});
+        auto data1 = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 3});
+        auto indata0 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3});
+        auto indata1 = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 3});
+        auto add = std::make_shared<snippets::op::Subgraph>(NodeVector{data0, data1},
+            std::make_shared<Function>(NodeVector{std::make_shared<opset1::Add>(indata0, indata1)}, ParameterVector{indata0, indata1}));
+        auto sub = std::make_shared<opset1::Subtract>(add, data1);
+        auto mul = std::make_shared<opset1::Multiply>(data0, sub);
+        f_ref = std::make_shared<Function>(NodeVector{mul}, ParameterVector{data0, data1});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, DontStartSubgraphIfCallback) {
+    std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
+    {
+        auto data0 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3});
+        auto data1 = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 3});
+        auto add = std::make_shared<opset1::Add>(data0, data1);
+        auto sub = std::make_shared<opset1::Subtract>(add, data1);
+        auto mul = std::make_shared<opset1::Multiply>(add, sub);
+        f = std::make_shared<Function>(NodeVector{mul}, ParameterVector{data0, data1});
+
+        pass::Manager m;
+        m.register_pass<pass::InitNodeInfo>();
+        m.register_pass<snippets::pass::StartSubgraph>();
+        m.get_pass_config()->set_callback<snippets::pass::StartSubgraph>(
+            [](const std::shared_ptr<const Node>& n) -> bool {
+                return std::dynamic_pointer_cast<const opset1::Add>(n) != nullptr;
+            });
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto data0 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 3});
+        auto data1 = std::make_shared<opset1::Parameter>(element::f32, Shape{1, 3});
+        auto add = std::make_shared<opset1::Add>(data0, data1);
+        auto sub = std::make_shared<opset1::Subtract>(add, data1);
+        auto mul = std::make_shared<opset1::Multiply>(add, sub);
+        f_ref = std::make_shared<Function>(NodeVector{mul}, ParameterVector{data0, data1});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
 TEST(TransformationTests, AttachToSubgraph) {
     std::shared_ptr<Function> f(nullptr), f_ref(nullptr);
     {
@@ -2,13 +2,16 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <chrono>
 #include <future>
+#include <thread>
 
 #include <gtest/gtest.h>
 
 #include <ie_parallel.hpp>
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <threading/ie_immediate_executor.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include <ie_system_conf.h>
 
 using namespace ::testing;
@@ -198,6 +201,66 @@ TEST_F(StreamsExecutorConfigTest, streamsExecutorConfigReturnStrings) {
     }
 }
 
+TEST_F(StreamsExecutorConfigTest, spinBudgetCanBeSet) {
+    IStreamsExecutor::Config config;
+    ASSERT_NO_THROW(config.SetConfig(CONFIG_KEY_INTERNAL(CPU_STREAMS_SPIN_BUDGET), "100"));
+    ASSERT_EQ(100, config._threadSpinBudget);
+    ASSERT_EQ("100", config.GetConfig(CONFIG_KEY_INTERNAL(CPU_STREAMS_SPIN_BUDGET)).as<std::string>());
+    ASSERT_THROW(config.SetConfig(CONFIG_KEY_INTERNAL(CPU_STREAMS_SPIN_BUDGET), "-1"), InferenceEngine::Exception);
+}
+
+// Many producers submit more tasks than the queues of the streams hold, so some of them go to the overflow queue
+class CPUStreamsExecutorDispatchTests : public ::testing::TestWithParam<int> {
+protected:
+    // returns the time of dispatching one task in ns
+    double dispatch(const int tasksPerProducer) {
+        const int spinBudget = GetParam();
+        const int streams = std::max(2, getNumberOfCPUCores());
+        const int producers = 4;
+        const int tasksNum = producers * tasksPerProducer;
+
+        std::atomic_int executed = {0};
+        std::promise<void> done;
+        auto task = [&] {
+            if (++executed == tasksNum)
+                done.set_value();
+        };
+
+        // is destroyed first, so the pending tasks are drained before the counter goes away
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor", streams, 1, IStreamsExecutor::ThreadBindingType::NONE};
+        config._threadSpinBudget = spinBudget;
+        auto taskExecutor = std::make_shared<CPUStreamsExecutor>(config);
+
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (int i = 0; i < producers; i++) {
+            threads.emplace_back([&] {
+                for (int k = 0; k < tasksPerProducer; k++) {
+                    taskExecutor->run(task);
+                }
+            });
+        }
+        for (auto&& thread : threads) thread.join();
+        EXPECT_EQ(std::future_status::ready, done.get_future().wait_for(std::chrono::seconds(60)));
+        const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+        EXPECT_EQ(tasksNum, executed);
+        return elapsed / tasksNum;
+    }
+};
+
+TEST_P(CPUStreamsExecutorDispatchTests, allTasksAreExecuted) {
+    dispatch(2000);
+}
+
+// The microbenchmark of the task dispatch: the tasks are empty, so the time per task is the overhead of the queues
+// and the thread wake-ups. Is run with --gtest_also_run_disabled_tests, the result is reported as the test property.
+TEST_P(CPUStreamsExecutorDispatchTests, DISABLED_measureDispatchOverhead) {
+    RecordProperty("dispatch_ns_per_task", std::to_string(dispatch(20000)));
+}
+
+INSTANTIATE_TEST_SUITE_P(CPUStreamsExecutorDispatchTests, CPUStreamsExecutorDispatchTests, ::testing::Values(0, 20, 200));
+
 static auto Executors = ::testing::Values(
     [] {
         auto streams = getNumberOfCPUCores();
@@ -3,6 +3,7 @@
 //
 
 #include "ie_plugin_config.hpp"
+#include "cpu/cpu_config.hpp"
 #include "behavior/config.hpp"
 
 using namespace BehaviorTestsDefinitions;
@@ -74,7 +75,9 @@ namespace {
                     {InferenceEngine::PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS, "should be int"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "OFF"}},
             {{InferenceEngine::PluginConfigParams::KEY_CPU_BIND_THREAD, "OFF"}},
-            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}}
+            {{InferenceEngine::PluginConfigParams::KEY_DYN_BATCH_LIMIT, "NAN"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES_UPPER_BOUNDS, "input[1,x]"}},
+            {{InferenceEngine::CPUConfigParams::KEY_CPU_SHARED_WEIGHTS_DIR_MAX_SIZE, "-1"}}
     };
 
     const std::vector<std::map<std::string, std::string>> multiinconfigs = {
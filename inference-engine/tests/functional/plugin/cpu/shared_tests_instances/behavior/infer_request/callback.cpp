@@ -16,6 +16,12 @@ const std::vector<std::map<std::string, std::string>> multiConfigs = {
         {{ MULTI_CONFIG_KEY(DEVICE_PRIORITIES) , CommonTestUtils::DEVICE_CPU}}
 };
 
+// the small timeout makes the tests executing single requests not to wait for the batch
+const std::vector<std::map<std::string, std::string>> autoBatchConfigs = {
+        {{ AUTO_BATCH_CONFIG_KEY(DEVICE_CONFIG) , std::string(CommonTestUtils::DEVICE_CPU) + "(4)"},
+         { AUTO_BATCH_CONFIG_KEY(TIMEOUT) , "10"}}
+};
+
 INSTANTIATE_TEST_SUITE_P(smoke_BehaviorTests, InferRequestCallbackTests,
         ::testing::Combine(
             ::testing::Values(CommonTestUtils::DEVICE_CPU),
@@ -33,4 +39,10 @@ INSTANTIATE_TEST_SUITE_P(smoke_Auto_BehaviorTests, InferRequestCallbackTests,
                 ::testing::Values(CommonTestUtils::DEVICE_AUTO),
                 ::testing::ValuesIn(multiConfigs)),
         InferRequestCallbackTests::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_AutoBatch_BehaviorTests, InferRequestCallbackTests,
+        ::testing::Combine(
+                ::testing::Values(CommonTestUtils::DEVICE_BATCH),
+                ::testing::ValuesIn(autoBatchConfigs)),
+        InferRequestCallbackTests::getTestCaseName);
 }  // namespace
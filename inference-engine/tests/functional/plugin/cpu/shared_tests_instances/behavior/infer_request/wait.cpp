@@ -15,6 +15,11 @@ namespace {
             {{InferenceEngine::PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, "0"}, {InferenceEngine::PluginConfigParams::KEY_CPU_THREADS_NUM, "1"}}
     };
 
+    const std::vector<std::map<std::string, std::string>> AutoBatchConfigs = {
+            {{ AUTO_BATCH_CONFIG_KEY(DEVICE_CONFIG) , std::string(CommonTestUtils::DEVICE_CPU) + "(4)"},
+             { AUTO_BATCH_CONFIG_KEY(TIMEOUT) , "10"}}
+    };
+
     const std::vector<std::map<std::string, std::string>> Multiconfigs = {
             {{ MULTI_CONFIG_KEY(DEVICE_PRIORITIES) , CommonTestUtils::DEVICE_CPU}}
     };
@@ -41,4 +46,10 @@ namespace {
                                     ::testing::ValuesIn(Autoconfigs)),
                              InferRequestWaitTests::getTestCaseName);
 
+    INSTANTIATE_TEST_SUITE_P(smoke_AutoBatch_BehaviorTests, InferRequestWaitTests,
+                            ::testing::Combine(
+                                    ::testing::Values(CommonTestUtils::DEVICE_BATCH),
+                                    ::testing::ValuesIn(AutoBatchConfigs)),
+                             InferRequestWaitTests::getTestCaseName);
+
 }  // namespace
@@ -43,6 +43,34 @@ const auto testCase1D = ::testing::Combine(
     ::testing::Values(CommonTestUtils::DEVICE_CPU)
 );
 
+/* 1D DFT of the audio frame sizes and of the sizes with big prime factors */
+const std::vector<std::vector<size_t>> inputShapesArbitrarySizes = {
+    {4, 960, 2},
+    {3, 97, 5, 2},
+};
+
+const std::vector<std::vector<int64_t>> signalSizesArbitrary = {
+    {}, {400}, {480}, {1031}
+};
+
+const auto testCase1DArbitrarySizes = ::testing::Combine(
+    ::testing::ValuesIn(inputShapesArbitrarySizes),
+    ::testing::ValuesIn(inputPrecision),
+    ::testing::Values(std::vector<int64_t>{1}),
+    ::testing::ValuesIn(signalSizesArbitrary),
+    ::testing::ValuesIn(opTypes),
+    ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+const auto testCase1DSingleSignal = ::testing::Combine(
+    ::testing::Values(std::vector<size_t>{1000, 2}),
+    ::testing::ValuesIn(inputPrecision),
+    ::testing::Values(std::vector<int64_t>{0}),
+    ::testing::ValuesIn(std::vector<std::vector<int64_t>>{{}, {1024}, {509}}),
+    ::testing::ValuesIn(opTypes),
+    ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
 /* 2D DFT */
 
 const std::vector<std::vector<int64_t>> axes2D = {
@@ -102,6 +130,8 @@ const auto testCase4D = ::testing::Combine(
 
 
 INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_1d, DFTLayerTest, testCase1D, DFTLayerTest::getTestCaseName);
+INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_1d_ArbitrarySizes, DFTLayerTest, testCase1DArbitrarySizes, DFTLayerTest::getTestCaseName);
+INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_1d_SingleSignal, DFTLayerTest, testCase1DSingleSignal, DFTLayerTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_2d, DFTLayerTest, testCase2D, DFTLayerTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_3d, DFTLayerTest, testCase3D, DFTLayerTest::getTestCaseName);
 INSTANTIATE_TEST_SUITE_P(smoke_MKLDNN_TestsDFT_4d, DFTLayerTest, testCase4D, DFTLayerTest::getTestCaseName);
@@ -107,6 +107,9 @@ const auto gather7ParamsSubset_BD0 = testing::Combine(
 
 INSTANTIATE_TEST_SUITE_P(smoke_Gather7_BD0, Gather7LayerTest, gather7ParamsSubset_BD0, Gather7LayerTest::getTestCaseName);
 
+// the generated indices include the negative ones
+INSTANTIATE_TEST_SUITE_P(smoke_Gather8_BD0, Gather8LayerTest, gather7ParamsSubset_BD0, Gather8LayerTest::getTestCaseName);
+
 const std::vector<std::vector<size_t>> indicesShapes_BD1 = {
         std::vector<size_t>{4, 2},
         std::vector<size_t>{4, 5, 3},
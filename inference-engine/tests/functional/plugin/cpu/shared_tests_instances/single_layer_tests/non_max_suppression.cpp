@@ -40,3 +40,20 @@ const auto nmsParams = ::testing::Combine(::testing::ValuesIn(inShapeParams),
 );
 
 INSTANTIATE_TEST_SUITE_P(smoke_NmsLayerTest, NmsLayerTest, nmsParams, NmsLayerTest::getTestCaseName);
+
+// Many kept boxes per class, so the boxes are compared by the vectors with the tails
+const auto nmsManyBoxesParams = ::testing::Combine(::testing::Values(InputShapeParams{2, 1000, 4}),
+                                                   ::testing::Combine(::testing::Values(Precision::FP32),
+                                                                      ::testing::Values(Precision::I32),
+                                                                      ::testing::Values(Precision::FP32)),
+                                                   ::testing::Values(300),
+                                                   ::testing::Values(0.7f),
+                                                   ::testing::Values(0.0f),
+                                                   ::testing::ValuesIn(sigmaThreshold),
+                                                   ::testing::ValuesIn(encodType),
+                                                   ::testing::Values(true),
+                                                   ::testing::Values(element::i32),
+                                                   ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_NmsLayerTest_ManyBoxes, NmsLayerTest, nmsManyBoxesParams, NmsLayerTest::getTestCaseName);
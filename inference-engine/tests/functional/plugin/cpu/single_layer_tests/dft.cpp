@@ -0,0 +1,71 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/single_layer/dft.hpp>
+#include "functional_test_utils/blob_utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPULayerTestsDefinitions {
+
+// The input with zero imaginary parts, the lines of the first transformed axis are transformed in pairs by one complex transform
+class DFTRealInputLayerCPUTest : public LayerTestsDefinitions::DFTLayerTest {
+protected:
+    Blob::Ptr GenerateInput(const InputInfo &info) const override {
+        auto blob = FuncTestUtils::createAndFillBlob(info.getTensorDesc());
+        auto *rawBlobDataPtr = blob->buffer().as<float *>();
+        for (size_t i = 1; i < blob->size(); i += 2) {
+            rawBlobDataPtr[i] = 0.f;
+        }
+        return blob;
+    }
+};
+
+TEST_P(DFTRealInputLayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+namespace {
+
+const std::vector<ngraph::helpers::DFTOpType> opTypes = {
+    ngraph::helpers::DFTOpType::FORWARD,
+    ngraph::helpers::DFTOpType::INVERSE
+};
+
+/* ============= 1D: the lines are transformed by the batches of 16, the odd batch has an unpaired line ============= */
+const std::vector<std::vector<size_t>> inputShapes1D = {
+    {4, 960, 2},        // the batch of 4 lines
+    {3, 97, 5, 2},      // the batch of 15 lines
+    {21, 64, 2},        // the batches of 16 and 5 lines
+};
+
+const std::vector<std::vector<int64_t>> signalSizes1D = {
+    {}, {48}, {400}, {1031}
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_DFT_RealInput_1D, DFTRealInputLayerCPUTest,
+        ::testing::Combine(
+            ::testing::ValuesIn(inputShapes1D),
+            ::testing::Values(Precision::FP32),
+            ::testing::Values(std::vector<int64_t>{1}),
+            ::testing::ValuesIn(signalSizes1D),
+            ::testing::ValuesIn(opTypes),
+            ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        DFTRealInputLayerCPUTest::getTestCaseName);
+
+/* ============= 2D: only the first axis has the real input, the second one is complex ============= */
+INSTANTIATE_TEST_SUITE_P(smoke_DFT_RealInput_2D, DFTRealInputLayerCPUTest,
+        ::testing::Combine(
+            ::testing::ValuesIn(std::vector<std::vector<size_t>>{{3, 7, 9, 2}, {5, 16, 12, 2}}),
+            ::testing::Values(Precision::FP32),
+            ::testing::ValuesIn(std::vector<std::vector<int64_t>>{{1, 2}, {2, 0}}),
+            ::testing::ValuesIn(std::vector<std::vector<int64_t>>{{}, {10, 5}}),
+            ::testing::ValuesIn(opTypes),
+            ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        DFTRealInputLayerCPUTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
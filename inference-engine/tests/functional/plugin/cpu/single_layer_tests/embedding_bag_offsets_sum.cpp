@@ -0,0 +1,65 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/single_layer/embedding_bag_offsets_sum.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPULayerTestsDefinitions {
+
+class EmbeddingBagOffsetsSumLayerCPUTest : public LayerTestsDefinitions::EmbeddingBagOffsetsSumLayerTest, public CPUTestsBase {
+protected:
+    void SetUp() override {
+        LayerTestsDefinitions::EmbeddingBagOffsetsSumLayerTest::SetUp();
+        const Precision netPrecision = std::get<1>(GetParam());
+        selectedType = std::string("ref_any_") + netPrecision.name();
+    }
+};
+
+TEST_P(EmbeddingBagOffsetsSumLayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckPluginRelatedResults(executableNetwork, "EmbeddingBagOffsetsSum");
+}
+
+namespace {
+
+// The bags of the same size spread over the table
+LayerTestsDefinitions::embeddingBagOffsetsSumParams makeBags(size_t tableSize, size_t embDim, size_t bagsNum, size_t bagSize,
+                                                             bool withWeights) {
+    std::vector<size_t> indices(bagsNum * bagSize), offsets(bagsNum);
+    for (size_t i = 0; i < indices.size(); i++) {
+        indices[i] = (i * 7919) % tableSize;
+    }
+    for (size_t i = 0; i < bagsNum; i++) {
+        offsets[i] = i * bagSize;
+    }
+    return LayerTestsDefinitions::embeddingBagOffsetsSumParams{{tableSize, embDim}, indices, offsets, 0, withWeights, false};
+}
+
+/* ============= Rows of the lengths which are not multiples of the vector and the split rows of a few bags ============= */
+std::vector<LayerTestsDefinitions::embeddingBagOffsetsSumParams> bagsParams() {
+    std::vector<LayerTestsDefinitions::embeddingBagOffsetsSumParams> res;
+    for (bool withWeights : {false, true}) {
+        res.push_back(makeBags(100, 37, 5, 3, withWeights));
+        res.push_back(makeBags(100, 300, 1, 50, withWeights));
+        res.push_back(makeBags(1000, 1000, 2, 7, withWeights));
+        res.push_back(LayerTestsDefinitions::embeddingBagOffsetsSumParams{{20, 70}, {1, 5, 19, 2, 3}, {0, 0, 2, 2}, 4, withWeights, true});
+    }
+    return res;
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_EmbeddingBagOffsetsSum, EmbeddingBagOffsetsSumLayerCPUTest,
+        ::testing::Combine(
+            ::testing::ValuesIn(bagsParams()),
+            ::testing::ValuesIn(std::vector<Precision>{Precision::FP32, Precision::BF16, Precision::I8}),
+            ::testing::Values(Precision::I32),
+            ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        LayerTestsDefinitions::EmbeddingBagOffsetsSumLayerTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
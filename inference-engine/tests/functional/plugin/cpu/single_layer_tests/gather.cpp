@@ -0,0 +1,227 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/single_layer/gather.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        LayerTestsDefinitions::gather7ParamsTuple,
+        CPUSpecificParams> GatherLayerCPUTestParamsSet;
+
+class GatherLayerCPUTest : public testing::WithParamInterface<GatherLayerCPUTestParamsSet>,
+                           virtual public LayerTestsUtils::LayerTestsCommon, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<GatherLayerCPUTestParamsSet> obj) {
+        LayerTestsDefinitions::gather7ParamsTuple basicParamsSet;
+        CPUSpecificParams cpuParams;
+        std::tie(basicParamsSet, cpuParams) = obj.param;
+
+        std::ostringstream result;
+        result << LayerTestsDefinitions::Gather8LayerTest::getTestCaseName(
+                     testing::TestParamInfo<LayerTestsDefinitions::gather7ParamsTuple>(basicParamsSet, 0));
+        result << CPUTestsBase::getTestCaseName(cpuParams);
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        LayerTestsDefinitions::gather7ParamsTuple basicParamsSet;
+        CPUSpecificParams cpuParams;
+        std::tie(basicParamsSet, cpuParams) = this->GetParam();
+        std::tie(inFmts, outFmts, priority, selectedType) = cpuParams;
+
+        std::tuple<int, int> axis_batchIdx;
+        std::vector<size_t> indicesShape;
+        std::vector<size_t> inputShape;
+        Precision netPrecision;
+        std::tie(inputShape, indicesShape, axis_batchIdx, netPrecision, inPrc, outPrc, inLayout, outLayout, targetDevice) = basicParamsSet;
+        int axis = std::get<0>(axis_batchIdx);
+        int batchIdx = std::get<1>(axis_batchIdx);
+        const int axisDim = static_cast<int>(inputShape[axis < 0 ? axis + inputShape.size() : axis]);
+
+        auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(netPrecision);
+        auto params = ngraph::builder::makeParams(ngPrc, {inputShape});
+        auto paramOuts = ngraph::helpers::convert2OutputVector(ngraph::helpers::castOps2Nodes<ngraph::op::Parameter>(params));
+        // the negative indices are counted from the end of the axis
+        auto indicesNode = ngraph::builder::makeConstant<int>(ngraph::element::i64, indicesShape, {}, true, axisDim - 1, 1 - axisDim);
+        auto axisNode = ngraph::opset8::Constant::create(ngraph::element::i64, ngraph::Shape({}), {axis});
+        auto gather = std::make_shared<ngraph::opset8::Gather>(paramOuts[0], indicesNode, axisNode, batchIdx);
+        gather->get_rt_info() = getCPUInfo();
+        ngraph::ResultVector results{std::make_shared<ngraph::opset8::Result>(gather)};
+        function = std::make_shared<ngraph::Function>(results, params, "Gather");
+
+        if (selectedType.empty()) {
+            selectedType = getPrimitiveType(isElementwise(inputShape, axis < 0 ? axis + inputShape.size() : axis));
+        }
+        selectedType.push_back('_');
+        selectedType += netPrecision.name();
+    }
+
+    // the JIT kernel is used only if single elements are gathered, i.e. the physical dims after the axis are all 1
+    bool isElementwise(const std::vector<size_t>& inputShape, size_t axis) const {
+        size_t rowLength = 1;
+        for (size_t i = axis + 1; i < inputShape.size(); i++)
+            rowLength *= inputShape[i];
+        if (!inFmts.empty() && (inFmts[0] == nhwc || inFmts[0] == ndhwc)) {
+            if (axis == 1)
+                rowLength = 1;
+            else if (axis > 1)
+                rowLength *= inputShape[1];
+        } else if (!inFmts.empty() && inFmts[0] != nchw && inFmts[0] != ncdhw) {
+            return false;
+        }
+        return rowLength == 1;
+    }
+
+    std::string getPrimitiveType(bool elementwise) const {
+        if (!elementwise)
+            return "ref_any";
+        if (with_cpu_x86_avx512f())
+            return "jit_avx512";
+        if (with_cpu_x86_avx2())
+            return "jit_avx2";
+        return "ref_any";
+    }
+};
+
+TEST_P(GatherLayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckPluginRelatedResults(executableNetwork, "Gather");
+}
+
+namespace {
+
+const std::vector<Precision> netPrecisions = {
+        Precision::FP32,
+        Precision::BF16,
+        Precision::I8
+};
+
+/* ============= Planar layouts: gathering single elements and rows ============= */
+const std::vector<std::vector<size_t>> indicesShapesPlanar = {
+        {7},
+        {37},
+        {3, 11}
+};
+
+const std::vector<std::tuple<int, int>> axesPlanar = {
+        std::tuple<int, int>{0, 0},
+        std::tuple<int, int>{2, 0},
+        std::tuple<int, int>{-1, 0}
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Gather_Planar, GatherLayerCPUTest,
+        ::testing::Combine(
+            ::testing::Combine(
+                ::testing::Values(std::vector<size_t>{3, 11, 7, 19}),
+                ::testing::ValuesIn(indicesShapesPlanar),
+                ::testing::ValuesIn(axesPlanar),
+                ::testing::ValuesIn(netPrecisions),
+                ::testing::Values(Precision::UNSPECIFIED),
+                ::testing::Values(Precision::UNSPECIFIED),
+                ::testing::Values(Layout::ANY),
+                ::testing::Values(Layout::ANY),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+            ::testing::Values(CPUSpecificParams{{}, {}, {}, {}})),
+        GatherLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_Gather_Planar_BatchDims, GatherLayerCPUTest,
+        ::testing::Combine(
+            ::testing::Combine(
+                ::testing::Values(std::vector<size_t>{3, 11, 7, 19}),
+                ::testing::Values(std::vector<size_t>{3, 11, 5}),
+                ::testing::ValuesIn(std::vector<std::tuple<int, int>>{{-1, 1}, {3, 2}, {2, 2}}),
+                ::testing::ValuesIn(netPrecisions),
+                ::testing::Values(Precision::UNSPECIFIED),
+                ::testing::Values(Precision::UNSPECIFIED),
+                ::testing::Values(Layout::ANY),
+                ::testing::Values(Layout::ANY),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+            ::testing::Values(CPUSpecificParams{{}, {}, {}, {}})),
+        GatherLayerCPUTest::getTestCaseName);
+
+/* ============= Channel-last and blocked layouts: no reorders around Gather ============= */
+std::vector<CPUSpecificParams> filterCPUInfoForDevice4D(bool withBlocked) {
+    std::vector<CPUSpecificParams> resCPUParams;
+    resCPUParams.push_back(CPUSpecificParams{{nchw}, {nchw}, {}, {}});
+    resCPUParams.push_back(CPUSpecificParams{{nhwc}, {nhwc}, {}, {}});
+    if (withBlocked) {
+        resCPUParams.push_back(CPUSpecificParams{{nChw8c}, {nChw8c}, {}, {}});
+        if (with_cpu_x86_avx512f())
+            resCPUParams.push_back(CPUSpecificParams{{nChw16c}, {nChw16c}, {}, {}});
+    }
+    return resCPUParams;
+}
+
+std::vector<CPUSpecificParams> filterCPUInfoForDevice5D() {
+    std::vector<CPUSpecificParams> resCPUParams;
+    resCPUParams.push_back(CPUSpecificParams{{ncdhw}, {ncdhw}, {}, {}});
+    resCPUParams.push_back(CPUSpecificParams{{ndhwc}, {ndhwc}, {}, {}});
+    resCPUParams.push_back(CPUSpecificParams{{nCdhw8c}, {nCdhw8c}, {}, {}});
+    if (with_cpu_x86_avx512f())
+        resCPUParams.push_back(CPUSpecificParams{{nCdhw16c}, {nCdhw16c}, {}, {}});
+    return resCPUParams;
+}
+
+const std::vector<std::vector<size_t>> indicesShapes1D = {
+        {5},
+        {29}
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Gather_4D_Spatial, GatherLayerCPUTest,
+        ::testing::Combine(
+            ::testing::Combine(
+                ::testing::Values(std::vector<size_t>{2, 32, 9, 13}),
+                ::testing::ValuesIn(indicesShapes1D),
+                ::testing::ValuesIn(std::vector<std::tuple<int, int>>{{0, 0}, {2, 0}, {3, 0}, {-1, 0}}),
+                ::testing::ValuesIn(netPrecisions),
+                ::testing::Values(Precision::UNSPECIFIED),
+                ::testing::Values(Precision::UNSPECIFIED),
+                ::testing::Values(Layout::ANY),
+                ::testing::Values(Layout::ANY),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+            ::testing::ValuesIn(filterCPUInfoForDevice4D(true))),
+        GatherLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_Gather_4D_Channels, GatherLayerCPUTest,
+        ::testing::Combine(
+            ::testing::Combine(
+                ::testing::Values(std::vector<size_t>{2, 32, 9, 13}),
+                ::testing::ValuesIn(indicesShapes1D),
+                ::testing::Values(std::tuple<int, int>{1, 0}),
+                ::testing::ValuesIn(netPrecisions),
+                ::testing::Values(Precision::UNSPECIFIED),
+                ::testing::Values(Precision::UNSPECIFIED),
+                ::testing::Values(Layout::ANY),
+                ::testing::Values(Layout::ANY),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+            ::testing::ValuesIn(filterCPUInfoForDevice4D(false))),
+        GatherLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_Gather_5D_Spatial, GatherLayerCPUTest,
+        ::testing::Combine(
+            ::testing::Combine(
+                ::testing::Values(std::vector<size_t>{2, 16, 5, 6, 7}),
+                ::testing::ValuesIn(indicesShapes1D),
+                ::testing::ValuesIn(std::vector<std::tuple<int, int>>{{2, 0}, {-1, 0}}),
+                ::testing::ValuesIn(netPrecisions),
+                ::testing::Values(Precision::UNSPECIFIED),
+                ::testing::Values(Precision::UNSPECIFIED),
+                ::testing::Values(Layout::ANY),
+                ::testing::Values(Layout::ANY),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+            ::testing::ValuesIn(filterCPUInfoForDevice5D())),
+        GatherLayerCPUTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
@@ -171,5 +171,37 @@ INSTANTIATE_TEST_SUITE_P(smoke_ROIAlignLayoutTest, ROIAlignLayerCPUTest,
                         ::testing::Values(CommonTestUtils::DEVICE_CPU)),
                 ::testing::ValuesIn(filterCPUInfoForDevice())),
                 ROIAlignLayerCPUTest::getTestCaseName);
+
+/* ============= Many regions of a feature map with many channels, the channels last path pools them at once ============= */
+std::pair<std::vector<float>, std::vector<size_t>> makeProposals(size_t roisNum, size_t batch, float size) {
+    std::vector<float> coords(4 * roisNum);
+    std::vector<size_t> idx(roisNum);
+    for (size_t i = 0; i < roisNum; i++) {
+        const float x = static_cast<float>((i * 37) % static_cast<size_t>(size / 2));
+        const float y = static_cast<float>((i * 53) % static_cast<size_t>(size / 2));
+        coords[4 * i] = x;
+        coords[4 * i + 1] = y;
+        coords[4 * i + 2] = x + size / 4 + static_cast<float>(i % 7);
+        coords[4 * i + 3] = y + size / 4 + static_cast<float>(i % 5);
+        idx[i] = i % batch;
+    }
+    return {coords, idx};
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ROIAlignManyRoisTest, ROIAlignLayerCPUTest,
+        ::testing::Combine(
+                ::testing::Combine(
+                        ::testing::Combine(
+                                ::testing::Values(7),
+                                ::testing::Values(7),
+                                ::testing::Values(0.25f),
+                                ::testing::Values(2),
+                                ::testing::Values(makeProposals(32, 2, 200.f)),
+                                ::testing::ValuesIn(modeVector),
+                                ::testing::Values(SizeVector({ 2, 40, 50, 50 }))),
+                        ::testing::ValuesIn(netPrecisions),
+                        ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                ::testing::ValuesIn(filterCPUInfoForDevice())),
+                ROIAlignLayerCPUTest::getTestCaseName);
 } // namespace
 } // namespace CPULayerTestsDefinitions
@@ -0,0 +1,148 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/single_layer/scatter_update.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        LayerTestsDefinitions::scatterUpdateParamsTuple,
+        CPUSpecificParams> ScatterUpdateLayerCPUTestParamsSet;
+
+class ScatterUpdateLayerCPUTest : public testing::WithParamInterface<ScatterUpdateLayerCPUTestParamsSet>,
+                                  virtual public LayerTestsUtils::LayerTestsCommon, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ScatterUpdateLayerCPUTestParamsSet> obj) {
+        LayerTestsDefinitions::scatterUpdateParamsTuple basicParamsSet;
+        CPUSpecificParams cpuParams;
+        std::tie(basicParamsSet, cpuParams) = obj.param;
+
+        std::ostringstream result;
+        result << LayerTestsDefinitions::ScatterUpdateLayerTest::getTestCaseName(
+                     testing::TestParamInfo<LayerTestsDefinitions::scatterUpdateParamsTuple>(basicParamsSet, 0));
+        result << CPUTestsBase::getTestCaseName(cpuParams);
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        LayerTestsDefinitions::scatterUpdateParamsTuple basicParamsSet;
+        CPUSpecificParams cpuParams;
+        std::tie(basicParamsSet, cpuParams) = this->GetParam();
+        std::tie(inFmts, outFmts, priority, selectedType) = cpuParams;
+
+        LayerTestsDefinitions::axisUpdateShapeInShape shapeDescript;
+        SizeVector inShape, indicesShape, updateShape;
+        int64_t axis;
+        std::vector<int64_t> indicesValue;
+        Precision inputPrecision, indicesPrecision;
+        std::tie(shapeDescript, indicesValue, inputPrecision, indicesPrecision, targetDevice) = basicParamsSet;
+        std::tie(inShape, indicesShape, updateShape, axis) = shapeDescript;
+
+        auto inPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(inputPrecision);
+        auto idxPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(indicesPrecision);
+        auto params = ngraph::builder::makeParams(inPrc, {inShape, updateShape});
+        auto paramOuts = ngraph::helpers::convert2OutputVector(ngraph::helpers::castOps2Nodes<ngraph::op::Parameter>(params));
+        auto scatter = ngraph::builder::makeScatterUpdate(paramOuts[0], idxPrc, indicesShape, indicesValue, paramOuts[1], axis);
+        scatter->get_rt_info() = getCPUInfo();
+        ngraph::ResultVector results{std::make_shared<ngraph::opset3::Result>(scatter)};
+        function = std::make_shared<ngraph::Function>(results, params, "ScatterUpdate");
+
+        selectedType = std::string("unknown_") + inputPrecision.name();
+    }
+};
+
+TEST_P(ScatterUpdateLayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckPluginRelatedResults(executableNetwork, "ScatterUpdate");
+}
+
+namespace {
+
+const std::vector<Precision> inputPrecisions = {
+        Precision::FP32,
+        Precision::I32
+};
+
+const std::vector<std::vector<int64_t>> idxValue = {
+        {0, 2, 4, 1}
+};
+
+std::vector<CPUSpecificParams> filterCPUInfoForDevice4D(bool withBlocked) {
+    std::vector<CPUSpecificParams> resCPUParams;
+    resCPUParams.push_back(CPUSpecificParams{{nhwc, x, nhwc}, {nhwc}, {}, {}});
+    if (withBlocked) {
+        resCPUParams.push_back(CPUSpecificParams{{nChw8c, x, nChw8c}, {nChw8c}, {}, {}});
+        if (with_cpu_x86_avx512f())
+            resCPUParams.push_back(CPUSpecificParams{{nChw16c, x, nChw16c}, {nChw16c}, {}, {}});
+    }
+    return resCPUParams;
+}
+
+std::vector<CPUSpecificParams> filterCPUInfoForDevice5D() {
+    std::vector<CPUSpecificParams> resCPUParams;
+    resCPUParams.push_back(CPUSpecificParams{{ndhwc, x, ndhwc}, {ndhwc}, {}, {}});
+    resCPUParams.push_back(CPUSpecificParams{{nCdhw8c, x, nCdhw8c}, {nCdhw8c}, {}, {}});
+    if (with_cpu_x86_avx512f())
+        resCPUParams.push_back(CPUSpecificParams{{nCdhw16c, x, nCdhw16c}, {nCdhw16c}, {}, {}});
+    return resCPUParams;
+}
+
+/* ============= Channels last and blocked layouts: the updates over the physical dims ============= */
+// map<inputShape, map<indicesShape, axis>>
+std::map<std::vector<size_t>, std::map<std::vector<size_t>, std::vector<int>>> spatialShapes4D {
+    {{6, 20, 7, 9}, {{{4}, {0, 2, -1}}}},
+};
+
+std::map<std::vector<size_t>, std::map<std::vector<size_t>, std::vector<int>>> channelShapes4D {
+    {{3, 21, 7, 9}, {{{4}, {1}}}},
+};
+
+std::map<std::vector<size_t>, std::map<std::vector<size_t>, std::vector<int>>> spatialShapes5D {
+    {{5, 10, 6, 5, 7}, {{{4}, {0, 2, 3, -1}}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ScatterUpdate_4D_Spatial, ScatterUpdateLayerCPUTest,
+        ::testing::Combine(
+            ::testing::Combine(
+                ::testing::ValuesIn(LayerTestsDefinitions::ScatterUpdateLayerTest::combineShapes(spatialShapes4D)),
+                ::testing::ValuesIn(idxValue),
+                ::testing::ValuesIn(inputPrecisions),
+                ::testing::Values(Precision::I32),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+            ::testing::ValuesIn(filterCPUInfoForDevice4D(true))),
+        ScatterUpdateLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_ScatterUpdate_4D_Channels, ScatterUpdateLayerCPUTest,
+        ::testing::Combine(
+            ::testing::Combine(
+                ::testing::ValuesIn(LayerTestsDefinitions::ScatterUpdateLayerTest::combineShapes(channelShapes4D)),
+                ::testing::ValuesIn(idxValue),
+                ::testing::ValuesIn(inputPrecisions),
+                ::testing::Values(Precision::I32),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+            ::testing::ValuesIn(filterCPUInfoForDevice4D(false))),
+        ScatterUpdateLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_ScatterUpdate_5D_Spatial, ScatterUpdateLayerCPUTest,
+        ::testing::Combine(
+            ::testing::Combine(
+                ::testing::ValuesIn(LayerTestsDefinitions::ScatterUpdateLayerTest::combineShapes(spatialShapes5D)),
+                ::testing::ValuesIn(idxValue),
+                ::testing::ValuesIn(inputPrecisions),
+                ::testing::Values(Precision::I32),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+            ::testing::ValuesIn(filterCPUInfoForDevice5D())),
+        ScatterUpdateLayerCPUTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
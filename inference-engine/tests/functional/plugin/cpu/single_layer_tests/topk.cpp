@@ -0,0 +1,159 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/single_layer/topk.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace CPULayerTestsDefinitions {
+
+typedef std::tuple<
+        LayerTestsDefinitions::TopKParams,
+        CPUSpecificParams> TopKLayerCPUTestParamsSet;
+
+class TopKLayerCPUTest : public testing::WithParamInterface<TopKLayerCPUTestParamsSet>,
+                         virtual public LayerTestsUtils::LayerTestsCommon, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<TopKLayerCPUTestParamsSet> obj) {
+        LayerTestsDefinitions::TopKParams basicParamsSet;
+        CPUSpecificParams cpuParams;
+        std::tie(basicParamsSet, cpuParams) = obj.param;
+
+        std::ostringstream result;
+        result << LayerTestsDefinitions::TopKLayerTest::getTestCaseName(
+                     testing::TestParamInfo<LayerTestsDefinitions::TopKParams>(basicParamsSet, 0));
+        result << CPUTestsBase::getTestCaseName(cpuParams);
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        LayerTestsDefinitions::TopKParams basicParamsSet;
+        CPUSpecificParams cpuParams;
+        std::tie(basicParamsSet, cpuParams) = this->GetParam();
+        std::tie(inFmts, outFmts, priority, selectedType) = cpuParams;
+
+        SizeVector inputShape;
+        Precision netPrecision;
+        int64_t keepK, axis;
+        ngraph::opset4::TopK::Mode mode;
+        ngraph::opset4::TopK::SortType sort;
+        std::tie(keepK, axis, mode, sort, netPrecision, inPrc, outPrc, inLayout, inputShape, targetDevice) = basicParamsSet;
+
+        auto ngPrc = FuncTestUtils::PrecisionUtils::convertIE2nGraphPrc(netPrecision);
+        auto params = ngraph::builder::makeParams(ngPrc, {inputShape});
+        auto paramIn = ngraph::helpers::convert2OutputVector(ngraph::helpers::castOps2Nodes<ngraph::op::Parameter>(params));
+
+        auto k = std::make_shared<ngraph::opset3::Constant>(ngraph::element::Type_t::i64, ngraph::Shape{}, &keepK);
+        auto topk = std::make_shared<ngraph::opset4::TopK>(paramIn[0], k, axis, mode, sort);
+        topk->get_rt_info() = getCPUInfo();
+
+        ngraph::ResultVector results;
+        for (size_t i = 0; i < topk->get_output_size(); i++) {
+            results.push_back(std::make_shared<ngraph::opset4::Result>(topk->output(i)));
+        }
+        function = std::make_shared<ngraph::Function>(results, params, "TopK");
+
+        if (selectedType.empty()) {
+            selectedType = "ref_any";
+        }
+        selectedType.push_back('_');
+        selectedType += netPrecision.name();
+    }
+};
+
+TEST_P(TopKLayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckPluginRelatedResults(executableNetwork, "TopK");
+}
+
+namespace {
+
+const std::vector<Precision> netPrecisions = {
+        Precision::FP32,
+        Precision::BF16,
+        Precision::I8,
+        Precision::U8,
+        Precision::I32
+};
+
+const std::vector<ngraph::opset4::TopK::Mode> modes = {
+        ngraph::opset4::TopK::Mode::MIN,
+        ngraph::opset4::TopK::Mode::MAX
+};
+
+const std::vector<ngraph::opset4::TopK::SortType> sortTypes = {
+        ngraph::opset4::TopK::SortType::SORT_INDICES,
+        ngraph::opset4::TopK::SortType::SORT_VALUES,
+};
+
+/* ============= Planar layout: k covers the top-1, the heap and the bitonic paths ============= */
+INSTANTIATE_TEST_SUITE_P(smoke_TopK_Planar, TopKLayerCPUTest,
+        ::testing::Combine(
+            ::testing::Combine(
+                ::testing::ValuesIn(std::vector<int64_t>{1, 3, 17, 40}),
+                ::testing::ValuesIn(std::vector<int64_t>{0, 1, 2}),
+                ::testing::ValuesIn(modes),
+                ::testing::ValuesIn(sortTypes),
+                ::testing::ValuesIn(netPrecisions),
+                ::testing::Values(Precision::UNSPECIFIED),
+                ::testing::Values(Precision::UNSPECIFIED),
+                ::testing::Values(Layout::ANY),
+                ::testing::Values(std::vector<size_t>{45, 41, 53}),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+            ::testing::Values(CPUSpecificParams{{}, {}, {}, {}})),
+        TopKLayerCPUTest::getTestCaseName);
+
+/* ============= Channel-last and blocked layouts: no reorders around TopK ============= */
+std::vector<CPUSpecificParams> filterCPUInfoForDevice4D(bool withBlocked) {
+    std::vector<CPUSpecificParams> resCPUParams;
+    resCPUParams.push_back(CPUSpecificParams{{nchw}, {nchw, nchw}, {}, {}});
+    resCPUParams.push_back(CPUSpecificParams{{nhwc}, {nhwc, nhwc}, {}, {}});
+    if (withBlocked) {
+        resCPUParams.push_back(CPUSpecificParams{{nChw8c}, {nChw8c, nChw8c}, {}, {}});
+        resCPUParams.push_back(CPUSpecificParams{{nChw16c}, {nChw16c, nChw16c}, {}, {}});
+    }
+    return resCPUParams;
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_TopK_4D_Spatial, TopKLayerCPUTest,
+        ::testing::Combine(
+            ::testing::Combine(
+                ::testing::ValuesIn(std::vector<int64_t>{1, 5}),
+                ::testing::ValuesIn(std::vector<int64_t>{0, 2, 3}),
+                ::testing::ValuesIn(modes),
+                ::testing::ValuesIn(sortTypes),
+                ::testing::ValuesIn(std::vector<Precision>{Precision::FP32, Precision::BF16, Precision::I8}),
+                ::testing::Values(Precision::UNSPECIFIED),
+                ::testing::Values(Precision::UNSPECIFIED),
+                ::testing::Values(Layout::ANY),
+                ::testing::Values(std::vector<size_t>{6, 20, 9, 11}),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+            ::testing::ValuesIn(filterCPUInfoForDevice4D(true))),
+        TopKLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_TopK_4D_Channels, TopKLayerCPUTest,
+        ::testing::Combine(
+            ::testing::Combine(
+                ::testing::ValuesIn(std::vector<int64_t>{1, 5, 16}),
+                ::testing::Values(1),
+                ::testing::ValuesIn(modes),
+                ::testing::ValuesIn(sortTypes),
+                ::testing::ValuesIn(std::vector<Precision>{Precision::FP32, Precision::BF16, Precision::I8}),
+                ::testing::Values(Precision::UNSPECIFIED),
+                ::testing::Values(Precision::UNSPECIFIED),
+                ::testing::Values(Layout::ANY),
+                ::testing::Values(std::vector<size_t>{2, 20, 9, 11}),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+            ::testing::ValuesIn(filterCPUInfoForDevice4D(false))),
+        TopKLayerCPUTest::getTestCaseName);
+
+} // namespace
+} // namespace CPULayerTestsDefinitions
@@ -0,0 +1,163 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <exec_graph_info.hpp>
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+enum class AttentionPattern {
+    SCORES,             // the scores only, the input transpositions are folded into the MatMul
+    SCORES_TRANSPOSED,  // the scores transposed back, the output transposition is folded into the MatMul as well
+    ATTENTION           // the whole attention
+};
+
+using AttentionFusionParams = std::tuple<
+        std::vector<size_t>,    // [batch, sequence, heads, head size]
+        AttentionPattern
+>;
+
+/* The transpositions of the heads are folded into the strides of the GEMMs, the attention is fused into one node
+ *
+ *     Q [B,S,H,D]          K [B,S,H,D]         V [B,S,H,D]
+ *         |                    |                   |
+ *  Transpose(0,2,1,3)  Transpose(0,2,3,1)  Transpose(0,2,1,3)
+ *          \                  /                    |
+ *               MatMul                             |
+ *                 |                                |
+ *            Multiply (scale)                      |
+ *                 |                                |
+ *            Add (mask [B,1,1,S])                  |
+ *                 |                                |
+ *              Softmax                             |
+ *                  \                              /
+ *                               MatMul
+ *                                 |
+ *                         Transpose(0,2,1,3)
+ *                                 |
+ *                          Reshape [B,S,H*D]
+ *
+ * The MatMul producing the scores is checked alone too, with and without the transposition of the output.
+ */
+class AttentionFusionTest : public testing::WithParamInterface<AttentionFusionParams>,
+                            virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<AttentionFusionParams> &obj) {
+        std::vector<size_t> shape;
+        AttentionPattern pattern;
+        std::tie(shape, pattern) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(shape) << "_";
+        result << "Pattern=" << (pattern == AttentionPattern::SCORES ? "scores" :
+                                 pattern == AttentionPattern::SCORES_TRANSPOSED ? "scores_transposed" : "attention");
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        std::vector<size_t> shape;
+        std::tie(shape, pattern) = this->GetParam();
+        const size_t batch = shape[0], seq = shape[1], heads = shape[2], size = shape[3];
+
+        auto params = builder::makeParams(element::f32, {shape, shape, shape, {batch, 1, 1, seq}});
+        auto transpose = [](const Output<Node>& input, const std::vector<int64_t>& order) {
+            return std::make_shared<opset1::Transpose>(input, opset1::Constant::create(element::i64, Shape{order.size()}, order));
+        };
+
+        auto q = transpose(params[0], {0, 2, 1, 3});
+        auto k = transpose(params[1], {0, 2, 3, 1});
+        std::shared_ptr<Node> last = std::make_shared<opset1::MatMul>(q, k);
+        if (pattern == AttentionPattern::ATTENTION) {
+            last = std::make_shared<opset1::Multiply>(last, opset1::Constant::create(element::f32, Shape{}, {1.f / std::sqrt(static_cast<float>(size))}));
+            last = std::make_shared<opset1::Add>(last, params[3]);
+            last = std::make_shared<opset1::Softmax>(last, 3);
+            auto v = transpose(params[2], {0, 2, 1, 3});
+            last = std::make_shared<opset1::MatMul>(last, v);
+            last = transpose(last, {0, 2, 1, 3});
+            last = std::make_shared<opset1::Reshape>(last, opset1::Constant::create(element::i64, Shape{3},
+                                                                                     std::vector<int64_t>{static_cast<int64_t>(batch),
+                                                                                                          static_cast<int64_t>(seq),
+                                                                                                          static_cast<int64_t>(heads * size)}), false);
+            function = std::make_shared<Function>(ResultVector{std::make_shared<op::Result>(last)}, params, "AttentionFusion");
+        } else {
+            if (pattern == AttentionPattern::SCORES_TRANSPOSED)
+                last = transpose(last, {0, 2, 1, 3});
+            params.pop_back();
+            params.pop_back();
+            function = std::make_shared<Function>(ResultVector{std::make_shared<op::Result>(last)}, params, "AttentionScores");
+        }
+    }
+
+    void CheckFusedNodes() {
+        InferenceEngine::CNNNetwork execGraphInfo = executableNetwork.GetExecGraphInfo();
+        auto execFunction = execGraphInfo.getFunction();
+        ASSERT_NE(nullptr, execFunction);
+        size_t gemmCount = 0;
+        size_t inputCount = 0;
+        for (const auto &node : execFunction->get_ops()) {
+            const auto & rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+            IE_ASSERT(rtInfo.end() != it);
+            auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+            IE_ASSERT(nullptr != value);
+            const auto layerType = value->get();
+            ASSERT_NE("Transpose", layerType);
+            ASSERT_NE("Softmax", layerType);
+            if (layerType == (pattern == AttentionPattern::ATTENTION ? "ScaledDotProductAttention" : "MatMul"))
+                gemmCount++;
+            if (layerType == "Input")
+                inputCount++;
+        }
+        ASSERT_EQ(1, gemmCount);
+        // the constants of the folded orders are removed
+        if (pattern != AttentionPattern::ATTENTION)
+            ASSERT_EQ(function->get_parameters().size(), inputCount);
+    }
+
+    AttentionPattern pattern = AttentionPattern::ATTENTION;
+};
+
+TEST_P(AttentionFusionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckFusedNodes();
+}
+
+namespace {
+
+const std::vector<std::vector<size_t>> shapes = {
+        {1, 16, 2, 8},
+        {2, 77, 4, 32},
+};
+
+const std::vector<AttentionPattern> patterns = {
+        AttentionPattern::SCORES,
+        AttentionPattern::SCORES_TRANSPOSED,
+        AttentionPattern::ATTENTION,
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_AttentionFusion, AttentionFusionTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(shapes),
+                                 ::testing::ValuesIn(patterns)),
+                         AttentionFusionTest::getTestCaseName);
+
+// the scores of the long sequence don't fit the half of L2, so the rows are split into the blocks with the tail,
+// several blocks of the same head are processed by different threads
+INSTANTIATE_TEST_SUITE_P(smoke_AttentionFusion_RowsBlocks, AttentionFusionTest,
+                         ::testing::Combine(
+                                 ::testing::Values(std::vector<size_t>{1, 1100, 2, 16}),
+                                 ::testing::Values(AttentionPattern::ATTENTION)),
+                         AttentionFusionTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,137 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <chrono>
+
+#include "ngraph_functions/builders.hpp"
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include <ie_core.hpp>
+#include <auto_batch/auto_batch_config.hpp>
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+using AutoBatchParams = std::tuple<
+        size_t,         // batch size of the BATCH device
+        size_t,         // number of requests
+        bool            // the long timeout is set, the default one otherwise
+>;
+
+/* The requests of the network are collected into the batches by the BATCH device
+ *
+ *      Param [1,3,10,10]
+ *        |
+ *    Convolution
+ *        |
+ *      Result
+ */
+class AutoBatchTest : public testing::WithParamInterface<AutoBatchParams>,
+                      public CommonTestUtils::TestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<AutoBatchParams> &obj) {
+        size_t batch, numRequests;
+        bool longTimeout;
+        std::tie(batch, numRequests, longTimeout) = obj.param;
+        std::ostringstream result;
+        result << "Batch=" << batch << "_Requests=" << numRequests << "_LongTimeout=" << longTimeout;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        auto params = builder::makeParams(element::f32, {{1, 3, 10, 10}});
+        auto conv = builder::makeConvolution(params[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 8);
+        auto function = std::make_shared<Function>(ResultVector{std::make_shared<op::Result>(conv)}, params, "AutoBatch");
+        network = InferenceEngine::CNNNetwork(function);
+        inputName = network.getInputsInfo().begin()->first;
+        outputName = network.getOutputsInfo().begin()->first;
+    }
+
+    static void Fill(const InferenceEngine::Blob::Ptr& blob, float seed) {
+        auto data = InferenceEngine::as<InferenceEngine::MemoryBlob>(blob)->wmap().as<float*>();
+        for (size_t i = 0; i < blob->size(); i++)
+            data[i] = seed + 0.01f * static_cast<float>(i % 101);
+    }
+
+    static std::vector<float> Read(const InferenceEngine::Blob::Ptr& blob) {
+        auto data = InferenceEngine::as<InferenceEngine::MemoryBlob>(blob)->rmap().as<const float*>();
+        return std::vector<float>(data, data + blob->size());
+    }
+
+    InferenceEngine::CNNNetwork network;
+    std::string inputName;
+    std::string outputName;
+};
+
+TEST_P(AutoBatchTest, CompareWithSingleRequests) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    size_t batch, numRequests;
+    bool longTimeout;
+    std::tie(batch, numRequests, longTimeout) = this->GetParam();
+    const int timeout = 60000;
+
+    InferenceEngine::Core core;
+    auto reference = core.LoadNetwork(network, CommonTestUtils::DEVICE_CPU).CreateInferRequest();
+    std::map<std::string, std::string> config = {
+        {AUTO_BATCH_CONFIG_KEY(DEVICE_CONFIG), std::string(CommonTestUtils::DEVICE_CPU) + "(" + std::to_string(batch) + ")"}};
+    if (longTimeout)
+        config[AUTO_BATCH_CONFIG_KEY(TIMEOUT)] = std::to_string(timeout);
+    auto batched = core.LoadNetwork(network, CommonTestUtils::DEVICE_BATCH, config);
+    std::vector<InferenceEngine::InferRequest> requests;
+    for (size_t i = 0; i < numRequests; i++)
+        requests.push_back(batched.CreateInferRequest());
+
+    // the requests are resubmitted with another data, so every one gets another place in the batch
+    for (float seed : {0.f, 1.f, -2.f}) {
+        std::vector<std::vector<float>> expected;
+        for (size_t i = 0; i < numRequests; i++) {
+            const auto itemSeed = seed + static_cast<float>(i);
+            Fill(reference.GetBlob(inputName), itemSeed);
+            reference.Infer();
+            expected.push_back(Read(reference.GetBlob(outputName)));
+            Fill(requests[i].GetBlob(inputName), itemSeed);
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        for (auto&& request : requests)
+            request.StartAsync();
+        for (auto&& request : requests)
+            request.Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY);
+        const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+        // with the long timeout the requests are completed in time only if the batch is collected
+        // or the fallback to the original batch is taken without waiting
+        if (longTimeout) {
+            ASSERT_LT(elapsed, timeout / 2);
+        }
+
+        for (size_t i = 0; i < numRequests; i++) {
+            auto output = Read(requests[i].GetBlob(outputName));
+            ASSERT_EQ(expected[i].size(), output.size());
+            for (size_t j = 0; j < output.size(); j++)
+                ASSERT_NEAR(expected[i][j], output[j], 1e-4f * std::max(1.f, std::abs(expected[i][j])));
+        }
+    }
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_AutoBatch, AutoBatchTest,
+                         ::testing::Values(
+                                 // the requests fill the batch exactly, they can't be completed before the timeout otherwise
+                                 AutoBatchParams{4, 4, true},
+                                 AutoBatchParams{3, 9, true},
+                                 // fewer requests than the batch size, the fallback doesn't wait for the timeout
+                                 AutoBatchParams{4, 2, true},
+                                 // the batches and the remaining requests executed with the original batch
+                                 AutoBatchParams{4, 10, false}),
+                         AutoBatchTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,129 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include <openvino/runtime/core.hpp>
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+using BatchedTensorsParams = std::vector<size_t>;    // input shape
+
+/* The batch items are read from the separate tensors
+ *
+ *      Param [N,C,H,W]
+ *        |
+ *    Convolution     the reorder to the blocked layout reads the items in place, the planar input of
+ *        |           the 3 channels is filled by the copy of the items
+ *      Result
+ */
+class BatchedTensorsTest : public testing::WithParamInterface<BatchedTensorsParams>,
+                           public CommonTestUtils::TestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<BatchedTensorsParams> &obj) {
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(obj.param);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        inputShape = this->GetParam();
+        auto params = builder::makeParams(element::f32, {inputShape});
+        auto conv = builder::makeConvolution(params[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 16);
+        function = std::make_shared<Function>(ResultVector{std::make_shared<op::Result>(conv)}, params, "BatchedTensors");
+    }
+
+    // Fills the items and returns the expected output of the contiguous input
+    std::vector<float> FillItems(ov::runtime::InferRequest& reference, std::vector<ov::runtime::Tensor>& items, float seed) {
+        const auto& inputName = function->get_parameters().front()->get_friendly_name();
+        auto input = reference.get_tensor(inputName);
+        auto inputData = input.data<float>();
+        const size_t itemSize = input.get_size() / items.size();
+        for (size_t i = 0; i < items.size(); i++) {
+            auto itemData = items[i].data<float>();
+            for (size_t j = 0; j < itemSize; j++) {
+                itemData[j] = seed + 0.01f * static_cast<float>((i * 7 + j) % 101);
+                inputData[i * itemSize + j] = itemData[j];
+            }
+        }
+        reference.infer();
+        auto output = reference.get_tensor(function->get_results().front()->input_value(0).get_node()->get_friendly_name());
+        return std::vector<float>(output.data<float>(), output.data<float>() + output.get_size());
+    }
+
+    void Compare(ov::runtime::InferRequest& request, const std::vector<float>& expected) {
+        auto output = request.get_tensor(function->get_results().front()->input_value(0).get_node()->get_friendly_name());
+        ASSERT_EQ(expected.size(), output.get_size());
+        auto outputData = output.data<float>();
+        for (size_t i = 0; i < expected.size(); i++)
+            ASSERT_NEAR(expected[i], outputData[i], 1e-4f * std::max(1.f, std::abs(expected[i])));
+    }
+
+    std::vector<size_t> inputShape;
+    std::shared_ptr<Function> function;
+};
+
+TEST_P(BatchedTensorsTest, CompareWithContiguousInput) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::runtime::Core core;
+    auto network = core.compile_model(function, CommonTestUtils::DEVICE_CPU);
+    auto reference = network.create_infer_request();
+    auto request = network.create_infer_request();
+    const auto& inputName = function->get_parameters().front()->get_friendly_name();
+
+    auto itemShape = inputShape;
+    itemShape[0] = 1;
+    std::vector<ov::runtime::Tensor> items;
+    for (size_t i = 0; i < inputShape[0]; i++)
+        items.emplace_back(element::f32, Shape(itemShape));
+    request.set_tensors(inputName, items);
+    // the items aren't gathered into a contiguous tensor, so it can't be returned
+    ASSERT_THROW(request.get_tensor(inputName), ov::Exception);
+
+    // the items are read at the inference time, so the changed content is used by the next inference
+    for (float seed : {0.f, -1.f}) {
+        auto expected = FillItems(reference, items, seed);
+        request.infer();
+        Compare(request, expected);
+    }
+
+    // the reference request shares the graph, it reads its own input after the batched one
+    auto expected = FillItems(reference, items, 2.f);
+    request.infer();
+    Compare(request, expected);
+    reference.infer();
+    Compare(reference, expected);
+
+    // the count and the shape of the items are validated
+    ASSERT_ANY_THROW(request.set_tensors(inputName, {}));
+    ASSERT_ANY_THROW(request.set_tensors(inputName, std::vector<ov::runtime::Tensor>(items.begin(), items.end() - 1)));
+    ASSERT_ANY_THROW(request.set_tensors(inputName, std::vector<ov::runtime::Tensor>(inputShape[0],
+                                                                                     ov::runtime::Tensor(element::f32, Shape(inputShape)))));
+
+    // the contiguous tensor replaces the items
+    auto contiguous = reference.get_tensor(inputName);
+    request.set_tensor(inputName, contiguous);
+    request.infer();
+    Compare(request, expected);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_BatchedTensors, BatchedTensorsTest,
+                         ::testing::Values(
+                                 BatchedTensorsParams{4, 16, 10, 12},    // the items are reordered to the blocked layout
+                                 BatchedTensorsParams{3, 3, 9, 7}),      // the planar input is filled by the copy
+                         BatchedTensorsTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,173 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "openvino/core/preprocess/pre_post_process.hpp"
+#include <exec_graph_info.hpp>
+
+using namespace ngraph;
+using namespace ov::preprocess;
+
+namespace SubgraphTestsDefinitions {
+
+using ColorConvertFusionParams = std::tuple<
+        std::vector<size_t>,    // network input shape, NCHW
+        ColorFormat,            // source color format
+        ColorFormat,            // RGB or BGR
+        std::vector<size_t>,    // source image height and width, the resize is added if they differ from the network ones
+        ResizeAlgorithm,
+        bool                    // NCHW network input, otherwise NHWC
+>;
+
+/* The color conversion, the resize, the mean and the scale and the layout conversion are done by ColorConvert node
+ *
+ *    Y     UV (or U, V)
+ *     \   /
+ *   NV12toRGB (I420toRGB)
+ *       |
+ *    Convert
+ *       |
+ *    Subtract (per channel)
+ *       |
+ *    Divide (per channel)
+ *       |
+ *   Interpolate
+ *       |
+ *    Transpose
+ *       |
+ *     Result
+ */
+class ColorConvertFusionTest : public testing::WithParamInterface<ColorConvertFusionParams>,
+                               virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ColorConvertFusionParams> &obj) {
+        std::vector<size_t> inputShape, imageSize;
+        ColorFormat srcFormat, dstFormat;
+        ResizeAlgorithm resizeAlg;
+        bool planar;
+        std::tie(inputShape, srcFormat, dstFormat, imageSize, resizeAlg, planar) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "Src=" << static_cast<int>(srcFormat) << "_";
+        result << "Dst=" << (dstFormat == ColorFormat::RGB ? "RGB" : "BGR") << "_";
+        result << "Image=" << CommonTestUtils::vec2str(imageSize) << "_";
+        result << "Resize=" << (resizeAlg == ResizeAlgorithm::RESIZE_NEAREST ? "nearest" : "linear") << "_";
+        result << "Planar=" << planar;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        // the rounding of the color conversion may differ by one, the relative deviation is ignored
+        abs_threshold = 0.05f;
+        threshold = 1.f;
+
+        std::vector<size_t> inputShape, imageSize;
+        ColorFormat srcFormat, dstFormat;
+        ResizeAlgorithm resizeAlg;
+        bool planar;
+        std::tie(inputShape, srcFormat, dstFormat, imageSize, resizeAlg, planar) = this->GetParam();
+
+        if (!planar)
+            inputShape = {inputShape[0], inputShape[2], inputShape[3], inputShape[1]};
+        auto params = builder::makeParams(element::f32, {inputShape});
+        params[0]->set_friendly_name("image");
+        ResultVector results{std::make_shared<op::Result>(params[0])};
+        function = std::make_shared<Function>(results, params, "ColorConvertFusion");
+
+        PreProcessSteps steps;
+        steps.convert_color(dstFormat)
+             .convert_element_type(element::f32)
+             .mean({123.675f, 116.28f, 103.53f})
+             .scale({58.395f, 57.12f, 57.375f});
+        const size_t height = planar ? inputShape[2] : inputShape[1];
+        const size_t width = planar ? inputShape[3] : inputShape[2];
+        InputTensorInfo tensor;
+        tensor.set_element_type(element::u8).set_color_format(srcFormat);
+        if (imageSize[0] != height || imageSize[1] != width) {
+            tensor.set_spatial_static_shape(imageSize[0], imageSize[1]);
+            steps.resize(resizeAlg);
+        }
+        if (planar)
+            steps.convert_layout();
+        function = PrePostProcessor()
+                .input(InputInfo()
+                           .tensor(std::move(tensor))
+                           .preprocess(std::move(steps))
+                           .network(InputNetworkInfo().set_layout(planar ? "NCHW" : "NHWC")))
+                .build(function);
+    }
+
+    InferenceEngine::Blob::Ptr GenerateInput(const InferenceEngine::InputInfo &info) const override {
+        return FuncTestUtils::createAndFillBlob(info.getTensorDesc(), 255, 0, 1);
+    }
+
+    void CheckFusedIntoColorConvert() {
+        InferenceEngine::CNNNetwork execGraphInfo = executableNetwork.GetExecGraphInfo();
+        auto execFunction = execGraphInfo.getFunction();
+        ASSERT_NE(nullptr, execFunction);
+        size_t colorConvertsCount = 0;
+        for (const auto &node : execFunction->get_ops()) {
+            const auto & rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+            IE_ASSERT(rtInfo.end() != it);
+            auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+            IE_ASSERT(nullptr != value);
+            const auto layerType = value->get();
+            ASSERT_NE("Eltwise", layerType);
+            ASSERT_NE("Convert", layerType);
+            ASSERT_NE("Interpolate", layerType);
+            ASSERT_NE("Transpose", layerType);
+            ASSERT_NE("Reference", layerType);
+            if (layerType == "ColorConvert")
+                colorConvertsCount++;
+        }
+        ASSERT_EQ(1, colorConvertsCount);
+    }
+};
+
+TEST_P(ColorConvertFusionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckFusedIntoColorConvert();
+}
+
+namespace {
+
+const std::vector<ColorFormat> srcFormats = {
+        ColorFormat::NV12_SINGLE_PLANE,
+        ColorFormat::NV12_TWO_PLANES,
+        ColorFormat::I420_SINGLE_PLANE,
+        ColorFormat::I420_THREE_PLANES,
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_ColorConvertFusion, ColorConvertFusionTest,
+                         ::testing::Combine(
+                                 ::testing::Values(std::vector<size_t>{2, 3, 10, 38}),   // the tail of the vector
+                                 ::testing::ValuesIn(srcFormats),
+                                 ::testing::Values(ColorFormat::RGB, ColorFormat::BGR),
+                                 ::testing::Values(std::vector<size_t>{10, 38}),
+                                 ::testing::Values(ResizeAlgorithm::RESIZE_LINEAR),
+                                 ::testing::Bool()),
+                         ColorConvertFusionTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_ColorConvertFusion_Resize, ColorConvertFusionTest,
+                         ::testing::Combine(
+                                 ::testing::Values(std::vector<size_t>{1, 3, 24, 32}),
+                                 ::testing::ValuesIn(srcFormats),
+                                 ::testing::Values(ColorFormat::BGR),
+                                 ::testing::Values(std::vector<size_t>{36, 50},     // downscale
+                                                   std::vector<size_t>{16, 20}),    // upscale
+                                 ::testing::Values(ResizeAlgorithm::RESIZE_LINEAR, ResizeAlgorithm::RESIZE_NEAREST),
+                                 ::testing::Bool()),
+                         ColorConvertFusionTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,116 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <sstream>
+
+#include "ngraph_functions/builders.hpp"
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include <ie_core.hpp>
+#include <cpu/cpu_config.hpp>
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+enum class BlobMismatch {
+    None,           // the constants are restored
+    PluginBuild,    // the blob is exported by another build of the plugin
+    Config,         // the network is imported with another precision config
+};
+
+/* The compiled constants (the reordered weights) are restored on import only if the header of the blob matches,
+ * they are computed once again otherwise
+ *
+ *      Param [1,3,16,16]
+ *        |
+ *    Convolution
+ *        |
+ *       Relu
+ *        |
+ *      Result
+ */
+class CompiledBlobImportTest : public testing::WithParamInterface<BlobMismatch>,
+                               public CommonTestUtils::TestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<BlobMismatch> &obj) {
+        switch (obj.param) {
+            case BlobMismatch::None: return "Mismatch=None";
+            case BlobMismatch::PluginBuild: return "Mismatch=PluginBuild";
+            case BlobMismatch::Config: return "Mismatch=Config";
+        }
+        return "";
+    }
+
+protected:
+    void SetUp() override {
+        auto params = builder::makeParams(element::f32, {{1, 3, 16, 16}});
+        auto conv = builder::makeConvolution(params[0], element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                             op::PadType::EXPLICIT, 16);
+        auto relu = std::make_shared<opset1::Relu>(conv);
+        auto function = std::make_shared<Function>(ResultVector{std::make_shared<op::Result>(relu)}, params, "CompiledBlobImport");
+        network = InferenceEngine::CNNNetwork(function);
+        inputName = network.getInputsInfo().begin()->first;
+        outputName = network.getOutputsInfo().begin()->first;
+    }
+
+    std::vector<float> Infer(InferenceEngine::ExecutableNetwork& execNetwork) {
+        auto request = execNetwork.CreateInferRequest();
+        auto input = request.GetBlob(inputName);
+        auto inputData = InferenceEngine::as<InferenceEngine::MemoryBlob>(input)->wmap().as<float*>();
+        for (size_t i = 0; i < input->size(); i++)
+            inputData[i] = 0.01f * static_cast<float>(static_cast<int>(i % 37) - 18);
+        request.Infer();
+        auto output = request.GetBlob(outputName);
+        auto outputData = InferenceEngine::as<InferenceEngine::MemoryBlob>(output)->rmap().as<const float*>();
+        return std::vector<float>(outputData, outputData + output->size());
+    }
+
+    InferenceEngine::CNNNetwork network;
+    std::string inputName;
+    std::string outputName;
+};
+
+TEST_P(CompiledBlobImportTest, CompareWithLoadedNetwork) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const auto mismatch = this->GetParam();
+
+    InferenceEngine::Core core;
+    auto loaded = core.LoadNetwork(network, CommonTestUtils::DEVICE_CPU);
+    const auto expected = Infer(loaded);
+
+    std::stringstream exported;
+    loaded.Export(exported);
+    std::string blob = exported.str();
+    std::map<std::string, std::string> importConfig;
+    if (mismatch == BlobMismatch::PluginBuild) {
+        // the build number is written to the header only, before the network
+        const std::string buildNumber = core.GetVersions(CommonTestUtils::DEVICE_CPU).at(CommonTestUtils::DEVICE_CPU).buildNumber;
+        const auto pos = blob.find(buildNumber);
+        ASSERT_NE(std::string::npos, pos);
+        blob[pos] = blob[pos] == 'x' ? 'y' : 'x';
+    } else if (mismatch == BlobMismatch::Config) {
+        importConfig[InferenceEngine::CPUConfigParams::KEY_CPU_FC_WEIGHTS_COMPRESSION] = "FP16";
+    }
+
+    std::istringstream blobStream(blob);
+    auto imported = core.ImportNetwork(blobStream, CommonTestUtils::DEVICE_CPU, importConfig);
+    const auto actual = Infer(imported);
+
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < actual.size(); i++)
+        ASSERT_NEAR(expected[i], actual[i], 1e-5f * std::max(1.f, std::abs(expected[i])));
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_CompiledBlobImport, CompiledBlobImportTest,
+                         ::testing::Values(BlobMismatch::None, BlobMismatch::PluginBuild, BlobMismatch::Config),
+                         CompiledBlobImportTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,109 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "common_test_utils/test_common.hpp"
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include <openvino/runtime/core.hpp>
+#include <cpu/cpu_config.hpp>
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+using DynamicUpperBoundsParams = std::tuple<
+        std::string,                    // upper bounds of the input, empty if not set
+        std::vector<std::vector<size_t>>    // shapes of the input for the inferences
+>;
+
+/* The upper bounds size the memory of the dynamic tensors only, the bigger inputs are accepted
+ *
+ *      Param [?,16]
+ *        |
+ *     Multiply
+ *        |
+ *       Relu
+ *        |
+ *      Result
+ */
+class DynamicUpperBoundsTest : public testing::WithParamInterface<DynamicUpperBoundsParams>,
+                               public CommonTestUtils::TestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<DynamicUpperBoundsParams> &obj) {
+        std::string bounds;
+        std::vector<std::vector<size_t>> shapes;
+        std::tie(bounds, shapes) = obj.param;
+        std::ostringstream result;
+        result << "WithBounds=" << !bounds.empty() << "_";
+        result << "Shapes=";
+        for (const auto& shape : shapes)
+            result << CommonTestUtils::vec2str(shape);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        auto param = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 16});
+        param->set_friendly_name("input");
+        auto scale = op::v0::Constant::create(element::f32, Shape{}, {2.f});
+        auto relu = std::make_shared<op::v0::Relu>(std::make_shared<op::v1::Multiply>(param, scale));
+        function = std::make_shared<Function>(ResultVector{std::make_shared<op::v0::Result>(relu)}, ParameterVector{param},
+                                              "DynamicUpperBounds");
+    }
+
+    std::shared_ptr<Function> function;
+};
+
+TEST_P(DynamicUpperBoundsTest, InferWithinAndAboveBounds) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    std::string bounds;
+    std::vector<std::vector<size_t>> shapes;
+    std::tie(bounds, shapes) = this->GetParam();
+
+    ov::runtime::Core core;
+    std::map<std::string, std::string> config;
+    if (!bounds.empty())
+        config[InferenceEngine::CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES_UPPER_BOUNDS] = bounds;
+    auto network = core.compile_model(function, CommonTestUtils::DEVICE_CPU, config);
+    auto request = network.create_infer_request();
+    const auto& inputName = function->get_parameters().front()->get_friendly_name();
+    const auto& outputName = function->get_results().front()->input_value(0).get_node()->get_friendly_name();
+
+    for (const auto& shape : shapes) {
+        ov::runtime::Tensor input(element::f32, Shape(shape));
+        auto inputData = input.data<float>();
+        for (size_t i = 0; i < input.get_size(); i++)
+            inputData[i] = static_cast<float>(static_cast<int>(i % 7) - 3);
+        request.set_tensor(inputName, input);
+        ASSERT_NO_THROW(request.infer());
+
+        auto output = request.get_tensor(outputName);
+        ASSERT_EQ(output.get_shape(), Shape(shape));
+        auto outputData = output.data<float>();
+        for (size_t i = 0; i < output.get_size(); i++)
+            ASSERT_EQ(std::max(2.f * inputData[i], 0.f), outputData[i]);
+    }
+}
+
+namespace {
+
+const std::vector<std::vector<size_t>> shapes = {
+        {2, 16},    // within the bound
+        {4, 16},    // equal to the bound
+        {9, 16},    // above the bound, the memory grows
+        {3, 16},    // within the bound again, the grown memory is reused
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_DynamicUpperBounds, DynamicUpperBoundsTest,
+                         ::testing::Combine(
+                                 ::testing::Values("input[4,16]", ""),
+                                 ::testing::Values(shapes)),
+                         DynamicUpperBoundsTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
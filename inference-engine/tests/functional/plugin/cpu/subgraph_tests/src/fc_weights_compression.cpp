@@ -0,0 +1,135 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <cpu/cpu_config.hpp>
+#include <exec_graph_info.hpp>
+#include <functional>
+#include <numeric>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+using FCWeightsCompressionTestParams = std::tuple<SizeVector,   // input shape
+                                                  size_t,       // output size
+                                                  std::string>; // weights compression
+
+/* The weights are kept compressed and decompressed by the FullyConnected node itself if the batch is small,
+ * the bigger batches are executed by the inner product primitive with the weights decompressed once
+ *
+ *    Param   Constant(f16|i8)
+ *       \        |
+ *        \    Convert    Constant(scales)
+ *         \      |      /
+ *          \  [Multiply]
+ *           \    /
+ *       FullyConnected
+ *             |
+ *           Result
+ */
+class FCWeightsCompressionTest : public testing::WithParamInterface<FCWeightsCompressionTestParams>,
+                                 virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<FCWeightsCompressionTestParams> obj) {
+        SizeVector inputShape;
+        size_t outputSize;
+        std::string compression;
+        std::tie(inputShape, outputSize, compression) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "OS=" << outputSize << "_";
+        result << "Compression=" << compression;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        SizeVector inputShape;
+        size_t outputSize;
+        std::string compression;
+        std::tie(inputShape, outputSize, compression) = this->GetParam();
+        configuration.insert({CPUConfigParams::KEY_CPU_FC_WEIGHTS_COMPRESSION, compression});
+        // the quantization error of I8 weights is much bigger than the rounding error of FP16 ones
+        if (compression == "I8")
+            threshold = 0.1f;
+
+        auto inputParams = builder::makeParams(element::f32, {inputShape});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+        auto fc = builder::makeFullyConnected(paramOuts[0], element::f32, outputSize, true, {inputShape.back(), outputSize});
+
+        ResultVector results{std::make_shared<op::Result>(fc)};
+        function = std::make_shared<Function>(results, inputParams, "FCWeightsCompression");
+    }
+
+    // the compressed weights are consumed by the FullyConnected node directly, no FP32 copy is kept in the memory
+    void CheckWeightsPrecision(const std::string& expectedPrecision) {
+        auto execFunction = executableNetwork.GetExecGraphInfo().getFunction();
+        ASSERT_NE(nullptr, execFunction);
+        size_t fcCount = 0;
+        for (const auto &node : execFunction->get_ops()) {
+            auto getExecValue = [](const std::shared_ptr<Node>& node, const std::string & paramName) -> std::string {
+                const auto & rtInfo = node->get_rt_info();
+                auto it = rtInfo.find(paramName);
+                IE_ASSERT(rtInfo.end() != it);
+                auto value = std::dynamic_pointer_cast<VariantImpl<std::string>>(it->second);
+                IE_ASSERT(nullptr != value);
+                return value->get();
+            };
+            if (getExecValue(node, ExecGraphInfoSerialization::LAYER_TYPE) != "FullyConnected")
+                continue;
+            fcCount++;
+            const auto weights = node->get_input_node_shared_ptr(1);
+            ASSERT_EQ(expectedPrecision, getExecValue(weights, ExecGraphInfoSerialization::OUTPUT_PRECISIONS));
+        }
+        ASSERT_EQ(1, fcCount);
+    }
+};
+
+TEST_P(FCWeightsCompressionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    SizeVector inputShape;
+    std::tie(inputShape, std::ignore, std::ignore) = this->GetParam();
+    const auto batch = std::accumulate(inputShape.begin(), inputShape.end() - 1, size_t(1), std::multiplies<size_t>());
+    const bool decompressionFused = batch <= 8;
+    CheckNodeOfTypeCount(executableNetwork, "Convert", decompressionFused ? 0 : 1);
+    CheckWeightsPrecision(decompressionFused ? configuration[CPUConfigParams::KEY_CPU_FC_WEIGHTS_COMPRESSION] : "FP32");
+}
+
+namespace {
+
+const std::vector<SizeVector> inputShapes = {
+    {1, 64},
+    {3, 67},
+    {2, 4, 64},
+    // the batch is too big for the decompression kernel
+    {16, 67},
+    {3, 5, 64},
+};
+
+const std::vector<size_t> outputSizes = {
+    16, 19
+};
+
+const std::vector<std::string> compressions = {
+    "FP16", "I8"
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_FCWeightsCompression, FCWeightsCompressionTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::ValuesIn(outputSizes),
+                                            ::testing::ValuesIn(compressions)),
+                         FCWeightsCompressionTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
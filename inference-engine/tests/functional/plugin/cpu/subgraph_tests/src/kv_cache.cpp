@@ -0,0 +1,169 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <ngraph/opsets/opset3.hpp>
+#include <exec_graph_info.hpp>
+#include <functional>
+#include <numeric>
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+using KVCacheParams = std::tuple<
+        std::vector<size_t>,    // state shape
+        size_t,                 // axis
+        size_t                  // rows appended by an inference
+>;
+
+/* The state is appended by the input in place, the concatenation is the view of the state buffer
+ *
+ *   ReadValue [.., L, ..]   Param [.., N, ..]
+ *              \            /
+ *                  Concat
+ *                 /      \
+ *   StridedSlice [N:]    Multiply (2)
+ *          |               |
+ *        Assign          Result
+ */
+class KVCacheTest : public testing::WithParamInterface<KVCacheParams>,
+                    virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<KVCacheParams> &obj) {
+        std::vector<size_t> stateShape;
+        size_t axis, appended;
+        std::tie(stateShape, axis, appended) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(stateShape) << "_";
+        result << "Axis=" << axis << "_";
+        result << "Appended=" << appended;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        std::vector<size_t> stateShape;
+        std::tie(stateShape, axis, appended) = this->GetParam();
+        auto inputShape = stateShape;
+        inputShape[axis] = appended;
+        outer = std::accumulate(stateShape.begin(), stateShape.begin() + axis, size_t(1), std::multiplies<size_t>());
+        inner = std::accumulate(stateShape.begin() + axis + 1, stateShape.end(), size_t(1), std::multiplies<size_t>());
+        length = stateShape[axis];
+
+        auto params = builder::makeParams(element::f32, {inputShape});
+        auto init = opset1::Constant::create(element::f32, stateShape, {0.f});
+        auto readValue = std::make_shared<opset3::ReadValue>(init, "kv");
+        auto concat = std::make_shared<opset1::Concat>(OutputVector{readValue, params[0]}, axis);
+
+        std::vector<int64_t> begin(stateShape.size(), 0), end(stateShape.size(), 0), mask(stateShape.size(), 1);
+        begin[axis] = appended;
+        end[axis] = length + appended;
+        mask[axis] = 0;
+        auto slice = std::make_shared<opset1::StridedSlice>(concat,
+                                                            opset1::Constant::create(element::i64, Shape{begin.size()}, begin),
+                                                            opset1::Constant::create(element::i64, Shape{end.size()}, end),
+                                                            opset1::Constant::create(element::i64, Shape{begin.size()}, std::vector<int64_t>(begin.size(), 1)),
+                                                            mask, mask);
+        auto assign = std::make_shared<opset3::Assign>(slice, "kv");
+        auto mul = std::make_shared<opset1::Multiply>(concat, opset1::Constant::create(element::f32, Shape{}, {2.f}));
+
+        function = std::make_shared<Function>(ResultVector{std::make_shared<op::Result>(mul)}, SinkVector{assign}, params, "KVCache");
+    }
+
+    void CheckKVCacheNode() {
+        InferenceEngine::CNNNetwork execGraphInfo = executableNetwork.GetExecGraphInfo();
+        auto execFunction = execGraphInfo.getFunction();
+        ASSERT_NE(nullptr, execFunction);
+        size_t kvCacheCount = 0;
+        for (const auto &node : execFunction->get_ops()) {
+            const auto & rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+            IE_ASSERT(rtInfo.end() != it);
+            auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+            IE_ASSERT(nullptr != value);
+            const auto layerType = value->get();
+            ASSERT_NE("MemoryInput", layerType);
+            ASSERT_NE("MemoryOutput", layerType);
+            ASSERT_NE("Concatenation", layerType);
+            if (layerType == "KVCache")
+                kvCacheCount++;
+        }
+        ASSERT_EQ(1, kvCacheCount);
+    }
+
+    // Infers the steps and compares the output with the concatenation of the expected state and the input
+    void InferSteps(InferenceEngine::InferRequest& request, size_t steps, std::vector<float>& expectedState) {
+        const auto inputName = executableNetwork.GetInputsInfo().begin()->first;
+        const auto outputName = executableNetwork.GetOutputsInfo().begin()->first;
+        for (size_t step = 0; step < steps; step++) {
+            auto input = request.GetBlob(inputName);
+            auto inputData = input->buffer().as<float*>();
+            for (size_t i = 0; i < input->size(); i++)
+                inputData[i] = static_cast<float>(step + 1) + 0.001f * static_cast<float>(i);
+
+            request.Infer();
+
+            auto outputData = request.GetBlob(outputName)->cbuffer().as<const float*>();
+            for (size_t o = 0; o < outer; o++) {
+                const float* state = expectedState.data() + o * length * inner;
+                const float* appendedRows = inputData + o * appended * inner;
+                const float* out = outputData + o * (length + appended) * inner;
+                for (size_t i = 0; i < length * inner; i++)
+                    ASSERT_FLOAT_EQ(2.f * state[i], out[i]) << "step " << step;
+                for (size_t i = 0; i < appended * inner; i++)
+                    ASSERT_FLOAT_EQ(2.f * appendedRows[i], out[length * inner + i]) << "step " << step;
+
+                std::vector<float> rows(state + appended * inner, state + length * inner);
+                rows.insert(rows.end(), appendedRows, appendedRows + appended * inner);
+                std::copy(rows.end() - length * inner, rows.end(), expectedState.begin() + o * length * inner);
+            }
+        }
+    }
+
+    size_t axis = 0, appended = 0;
+    size_t outer = 1, inner = 1, length = 0;
+};
+
+TEST_P(KVCacheTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    LoadNetwork();
+    CheckKVCacheNode();
+
+    auto request = executableNetwork.CreateInferRequest();
+    std::vector<float> expectedState(outer * length * inner, 0.f);
+    // more steps than the window has rows, so the window is moved back in the state buffer
+    const size_t steps = 2 * length / appended + 2;
+    InferSteps(request, steps, expectedState);
+
+    auto states = request.QueryState();
+    ASSERT_EQ(1, states.size());
+    auto state = states.front().GetState();
+    auto stateData = state->cbuffer().as<const float*>();
+    ASSERT_EQ(expectedState.size(), state->size());
+    for (size_t i = 0; i < expectedState.size(); i++)
+        ASSERT_FLOAT_EQ(expectedState[i], stateData[i]);
+
+    states.front().Reset();
+    std::fill(expectedState.begin(), expectedState.end(), 0.f);
+    InferSteps(request, 2, expectedState);
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_KVCache, KVCacheTest,
+                         ::testing::Values(
+                                 KVCacheParams{{1, 6, 8}, 1, 2},
+                                 KVCacheParams{{6, 4}, 0, 3},
+                                 KVCacheParams{{2, 5, 4}, 1, 1}),    // the outer axis, the concatenation is copied
+                         KVCacheTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
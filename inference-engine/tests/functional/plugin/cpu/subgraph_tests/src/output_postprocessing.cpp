@@ -0,0 +1,121 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "openvino/core/preprocess/pre_post_process.hpp"
+#include <exec_graph_info.hpp>
+
+using namespace ngraph;
+using namespace ov::preprocess;
+
+namespace SubgraphTestsDefinitions {
+
+using OutputPostprocessingParams = std::tuple<
+        std::vector<size_t>,    // network output shape, NCHW
+        element::Type,          // user output type
+        std::string             // user output layout
+>;
+
+/* The post-processing steps appended to the network output
+ *
+ *      Param
+ *        |
+ *       Relu
+ *        |
+ *     Convert (the user output type)
+ *        |
+ *    Transpose (the user output layout)
+ *        |
+ *      Result
+ *
+ * The CPU plugin has no FP16 memory: the FP16 conversion is turned into FP32 by the transformations and the output
+ * blob is kept FP32, so no Convert node is executed. The layout conversion is done by the single Transpose/Reorder node.
+ */
+class OutputPostprocessingTest : public testing::WithParamInterface<OutputPostprocessingParams>,
+                                 virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<OutputPostprocessingParams> &obj) {
+        std::vector<size_t> outputShape;
+        element::Type outType;
+        std::string layout;
+        std::tie(outputShape, outType, layout) = obj.param;
+
+        std::ostringstream result;
+        result << "OS=" << CommonTestUtils::vec2str(outputShape) << "_";
+        result << "OutType=" << outType << "_";
+        result << "Layout=" << layout;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        std::vector<size_t> outputShape;
+        element::Type outType;
+        std::string layout;
+        std::tie(outputShape, outType, layout) = this->GetParam();
+        if (outType == element::f16)
+            threshold = 0.01f;
+
+        auto params = builder::makeParams(element::f32, {outputShape});
+        auto relu = std::make_shared<opset1::Relu>(params[0]);
+        ResultVector results{std::make_shared<op::Result>(relu)};
+        function = std::make_shared<Function>(results, params, "OutputPostprocessing");
+
+        function = PrePostProcessor()
+                .output(OutputInfo()
+                            .network(OutputNetworkInfo().set_layout("NCHW"))
+                            .tensor(OutputTensorInfo().set_element_type(outType).set_layout(ov::Layout(layout))))
+                .build(function);
+    }
+
+    void CheckExecGraph() {
+        std::string layout;
+        std::tie(std::ignore, std::ignore, layout) = this->GetParam();
+
+        InferenceEngine::CNNNetwork execGraphInfo = executableNetwork.GetExecGraphInfo();
+        auto execFunction = execGraphInfo.getFunction();
+        ASSERT_NE(nullptr, execFunction);
+        size_t layoutConversionsCount = 0;
+        for (const auto &node : execFunction->get_ops()) {
+            auto getExecValue = [](const std::shared_ptr<Node>& node, const std::string & paramName) -> std::string {
+                const auto & rtInfo = node->get_rt_info();
+                auto it = rtInfo.find(paramName);
+                IE_ASSERT(rtInfo.end() != it);
+                auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+                IE_ASSERT(nullptr != value);
+                return value->get();
+            };
+            const auto layerType = getExecValue(node, ExecGraphInfoSerialization::LAYER_TYPE);
+            ASSERT_NE("Convert", layerType);
+            if (layerType == "Transpose" || layerType == "Reorder")
+                layoutConversionsCount++;
+            if (layerType == "Output")
+                ASSERT_EQ("FP32", getExecValue(node->get_input_node_shared_ptr(0), ExecGraphInfoSerialization::OUTPUT_PRECISIONS));
+        }
+        ASSERT_EQ(layout == "NCHW" ? 0 : 1, layoutConversionsCount);
+    }
+};
+
+TEST_P(OutputPostprocessingTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckExecGraph();
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_OutputPostprocessing, OutputPostprocessingTest,
+                         ::testing::Combine(
+                                 ::testing::Values(std::vector<size_t>{1, 16, 24, 40}),
+                                 ::testing::Values(element::f32, element::f16),
+                                 ::testing::Values("NCHW", "NHWC")),
+                         OutputPostprocessingTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,100 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <cpu/cpu_config.hpp>
+#include <ie_parallel.hpp>
+#include <thread>
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+/* Inception-like block, the branches share memory of the intermediate tensors with each other
+ *
+ *                       Param
+ *          /          |          |           \
+ *     Conv1x1     Conv1x1     Conv1x1     MaxPool
+ *        |           |           |           |
+ *      Relu      Conv3x3     Conv3x3     Conv1x1
+ *        |           |           |           |
+ *        |         Relu      Conv3x3       Relu
+ *        |           |           |           |
+ *         \          |         Relu         /
+ *                       Concat
+ *                          |
+ *                        Result
+ *
+ * The scheduler reports the width of the dependency graph and the maximal number of the nodes executed at the same
+ * time in the "ParallelBranches" performance counter. It is created with TBB threading only.
+ */
+class ParallelBranchesTest : public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({InferenceEngine::CPUConfigParams::KEY_CPU_PARALLEL_BRANCHES,
+                              InferenceEngine::PluginConfigParams::YES});
+        configuration.insert({InferenceEngine::PluginConfigParams::KEY_PERF_COUNT, InferenceEngine::PluginConfigParams::YES});
+
+        auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {{1, 16, 20, 20}});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        auto makeConv = [&](const Output<Node>& in, size_t kernel) {
+            const std::vector<ptrdiff_t> pad(2, kernel / 2);
+            return builder::makeConvolution(in, ngPrc, {kernel, kernel}, {1, 1}, pad, pad, {1, 1},
+                                            op::PadType::EXPLICIT, 8, true);
+        };
+        auto makeRelu = [](const Output<Node>& in) {
+            return builder::makeActivation(in, element::f32, helpers::ActivationTypes::Relu);
+        };
+
+        auto branch1 = makeRelu(makeConv(paramOuts[0], 1));
+        auto branch2 = makeRelu(makeConv(makeConv(paramOuts[0], 1), 3));
+        auto branch3 = makeRelu(makeConv(makeConv(makeConv(paramOuts[0], 1), 3), 3));
+        auto pool = builder::makePooling(paramOuts[0], {1, 1}, {1, 1}, {1, 1}, {3, 3}, op::RoundingType::FLOOR,
+                                         op::PadType::EXPLICIT, false, helpers::PoolingTypes::MAX);
+        auto branch4 = makeRelu(makeConv(pool, 1));
+
+        auto concat = builder::makeConcat({branch1, branch2, branch3, branch4}, 1);
+
+        ResultVector results{std::make_shared<op::Result>(concat)};
+        function = std::make_shared<Function>(results, inputParams, "ParallelBranches");
+    }
+
+    // exec_type is "parallelism_<ratio>_width_<width>_concurrency_<concurrency>"
+    static size_t getCounterValue(const std::string& execType, const std::string& name) {
+        const auto pos = execType.find("_" + name + "_");
+        IE_ASSERT(pos != std::string::npos);
+        return std::stoul(execType.substr(pos + name.size() + 2));
+    }
+
+    void CheckConcurrency() {
+        const auto perfMap = inferRequest.GetPerformanceCounts();
+        const auto it = perfMap.find("ParallelBranches");
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+        ASSERT_NE(perfMap.end(), it);
+        ASSERT_EQ(InferenceEngine::InferenceEngineProfileInfo::EXECUTED, it->second.status);
+        const std::string execType = it->second.exec_type;
+        // the first nodes of the four branches at least, the reorders may be added to them
+        ASSERT_GE(getCounterValue(execType, "width"), 4);
+        const auto concurrency = getCounterValue(execType, "concurrency");
+        ASSERT_GE(concurrency, 1);
+        if (std::thread::hardware_concurrency() > 1)
+            ASSERT_GT(concurrency, 1) << execType;
+#else
+        ASSERT_EQ(perfMap.end(), it);
+#endif
+    }
+};
+
+TEST_F(ParallelBranchesTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckConcurrency();
+}
+
+} // namespace SubgraphTestsDefinitions
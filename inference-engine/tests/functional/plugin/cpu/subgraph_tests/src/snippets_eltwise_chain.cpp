@@ -0,0 +1,99 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <sstream>
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <cpu/cpu_config.hpp>
+#include <exec_graph_info.hpp>
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+/* The eltwise chain with the inputs broadcast along the different axes is fused into one JIT compiled subgraph,
+ * the last operation feeds the result, so it stays out of the subgraph
+ *
+ *  Param0 [1,16,10,20]   Param1 [1,16,1,20]
+ *             \         /        |
+ *                Add             |
+ *                 |   Param2 [1,1,10,1]
+ *                 |   /          |
+ *             Multiply           |
+ *                 |              |
+ *              Sigmoid           |
+ *                 |             /
+ *              Subtract --------
+ *                 |
+ *               Relu
+ *                 |
+ *               Result
+ */
+class SnippetsEltwiseChainTest : public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({InferenceEngine::CPUConfigParams::KEY_CPU_SNIPPETS,
+                              InferenceEngine::PluginConfigParams::YES});
+
+        auto inputParams = builder::makeParams(element::f32, {{1, 16, 10, 20}, {1, 16, 1, 20}, {1, 1, 10, 1}});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        auto add = std::make_shared<opset1::Add>(paramOuts[0], paramOuts[1]);
+        auto mul = std::make_shared<opset1::Multiply>(add, paramOuts[2]);
+        auto sigmoid = std::make_shared<opset1::Sigmoid>(mul);
+        auto sub = std::make_shared<opset1::Subtract>(sigmoid, paramOuts[1]);
+        auto relu = std::make_shared<opset1::Relu>(sub);
+
+        ResultVector results{std::make_shared<op::Result>(relu)};
+        function = std::make_shared<Function>(results, inputParams, "SnippetsEltwiseChain");
+    }
+
+    void CheckFusedOpsCount(size_t expectedFusedOpsCount) {
+        InferenceEngine::CNNNetwork execGraphInfo = executableNetwork.GetExecGraphInfo();
+        auto execFunction = execGraphInfo.getFunction();
+        ASSERT_NE(nullptr, execFunction);
+        size_t subgraphsCount = 0;
+        for (const auto &node : execFunction->get_ops()) {
+            const auto & rtInfo = node->get_rt_info();
+            auto getExecValue = [&rtInfo](const std::string & paramName) -> std::string {
+                auto it = rtInfo.find(paramName);
+                IE_ASSERT(rtInfo.end() != it);
+                auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+                IE_ASSERT(nullptr != value);
+                return value->get();
+            };
+            if (getExecValue(ExecGraphInfoSerialization::LAYER_TYPE) == "Subgraph") {
+                subgraphsCount++;
+                ASSERT_EQ(std::to_string(expectedFusedOpsCount), getExecValue(ExecGraphInfoSerialization::FUSED_OPS_COUNT));
+            }
+        }
+        ASSERT_EQ(1, subgraphsCount);
+    }
+};
+
+TEST_F(SnippetsEltwiseChainTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckFusedOpsCount(4);
+}
+
+// The network is exported without the snippets and tokenized once again on import
+TEST_F(SnippetsEltwiseChainTest, smoke_ExportImport) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    std::stringstream exported;
+    executableNetwork.Export(exported);
+    executableNetwork = core->ImportNetwork(exported, targetDevice, configuration);
+    CheckFusedOpsCount(4);
+
+    Infer();
+    Validate();
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,272 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <exec_graph_info.hpp>
+#include <ie_system_conf.h>
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+using TransposeFusionParams = std::tuple<
+        std::vector<size_t>,    // input shape
+        std::vector<int64_t>,   // transpose order
+        element::Type,          // input type
+        bool,                   // with the scale and the shift
+        element::Type,          // output type, the conversion is added if it differs from the input type
+        bool                    // whether the permutation can be executed by the tiles
+>;
+
+/* The scale and the shift and the conversion are applied by the transpose on the fly if the permutation is
+ * executed by the tiles, the nodes stay separate otherwise
+ *
+ *      Param
+ *        |
+ *    Transpose
+ *        |
+ *     Multiply (scalar)
+ *        |
+ *       Add (scalar)
+ *        |
+ *     Convert
+ *        |
+ *      Result
+ */
+class TransposeFusionTest : public testing::WithParamInterface<TransposeFusionParams>,
+                            virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<TransposeFusionParams> &obj) {
+        std::vector<size_t> inputShape;
+        std::vector<int64_t> order;
+        element::Type inType, outType;
+        bool withScaleShift, tileable;
+        std::tie(inputShape, order, inType, withScaleShift, outType, tileable) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        result << "Order=" << CommonTestUtils::vec2str(order) << "_";
+        result << "InType=" << inType << "_";
+        result << "ScaleShift=" << withScaleShift << "_";
+        result << "OutType=" << outType;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        std::vector<size_t> inputShape;
+        std::vector<int64_t> order;
+        element::Type inType, outType;
+        bool withScaleShift, tileable;
+        std::tie(inputShape, order, inType, withScaleShift, outType, tileable) = this->GetParam();
+        inPrc = InferenceEngine::details::convertPrecision(inType);
+        outPrc = InferenceEngine::details::convertPrecision(outType);
+        // the tiles of BF16 are supported on AVX-512 only
+        expectFusion = tileable && InferenceEngine::with_cpu_x86_avx2() &&
+                       (outType != element::bf16 || InferenceEngine::with_cpu_x86_avx512_core());
+
+        auto params = builder::makeParams(inType, {inputShape});
+        auto orderConst = opset1::Constant::create(element::i64, Shape{order.size()}, order);
+        std::shared_ptr<Node> last = std::make_shared<opset1::Transpose>(params[0], orderConst);
+        last->set_friendly_name("transpose");
+        if (withScaleShift) {
+            last = std::make_shared<opset1::Multiply>(last, opset1::Constant::create(element::f32, Shape{}, {0.5f}));
+            last->set_friendly_name("scale");
+            last = std::make_shared<opset1::Add>(last, opset1::Constant::create(element::f32, Shape{}, {-1.f}));
+            last->set_friendly_name("shift");
+        }
+        if (outType != inType) {
+            last = std::make_shared<opset1::Convert>(last, outType);
+            last->set_friendly_name("convert");
+        }
+
+        ResultVector results{std::make_shared<op::Result>(last)};
+        function = std::make_shared<Function>(results, params, "TransposeFusion");
+    }
+
+    void CheckFusion() {
+        InferenceEngine::CNNNetwork execGraphInfo = executableNetwork.GetExecGraphInfo();
+        auto execFunction = execGraphInfo.getFunction();
+        ASSERT_NE(nullptr, execFunction);
+        size_t transposesCount = 0;
+        for (const auto &node : execFunction->get_ops()) {
+            const auto & rtInfo = node->get_rt_info();
+            auto getExecValue = [&rtInfo](const std::string & paramName) -> std::string {
+                auto it = rtInfo.find(paramName);
+                IE_ASSERT(rtInfo.end() != it);
+                auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+                IE_ASSERT(nullptr != value);
+                return value->get();
+            };
+            if (getExecValue(ExecGraphInfoSerialization::LAYER_TYPE) != "Transpose")
+                continue;
+            transposesCount++;
+            // the names of the fused nodes are listed by the transpose
+            const auto originalNames = getExecValue(ExecGraphInfoSerialization::ORIGINAL_NAMES);
+            const bool fused = originalNames.find("scale") != std::string::npos ||
+                               originalNames.find("convert") != std::string::npos;
+            ASSERT_EQ(expectFusion, fused) << "The transpose layer names: " << originalNames;
+        }
+        ASSERT_EQ(1, transposesCount);
+    }
+
+    bool expectFusion = false;
+};
+
+TEST_P(TransposeFusionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckFusion();
+}
+
+using TransposeReorderParams = std::tuple<
+        std::vector<size_t>,    // input shape
+        bool                    // whether the planar <-> channels last reorders can be executed by the tiles
+>;
+
+/* The reorders to the channels last layout and back are executed by the permute kernel if the shape fits the tiles
+ *
+ *      Param (nchw)
+ *        |
+ *     Reorder
+ *        |
+ *       Relu (nhwc)
+ *        |
+ *     Reorder
+ *        |
+ *      Result (nchw)
+ */
+class TransposeReorderTest : public testing::WithParamInterface<TransposeReorderParams>,
+                             virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<TransposeReorderParams> &obj) {
+        std::vector<size_t> inputShape;
+        bool tileable;
+        std::tie(inputShape, tileable) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::vec2str(inputShape);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        std::vector<size_t> inputShape;
+        std::tie(inputShape, tileable) = this->GetParam();
+
+        auto params = builder::makeParams(element::f32, {inputShape});
+        auto relu = std::make_shared<opset1::Relu>(params[0]);
+        relu->get_rt_info() = CPUTestUtils::CPUTestsBase::makeCPUInfo({CPUTestUtils::nhwc}, {CPUTestUtils::nhwc}, {});
+
+        ResultVector results{std::make_shared<op::Result>(relu)};
+        function = std::make_shared<Function>(results, params, "TransposeReorder");
+    }
+
+    void CheckReorders() {
+        InferenceEngine::CNNNetwork execGraphInfo = executableNetwork.GetExecGraphInfo();
+        auto execFunction = execGraphInfo.getFunction();
+        ASSERT_NE(nullptr, execFunction);
+        const std::string expectedType = InferenceEngine::with_cpu_x86_avx512f() ? "jit_avx512" : "jit_avx2";
+        size_t reordersCount = 0;
+        for (const auto &node : execFunction->get_ops()) {
+            const auto & rtInfo = node->get_rt_info();
+            auto getExecValue = [&rtInfo](const std::string & paramName) -> std::string {
+                auto it = rtInfo.find(paramName);
+                IE_ASSERT(rtInfo.end() != it);
+                auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+                IE_ASSERT(nullptr != value);
+                return value->get();
+            };
+            if (getExecValue(ExecGraphInfoSerialization::LAYER_TYPE) != "Reorder")
+                continue;
+            reordersCount++;
+            // the other implementations are reported by the oneDNN reorder names
+            const auto primitiveType = getExecValue(ExecGraphInfoSerialization::IMPL_TYPE);
+            if (tileable && InferenceEngine::with_cpu_x86_avx2()) {
+                ASSERT_EQ(expectedType, primitiveType);
+            } else {
+                ASSERT_NE(expectedType, primitiveType);
+            }
+        }
+        ASSERT_EQ(2, reordersCount);
+    }
+
+    bool tileable = false;
+};
+
+TEST_P(TransposeReorderTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    CheckReorders();
+}
+
+namespace {
+
+const std::vector<std::vector<size_t>> inputShapes = {
+        {1, 32, 24, 40},
+        {2, 19, 35, 17},    // the tails of the tiles
+};
+
+const std::vector<std::vector<int64_t>> orders = {
+        {0, 1, 3, 2},
+        {0, 2, 3, 1},
+        {0, 3, 1, 2},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_TransposeFusion, TransposeFusionTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(inputShapes),
+                                 ::testing::ValuesIn(orders),
+                                 ::testing::Values(element::f32),
+                                 ::testing::Values(true),
+                                 ::testing::Values(element::f32, element::bf16),
+                                 ::testing::Values(true)),
+                         TransposeFusionTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_TransposeFusion_Convert, TransposeFusionTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(inputShapes),
+                                 ::testing::ValuesIn(orders),
+                                 ::testing::Values(element::f32, element::u8),
+                                 ::testing::Values(false),
+                                 ::testing::Values(element::bf16),
+                                 ::testing::Values(true)),
+                         TransposeFusionTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_TransposeFusion_U8, TransposeFusionTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(inputShapes),
+                                 ::testing::Values(std::vector<int64_t>{0, 2, 3, 1}),
+                                 ::testing::Values(element::u8),
+                                 ::testing::Values(false),
+                                 ::testing::Values(element::f32),
+                                 ::testing::Values(true)),
+                         TransposeFusionTest::getTestCaseName);
+
+// the innermost axis is kept, or the panels are smaller than a tile: the nodes aren't fused
+INSTANTIATE_TEST_SUITE_P(smoke_TransposeFusion_NotTiled, TransposeFusionTest,
+                         ::testing::Values(
+                                 TransposeFusionParams{{1, 32, 24, 40}, {0, 2, 1, 3}, element::f32, true, element::f32, false},
+                                 TransposeFusionParams{{1, 32, 24, 40}, {0, 2, 1, 3}, element::f32, false, element::bf16, false},
+                                 TransposeFusionParams{{1, 6, 5, 7}, {0, 2, 3, 1}, element::f32, true, element::f32, false},
+                                 TransposeFusionParams{{1, 6, 5, 7}, {0, 3, 1, 2}, element::u8, false, element::f32, false}),
+                         TransposeFusionTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_TransposeReorder, TransposeReorderTest,
+                         ::testing::Values(
+                                 TransposeReorderParams{{1, 32, 24, 40}, true},
+                                 TransposeReorderParams{{2, 19, 35, 17}, true},
+                                 TransposeReorderParams{{1, 6, 5, 7}, false}),
+                         TransposeReorderTest::getTestCaseName);
+
+} // namespace
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,15 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "shared_test_classes/single_layer/convert_color_i420.hpp"
+
+namespace LayerTestsDefinitions {
+
+TEST_P(ConvertColorI420LayerTest, CompareWithRefs) {
+    Run();
+};
+
+} // namespace LayerTestsDefinitions
\ No newline at end of file
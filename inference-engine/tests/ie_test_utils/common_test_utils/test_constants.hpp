@@ -16,6 +16,7 @@ const char DEVICE_KEEMBAY[] = "VPUX";
 const char DEVICE_MULTI[] = "MULTI";
 const char DEVICE_TEMPLATE[] = "TEMPLATE";
 const char DEVICE_HETERO[] = "HETERO";
+const char DEVICE_BATCH[] = "BATCH";
 
 const char REPORT_FILENAME[] = "report";
 const char REPORT_EXTENSION[] = ".xml";
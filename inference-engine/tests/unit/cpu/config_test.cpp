@@ -0,0 +1,37 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "config.h"
+#include "cpu/cpu_config.hpp"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+TEST(ConfigTest, DynamicShapesUpperBounds) {
+    Config config;
+    ASSERT_TRUE(config.inputsUpperBounds.empty());
+
+    const std::string value = "data[1,3,64,64],mask[1,64]";
+    config.readProperties({{CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES_UPPER_BOUNDS, value}});
+    ASSERT_EQ(config.inputsUpperBounds.size(), 2u);
+    ASSERT_EQ(config.inputsUpperBounds.at("data"), (std::vector<size_t>{1, 3, 64, 64}));
+    ASSERT_EQ(config.inputsUpperBounds.at("mask"), (std::vector<size_t>{1, 64}));
+
+    config.updateProperties();
+    ASSERT_EQ(config._config.at(CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES_UPPER_BOUNDS), value);
+
+    // the empty value resets the bounds
+    config.readProperties({{CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES_UPPER_BOUNDS, ""}});
+    ASSERT_TRUE(config.inputsUpperBounds.empty());
+}
+
+TEST(ConfigTest, DynamicShapesUpperBoundsWrongFormat) {
+    for (const auto& value : {"data", "data[1,x]", "[1,2]", "data1,2]", "data[1,2]mask[1]", "data[1,-2]",
+                              "data[1,99999999999999999999999]"}) {
+        Config config;
+        ASSERT_THROW(config.readProperties({{CPUConfigParams::KEY_CPU_DYNAMIC_SHAPES_UPPER_BOUNDS, value}}), Exception) << value;
+    }
+}
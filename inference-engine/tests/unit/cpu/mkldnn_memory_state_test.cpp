@@ -0,0 +1,139 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "mkldnn_memory_state.h"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+// The state [outer, window, inner] appended by 2 rows per inference, the window is moved back in the buffer of
+// 2 * window + 2 rows by the 5th append
+constexpr size_t outer = 2;
+constexpr size_t window = 6;
+constexpr size_t inner = 3;
+constexpr size_t appended = 2;
+}  // namespace
+
+class KVCacheStateTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        state = std::make_shared<MKLDNNVariableStateKVCache>("kv", TensorDesc(Precision::FP32, {outer, window, inner}, Layout::CHW),
+                                                             1, appended);
+        expected.assign(outer * window * inner, 0.f);
+    }
+
+    // Appends the rows, checks the concatenation and slides the window over the rows as the KVCache node does
+    void Step() {
+        std::vector<float> rows(outer * appended * inner);
+        for (size_t i = 0; i < rows.size(); i++)
+            rows[i] = static_cast<float>(++counter);
+        state->append(rows.data());
+
+        std::vector<float> concatenation(outer * (window + appended) * inner);
+        state->copyConcatenation(concatenation.data());
+        for (size_t o = 0; o < outer; o++) {
+            std::vector<float> reference(expected.begin() + o * window * inner, expected.begin() + (o + 1) * window * inner);
+            reference.insert(reference.end(), rows.begin() + o * appended * inner, rows.begin() + (o + 1) * appended * inner);
+            ASSERT_TRUE(std::equal(reference.begin(), reference.end(), concatenation.begin() + o * reference.size()))
+                << "append " << counter;
+            std::copy(reference.end() - window * inner, reference.end(), expected.begin() + o * window * inner);
+        }
+        state->commit();
+        stored = std::min(stored + appended, window);
+    }
+
+    // The first `length` stored rows become the tail of the window
+    void ExpectTrim(size_t length) {
+        state->Trim(length);
+        if (length >= stored)
+            return;
+        for (size_t o = 0; o < outer; o++) {
+            auto begin = expected.begin() + o * window * inner;
+            std::vector<float> kept(begin + (window - stored) * inner, begin + (window - stored + length) * inner);
+            std::fill(begin, begin + (window - length) * inner, 0.f);
+            std::copy(kept.begin(), kept.end(), begin + (window - length) * inner);
+        }
+        stored = length;
+    }
+
+    void CheckState() {
+        auto blob = state->GetState();
+        ASSERT_EQ(expected.size(), blob->size());
+        auto data = blob->cbuffer().as<const float*>();
+        ASSERT_TRUE(std::equal(expected.begin(), expected.end(), data));
+    }
+
+    std::shared_ptr<MKLDNNVariableStateKVCache> state;
+    std::vector<float> expected;
+    size_t stored = 0;
+    size_t counter = 0;
+};
+
+TEST_F(KVCacheStateTest, TrimWithinBuffer) {
+    Step();
+    Step();
+    // the window is moved back over the dropped rows, nothing is copied
+    ExpectTrim(1);
+    CheckState();
+}
+
+TEST_F(KVCacheStateTest, TrimLongerThanStoredKeepsState) {
+    Step();
+    ExpectTrim(appended);
+    CheckState();
+    ExpectTrim(window);
+    CheckState();
+}
+
+TEST_F(KVCacheStateTest, TrimMovesRowsAfterSetState) {
+    std::vector<float> values(outer * window * inner);
+    for (size_t i = 0; i < values.size(); i++)
+        values[i] = static_cast<float>(i + 1);
+    state->SetState(make_shared_blob<float>(TensorDesc(Precision::FP32, {outer, window, inner}, Layout::CHW), values.data()));
+    expected = values;
+    stored = window;
+    CheckState();
+
+    // the window starts at the beginning of the buffer, so the kept rows are moved to its tail
+    ExpectTrim(2);
+    CheckState();
+}
+
+TEST_F(KVCacheStateTest, TrimAfterWrapAround) {
+    // the 5th append moves the window back to the beginning of the buffer
+    for (size_t i = 0; i < 5; i++)
+        Step();
+    CheckState();
+
+    // more rows are dropped than the window is moved from the beginning of the buffer
+    ExpectTrim(3);
+    CheckState();
+}
+
+TEST_F(KVCacheStateTest, AppendAfterTrim) {
+    for (size_t i = 0; i < 5; i++)
+        Step();
+    ExpectTrim(3);
+    // the trimmed state grows again and wraps around once more
+    for (size_t i = 0; i < 6; i++) {
+        Step();
+        CheckState();
+    }
+
+    ExpectTrim(1);
+    for (size_t i = 0; i < 2; i++)
+        Step();
+    CheckState();
+
+    state->Reset();
+    std::fill(expected.begin(), expected.end(), 0.f);
+    stored = 0;
+    Step();
+    CheckState();
+}
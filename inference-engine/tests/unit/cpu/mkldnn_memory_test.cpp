@@ -3,9 +3,11 @@
 //
 
 #include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include "mkldnn_memory.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
 
 using namespace MKLDNNPlugin;
 using namespace InferenceEngine;
@@ -17,3 +19,55 @@ TEST(MemoryTest, SedDataCheck) {
 TEST(MemoryTest, SedDataWithAutoPadCheck) {
     GTEST_SKIP();
 }
+
+TEST(MemoryTest, RedefineDescReusesOwnedStorage) {
+    const mkldnn::engine eng(mkldnn::engine::kind::cpu, 0);
+    MKLDNNMemory memory(eng);
+    memory.Create(std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape(SizeVector{4, 3})));
+    auto data = memory.GetData();
+
+    // the storage is big enough for a smaller tensor
+    memory.redefineDesc(std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape(SizeVector{2, 3})));
+    ASSERT_EQ(memory.GetData(), data);
+    ASSERT_EQ(memory.getStaticDims(), (SizeVector{2, 3}));
+
+    // and for the original one
+    memory.redefineDesc(std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape(SizeVector{4, 3})));
+    ASSERT_EQ(memory.GetData(), data);
+
+    // a bigger tensor requires new storage
+    memory.redefineDesc(std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape(SizeVector{8, 3})));
+    ASSERT_EQ(memory.getStaticDims(), (SizeVector{8, 3}));
+    ASSERT_NE(memory.GetData(), nullptr);
+}
+
+TEST(MemoryTest, BindStorageForUndefinedDesc) {
+    const mkldnn::engine eng(mkldnn::engine::kind::cpu, 0);
+    MKLDNNMemory memory(eng);
+    memory.Create(std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape(ngraph::PartialShape{-1, 3})));
+    std::vector<float> storage(8 * 3);
+    memory.bindStorage(storage.data(), storage.size() * sizeof(float));
+    ASSERT_EQ(memory.GetData(), storage.data());
+
+    // the tensors within the bound use the storage
+    memory.redefineDesc(std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape(SizeVector{2, 3})));
+    ASSERT_EQ(memory.GetData(), storage.data());
+    memory.redefineDesc(std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape(SizeVector{8, 3})));
+    ASSERT_EQ(memory.GetData(), storage.data());
+    ASSERT_EQ(memory.getStaticDims(), (SizeVector{8, 3}));
+
+    // a bigger tensor is moved to the owned storage instead of failing
+    memory.redefineDesc(std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape(SizeVector{16, 3})));
+    ASSERT_EQ(memory.getStaticDims(), (SizeVector{16, 3}));
+    ASSERT_NE(memory.GetData(), nullptr);
+    ASSERT_NE(memory.GetData(), storage.data());
+    static_cast<float*>(memory.GetData())[16 * 3 - 1] = 1.f;
+
+    // the owned storage is reused for the smaller tensors
+    const auto data = memory.GetData();
+    memory.redefineDesc(std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape(SizeVector{4, 3})));
+    ASSERT_EQ(memory.GetData(), data);
+
+    // the memory with defined descriptor has its own storage
+    ASSERT_ANY_THROW(memory.bindStorage(storage.data(), storage.size() * sizeof(float)));
+}
@@ -0,0 +1,122 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <sstream>
+#include <gtest/gtest.h>
+
+#include "mkldnn_serialize.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+
+namespace {
+const std::string pluginVersion = "2021.4.0-1234";
+
+// the header is read back the same way ImportNetwork does
+CompiledBlobHeader exportAndRead(const CompiledBlobHeader& exported) {
+    std::stringstream stream;
+    stream.write(reinterpret_cast<const char*>(&exported), sizeof(exported));
+    CompiledBlobHeader imported(Config(), "");
+    stream.read(reinterpret_cast<char*>(&imported), sizeof(imported));
+    return imported;
+}
+}  // namespace
+
+TEST(CompiledBlobHeaderTest, SameConfigAndBuildIsCompatible) {
+    Config config;
+    const auto imported = exportAndRead(CompiledBlobHeader(config, pluginVersion));
+    ASSERT_TRUE(imported.isCompiledBlob());
+    ASSERT_TRUE(imported.isCompatible(CompiledBlobHeader(config, pluginVersion)));
+}
+
+TEST(CompiledBlobHeaderTest, OtherBuildIsNotCompatible) {
+    Config config;
+    const auto imported = exportAndRead(CompiledBlobHeader(config, pluginVersion));
+    ASSERT_FALSE(imported.isCompatible(CompiledBlobHeader(config, "2021.4.0-1235")));
+    ASSERT_FALSE(imported.isCompatible(CompiledBlobHeader(config, "")));
+    // the unknown build of the exporter never matches
+    ASSERT_FALSE(exportAndRead(CompiledBlobHeader(config, "")).isCompatible(CompiledBlobHeader(config, pluginVersion)));
+}
+
+TEST(CompiledBlobHeaderTest, OtherPrecisionConfigIsNotCompatible) {
+    Config config;
+    const auto imported = exportAndRead(CompiledBlobHeader(config, pluginVersion));
+
+    auto bf16 = config;
+    bf16.enforceBF16 = !config.enforceBF16;
+    ASSERT_FALSE(imported.isCompatible(CompiledBlobHeader(bf16, pluginVersion)));
+
+    auto lpt = config;
+    lpt.lpTransformsMode = config.lpTransformsMode == Config::LPTransformsMode::On ? Config::LPTransformsMode::Off
+                                                                                  : Config::LPTransformsMode::On;
+    ASSERT_FALSE(imported.isCompatible(CompiledBlobHeader(lpt, pluginVersion)));
+
+    auto compression = config;
+    compression.fcWeightsCompression = Precision::FP16;
+    ASSERT_FALSE(imported.isCompatible(CompiledBlobHeader(compression, pluginVersion)));
+}
+
+TEST(CompiledBlobHeaderTest, OtherFormatIsNotCompatible) {
+    Config config;
+    CompiledBlobHeader header(config, pluginVersion);
+
+    auto otherVersion = header;
+    otherVersion.version++;
+    ASSERT_FALSE(exportAndRead(otherVersion).isCompatible(header));
+
+    auto otherIsa = header;
+    otherIsa.isa++;
+    ASSERT_FALSE(exportAndRead(otherIsa).isCompatible(header));
+
+    // the blobs of the previous versions start with the network
+    auto noMagic = header;
+    noMagic.magic[0] = 0;
+    ASSERT_FALSE(exportAndRead(noMagic).isCompiledBlob());
+    ASSERT_FALSE(exportAndRead(noMagic).isCompatible(header));
+}
+
+TEST(CompiledBlobHeaderTest, LongPluginVersionIsTruncated) {
+    Config config;
+    const std::string longVersion(100, 'x');
+    CompiledBlobHeader header(config, longVersion);
+    ASSERT_EQ(0, header.pluginVersion[sizeof(header.pluginVersion) - 1]);
+    ASSERT_TRUE(exportAndRead(header).isCompatible(CompiledBlobHeader(config, longVersion)));
+}
+
+TEST(CompiledBlobHeaderTest, DescriptorDependsOnLayout) {
+    const Shape shape(SizeVector{1, 8, 4, 4});
+    CpuBlockedMemoryDesc planar(Precision::FP32, shape);
+    CpuBlockedMemoryDesc nspc(Precision::FP32, shape, {1, 4, 4, 8}, {0, 2, 3, 1});
+    CpuBlockedMemoryDesc blocked(Precision::FP32, shape, {1, 1, 4, 4, 8}, {0, 1, 2, 3, 1});
+    CpuBlockedMemoryDesc bf16(Precision::BF16, shape);
+    CpuBlockedMemoryDesc otherShape(Precision::FP32, Shape(SizeVector{1, 4, 8, 4}));
+
+    const auto desc = CompiledBlobHeader::describe(planar);
+    ASSERT_EQ(desc, CompiledBlobHeader::describe(CpuBlockedMemoryDesc(Precision::FP32, shape)));
+    ASSERT_NE(desc, CompiledBlobHeader::describe(nspc));
+    ASSERT_NE(desc, CompiledBlobHeader::describe(blocked));
+    ASSERT_NE(desc, CompiledBlobHeader::describe(bf16));
+    ASSERT_NE(desc, CompiledBlobHeader::describe(otherShape));
+}
+
+TEST(CompiledConstantsDeserializerTest, TruncatedConstantsAreRejected) {
+    std::stringstream stream;
+    auto writeSize = [&](uint64_t size) {
+        stream.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    };
+    auto writeString = [&](const std::string& str) {
+        writeSize(str.size());
+        stream.write(str.data(), str.size());
+    };
+    writeSize(1);
+    writeString("weights->conv");
+    writeString("FP32:abcd:{1,8,4,4}");
+    writeSize(128);
+    stream.write(std::string(64, 'x').data(), 64);
+
+    CompiledConstants constants;
+    CompiledConstantsDeserializer deserializer(stream);
+    ASSERT_ANY_THROW(deserializer >> constants);
+}
@@ -0,0 +1,180 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <vector>
+#include <gtest/gtest.h>
+#include <openvino/util/file_util.hpp>
+
+#ifdef _WIN32
+# include <direct.h>
+#else
+# include <unistd.h>
+#endif
+
+#include "mkldnn_weights_cache.hpp"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+const std::string storageDir = "shared_weights_storage_test";
+}  // namespace
+
+class SharedWeightsStorageTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        info.digest = {0x1234, 0x5678};
+        info.precision = InferenceEngine::Precision::FP32;
+        info.layout = "aBcd16b{32,3,3,3}";
+        info.size = 64;
+    }
+
+    void TearDown() override {
+        ov::util::iterate_files(storageDir, [](const std::string& file, bool isDir) {
+            if (!isDir)
+                std::remove(file.c_str());
+        });
+#ifdef _WIN32
+        _rmdir(storageDir.c_str());
+#else
+        rmdir(storageDir.c_str());
+#endif
+    }
+
+    static std::vector<std::string> listFiles() {
+        std::vector<std::string> files;
+        ov::util::iterate_files(storageDir, [&](const std::string& file, bool isDir) {
+            if (!isDir)
+                files.push_back(file);
+        });
+        return files;
+    }
+
+    MKLDNNSharedWeightsStorage::DataInfo info;
+};
+
+TEST_F(SharedWeightsStorageTests, PublishedDataIsFoundByAnotherStorage) {
+    std::vector<float> data(16);
+    for (size_t i = 0; i < data.size(); i++)
+        data[i] = static_cast<float>(i);
+
+    MKLDNNSharedWeightsStorage publisher(storageDir, 0);
+    ASSERT_EQ(nullptr, publisher.find(info));
+    auto published = publisher.publish(info, data.data());
+    ASSERT_NE(nullptr, published);
+    ASSERT_NE(static_cast<const void*>(data.data()), published.get());
+    // the data is aligned in the mapped file
+    ASSERT_EQ(0u, reinterpret_cast<uintptr_t>(published.get()) % 64);
+
+    // another process is emulated by a separate storage
+    MKLDNNSharedWeightsStorage consumer(storageDir, 0);
+    auto mapped = consumer.find(info);
+    ASSERT_NE(nullptr, mapped);
+    ASSERT_EQ(0, std::memcmp(data.data(), mapped.get(), info.size));
+    // the data of other NUMA node isn't found
+    ASSERT_EQ(nullptr, MKLDNNSharedWeightsStorage(storageDir, 1).find(info));
+}
+
+TEST_F(SharedWeightsStorageTests, DataOfOtherDescriptionIsNotFound) {
+    std::vector<char> data(info.size, 1);
+    ASSERT_NE(nullptr, MKLDNNSharedWeightsStorage(storageDir, 0).publish(info, data.data()));
+
+    // the file name is defined by the digest only, so the other fields are checked by the header
+    auto otherSize = info;
+    otherSize.size /= 2;
+    ASSERT_EQ(nullptr, MKLDNNSharedWeightsStorage(storageDir, 0).find(otherSize));
+    auto otherPrecision = info;
+    otherPrecision.precision = InferenceEngine::Precision::I32;
+    ASSERT_EQ(nullptr, MKLDNNSharedWeightsStorage(storageDir, 0).find(otherPrecision));
+    auto otherLayout = info;
+    otherLayout.layout = "aBcd8b{32,3,3,3}";
+    ASSERT_EQ(nullptr, MKLDNNSharedWeightsStorage(storageDir, 0).find(otherLayout));
+    auto otherDigest = info;
+    otherDigest.digest[1]++;
+    ASSERT_EQ(nullptr, MKLDNNSharedWeightsStorage(storageDir, 0).find(otherDigest));
+
+    ASSERT_NE(nullptr, MKLDNNSharedWeightsStorage(storageDir, 0).find(info));
+}
+
+TEST_F(SharedWeightsStorageTests, CorruptedFileIsNotUsed) {
+    std::vector<char> data(info.size, 1);
+    ASSERT_NE(nullptr, MKLDNNSharedWeightsStorage(storageDir, 0).publish(info, data.data()));
+    const auto files = listFiles();
+    ASSERT_EQ(1u, files.size());
+
+    // the magic of the header is broken
+    {
+        std::fstream file(files.front(), std::ios::binary | std::ios::in | std::ios::out);
+        file.write("XXXX", 4);
+    }
+    ASSERT_EQ(nullptr, MKLDNNSharedWeightsStorage(storageDir, 0).find(info));
+
+    // the truncated file
+    {
+        std::ofstream file(files.front(), std::ios::binary | std::ios::trunc);
+        file.write(data.data(), 16);
+    }
+    ASSERT_EQ(nullptr, MKLDNNSharedWeightsStorage(storageDir, 0).find(info));
+
+    // the broken file is replaced by the next publisher
+    std::vector<char> newData(info.size, 2);
+    MKLDNNSharedWeightsStorage storage(storageDir, 0);
+    auto mapped = storage.publish(info, newData.data());
+    ASSERT_NE(nullptr, mapped);
+    ASSERT_EQ(0, std::memcmp(newData.data(), mapped.get(), info.size));
+}
+
+TEST_F(SharedWeightsStorageTests, FirstPublishedDataIsKept) {
+    std::vector<char> first(info.size, 1), second(info.size, 2);
+
+    MKLDNNSharedWeightsStorage(storageDir, 0).publish(info, first.data());
+    MKLDNNSharedWeightsStorage storage(storageDir, 0);
+    auto mapped = storage.publish(info, second.data());
+    ASSERT_NE(nullptr, mapped);
+    ASSERT_EQ(0, std::memcmp(first.data(), mapped.get(), info.size));
+}
+
+TEST_F(SharedWeightsStorageTests, MappingIsOwnedByItsUsers) {
+    std::vector<char> data(info.size, 1);
+    MKLDNNSharedWeightsStorage storage(storageDir, 0);
+    auto published = storage.publish(info, data.data());
+    ASSERT_NE(nullptr, published);
+
+    // the users of the same file share one mapping, the storage doesn't own it
+    auto mapped = storage.find(info);
+    ASSERT_EQ(published.get(), mapped.get());
+    ASSERT_EQ(2, mapped.use_count());
+
+    // the file is unmapped once the users are released and is mapped again on the next request
+    std::weak_ptr<const void> mapping = mapped;
+    published.reset();
+    mapped.reset();
+    ASSERT_TRUE(mapping.expired());
+    mapped = storage.find(info);
+    ASSERT_NE(nullptr, mapped);
+    ASSERT_EQ(0, std::memcmp(data.data(), mapped.get(), info.size));
+}
+
+TEST_F(SharedWeightsStorageTests, DirectoryIsLimited) {
+    std::vector<char> data(info.size, 1);
+    MKLDNNSharedWeightsStorage storage(storageDir, 0);
+    uint64_t fileSize = 0;
+    for (uint64_t i = 0; i < 4; i++) {
+        auto next = info;
+        next.digest[0] = i;
+        // the mapped data stays valid after the file is evicted
+        auto mapped = storage.publish(next, data.data(), 2 * (fileSize ? fileSize : 1024));
+        ASSERT_NE(nullptr, mapped);
+        ASSERT_EQ(0, std::memcmp(data.data(), mapped.get(), info.size));
+        if (!fileSize) {
+            std::ifstream file(listFiles().front(), std::ios::binary | std::ios::ate);
+            fileSize = static_cast<uint64_t>(file.tellg());
+        }
+    }
+    ASSERT_EQ(2u, listFiles().size());
+}
@@ -0,0 +1,159 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <memory>
+#include <gtest/gtest.h>
+
+#include "cache/lru_cache.h"
+#include "cache/multi_cache.h"
+
+using namespace MKLDNNPlugin;
+
+namespace {
+struct IntKey {
+    size_t hash() const {
+        return std::hash<int>().operator()(data);
+    }
+    bool operator==(const IntKey& rhs) const noexcept {
+        return this->data == rhs.data;
+    }
+
+    int data;
+};
+
+struct StringKey {
+    size_t hash() const {
+        return std::hash<std::string>().operator()(data);
+    }
+    bool operator==(const StringKey& rhs) const noexcept {
+        return this->data == rhs.data;
+    }
+
+    std::string data;
+};
+}  // namespace
+
+TEST(LruCacheTests, Evict) {
+    constexpr size_t capacity = 10;
+    LruCache<IntKey, int> cache(capacity);
+    for (size_t i = 0; i < 2 * capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({static_cast<int>(i)}, static_cast<int>(i) * 2));
+    }
+    ASSERT_EQ(cache.size(), capacity);
+    for (size_t i = 0; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({static_cast<int>(i)}), 0);
+    }
+    for (size_t i = capacity; i < 2 * capacity; ++i) {
+        ASSERT_EQ(cache.get({static_cast<int>(i)}), static_cast<int>(i) * 2);
+    }
+}
+
+TEST(LruCacheTests, Put) {
+    constexpr size_t capacity = 10;
+    LruCache<IntKey, int> cache(capacity);
+    for (size_t i = 0; i < capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({static_cast<int>(i)}, 10));
+    }
+    ASSERT_NO_THROW(cache.put({1}, 42));
+    ASSERT_EQ(cache.size(), capacity);
+    ASSERT_EQ(cache.get({1}), 42);
+}
+
+TEST(LruCacheTests, Touch) {
+    constexpr size_t capacity = 3;
+    LruCache<IntKey, int> cache(capacity);
+    cache.put({1}, 1);
+    cache.put({2}, 2);
+    cache.put({3}, 3);
+
+    // key 1 becomes the most recently used one, so key 2 has to be evicted
+    ASSERT_EQ(cache.get({1}), 1);
+    cache.put({4}, 4);
+    ASSERT_EQ(cache.get({2}), 0);
+    ASSERT_EQ(cache.get({1}), 1);
+    ASSERT_EQ(cache.get({3}), 3);
+    ASSERT_EQ(cache.get({4}), 4);
+}
+
+TEST(LruCacheTests, SetCapacity) {
+    constexpr size_t capacity = 10;
+    LruCache<IntKey, int> cache(capacity);
+    for (size_t i = 0; i < capacity; ++i) {
+        cache.put({static_cast<int>(i)}, static_cast<int>(i) + 1);
+    }
+    cache.setCapacity(capacity / 2);
+    ASSERT_EQ(cache.size(), capacity / 2);
+    for (size_t i = capacity / 2; i < capacity; ++i) {
+        ASSERT_EQ(cache.get({static_cast<int>(i)}), static_cast<int>(i) + 1);
+    }
+}
+
+TEST(LruCacheTests, ZeroCapacity) {
+    LruCache<IntKey, int> cache(0);
+    ASSERT_NO_THROW(cache.put({1}, 1));
+    ASSERT_EQ(cache.size(), 0);
+    ASSERT_EQ(cache.get({1}), 0);
+}
+
+TEST(MultiCacheTests, GetOrCreate) {
+    MultiCache cache(10);
+    int buildCount = 0;
+    auto intBuilder = [&buildCount](const IntKey& key) {
+        ++buildCount;
+        return std::make_shared<int>(key.data * 2);
+    };
+    auto strBuilder = [&buildCount](const StringKey& key) {
+        ++buildCount;
+        return std::make_shared<std::string>(key.data + key.data);
+    };
+
+    auto intResult = cache.getOrCreate(IntKey{21}, intBuilder);
+    ASSERT_EQ(*intResult.first, 42);
+    ASSERT_EQ(intResult.second, CacheEntryBase::LookUpStatus::Miss);
+
+    intResult = cache.getOrCreate(IntKey{21}, intBuilder);
+    ASSERT_EQ(*intResult.first, 42);
+    ASSERT_EQ(intResult.second, CacheEntryBase::LookUpStatus::Hit);
+
+    // different key types are stored in different entries
+    auto strResult = cache.getOrCreate(StringKey{"ab"}, strBuilder);
+    ASSERT_EQ(*strResult.first, "abab");
+    ASSERT_EQ(strResult.second, CacheEntryBase::LookUpStatus::Miss);
+
+    ASSERT_EQ(buildCount, 2);
+    ASSERT_EQ(cache.getHitsCount(), 1);
+    ASSERT_EQ(cache.getMissesCount(), 2);
+}
+
+TEST(MultiCacheTests, Disabled) {
+    MultiCache cache(0);
+    int buildCount = 0;
+    auto builder = [&buildCount](const IntKey& key) {
+        ++buildCount;
+        return std::make_shared<int>(key.data);
+    };
+
+    for (int i = 0; i < 3; ++i) {
+        auto result = cache.getOrCreate(IntKey{1}, builder);
+        ASSERT_EQ(*result.first, 1);
+        ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Miss);
+    }
+    ASSERT_EQ(buildCount, 3);
+}
+
+TEST(MultiCacheTests, SetCapacity) {
+    MultiCache cache(2);
+    auto builder = [](const IntKey& key) {
+        return std::make_shared<int>(key.data);
+    };
+
+    cache.getOrCreate(IntKey{1}, builder);
+    cache.getOrCreate(IntKey{2}, builder);
+    cache.setCapacity(1);
+    ASSERT_EQ(cache.getCapacity(), 1);
+
+    // key 1 is the least recently used, so it must be evicted
+    ASSERT_EQ(cache.getOrCreate(IntKey{2}, builder).second, CacheEntryBase::LookUpStatus::Hit);
+    ASSERT_EQ(cache.getOrCreate(IntKey{1}, builder).second, CacheEntryBase::LookUpStatus::Miss);
+}
@@ -7,8 +7,10 @@
 #include <openvino/op/convolution.hpp>
 #include <openvino/op/parameter.hpp>
 #include <convolution_shape_inference.hpp>
+#include <reshape_shape_inference.hpp>
 #include <openvino/op/ops.hpp>
 #include "utils/shape_inference/static_shape.hpp"
+#include "utils/shape_inference/shape_inference.hpp"
 
 using namespace ov;
 
@@ -40,6 +42,254 @@ TEST(StaticShapeInferenceTest, ConvolutionTest) {
     ASSERT_EQ(conv->get_pads_end(), (CoordinateDiff{1, 1}));
 }
 
+namespace {
+std::vector<StaticShape> static_infer(const std::shared_ptr<Node>& op,
+                                      const std::vector<StaticShape>& input_shapes,
+                                      const IStaticShapeInfer::DataGetter& get_data = {}) {
+    auto shape_inference = make_shape_inference(op);
+    EXPECT_NE(nullptr, shape_inference);
+    std::vector<StaticShape> output_shapes(op->get_output_size(), StaticShape{});
+    EXPECT_TRUE(shape_inference->infer(input_shapes, output_shapes, get_data));
+    return output_shapes;
+}
+}  // namespace
+
+TEST(StaticShapeInferenceTest, EltwiseNumpyBroadcastTest) {
+    auto a = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(4));
+    auto b = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(2));
+    auto add = std::make_shared<op::v1::Add>(a, b);
+
+    auto output_shapes = static_infer(add, {StaticShape{2, 1, 5, 1}, StaticShape{1, 3}});
+    ASSERT_EQ(output_shapes[0], StaticShape({2, 1, 5, 3}));
+
+    output_shapes = static_infer(add, {StaticShape{3, 1}, StaticShape{4, 1, 5}});
+    ASSERT_EQ(output_shapes[0], StaticShape({4, 3, 5}));
+
+    auto shape_inference = make_shape_inference(add);
+    std::vector<StaticShape> out = {StaticShape{}};
+    ASSERT_THROW(shape_inference->infer({StaticShape{2, 3}, StaticShape{4, 3}}, out, {}), NodeValidationFailure);
+}
+
+TEST(StaticShapeInferenceTest, ReshapeTest) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(4));
+    auto pattern = op::v0::Constant::create(element::i64, Shape{3}, {0, -1, 4});
+    auto reshape = std::make_shared<op::v1::Reshape>(data, pattern, true);
+
+    auto output_shapes = static_infer(reshape, {StaticShape{2, 3, 4, 4}, StaticShape{3}});
+    ASSERT_EQ(output_shapes[0], StaticShape({2, 12, 4}));
+}
+
+TEST(StaticShapeInferenceTest, ReshapeRuntimePatternTest) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(2));
+    auto pattern = std::make_shared<op::v0::Parameter>(element::i32, PartialShape{2});
+    auto reshape = std::make_shared<op::v1::Reshape>(data, pattern, false);
+
+    auto shape_inference = make_shape_inference(reshape);
+    ASSERT_EQ(shape_inference->get_data_ports(), std::vector<size_t>{1});
+
+    std::vector<StaticShape> output_shapes = {StaticShape{}};
+    // the pattern values are unknown
+    ASSERT_FALSE(shape_inference->infer({StaticShape{6, 4}, StaticShape{2}}, output_shapes, {}));
+
+    const auto get_data = [](size_t port, std::vector<int64_t>& values) {
+        values = {3, -1};
+        return port == 1;
+    };
+    ASSERT_TRUE(shape_inference->infer({StaticShape{6, 4}, StaticShape{2}}, output_shapes, get_data));
+    ASSERT_EQ(output_shapes[0], StaticShape({3, 8}));
+}
+
+TEST(StaticShapeInferenceTest, ConcatTest) {
+    auto a = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(3));
+    auto b = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(3));
+    auto concat = std::make_shared<op::v0::Concat>(OutputVector{a, b}, -2);
+
+    auto output_shapes = static_infer(concat, {StaticShape{2, 3, 4}, StaticShape{2, 5, 4}});
+    ASSERT_EQ(output_shapes[0], StaticShape({2, 8, 4}));
+}
+
+TEST(StaticShapeInferenceTest, MatMulTest) {
+    auto a = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(3));
+    auto b = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(4));
+    auto matmul = std::make_shared<op::v0::MatMul>(a, b, false, true);
+
+    auto output_shapes = static_infer(matmul, {StaticShape{5, 2, 3}, StaticShape{4, 1, 7, 3}});
+    ASSERT_EQ(output_shapes[0], StaticShape({4, 5, 2, 7}));
+
+    auto c = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(1));
+    auto matmul_1d = std::make_shared<op::v0::MatMul>(a, c);
+    output_shapes = static_infer(matmul_1d, {StaticShape{5, 2, 3}, StaticShape{3}});
+    ASSERT_EQ(output_shapes[0], StaticShape({5, 2}));
+}
+
+TEST(StaticShapeInferenceTest, MaxPoolTest) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(4));
+    auto pool = std::make_shared<op::v1::MaxPool>(data,
+                                                  Strides{2, 2},
+                                                  Shape{0, 0},
+                                                  Shape{0, 0},
+                                                  Shape{3, 3},
+                                                  op::RoundingType::CEIL,
+                                                  op::PadType::EXPLICIT);
+
+    auto output_shapes = static_infer(pool, {StaticShape{1, 16, 10, 11}});
+    ASSERT_EQ(output_shapes[0], StaticShape({1, 16, 5, 5}));
+}
+
+TEST(StaticShapeInferenceTest, AvgPoolSameUpperTest) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(4));
+    auto pool = std::make_shared<op::v1::AvgPool>(data,
+                                                  Strides{2, 2},
+                                                  Shape{0, 0},
+                                                  Shape{0, 0},
+                                                  Shape{3, 3},
+                                                  true,
+                                                  op::RoundingType::FLOOR,
+                                                  op::PadType::SAME_UPPER);
+
+    auto output_shapes = static_infer(pool, {StaticShape{1, 16, 10, 11}});
+    ASSERT_EQ(output_shapes[0], StaticShape({1, 16, 5, 6}));
+}
+
+TEST(StaticShapeInferenceTest, GatherTest) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(3));
+    auto indices = std::make_shared<op::v0::Parameter>(element::i32, PartialShape::dynamic(2));
+    auto axis = op::v0::Constant::create(element::i64, Shape{}, {-1});
+    auto gather = std::make_shared<op::v8::Gather>(data, indices, axis, 1);
+
+    auto output_shapes = static_infer(gather, {StaticShape{2, 3, 4}, StaticShape{2, 5}, StaticShape{}});
+    ASSERT_EQ(output_shapes[0], StaticShape({2, 3, 5}));
+}
+
+TEST(StaticShapeInferenceTest, TransposeTest) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(3));
+    auto order = op::v0::Constant::create(element::i64, Shape{3}, {2, 0, 1});
+    auto transpose = std::make_shared<op::v1::Transpose>(data, order);
+
+    auto output_shapes = static_infer(transpose, {StaticShape{2, 3, 4}, StaticShape{3}});
+    ASSERT_EQ(output_shapes[0], StaticShape({4, 2, 3}));
+}
+
+TEST(StaticShapeInferenceTest, StridedSliceTest) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(3));
+    auto begin = op::v0::Constant::create(element::i64, Shape{3}, {0, 1, -1});
+    auto end = op::v0::Constant::create(element::i64, Shape{3}, {0, 0, 0});
+    auto strides = op::v0::Constant::create(element::i64, Shape{3}, {1, 2, -1});
+    auto slice = std::make_shared<op::v1::StridedSlice>(data,
+                                                        begin,
+                                                        end,
+                                                        strides,
+                                                        std::vector<int64_t>{0, 0, 0},
+                                                        std::vector<int64_t>{1, 1, 1});
+
+    auto output_shapes = static_infer(slice, {StaticShape{2, 7, 4}, StaticShape{3}, StaticShape{3}, StaticShape{3}});
+    ASSERT_EQ(output_shapes[0], StaticShape({2, 3, 4}));
+
+    // the strides default to ones, the new axis is inserted and the shrunk one is removed
+    auto slice_no_strides = std::make_shared<op::v1::StridedSlice>(data,
+                                                                   begin,
+                                                                   end,
+                                                                   std::vector<int64_t>{1, 0, 0},
+                                                                   std::vector<int64_t>{1, 0, 1},
+                                                                   std::vector<int64_t>{0, 1, 0},
+                                                                   std::vector<int64_t>{0, 0, 1});
+    output_shapes = static_infer(slice_no_strides, {StaticShape{2, 7, 4}, StaticShape{3}, StaticShape{3}});
+    ASSERT_EQ(output_shapes[0], StaticShape({2, 1, 4}));
+}
+
+TEST(StaticShapeInferenceTest, ReduceTest) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(4));
+    auto axes = op::v0::Constant::create(element::i64, Shape{2}, {1, -1});
+
+    auto reduce_keep = std::make_shared<op::v1::ReduceMean>(data, axes, true);
+    auto output_shapes = static_infer(reduce_keep, {StaticShape{2, 3, 4, 5}, StaticShape{2}});
+    ASSERT_EQ(output_shapes[0], StaticShape({2, 1, 4, 1}));
+
+    auto bool_data = std::make_shared<op::v0::Parameter>(element::boolean, PartialShape::dynamic(4));
+    auto reduce = std::make_shared<op::v1::ReduceLogicalOr>(bool_data, axes, false);
+    output_shapes = static_infer(reduce, {StaticShape{2, 3, 4, 5}, StaticShape{2}});
+    ASSERT_EQ(output_shapes[0], StaticShape({2, 4}));
+}
+
+TEST(StaticShapeInferenceTest, ReshapeTemplateTest) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(4));
+    auto pattern = std::make_shared<op::v0::Parameter>(element::i64, PartialShape{2});
+    auto reshape = std::make_shared<op::v1::Reshape>(data, pattern, true);
+    const op::ShapeInferData values = {{1, {0, -1}}};
+
+    std::vector<StaticShape> static_output_shapes = {StaticShape{}};
+    op::v1::shape_infer(reshape.get(), std::vector<StaticShape>{{2, 3, 4, 4}, {2}}, static_output_shapes, values);
+    ASSERT_EQ(static_output_shapes[0], StaticShape({2, 48}));
+
+    ASSERT_THROW(op::v1::shape_infer(reshape.get(), std::vector<StaticShape>{{2, 3, 4, 4}, {2}}, static_output_shapes, {}),
+                 NodeValidationFailure);
+}
+
+TEST(StaticShapeInferenceTest, BroadcastRuntimeTargetTest) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(2));
+    auto target = std::make_shared<op::v0::Parameter>(element::i32, PartialShape{3});
+    std::vector<int64_t> target_values;
+    const auto get_data = [&](size_t port, std::vector<int64_t>& values) {
+        values = target_values;
+        return port == 1;
+    };
+
+    auto numpy = std::make_shared<op::v3::Broadcast>(data, target);
+    auto shape_inference = make_shape_inference(numpy);
+    ASSERT_EQ(shape_inference->get_data_ports(), std::vector<size_t>{1});
+    std::vector<StaticShape> output_shapes = {StaticShape{}};
+    // the output shape follows the target values for the same input shapes
+    target_values = {2, 3, 4};
+    ASSERT_TRUE(shape_inference->infer({StaticShape{1, 4}, StaticShape{3}}, output_shapes, get_data));
+    ASSERT_EQ(output_shapes[0], StaticShape({2, 3, 4}));
+    target_values = {5, 2, 4};
+    ASSERT_TRUE(shape_inference->infer({StaticShape{1, 4}, StaticShape{3}}, output_shapes, get_data));
+    ASSERT_EQ(output_shapes[0], StaticShape({5, 2, 4}));
+    target_values = {5, 2, 3};
+    ASSERT_THROW(shape_inference->infer({StaticShape{1, 4}, StaticShape{3}}, output_shapes, get_data),
+                 NodeValidationFailure);
+
+    auto bidirectional = std::make_shared<op::v3::Broadcast>(data, target, op::BroadcastType::BIDIRECTIONAL);
+    target_values = {2, 3, 1};
+    output_shapes = static_infer(bidirectional, {StaticShape{1, 4}, StaticShape{3}}, get_data);
+    ASSERT_EQ(output_shapes[0], StaticShape({2, 3, 4}));
+
+    auto axes_mapping = op::v0::Constant::create(element::i64, Shape{2}, {0, 2});
+    auto explicit_broadcast = std::make_shared<op::v3::Broadcast>(data, target, axes_mapping, op::BroadcastType::EXPLICIT);
+    target_values = {2, 3, 4};
+    output_shapes = static_infer(explicit_broadcast, {StaticShape{2, 1}, StaticShape{3}, StaticShape{2}}, get_data);
+    ASSERT_EQ(output_shapes[0], StaticShape({2, 3, 4}));
+
+    auto pdpd = std::make_shared<op::v3::Broadcast>(data, target, op::BroadcastModeSpec(op::BroadcastType::PDPD, 1));
+    ASSERT_EQ(nullptr, make_shape_inference(pdpd));
+}
+
+TEST(StaticShapeInferenceTest, TileRuntimeRepeatsTest) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(3));
+    auto repeats = std::make_shared<op::v0::Parameter>(element::i64, PartialShape{2});
+    auto tile = std::make_shared<op::v0::Tile>(data, repeats);
+    std::vector<int64_t> repeats_values;
+    const auto get_data = [&](size_t port, std::vector<int64_t>& values) {
+        values = repeats_values;
+        return port == 1;
+    };
+
+    repeats_values = {2, 3};
+    auto output_shapes = static_infer(tile, {StaticShape{2, 3, 4}, StaticShape{2}}, get_data);
+    ASSERT_EQ(output_shapes[0], StaticShape({2, 6, 12}));
+
+    repeats_values = {2, 1, 1, 3};
+    output_shapes = static_infer(tile, {StaticShape{2, 3, 4}, StaticShape{4}}, get_data);
+    ASSERT_EQ(output_shapes[0], StaticShape({2, 2, 3, 12}));
+}
+
+TEST(StaticShapeInferenceTest, UnsupportedOpTest) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic(4));
+    auto shape_of = std::make_shared<op::v3::ShapeOf>(data);
+
+    ASSERT_EQ(nullptr, make_shape_inference(shape_of));
+}
+
 #if 0
 TEST(StaticShapeInferenceTest, ConvolutionTimeTest) {
     Strides strides{1, 1};
@@ -82,4 +332,4 @@ TEST(StaticShapeInferenceTest, ConvolutionTimeTest) {
     std::cout << (convolution_time_sum >= other_op_time_sum ? "ON PAR WITH CONVOLUTION: " : "LONGER THAN CONVOLUTION ")
               << 1. * other_op_time_sum / convolution_time_sum << std::endl;
 }
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,231 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ie_cache_manager.hpp"
+
+#include "common_test_utils/file_utils.hpp"
+
+using namespace InferenceEngine;
+using namespace ::testing;
+
+class FileStorageCacheManagerTests : public Test {
+public:
+    std::string m_cacheDir;
+
+    void SetUp() override {
+        auto testInfo = UnitTest::GetInstance()->current_test_info();
+        std::stringstream ss;
+        ss << "testCache_" << testInfo->name() << "_" << std::this_thread::get_id() << "_"
+           << std::chrono::steady_clock::now().time_since_epoch().count();
+        m_cacheDir = ss.str();
+        CommonTestUtils::createDirectory(m_cacheDir);
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(m_cacheDir, "blob");
+        CommonTestUtils::removeFilesWithExt(m_cacheDir, "tmp");
+        CommonTestUtils::removeFilesWithExt(m_cacheDir, "lock");
+        CommonTestUtils::removeDir(m_cacheDir);
+    }
+
+    std::shared_ptr<FileStorageCacheManager> createManager(uint64_t maxSize = 0) {
+        return std::make_shared<FileStorageCacheManager>(std::string(m_cacheDir), maxSize);
+    }
+
+    static void write(ICacheManager& manager, const std::string& id, const std::string& content) {
+        manager.writeCacheEntry(id, [&](std::ostream& stream) {
+            stream << content;
+        });
+    }
+
+    // Returns the content of the entry, empty if the reader is not called
+    static std::string read(ICacheManager& manager, const std::string& id) {
+        std::string content;
+        manager.readCacheEntry(id, [&](std::istream& stream) {
+            content.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+        });
+        return content;
+    }
+
+    std::string blobFile(const std::string& id) const {
+        return m_cacheDir + CommonTestUtils::FileSeparator + id + ".blob";
+    }
+};
+
+TEST_F(FileStorageCacheManagerTests, WriteRead) {
+    auto manager = createManager();
+    write(*manager, "entry", "compiled network");
+    ASSERT_EQ("compiled network", read(*manager, "entry"));
+    ASSERT_EQ("", read(*manager, "missing"));
+
+    auto statistics = manager->getStatistics();
+    ASSERT_EQ(1, statistics.hits);
+    ASSERT_EQ(1, statistics.misses);
+    ASSERT_EQ(0, statistics.evictions);
+    // the temporary file is renamed
+    ASSERT_EQ(1, CommonTestUtils::listFilesWithExt(m_cacheDir, "blob").size());
+    ASSERT_TRUE(CommonTestUtils::listFilesWithExt(m_cacheDir, "tmp").empty());
+}
+
+TEST_F(FileStorageCacheManagerTests, SeekInWriter) {
+    auto manager = createManager();
+    ICacheManager& cache = *manager;
+    cache.writeCacheEntry("entry", [&](std::ostream& stream) {
+        auto start = stream.tellp();
+        stream << "xxxx network";
+        stream.seekp(start);
+        stream << "good";
+        stream.seekp(0, std::ios::end);
+    });
+    ASSERT_EQ("good network", read(*manager, "entry"));
+}
+
+TEST_F(FileStorageCacheManagerTests, FailedWriter) {
+    auto manager = createManager();
+    ICacheManager& cache = *manager;
+    ASSERT_ANY_THROW(cache.writeCacheEntry("entry", [&](std::ostream& stream) {
+        stream << "partial";
+        throw std::runtime_error("export failed");
+    }));
+    ASSERT_TRUE(CommonTestUtils::listFilesWithExt(m_cacheDir, "blob").empty());
+    ASSERT_TRUE(CommonTestUtils::listFilesWithExt(m_cacheDir, "tmp").empty());
+}
+
+TEST_F(FileStorageCacheManagerTests, CorruptedEntry) {
+    auto manager = createManager();
+    write(*manager, "entry", "compiled network");
+    {
+        std::fstream stream(blobFile("entry"), std::ios::binary | std::ios::in | std::ios::out);
+        stream.seekp(-1, std::ios::end);
+        stream.put('X');
+    }
+    // the checksum is checked after the reader
+    ASSERT_ANY_THROW(read(*manager, "entry"));
+    ASSERT_FALSE(CommonTestUtils::fileExists(blobFile("entry")));
+    ASSERT_EQ(1, manager->getStatistics().misses);
+}
+
+TEST_F(FileStorageCacheManagerTests, CorruptedEntryNotReadToEnd) {
+    auto manager = createManager();
+    write(*manager, "entry", "compiled network");
+    {
+        std::fstream stream(blobFile("entry"), std::ios::binary | std::ios::in | std::ios::out);
+        stream.seekp(-1, std::ios::end);
+        stream.put('X');
+    }
+    ICacheManager& cache = *manager;
+    ASSERT_ANY_THROW(cache.readCacheEntry("entry", [&](std::istream& stream) {
+        char header[8];
+        stream.read(header, sizeof(header));
+    }));
+    ASSERT_FALSE(CommonTestUtils::fileExists(blobFile("entry")));
+}
+
+TEST_F(FileStorageCacheManagerTests, SeekInReader) {
+    // larger than the buffer of the reader, so the seeks leave it
+    std::string content(3 * 1024 * 1024 + 17, 'a');
+    for (size_t i = 0; i < content.size(); i++)
+        content[i] = static_cast<char>('a' + i % 26);
+    auto manager = createManager();
+    write(*manager, "entry", content);
+
+    ICacheManager& cache = *manager;
+    std::string tail, all;
+    std::streamoff size = 0;
+    cache.readCacheEntry("entry", [&](std::istream& stream) {
+        const auto start = stream.tellg();
+        // the size is taken as some plugins do, then the end is read before the beginning
+        stream.seekg(0, std::ios::end);
+        size = stream.tellg() - start;
+        stream.seekg(-1000, std::ios::end);
+        tail.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+        stream.clear();
+        stream.seekg(start);
+        all.resize(static_cast<size_t>(size));
+        stream.read(&all[0], size);
+    });
+    ASSERT_EQ(static_cast<std::streamoff>(content.size()), size);
+    ASSERT_EQ(content.substr(content.size() - 1000), tail);
+    ASSERT_EQ(content, all);
+    ASSERT_EQ(1, manager->getStatistics().hits);
+}
+
+TEST_F(FileStorageCacheManagerTests, TruncatedEntry) {
+    auto manager = createManager();
+    write(*manager, "entry", "compiled network");
+    std::string content;
+    {
+        std::ifstream stream(blobFile("entry"), std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    }
+    {
+        std::ofstream stream(blobFile("entry"), std::ios::binary);
+        stream << content.substr(0, content.size() - 4);
+    }
+    ASSERT_EQ("", read(*manager, "entry"));
+
+    // the entry written without the header
+    {
+        std::ofstream stream(blobFile("legacy"), std::ios::binary);
+        stream << "compiled network without header";
+    }
+    ASSERT_EQ("", read(*manager, "legacy"));
+    ASSERT_EQ(2, manager->getStatistics().misses);
+}
+
+TEST_F(FileStorageCacheManagerTests, EvictLeastRecentlyUsed) {
+    const std::string content(1000, 'a');
+    // the entries and the headers fit twice
+    auto manager = createManager(2 * 1100);
+    write(*manager, "first", content);
+    // the modification time of some file systems has the resolution of a second
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    write(*manager, "second", content);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+    ASSERT_EQ(content, read(*manager, "first"));
+
+    write(*manager, "third", content);
+    ASSERT_EQ(content, read(*manager, "first"));
+    ASSERT_EQ("", read(*manager, "second"));
+    ASSERT_EQ(content, read(*manager, "third"));
+
+    auto statistics = manager->getStatistics();
+    ASSERT_EQ(3, statistics.hits);
+    ASSERT_EQ(1, statistics.misses);
+    ASSERT_EQ(1, statistics.evictions);
+}
+
+TEST_F(FileStorageCacheManagerTests, ConcurrentWriters) {
+    const size_t threadsNum = 4;
+    std::vector<std::shared_ptr<FileStorageCacheManager>> managers;
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadsNum; i++) {
+        // the managers of the different cores share the directory
+        managers.push_back(createManager(1024 * 1024));
+    }
+    for (size_t i = 0; i < threadsNum; i++) {
+        threads.emplace_back([&, i] {
+            for (int j = 0; j < 20; j++)
+                write(*managers[i], "entry", std::string(1000 + i, static_cast<char>('a' + i)));
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    // one of the complete entries is read
+    const auto content = read(*managers.front(), "entry");
+    ASSERT_FALSE(content.empty());
+    ASSERT_EQ(std::string(content.size(), content.front()), content);
+    ASSERT_EQ(1000 + static_cast<size_t>(content.front() - 'a'), content.size());
+    ASSERT_TRUE(CommonTestUtils::listFilesWithExt(m_cacheDir, "tmp").empty());
+}
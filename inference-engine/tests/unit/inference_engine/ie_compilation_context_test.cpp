@@ -7,6 +7,7 @@
 #include <fstream>
 #include <thread>
 #include <chrono>
+#include <numeric>
 
 #include "compilation_context.hpp"
 #include "ngraph/function.hpp"
@@ -341,6 +342,78 @@ TEST(NetworkContext_CNNNetwork, HashWithDifferentMeanValues) {
               NetworkCompilationContext::computeHash(net3, {}));
 }
 
+static CNNNetwork createNetworkWithWeights(const std::vector<float>& mulWeights, const std::vector<float>& addWeights) {
+    const Shape shape{1, mulWeights.size()};
+    auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, shape);
+    auto mul = std::make_shared<ngraph::opset6::Multiply>(data,
+            ngraph::opset6::Constant::create(ngraph::element::f32, shape, mulWeights));
+    auto add = std::make_shared<ngraph::opset6::Add>(mul,
+            ngraph::opset6::Constant::create(ngraph::element::f32, shape, addWeights));
+    auto res = std::make_shared<ngraph::opset6::Result>(add);
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithPermutedWeights) {
+    std::vector<float> weights(1024);
+    std::iota(weights.begin(), weights.end(), 0.f);
+    auto permuted = weights;
+    std::swap(permuted[0], permuted[1]);
+
+    auto net1 = createNetworkWithWeights(weights, weights);
+    auto net2 = createNetworkWithWeights(weights, weights);
+    auto net3 = createNetworkWithWeights(permuted, weights);
+    auto net4 = createNetworkWithWeights(weights, permuted);
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+    ASSERT_NE(NetworkCompilationContext::computeHash(net3, {}),
+              NetworkCompilationContext::computeHash(net4, {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithLargeWeights) {
+    // the weights are hashed by the chunks in parallel
+    std::vector<float> weights(3 * 1024 * 1024);
+    std::iota(weights.begin(), weights.end(), 0.f);
+    auto modified = weights;
+    modified[modified.size() / 2] = -1.f;
+
+    auto net1 = createNetworkWithWeights(weights, weights);
+    auto net2 = createNetworkWithWeights(weights, weights);
+    auto net3 = createNetworkWithWeights(weights, modified);
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithMemoizedWeights) {
+    auto net1 = createNetwork();
+    auto net2 = createNetwork();
+    auto hash1 = NetworkCompilationContext::computeHash(net1, {});
+
+    // the digests of the weights are kept by the Constants, they don't affect the hash
+    size_t memoized = 0;
+    for (const auto& op : net1.getFunction()->get_ops()) {
+        if (ngraph::is_type<ngraph::opset6::Constant>(op))
+            memoized += op->get_rt_info().size();
+    }
+    ASSERT_EQ(2, memoized);
+    ASSERT_EQ(hash1, NetworkCompilationContext::computeHash(net1, {}));
+    ASSERT_EQ(hash1, NetworkCompilationContext::computeHash(net2, {}));
+
+    // the digest is not used for the other data
+    auto constant = ngraph::as_type_ptr<ngraph::opset6::Constant>(
+            net1.getFunction()->get_results().front()->get_input_node_shared_ptr(0)->get_input_node_shared_ptr(1));
+    ASSERT_NE(nullptr, constant);
+    auto newConstant = ngraph::opset6::Constant::create(ngraph::element::i8, ngraph::Shape{1}, {5});
+    newConstant->set_friendly_name(constant->get_friendly_name());
+    newConstant->get_output_tensor(0).set_names(constant->get_output_tensor(0).get_names());
+    newConstant->get_rt_info() = constant->get_rt_info();
+    ngraph::replace_node(constant, newConstant);
+    ASSERT_NE(hash1, NetworkCompilationContext::computeHash(net1, {}));
+}
+
 // Verify all internal hash calculations are thread-safe (like ngraph::function serialization)
 TEST(NetworkContext_CNNNetwork, HashOfSameMultiThreading) {
     auto net1 = createNetwork();
@@ -0,0 +1,15 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/i420_to_rgb.hpp"
+
+namespace ngraph {
+namespace op {
+namespace v8 {
+using ov::op::v8::I420toRGB;
+}  // namespace v8
+}  // namespace op
+}  // namespace ngraph
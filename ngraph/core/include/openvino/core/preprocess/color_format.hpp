@@ -0,0 +1,26 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+namespace ov {
+namespace preprocess {
+
+/// \brief Color format enumeration for conversion
+///
+/// NV12 and I420 formats describe 4:2:0 YUV images with 'NHWC' layout of each plane. Single plane variants store all
+/// the planes in one tensor of [N, H * 3 / 2, W, 1] shape. Multi-plane variants use separate tensors: Y plane is
+/// [N, H, W, 1], interleaved UV plane of NV12 is [N, H / 2, W / 2, 2], U and V planes of I420 are [N, H / 2, W / 2, 1]
+enum class ColorFormat {
+    UNDEFINED,
+    NV12_SINGLE_PLANE,  // Image in NV12 format as single tensor
+    NV12_TWO_PLANES,    // Image in NV12 format represented as separate tensors for Y and UV planes
+    I420_SINGLE_PLANE,  // Image in I420 (YUV) format as single tensor
+    I420_THREE_PLANES,  // Image in I420 format represented as separate tensors for Y, U and V planes
+    RGB,
+    BGR
+};
+
+}  // namespace preprocess
+}  // namespace ov
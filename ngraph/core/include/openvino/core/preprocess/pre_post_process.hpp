@@ -6,6 +6,7 @@
 
 #include "openvino/core/core_visibility.hpp"
 #include "openvino/core/preprocess/input_info.hpp"
+#include "openvino/core/preprocess/output_info.hpp"
 
 namespace ov {
 
@@ -58,6 +59,22 @@ public:
     /// \return Rvalue reference to 'this' to allow chaining with other calls in a builder-like manner
     PrePostProcessor&& input(InputInfo&& builder) &&;
 
+    /// \brief Adds post-processing information and steps to output of model. This method can be used only if
+    /// ov::Function passed on `build` has only one output
+    ///
+    /// \param builder Post-processing data for output tensor of model.
+    ///
+    /// \return Reference to 'this' to allow chaining with other calls in a builder-like manner
+    PrePostProcessor& output(OutputInfo&& builder) &;
+
+    /// \brief Adds post-processing information and steps to output of model - Rvalue version. This method can be used
+    /// only if ov::Function passed on `build` has only one output.
+    ///
+    /// \param builder Post-processing data for output tensor of model.
+    ///
+    /// \return Rvalue reference to 'this' to allow chaining with other calls in a builder-like manner
+    PrePostProcessor&& output(OutputInfo&& builder) &&;
+
     /// \brief Adds pre/post-processing operations to existing function
     ///
     /// \param function Existing function representing loaded model
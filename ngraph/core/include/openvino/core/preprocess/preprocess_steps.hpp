@@ -5,6 +5,7 @@
 #pragma once
 
 #include "openvino/core/core_visibility.hpp"
+#include "openvino/core/preprocess/color_format.hpp"
 #include "openvino/core/preprocess/resize_algorithm.hpp"
 #include "openvino/core/type/element_type.hpp"
 
@@ -207,6 +208,40 @@ public:
     ///
     /// \return Rvalue reference to 'this' to allow chaining with other calls in a builder-like manner.
     PreProcessSteps&& convert_layout(const Layout& dst_layout = {}) &&;
+    /// \brief Converts color format for user's input tensor to requested color format - Lvalue version.
+    ///
+    /// \details Source color format shall be specified with 'InputTensorInfo::set_color_format'. Conversion from
+    /// NV12 and I420 formats inserts appropriate NV12toRGB/NV12toBGR/I420toRGB/I420toBGR operation, so multi-plane
+    /// input becomes single RGB/BGR image with 'NHWC' layout. Conversion between RGB and BGR reverses channels.
+    ///
+    /// \example Example: when user data is NV12 image in two planes, but network expects planar RGB image
+    /// (NCHW, [1, 3, 224, 224]). Preprocessing may look like this:
+    ///
+    /// \code{.cpp} auto proc =
+    /// PrePostProcessor()
+    ///     .input(InputInfo()
+    ///            .tensor(InputTensorInfo()
+    ///                    .set_element_type(element::u8)
+    ///                    .set_color_format(ColorFormat::NV12_TWO_PLANES))
+    ///            .preprocess(PreProcessSteps()
+    ///                        .convert_color(ColorFormat::RGB)
+    ///                        .convert_element_type(element::f32)
+    ///                        .convert_layout())
+    ///            .network(InputNetworkInfo().set_layout("NCHW"))
+    ///     );
+    /// \endcode
+    ///
+    /// \param dst_format Destination color format of input image.
+    ///
+    /// \return Reference to 'this' to allow chaining with other calls in a builder-like manner.
+    PreProcessSteps& convert_color(const ov::preprocess::ColorFormat& dst_format) &;
+
+    /// \brief Converts color format for user's input tensor to requested color format - Rvalue version.
+    ///
+    /// \param dst_format Destination color format of input image.
+    ///
+    /// \return Rvalue reference to 'this' to allow chaining with other calls in a builder-like manner.
+    PreProcessSteps&& convert_color(const ov::preprocess::ColorFormat& dst_format) &&;
 };
 
 }  // namespace preprocess
@@ -183,6 +183,8 @@ _OPENVINO_OP_REG(MaxPool, ov::op::v8)
 _OPENVINO_OP_REG(MulticlassNms, ov::op::v8)
 _OPENVINO_OP_REG(NV12toBGR, ov::op::v8)
 _OPENVINO_OP_REG(NV12toRGB, ov::op::v8)
+_OPENVINO_OP_REG(I420toBGR, ov::op::v8)
+_OPENVINO_OP_REG(I420toRGB, ov::op::v8)
 _OPENVINO_OP_REG(RandomUniform, ov::op::v8)
 _OPENVINO_OP_REG(Slice, ov::op::v8)
 _OPENVINO_OP_REG(If, ov::op::v8)
@@ -7,11 +7,29 @@
 #include <cmath>
 #include <cstddef>
 
+#include "openvino/op/util/convert_color_i420_base.hpp"
 #include "openvino/op/util/convert_color_nv12_base.hpp"
 
 namespace ngraph {
 namespace runtime {
 namespace reference {
+/// \brief Converts one YUV pixel to RGB and stores it as 3 channels, R first for RGB or B first for BGR
+template <typename T>
+void color_convert_yuv_pixel(float y_val, float u_val, float v_val, T* out, bool to_bgr) {
+    auto c = y_val - 16.f;
+    auto d = u_val - 128.f;
+    auto e = v_val - 128.f;
+    auto clip = [](float a) -> T {
+        return a < 0.5f ? static_cast<T>(0) : (a > 254.5f ? static_cast<T>(255) : static_cast<T>(a));
+    };
+    auto b = clip(1.164f * c + 2.018f * d);
+    auto g = clip(1.164f * c - 0.391f * d - 0.813f * e);
+    auto r = clip(1.164f * c + 1.596f * e);
+    out[0] = to_bgr ? b : r;
+    out[1] = g;
+    out[2] = to_bgr ? r : b;
+}
+
 template <typename T>
 void color_convert_nv12(const T* arg_y,
                         const T* arg_uv,
@@ -22,49 +40,53 @@ void color_convert_nv12(const T* arg_y,
                         size_t stride_y,
                         size_t stride_uv,
                         ov::op::util::ConvertColorNV12Base::ColorConversion color_format) {
-    // With C++20 - std::endian can be used at compile time
-    auto little_endian = []() -> int {
-        union {
-            int32_t i;
-            char c[4];
-        } u = {0x00000001};
-        return static_cast<int>(u.c[0]);
-    };
-    auto is_little_endian = little_endian();
-    for (int batch = 0; batch < batch_size; batch++) {
+    const bool to_bgr = color_format == ov::op::util::ConvertColorNV12Base::ColorConversion::NV12_TO_BGR;
+    for (size_t batch = 0; batch < batch_size; batch++) {
         T* out = out_ptr + batch * image_w * image_h * 3;
         auto y_ptr = arg_y + batch * stride_y;
         auto uv_ptr = arg_uv + batch * stride_uv;
-        for (int h = 0; h < image_h; h++) {
-            for (int w = 0; w < image_w; w++) {
+        for (size_t h = 0; h < image_h; h++) {
+            for (size_t w = 0; w < image_w; w++) {
                 auto y_index = h * image_w + w;
-                // For little-endian systems:
-                //      Y bytes are shuffled as Y1, Y0, Y3, Y2, Y5, Y4, etc.
-                //      UV bytes are ordered as V0, U0, V1, U1, V2, U2, etc.
-                // For float point case follow the same order
-                auto add_y_index = is_little_endian ? (w % 2 ? -1 : 1) : 0;
-                auto y_val = static_cast<float>(y_ptr[y_index + add_y_index]);
+                // UV plane is interleaved: U0, V0, U1, V1, etc. Each U/V pair is shared by 2x2 pixels
                 auto uv_index = (h / 2) * image_w + (w / 2) * 2;
-                auto u_val = static_cast<float>(uv_ptr[uv_index + is_little_endian]);
-                auto v_val = static_cast<float>(uv_ptr[uv_index + 1 - is_little_endian]);
-                auto c = y_val - 16.f;
-                auto d = u_val - 128.f;
-                auto e = v_val - 128.f;
-                auto clip = [](float a) -> T {
-                    return a < 0.5f ? static_cast<T>(0) : (a > 254.5f ? static_cast<T>(255) : static_cast<T>(a));
-                };
-                auto b = clip(1.164f * c + 2.018f * d);
-                auto g = clip(1.164f * c - 0.391f * d - 0.813f * e);
-                auto r = clip(1.164f * c + 1.596f * e);
-                if (color_format == ov::op::util::ConvertColorNV12Base::ColorConversion::NV12_TO_RGB) {
-                    out[y_index * 3] = r;
-                    out[y_index * 3 + 1] = g;
-                    out[y_index * 3 + 2] = b;
-                } else if (color_format == ov::op::util::ConvertColorNV12Base::ColorConversion::NV12_TO_BGR) {
-                    out[y_index * 3] = b;
-                    out[y_index * 3 + 1] = g;
-                    out[y_index * 3 + 2] = r;
-                }
+                color_convert_yuv_pixel(static_cast<float>(y_ptr[y_index]),
+                                        static_cast<float>(uv_ptr[uv_index]),
+                                        static_cast<float>(uv_ptr[uv_index + 1]),
+                                        out + y_index * 3,
+                                        to_bgr);
+            }
+        }
+    }
+}
+
+template <typename T>
+void color_convert_i420(const T* arg_y,
+                        const T* arg_u,
+                        const T* arg_v,
+                        T* out_ptr,
+                        size_t batch_size,
+                        size_t image_h,
+                        size_t image_w,
+                        size_t stride_y,
+                        size_t stride_uv,
+                        ov::op::util::ConvertColorI420Base::ColorConversion color_format) {
+    const bool to_bgr = color_format == ov::op::util::ConvertColorI420Base::ColorConversion::I420_TO_BGR;
+    for (size_t batch = 0; batch < batch_size; batch++) {
+        T* out = out_ptr + batch * image_w * image_h * 3;
+        auto y_ptr = arg_y + batch * stride_y;
+        auto u_ptr = arg_u + batch * stride_uv;
+        auto v_ptr = arg_v + batch * stride_uv;
+        for (size_t h = 0; h < image_h; h++) {
+            for (size_t w = 0; w < image_w; w++) {
+                auto y_index = h * image_w + w;
+                // U and V planes have half of image width and height
+                auto uv_index = (h / 2) * (image_w / 2) + (w / 2);
+                color_convert_yuv_pixel(static_cast<float>(y_ptr[y_index]),
+                                        static_cast<float>(u_ptr[uv_index]),
+                                        static_cast<float>(v_ptr[uv_index]),
+                                        out + y_index * 3,
+                                        to_bgr);
             }
         }
     }
@@ -0,0 +1,125 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include <openvino/op/broadcast.hpp>
+#include "utils.hpp"
+
+namespace ov {
+namespace op {
+
+/// \brief The input (port 0) is broadcasted to the target shape (port 1), the EXPLICIT mode maps the input
+/// dimensions to the target ones by the axes mapping (port 2). PDPD mode is not supported.
+template <class T>
+void broadcast_shape_infer(const Node* op,
+                           BroadcastType mode,
+                           const std::vector<T>& input_shapes,
+                           std::vector<T>& output_shapes,
+                           const ShapeInferData& data) {
+    static_assert(is_static_shape<T>::value, "The shape inference supports static shapes only");
+    NODE_VALIDATION_CHECK(op, input_shapes.size() >= 2 && output_shapes.size() == 1);
+    const auto& input_shape = input_shapes[0];
+    const auto& target = get_input_values(op, 1, data);
+    const auto input_rank = input_shape.size();
+    auto& output_shape = output_shapes[0];
+
+    switch (mode) {
+    case BroadcastType::NUMPY:
+    case BroadcastType::BIDIRECTIONAL: {
+        const bool bidirectional = mode == BroadcastType::BIDIRECTIONAL;
+        NODE_VALIDATION_CHECK(op,
+                              bidirectional || target.size() >= input_rank,
+                              "Broadcast target_shape has smaller rank ",
+                              target.size(),
+                              " than arg shape ",
+                              input_rank);
+        const auto rank = std::max(input_rank, target.size());
+        output_shape.resize(rank);
+        for (size_t i = 0; i < rank; i++) {
+            const int64_t target_dim = i < rank - target.size() ? 1 : target[i - (rank - target.size())];
+            const int64_t input_dim = i < rank - input_rank ? 1 : input_shape[i - (rank - input_rank)].get_length();
+            NODE_VALIDATION_CHECK(op,
+                                  input_dim == target_dim || input_dim == 1 || (bidirectional && target_dim == 1),
+                                  "Broadcast incorrect target shape. Expecting either 1 or ",
+                                  input_dim,
+                                  ". Got ",
+                                  target_dim);
+            output_shape[i] = bidirectional ? std::max(input_dim, target_dim) : target_dim;
+        }
+        break;
+    }
+    case BroadcastType::EXPLICIT: {
+        NODE_VALIDATION_CHECK(op, input_shapes.size() == 3, "axes_mapping input should be provided if explicit mode is used");
+        const auto& axes_mapping = get_input_values(op, 2, data);
+        NODE_VALIDATION_CHECK(op,
+                              axes_mapping.size() == input_rank,
+                              "Broadcast axes_mapping shape ",
+                              axes_mapping.size(),
+                              " doesn't match rank of input tensor ",
+                              input_rank);
+        output_shape.resize(target.size());
+        for (size_t i = 0; i < target.size(); i++)
+            output_shape[i] = target[i];
+        for (size_t i = 0; i < input_rank; i++) {
+            const auto axis = axes_mapping[i];
+            NODE_VALIDATION_CHECK(op,
+                                  axis >= 0 && static_cast<size_t>(axis) < target.size() &&
+                                      (i == 0 || axis > axes_mapping[i - 1]),
+                                  "Broadcast doesn't permit transposes. axes_mapping ",
+                                  axis,
+                                  " is out of order or out of range of the target shape");
+            const int64_t input_dim = input_shape[i].get_length();
+            NODE_VALIDATION_CHECK(op,
+                                  input_dim == 1 || input_dim == target[axis],
+                                  "Broadcast target[axes_mapping[",
+                                  i,
+                                  "]] Expected ",
+                                  input_dim,
+                                  ". Got ",
+                                  target[axis]);
+        }
+        break;
+    }
+    default:
+        NODE_VALIDATION_CHECK(op, false, "Unsupported broadcast specification");
+    }
+}
+
+namespace v3 {
+
+template <class T>
+void shape_infer(const Broadcast* op,
+                 const std::vector<T>& input_shapes,
+                 std::vector<T>& output_shapes,
+                 const ShapeInferData& data) {
+    static_assert(is_static_shape<T>::value, "The shape inference supports static shapes only");
+    broadcast_shape_infer(op, op->get_broadcast_spec().m_type, input_shapes, output_shapes, data);
+}
+
+}  // namespace v3
+
+namespace v1 {
+
+template <class T>
+void shape_infer(const Broadcast* op,
+                 const std::vector<T>& input_shapes,
+                 std::vector<T>& output_shapes,
+                 const ShapeInferData& data) {
+    static_assert(is_static_shape<T>::value, "The shape inference supports static shapes only");
+    const auto& autob = op->get_broadcast_spec();
+    NODE_VALIDATION_CHECK(op, autob.m_type != AutoBroadcastType::PDPD, "Unsupported broadcast specification");
+    broadcast_shape_infer(op,
+                          autob.m_type == AutoBroadcastType::NUMPY ? BroadcastType::NUMPY : BroadcastType::EXPLICIT,
+                          input_shapes,
+                          output_shapes,
+                          data);
+}
+
+}  // namespace v1
+}  // namespace op
+}  // namespace ov
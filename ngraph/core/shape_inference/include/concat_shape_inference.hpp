@@ -0,0 +1,49 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <iterator>
+#include <vector>
+
+#include <openvino/core/validation_util.hpp>
+#include <openvino/op/concat.hpp>
+#include "utils.hpp"
+
+namespace ov {
+namespace op {
+namespace v0 {
+
+/// \brief The inputs are concatenated along the axis, the input shapes must have static ranks
+template <class T>
+void shape_infer(const Concat* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes) {
+    static_assert(is_static_shape<T>::value, "The shape inference supports static shapes only");
+    using DimType = typename std::iterator_traits<typename T::iterator>::value_type;
+    NODE_VALIDATION_CHECK(op, !input_shapes.empty() && output_shapes.size() == 1);
+    const auto rank = input_shapes[0].size();
+    const auto axis = static_cast<size_t>(ov::normalize_axis(op, op->get_axis(), Rank(rank)));
+
+    auto& output_shape = output_shapes[0];
+    output_shape = input_shapes[0];
+    for (size_t i = 1; i < input_shapes.size(); i++) {
+        const auto& input_shape = input_shapes[i];
+        NODE_VALIDATION_CHECK(op, input_shape.size() == rank, "Argument shapes are inconsistent.");
+        for (size_t j = 0; j < rank; j++) {
+            if (j == axis) {
+                output_shape[j] += input_shape[j];
+            } else {
+                NODE_VALIDATION_CHECK(op,
+                                      DimType::merge(output_shape[j], output_shape[j], input_shape[j]),
+                                      "Argument shapes are inconsistent; they must have the same rank, and must "
+                                      "have equal dimension everywhere except on the concatenation axis (axis ",
+                                      axis,
+                                      ").");
+            }
+        }
+    }
+}
+
+}  // namespace v0
+}  // namespace op
+}  // namespace ov
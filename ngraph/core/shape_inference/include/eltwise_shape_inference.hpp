@@ -0,0 +1,74 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <openvino/core/node.hpp>
+#include <openvino/op/util/attr_types.hpp>
+#include "utils.hpp"
+
+namespace ov {
+namespace op {
+
+/// \brief The output shape is the shape of the first input (unary element-wise operations, Softmax, MVN, etc.)
+template <class T>
+void copy_shape_infer(const Node* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes) {
+    static_assert(is_static_shape<T>::value, "The shape inference supports static shapes only");
+    NODE_VALIDATION_CHECK(op, !input_shapes.empty() && output_shapes.size() == 1);
+    output_shapes[0] = input_shapes[0];
+}
+
+/// \brief The output shape is the broadcast of the input shapes (binary element-wise operations, FakeQuantize)
+template <class T>
+void eltwise_shape_infer(const Node* op,
+                         const AutoBroadcastSpec& autob,
+                         const std::vector<T>& input_shapes,
+                         std::vector<T>& output_shapes) {
+    static_assert(is_static_shape<T>::value, "The shape inference supports static shapes only");
+    using DimType = typename std::iterator_traits<typename T::iterator>::value_type;
+    NODE_VALIDATION_CHECK(op, !input_shapes.empty() && output_shapes.size() == 1);
+    auto& output_shape = output_shapes[0];
+    output_shape = input_shapes[0];
+    for (size_t i = 1; i < input_shapes.size(); i++) {
+        const auto& src = input_shapes[i];
+        switch (autob.m_type) {
+        case AutoBroadcastType::NONE:
+            NODE_VALIDATION_CHECK(op, output_shape == src, "Argument shapes are inconsistent.");
+            break;
+        case AutoBroadcastType::NUMPY: {
+            // the shorter shape is aligned to the right
+            if (src.size() > output_shape.size()) {
+                const auto offset = src.size() - output_shape.size();
+                output_shape.resize(src.size());
+                for (size_t j = output_shape.size(); j-- > offset;)
+                    output_shape[j] = output_shape[j - offset];
+                for (size_t j = 0; j < offset; j++)
+                    output_shape[j] = 1;
+            }
+            const auto offset = output_shape.size() - src.size();
+            for (size_t j = 0; j < src.size(); j++) {
+                auto& dst = output_shape[offset + j];
+                NODE_VALIDATION_CHECK(op,
+                                      DimType::broadcast_merge(dst, dst, src[j]),
+                                      "Argument shapes are inconsistent.");
+            }
+            break;
+        }
+        case AutoBroadcastType::PDPD:
+            NODE_VALIDATION_CHECK(op,
+                                  T::broadcast_merge_into(output_shape, src, autob),
+                                  "Argument shapes are inconsistent.");
+            break;
+        default:
+            NODE_VALIDATION_CHECK(op, false, "Unsupported auto broadcast specification");
+        }
+    }
+}
+
+}  // namespace op
+}  // namespace ov
@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <iterator>
+#include <vector>
+
+#include <openvino/core/validation_util.hpp>
+#include <openvino/op/gather.hpp>
+#include <openvino/op/util/gather_base.hpp>
+#include "utils.hpp"
+
+namespace ov {
+namespace op {
+namespace util {
+
+/// \brief data.shape[:axis] + indices.shape[batch_dims:] + data.shape[axis + 1:], the axis is the input 2
+template <class T>
+void shape_infer(const GatherBase* op,
+                 const std::vector<T>& input_shapes,
+                 std::vector<T>& output_shapes,
+                 const ShapeInferData& data) {
+    static_assert(is_static_shape<T>::value, "The shape inference supports static shapes only");
+    using DimType = typename std::iterator_traits<typename T::iterator>::value_type;
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 3 && output_shapes.size() == 1);
+    const auto& data_shape = input_shapes[0];
+    const auto& indices_shape = input_shapes[1];
+    const auto data_rank = static_cast<int64_t>(data_shape.size());
+    const auto indices_rank = static_cast<int64_t>(indices_shape.size());
+
+    const auto& axis_values = get_input_values(op, 2, data);
+    NODE_VALIDATION_CHECK(op, axis_values.size() == 1, "Axis input must be scalar or have 1 element.");
+    const auto axis = ov::normalize_axis(op, axis_values[0], Rank(data_rank));
+
+    int64_t batch_dims = 0;
+    if (const auto gather_v7 = ov::as_type<const v7::Gather>(op)) {
+        batch_dims = gather_v7->get_batch_dims();
+    } else if (const auto gather_v8 = ov::as_type<const v8::Gather>(op)) {
+        batch_dims = gather_v8->get_batch_dims();
+    }
+    if (batch_dims < 0)
+        batch_dims += indices_rank;
+    NODE_VALIDATION_CHECK(op,
+                          batch_dims >= 0 && batch_dims <= axis && batch_dims <= indices_rank,
+                          "After normalization batch_dims must be <= axis and <= indices_rank. But instead got: "
+                          "batch_dims = ",
+                          batch_dims,
+                          ", axis = ",
+                          axis);
+
+    auto& output_shape = output_shapes[0];
+    output_shape.resize(data_rank + indices_rank - 1 - batch_dims);
+    size_t idx = 0;
+    for (int64_t i = 0; i < axis; i++) {
+        output_shape[idx] = data_shape[i];
+        if (i < batch_dims) {
+            NODE_VALIDATION_CHECK(op,
+                                  DimType::merge(output_shape[idx], data_shape[i], indices_shape[i]),
+                                  "Shapes ",
+                                  data_shape,
+                                  " and ",
+                                  indices_shape,
+                                  " are not consistent. data and indices must have equal sizes until batch_dims");
+        }
+        idx++;
+    }
+    for (int64_t i = batch_dims; i < indices_rank; i++)
+        output_shape[idx++] = indices_shape[i];
+    for (int64_t i = axis + 1; i < data_rank; i++)
+        output_shape[idx++] = data_shape[i];
+}
+
+}  // namespace util
+}  // namespace op
+}  // namespace ov
@@ -0,0 +1,69 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <openvino/op/matmul.hpp>
+#include "utils.hpp"
+
+namespace ov {
+namespace op {
+namespace v0 {
+
+/// \brief The batch dimensions are broadcast with the numpy rules, the input shapes must have static ranks
+template <class T>
+void shape_infer(const MatMul* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes) {
+    static_assert(is_static_shape<T>::value, "The shape inference supports static shapes only");
+    using DimType = typename std::iterator_traits<typename T::iterator>::value_type;
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 2 && output_shapes.size() == 1);
+    const auto& a = input_shapes[0];
+    const auto& b = input_shapes[1];
+    const auto rank_a = a.size();
+    const auto rank_b = b.size();
+    NODE_VALIDATION_CHECK(op, rank_a != 0 && rank_b != 0, "Scalars are not supported as MatMul inputs.");
+
+    // 1D inputs are unsqueezed to a row (the first one) or a column (the second one) and transposes are ignored
+    const bool transpose_a = op->get_transpose_a() && rank_a > 1;
+    const bool transpose_b = op->get_transpose_b() && rank_b > 1;
+    const auto& k_a = a[rank_a - (transpose_a ? 2 : 1)];
+    const auto& k_b = rank_b == 1 ? b[0] : b[rank_b - (transpose_b ? 1 : 2)];
+    DimType k;
+    NODE_VALIDATION_CHECK(op,
+                          DimType::merge(k, k_a, k_b),
+                          "Incompatible MatMul matrix dimension. First input dimension=",
+                          k_a,
+                          " doesn't match the second input dimension=",
+                          k_b);
+
+    const size_t batch_a = rank_a > 2 ? rank_a - 2 : 0;
+    const size_t batch_b = rank_b > 2 ? rank_b - 2 : 0;
+    const size_t batch_rank = std::max(batch_a, batch_b);
+    auto& output_shape = output_shapes[0];
+    output_shape.resize(batch_rank + (rank_a == 1 ? 0 : 1) + (rank_b == 1 ? 0 : 1));
+    for (size_t i = 0; i < batch_rank; i++) {
+        const auto dim_a = i < batch_rank - batch_a ? DimType(1) : a[i - (batch_rank - batch_a)];
+        const auto dim_b = i < batch_rank - batch_b ? DimType(1) : b[i - (batch_rank - batch_b)];
+        NODE_VALIDATION_CHECK(op,
+                              DimType::broadcast_merge(output_shape[i], dim_a, dim_b),
+                              "Incompatible MatMul batch dimension. Can't merge first input dimension=",
+                              dim_a,
+                              " with second input dimension=",
+                              dim_b,
+                              " at index=",
+                              i);
+    }
+    size_t idx = batch_rank;
+    if (rank_a != 1)
+        output_shape[idx++] = a[rank_a - (transpose_a ? 1 : 2)];
+    if (rank_b != 1)
+        output_shape[idx] = b[rank_b - (transpose_b ? 2 : 1)];
+}
+
+}  // namespace v0
+}  // namespace op
+}  // namespace ov
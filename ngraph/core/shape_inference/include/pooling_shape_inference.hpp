@@ -0,0 +1,132 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include <openvino/op/avg_pool.hpp>
+#include <openvino/op/max_pool.hpp>
+#include "utils.hpp"
+
+namespace ov {
+namespace op {
+
+/// \brief Common part of the pooling operations, the spatial dimensions of the input must be static
+template <class T>
+void pooling_shape_infer(const Node* op,
+                         const Shape& kernel,
+                         const Strides& strides,
+                         const Strides& dilations,
+                         const Shape& pads_begin,
+                         const Shape& pads_end,
+                         PadType auto_pad,
+                         bool ceil_mode,
+                         const T& input_shape,
+                         T& output_shape) {
+    static_assert(is_static_shape<T>::value, "The shape inference supports static shapes only");
+    const auto num_spatial = kernel.size();
+    NODE_VALIDATION_CHECK(op,
+                          input_shape.size() == num_spatial + 2,
+                          "Expected kernel size to be equal to input size - 2. Got: ",
+                          num_spatial);
+
+    output_shape.resize(input_shape.size());
+    output_shape[0] = input_shape[0];
+    output_shape[1] = input_shape[1];
+    for (size_t i = 0; i < num_spatial; i++) {
+        const int64_t data_dim = input_shape[i + 2].get_length();
+        const int64_t stride = strides.empty() ? 1 : strides[i];
+        const int64_t dilation = dilations.empty() ? 1 : dilations[i];
+        const int64_t window = (static_cast<int64_t>(kernel[i]) - 1) * dilation + 1;
+
+        int64_t pad_begin = 0, pad_end = 0;
+        if (auto_pad == PadType::SAME_UPPER || auto_pad == PadType::SAME_LOWER) {
+            // the same as ngraph::try_apply_auto_padding()
+            const int64_t output_size = (data_dim + stride - 1) / stride;
+            const int64_t padding_needed = std::max(int64_t(0), (output_size - 1) * stride + window - data_dim);
+            const int64_t padding_lhs = padding_needed / 2;
+            const int64_t padding_rhs = padding_needed - padding_lhs;
+            pad_begin = auto_pad == PadType::SAME_UPPER ? padding_lhs : padding_rhs;
+            pad_end = auto_pad == PadType::SAME_UPPER ? padding_rhs : padding_lhs;
+        } else if (auto_pad != PadType::VALID) {
+            pad_begin = pads_begin.empty() ? 0 : pads_begin[i];
+            pad_end = pads_end.empty() ? 0 : pads_end[i];
+        }
+
+        const int64_t data_padded = data_dim + pad_begin + pad_end;
+        NODE_VALIDATION_CHECK(op,
+                              window <= data_padded,
+                              "Window after dilation has dimension (dim: ",
+                              window,
+                              ") larger than the data shape after padding (dim: ",
+                              data_padded,
+                              ") at axis ",
+                              i,
+                              ".");
+        const int64_t range = data_padded - window;
+        output_shape[i + 2] = (ceil_mode ? (range + stride - 1) : range) / stride + 1;
+    }
+}
+
+namespace v1 {
+
+template <class T>
+void shape_infer(const AvgPool* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes) {
+    static_assert(is_static_shape<T>::value, "The shape inference supports static shapes only");
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 1 && output_shapes.size() == 1);
+    pooling_shape_infer(op,
+                        op->get_kernel(),
+                        op->get_strides(),
+                        Strides{},
+                        op->get_pads_begin(),
+                        op->get_pads_end(),
+                        op->get_auto_pad(),
+                        op->get_rounding_type() == RoundingType::CEIL,
+                        input_shapes[0],
+                        output_shapes[0]);
+}
+
+template <class T>
+void shape_infer(const MaxPool* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes) {
+    static_assert(is_static_shape<T>::value, "The shape inference supports static shapes only");
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 1 && output_shapes.size() == 1);
+    pooling_shape_infer(op,
+                        op->get_kernel(),
+                        op->get_strides(),
+                        Strides{},
+                        op->get_pads_begin(),
+                        op->get_pads_end(),
+                        op->get_auto_pad(),
+                        op->get_rounding_type() == RoundingType::CEIL,
+                        input_shapes[0],
+                        output_shapes[0]);
+}
+
+}  // namespace v1
+
+namespace v8 {
+
+/// \brief The second output with the indices has the same shape as the first one
+template <class T>
+void shape_infer(const MaxPool* op, const std::vector<T>& input_shapes, std::vector<T>& output_shapes) {
+    static_assert(is_static_shape<T>::value, "The shape inference supports static shapes only");
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 1 && output_shapes.size() == 2);
+    pooling_shape_infer(op,
+                        op->get_kernel(),
+                        op->get_strides(),
+                        op->get_dilations(),
+                        op->get_pads_begin(),
+                        op->get_pads_end(),
+                        op->get_auto_pad(),
+                        op->get_rounding_type() == RoundingType::CEIL,
+                        input_shapes[0],
+                        output_shapes[0]);
+    output_shapes[1] = output_shapes[0];
+}
+
+}  // namespace v8
+}  // namespace op
+}  // namespace ov
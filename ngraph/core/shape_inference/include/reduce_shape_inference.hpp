@@ -0,0 +1,79 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <openvino/core/validation_util.hpp>
+#include <openvino/op/util/arithmetic_reductions_keep_dims.hpp>
+#include <openvino/op/util/logical_reduction_keep_dims.hpp>
+#include "utils.hpp"
+
+namespace ov {
+namespace op {
+
+/// \brief The dimensions listed by the axes input (port 1) are reduced to 1 or removed
+template <class T>
+void reduce_shape_infer(const Node* op,
+                        bool keep_dims,
+                        const std::vector<T>& input_shapes,
+                        std::vector<T>& output_shapes,
+                        const ShapeInferData& data) {
+    static_assert(is_static_shape<T>::value, "The shape inference supports static shapes only");
+    using DimType = typename std::iterator_traits<typename T::iterator>::value_type;
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 2 && output_shapes.size() == 1);
+    const auto& input_shape = input_shapes[0];
+    const auto rank = input_shape.size();
+    const auto& axes = get_input_values(op, 1, data);
+
+    const auto is_reduced = [&](size_t dim) {
+        return std::any_of(axes.begin(), axes.end(), [&](int64_t axis) {
+            return static_cast<size_t>(ov::normalize_axis(op, axis, Rank(rank))) == dim;
+        });
+    };
+
+    auto& output_shape = output_shapes[0];
+    if (keep_dims) {
+        output_shape.resize(rank);
+        for (size_t i = 0; i < rank; i++)
+            output_shape[i] = is_reduced(i) ? DimType(1) : input_shape[i];
+        return;
+    }
+
+    size_t reduced = 0;
+    for (size_t i = 0; i < rank; i++)
+        reduced += is_reduced(i);
+    output_shape.resize(rank - reduced);
+    for (size_t i = 0, idx = 0; i < rank; i++) {
+        if (!is_reduced(i))
+            output_shape[idx++] = input_shape[i];
+    }
+}
+
+namespace util {
+
+template <class T>
+void shape_infer(const ArithmeticReductionKeepDims* op,
+                 const std::vector<T>& input_shapes,
+                 std::vector<T>& output_shapes,
+                 const ShapeInferData& data) {
+    static_assert(is_static_shape<T>::value, "The shape inference supports static shapes only");
+    reduce_shape_infer(op, op->get_keep_dims(), input_shapes, output_shapes, data);
+}
+
+template <class T>
+void shape_infer(const LogicalReductionKeepDims* op,
+                 const std::vector<T>& input_shapes,
+                 std::vector<T>& output_shapes,
+                 const ShapeInferData& data) {
+    static_assert(is_static_shape<T>::value, "The shape inference supports static shapes only");
+    reduce_shape_infer(op, op->get_keep_dims(), input_shapes, output_shapes, data);
+}
+
+}  // namespace util
+}  // namespace op
+}  // namespace ov
@@ -0,0 +1,90 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include <openvino/op/reshape.hpp>
+#include "utils.hpp"
+
+namespace ov {
+namespace op {
+namespace v1 {
+
+/// \brief The output shape is defined by the values of the pattern input (port 1), the dimensions must be static
+template <class T>
+void shape_infer(const Reshape* op,
+                 const std::vector<T>& input_shapes,
+                 std::vector<T>& output_shapes,
+                 const ShapeInferData& data) {
+    static_assert(is_static_shape<T>::value, "The shape inference supports static shapes only");
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 2 && output_shapes.size() == 1);
+    const auto& input_shape = input_shapes[0];
+    const auto& pattern = get_input_values(op, 1, data);
+    const bool special_zero = op->get_special_zero();
+    auto& output_shape = output_shapes[0];
+
+    // scalar output is described by an empty pattern or a single 1 value
+    if (input_shapes[1].size() == 0) {
+        NODE_VALIDATION_CHECK(op,
+                              pattern.empty() || (pattern.size() == 1 && pattern[0] == 1),
+                              "The value of scalar shape pattern should be equal to 1!");
+        output_shape.resize(0);
+        return;
+    }
+
+    output_shape.resize(pattern.size());
+    int64_t minus_one_idx = -1;
+    int64_t output_product = 1;
+    for (size_t i = 0; i < pattern.size(); i++) {
+        NODE_VALIDATION_CHECK(op, pattern[i] >= -1, "Dim size cannot be less than -1");
+        if (pattern[i] == -1) {
+            NODE_VALIDATION_CHECK(op, minus_one_idx == -1, "More than one dimension has size of -1");
+            minus_one_idx = static_cast<int64_t>(i);
+        } else if (pattern[i] == 0 && special_zero) {
+            NODE_VALIDATION_CHECK(op, i < input_shape.size(), "'0' dimension is out of range");
+            // the dimension is excluded from both products, as it's the same in the input and the output
+            output_shape[i] = input_shape[i];
+        } else {
+            output_shape[i] = pattern[i];
+            output_product *= pattern[i];
+        }
+    }
+
+    int64_t input_product = 1;
+    for (size_t i = 0; i < input_shape.size(); i++) {
+        if (special_zero && i < pattern.size() && pattern[i] == 0)
+            continue;
+        input_product *= input_shape[i].get_length();
+    }
+
+    if (minus_one_idx != -1) {
+        if (output_product == 0) {
+            NODE_VALIDATION_CHECK(op,
+                                  input_product == 0,
+                                  "Cannot infer '-1' dimension with zero-size output "
+                                  "dimension unless at least one input dimension is "
+                                  "also zero-size");
+            output_shape[minus_one_idx] = 0;
+        } else {
+            NODE_VALIDATION_CHECK(op,
+                                  input_product % output_product == 0,
+                                  "Non-'-1' output dimensions do not evenly divide the input dimensions");
+            output_shape[minus_one_idx] = input_product / output_product;
+        }
+    } else {
+        NODE_VALIDATION_CHECK(op,
+                              input_product == output_product,
+                              "Requested output shape ",
+                              output_shape,
+                              " is incompatible with input shape ",
+                              input_shape);
+    }
+}
+
+}  // namespace v1
+}  // namespace op
+}  // namespace ov
@@ -0,0 +1,134 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include <openvino/op/strided_slice.hpp>
+#include "utils.hpp"
+
+namespace ov {
+namespace op {
+namespace v1 {
+
+/// \brief The same algorithm as ngraph::infer_slice_shape(), the begin, end and strides are the inputs 1, 2 and 3.
+/// The strides are optional and default to ones. The sliced dimensions of the input must be static.
+template <class T>
+void shape_infer(const StridedSlice* op,
+                 const std::vector<T>& input_shapes,
+                 std::vector<T>& output_shapes,
+                 const ShapeInferData& data) {
+    static_assert(is_static_shape<T>::value, "The shape inference supports static shapes only");
+    using DimType = typename std::iterator_traits<typename T::iterator>::value_type;
+    NODE_VALIDATION_CHECK(op, (input_shapes.size() == 3 || input_shapes.size() == 4) && output_shapes.size() == 1);
+    const auto& input_shape = input_shapes[0];
+    const auto& begin = get_input_values(op, 1, data);
+    const auto& end = get_input_values(op, 2, data);
+    const auto strides = input_shapes.size() > 3 ? &get_input_values(op, 3, data) : nullptr;
+    const auto in_mask = [](const std::vector<int64_t>& mask, size_t axis) {
+        return axis < mask.size() && mask[axis] == 1;
+    };
+    const auto& begin_mask = op->get_begin_mask();
+    const auto& end_mask = op->get_end_mask();
+    const auto& new_axis_mask = op->get_new_axis_mask();
+    const auto& shrink_axis_mask = op->get_shrink_axis_mask();
+    const auto& ellipsis_mask = op->get_ellipsis_mask();
+
+    NODE_VALIDATION_CHECK(op,
+                          begin.size() == end.size() && (!strides || begin.size() == strides->size()),
+                          "Lower bounds, upper bounds and strides needs to have same number of values");
+    NODE_VALIDATION_CHECK(op,
+                          std::count(ellipsis_mask.begin(), ellipsis_mask.end(), 1) <= 1,
+                          "At most one ellipsis is allowed.");
+
+    const auto input_rank = static_cast<int64_t>(input_shape.size());
+    const auto new_axes_count = std::count(new_axis_mask.begin(), new_axis_mask.end(), 1);
+    NODE_VALIDATION_CHECK(op,
+                          input_rank + new_axes_count >= static_cast<int64_t>(begin.size()),
+                          "Input rank plus number of new axis has to be at least the size of Lower "
+                          "and Upper bounds vector.");
+
+    auto& output_shape = output_shapes[0];
+    // the first pass counts the output dimensions, the second one fills them
+    for (const bool fill : {false, true}) {
+        size_t output_idx = 0;
+        const auto set_next = [&](const DimType& dim) {
+            if (fill)
+                output_shape[output_idx] = dim;
+            output_idx++;
+        };
+
+        int64_t input_idx = 0;
+        for (size_t axis = 0; axis < begin.size(); axis++) {
+            if (in_mask(ellipsis_mask, axis)) {
+                // add all the dimensions hidden under the ellipsis
+                int64_t num_input_axis_before_ellipsis = 0;
+                int64_t num_new_axis_after_ellipsis = 0;
+                for (size_t i = 0; i < axis; i++) {
+                    if (!in_mask(new_axis_mask, i))
+                        num_input_axis_before_ellipsis++;
+                }
+                for (size_t i = axis + 1; i < begin.size(); i++) {
+                    if (in_mask(new_axis_mask, i))
+                        num_new_axis_after_ellipsis++;
+                }
+                const int64_t num_input_axis_after_ellipsis = begin.size() - axis - num_new_axis_after_ellipsis - 1;
+                const int64_t num_hidden_dims =
+                    input_rank - num_input_axis_after_ellipsis - num_input_axis_before_ellipsis;
+                for (int64_t i = 0; i < num_hidden_dims; i++)
+                    set_next(input_shape[input_idx++]);
+            } else if (in_mask(new_axis_mask, axis)) {
+                set_next(1);
+            } else if (in_mask(shrink_axis_mask, axis)) {
+                input_idx++;
+            } else {
+                const int64_t dim = input_shape[input_idx++].get_length();
+                const int64_t stride = strides ? (*strides)[axis] : 1;
+                NODE_VALIDATION_CHECK(op, stride != 0, "Stride must be non-zero");
+
+                int64_t lb = begin[axis];
+                int64_t ub = end[axis];
+                // negative indices are counted from the end, too big values are clipped
+                if (lb < 0)
+                    lb = std::max(dim + lb, int64_t(0));
+                if (ub < 0)
+                    ub = std::max(dim + ub, stride > 0 ? int64_t(0) : int64_t(-1));
+                lb = std::min(dim, lb);
+                ub = std::min(dim, ub);
+
+                int64_t out_dim = 0;
+                if (stride < 0) {
+                    if (in_mask(begin_mask, axis))
+                        lb = dim - 1;
+                    if (in_mask(end_mask, axis))
+                        ub = -1;
+                    lb = std::min(lb, dim - 1) - 1;
+                    if (ub <= lb)
+                        out_dim = (ub - lb) / stride + 1;
+                } else {
+                    if (in_mask(begin_mask, axis))
+                        lb = 0;
+                    if (in_mask(end_mask, axis))
+                        ub = dim;
+                    lb += 1;
+                    if (ub >= lb)
+                        out_dim = (ub - lb) / stride + 1;
+                }
+                set_next(out_dim);
+            }
+        }
+        for (; input_idx < input_rank; input_idx++)
+            set_next(input_shape[input_idx]);
+
+        if (!fill)
+            output_shape.resize(output_idx);
+    }
+}
+
+}  // namespace v1
+}  // namespace op
+}  // namespace ov
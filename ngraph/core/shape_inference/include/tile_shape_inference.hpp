@@ -0,0 +1,42 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include <openvino/op/tile.hpp>
+#include "utils.hpp"
+
+namespace ov {
+namespace op {
+namespace v0 {
+
+/// \brief The input dimensions are multiplied by the repeats input (port 1), the shorter one is padded by ones
+template <class T>
+void shape_infer(const Tile* op,
+                 const std::vector<T>& input_shapes,
+                 std::vector<T>& output_shapes,
+                 const ShapeInferData& data) {
+    static_assert(is_static_shape<T>::value, "The shape inference supports static shapes only");
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 2 && output_shapes.size() == 1);
+    const auto& input_shape = input_shapes[0];
+    const auto& repeats = get_input_values(op, 1, data);
+    const auto input_rank = input_shape.size();
+    const auto rank = std::max(input_rank, repeats.size());
+
+    auto& output_shape = output_shapes[0];
+    output_shape.resize(rank);
+    for (size_t i = 0; i < rank; i++) {
+        const auto input_dim = i < rank - input_rank ? 1 : input_shape[i - (rank - input_rank)].get_length();
+        const auto repeat = i < rank - repeats.size() ? 1 : repeats[i - (rank - repeats.size())];
+        NODE_VALIDATION_CHECK(op, repeat >= 0, "Tile repeats must be non-negative");
+        output_shape[i] = input_dim * repeat;
+    }
+}
+
+}  // namespace v0
+}  // namespace op
+}  // namespace ov
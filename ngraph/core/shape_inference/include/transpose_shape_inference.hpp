@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <vector>
+
+#include <openvino/op/transpose.hpp>
+#include "utils.hpp"
+
+namespace ov {
+namespace op {
+namespace v1 {
+
+/// \brief The input dimensions are permuted by the order input (port 1), the empty order reverses them
+template <class T>
+void shape_infer(const Transpose* op,
+                 const std::vector<T>& input_shapes,
+                 std::vector<T>& output_shapes,
+                 const ShapeInferData& data) {
+    static_assert(is_static_shape<T>::value, "The shape inference supports static shapes only");
+    NODE_VALIDATION_CHECK(op, input_shapes.size() == 2 && output_shapes.size() == 1);
+    const auto& input_shape = input_shapes[0];
+    const auto& order = get_input_values(op, 1, data);
+    const auto rank = input_shape.size();
+
+    auto& output_shape = output_shapes[0];
+    output_shape.resize(rank);
+    if (order.empty()) {
+        for (size_t i = 0; i < rank; i++)
+            output_shape[i] = input_shape[rank - 1 - i];
+        return;
+    }
+
+    NODE_VALIDATION_CHECK(op, order.size() == rank, "Input order must have shape [n], where n is the rank of arg.");
+    for (size_t i = 0; i < rank; i++) {
+        NODE_VALIDATION_CHECK(op,
+                              order[i] >= 0 && static_cast<size_t>(order[i]) < rank,
+                              "Permutation ",
+                              order[i],
+                              " is not valid for input shape ",
+                              input_shape);
+        output_shape[i] = input_shape[order[i]];
+    }
+}
+
+}  // namespace v1
+}  // namespace op
+}  // namespace ov
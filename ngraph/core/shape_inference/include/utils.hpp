@@ -0,0 +1,39 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <type_traits>
+#include <vector>
+
+#include <openvino/core/node.hpp>
+#include <openvino/core/partial_shape.hpp>
+
+namespace ov {
+namespace op {
+
+/// \brief The shape_infer() templates of this directory, except the convolution one, expect the shapes with the static
+/// dimensions and ranks (e.g. the StaticShape of the CPU plugin). ov::PartialShape is inferred by the
+/// validate_and_infer_types() of the operations.
+template <class T>
+struct is_static_shape : std::integral_constant<bool, !std::is_same<T, PartialShape>::value> {};
+
+/// \brief Values of the shape-defining inputs of an operation (e.g. the target shape of Reshape) by the input port
+using ShapeInferData = std::map<size_t, std::vector<int64_t>>;
+
+/// \return values of the input port
+/// \throw NodeValidationFailure if the values are not provided
+inline const std::vector<int64_t>& get_input_values(const Node* op, size_t port, const ShapeInferData& data) {
+    const auto found = data.find(port);
+    NODE_VALIDATION_CHECK(op,
+                          found != data.end(),
+                          "The values of the input ",
+                          port,
+                          " are required to infer the output shapes");
+    return found->second;
+}
+
+}  // namespace op
+}  // namespace ov
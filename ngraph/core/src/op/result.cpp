@@ -65,6 +65,20 @@ bool op::Result::constant_fold(OutputVector& output_values, const OutputVector&
     return false;
 }
 
+ov::Layout op::Result::get_layout() const {
+    auto it = get_output_tensor(0).get_rt_info().find("LAYOUT");
+    if (it == get_output_tensor(0).get_rt_info().end()) {
+        return ov::Layout();
+    }
+    auto layout = std::dynamic_pointer_cast<VariantWrapper<ov::Layout>>(it->second);
+    OPENVINO_ASSERT(layout, "'LAYOUT' runtime info for node is invalid, use set_layout API");
+    return layout->get();
+}
+
+void op::Result::set_layout(const ov::Layout& layout) {
+    get_output_tensor(0).get_rt_info()["LAYOUT"] = std::make_shared<VariantWrapper<ov::Layout>>(layout);
+}
+
 BWDCMP_RTTI_DEFINITION(ov::AttributeAdapter<ResultVector>);
 
 ov::AttributeAdapter<ResultVector>::AttributeAdapter(ResultVector& ref) : m_ref(ref) {}
@@ -0,0 +1,254 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/op/util/convert_color_i420_base.hpp"
+
+#include <memory>
+#include <ngraph/validation_util.hpp>
+
+#include "itt.hpp"
+#include "ngraph/runtime/reference/convert_color_nv12.hpp"
+#include "openvino/core/layout.hpp"
+
+static const size_t N_DIM = 0;
+static const size_t H_DIM = 1;
+static const size_t W_DIM = 2;
+static const size_t C_DIM = 3;
+
+ov::op::util::ConvertColorI420Base::ConvertColorI420Base(const Output<Node>& arg, ColorConversion format)
+    : Op({arg}),
+      m_format(format) {}
+
+ov::op::util::ConvertColorI420Base::ConvertColorI420Base(const Output<Node>& arg_y,
+                                                         const Output<Node>& arg_u,
+                                                         const Output<Node>& arg_v,
+                                                         ColorConversion format)
+    : Op({arg_y, arg_u, arg_v}),
+      m_format(format) {
+    constructor_validate_and_infer_types();
+}
+
+void ov::op::util::ConvertColorI420Base::validate_and_infer_types() {
+    NGRAPH_OP_SCOPE(v8_Convert_I420_Base_validate_and_infer_types);
+
+    NODE_VALIDATION_CHECK(this,
+                          get_input_size() == 1 || get_input_size() == 3,
+                          "I420 conversion shall have one or 3 inputs, but it is ",
+                          get_input_size());
+    auto single_plane = get_input_size() == 1;
+    auto y_type = get_input_element_type(0);
+    NODE_VALIDATION_CHECK(this,
+                          is_type_supported(y_type),
+                          "Y input shall have u8 or floating-point precision, got ",
+                          y_type);
+    const auto& shape_y = get_input_partial_shape(0);
+    if (shape_y.rank().is_static()) {
+        NODE_VALIDATION_CHECK(this,
+                              shape_y.rank().get_length() == 4,
+                              "Y input with static shape shall have 4 dimensions (N, H, W, C)");
+
+        NODE_VALIDATION_CHECK(this,
+                              shape_y[C_DIM].is_dynamic() || shape_y[C_DIM].get_length() == 1,
+                              "Y channels dimension shall be either dynamic or equal to 1. Current value is ",
+                              shape_y[C_DIM].get_length());
+    }
+    auto out_shape = shape_y;
+    auto out_type = y_type;
+    if (out_shape.rank().is_dynamic()) {
+        out_shape = PartialShape{Dimension::dynamic(), Dimension::dynamic(), Dimension::dynamic(), 3};
+    }
+    out_shape[C_DIM] = 3;  // 3 is number of channels (R, G, B)
+    if (single_plane) {
+        if (shape_y.rank().is_static() && shape_y[H_DIM].is_static()) {
+            NODE_VALIDATION_CHECK(this,
+                                  shape_y[H_DIM].get_length() % 3 == 0,
+                                  "I420 image height shall be divisible by 3, but it is ",
+                                  shape_y[H_DIM].get_length());
+            // E.g. if input shape height is 720 for I420, then real image height is 720 * 2 / 3 = 480
+            out_shape[H_DIM] = shape_y[H_DIM].get_length() * 2 / 3;
+        }
+    } else {
+        // U and V planes are validated in the same way
+        for (size_t i = 1; i < 3; i++) {
+            const char* plane = i == 1 ? "U" : "V";
+            auto uv_type = get_input_element_type(i);
+            if (out_type.is_dynamic()) {
+                NODE_VALIDATION_CHECK(this,
+                                      is_type_supported(uv_type),
+                                      plane,
+                                      " input shall have u8 or floating-point precision, got ",
+                                      uv_type);
+                out_type = uv_type;
+            } else {
+                NODE_VALIDATION_CHECK(this,
+                                      uv_type.is_dynamic() || uv_type == out_type,
+                                      plane,
+                                      " input ",
+                                      uv_type,
+                                      " shall have same precision as Y input ",
+                                      out_type);
+            }
+            const auto& shape_uv = get_input_partial_shape(i);
+            NODE_VALIDATION_CHECK(this,
+                                  shape_uv.rank().is_dynamic() || shape_uv.rank().get_length() == 4,
+                                  plane,
+                                  " input with static shape shall have 4 dimensions (N, H, W, C)");
+            if (shape_uv.rank().is_dynamic()) {
+                continue;
+            }
+            NODE_VALIDATION_CHECK(this,
+                                  shape_uv[C_DIM].is_dynamic() || shape_uv[C_DIM].get_length() == 1,
+                                  plane,
+                                  " channels dimension shall be either dynamic or equal to 1. Current value is ",
+                                  shape_uv[C_DIM].get_length());
+            if (shape_y.rank().is_static()) {
+                // Verify that height and width for Y input are 2 times bigger than ones for U and V
+                NODE_VALIDATION_CHECK(this,
+                                      shape_y[H_DIM].is_dynamic() || shape_uv[H_DIM].is_dynamic() ||
+                                          shape_y[H_DIM].get_length() == shape_uv[H_DIM].get_length() * 2,
+                                      "Y input height shall be 2 times bigger that ",
+                                      plane,
+                                      " input height: Y height = ",
+                                      shape_y[H_DIM].get_length(),
+                                      " ",
+                                      plane,
+                                      " height = ",
+                                      shape_uv[H_DIM].get_length());
+                NODE_VALIDATION_CHECK(this,
+                                      shape_y[W_DIM].is_dynamic() || shape_uv[W_DIM].is_dynamic() ||
+                                          shape_y[W_DIM].get_length() == shape_uv[W_DIM].get_length() * 2,
+                                      "Y input width shall be 2 times bigger that ",
+                                      plane,
+                                      " input width: Y width = ",
+                                      shape_y[W_DIM].get_length(),
+                                      " ",
+                                      plane,
+                                      " width = ",
+                                      shape_uv[W_DIM].get_length());
+                NODE_VALIDATION_CHECK(this,
+                                      shape_y[N_DIM].is_dynamic() || shape_uv[N_DIM].is_dynamic() ||
+                                          shape_y[N_DIM].get_length() == shape_uv[N_DIM].get_length(),
+                                      "Y input batch shall be same as ",
+                                      plane,
+                                      " input batch: Y batch = ",
+                                      shape_y[N_DIM].get_length(),
+                                      " ",
+                                      plane,
+                                      " batch = ",
+                                      shape_uv[N_DIM].get_length());
+            }
+            // Set shape based on U/V shape, if Y are dynamic
+            if (out_shape[N_DIM].is_dynamic()) {
+                out_shape[N_DIM] = shape_uv[N_DIM];
+            }
+            if (out_shape[H_DIM].is_dynamic()) {
+                out_shape[H_DIM] = shape_uv[H_DIM] * 2;
+            }
+            if (out_shape[W_DIM].is_dynamic()) {
+                out_shape[W_DIM] = shape_uv[W_DIM] * 2;
+            }
+        }
+    }
+    NODE_VALIDATION_CHECK(this,
+                          out_shape[H_DIM].is_dynamic() || out_shape[H_DIM].get_length() % 2 == 0,
+                          "Image height must be even, but it is ",
+                          out_shape[H_DIM].get_length());
+    NODE_VALIDATION_CHECK(this,
+                          out_shape[W_DIM].is_dynamic() || out_shape[W_DIM].get_length() % 2 == 0,
+                          "Image width must be even, but it is ",
+                          out_shape[W_DIM].get_length());
+    set_output_type(0, out_type, out_shape);
+}
+
+namespace color_convert_i420_op {
+
+template <ov::element::Type_t ET>
+inline bool evaluate(const ov::HostTensorVector& input_values,
+                     const ov::HostTensorPtr& output_value,
+                     bool single_tensor,
+                     ov::op::util::ConvertColorI420Base::ColorConversion color_format) {
+    using namespace ov::op::util;
+    const auto& y_tensor = input_values[0];
+    auto batch_size = y_tensor->get_shape()[N_DIM];
+    auto image_w = y_tensor->get_shape()[W_DIM];
+    auto image_h = y_tensor->get_shape()[H_DIM];
+    if (single_tensor) {
+        OPENVINO_ASSERT(ngraph::validate_host_tensor_vector(input_values, 1));
+        image_h = image_h * 2 / 3;
+    } else {
+        OPENVINO_ASSERT(ngraph::validate_host_tensor_vector(input_values, 3));
+    }
+    output_value->set_shape({batch_size, image_h, image_w, 3});  // 3 is RGB
+    if (single_tensor) {
+        // Y plane is followed by U plane and then by V plane, each of U and V is a quarter of Y
+        auto y_ptr = y_tensor->get_data_ptr<ET>();
+        ngraph::runtime::reference::color_convert_i420(y_ptr,
+                                                       y_ptr + image_w * image_h,
+                                                       y_ptr + image_w * image_h * 5 / 4,
+                                                       output_value->get_data_ptr<ET>(),
+                                                       batch_size,
+                                                       image_h,
+                                                       image_w,
+                                                       image_w * image_h * 3 / 2,
+                                                       image_w * image_h * 3 / 2,
+                                                       color_format);
+    } else {
+        ngraph::runtime::reference::color_convert_i420(y_tensor->get_data_ptr<ET>(),
+                                                       input_values[1]->get_data_ptr<ET>(),
+                                                       input_values[2]->get_data_ptr<ET>(),
+                                                       output_value->get_data_ptr<ET>(),
+                                                       batch_size,
+                                                       image_h,
+                                                       image_w,
+                                                       image_w * image_h,
+                                                       image_w * image_h / 4,
+                                                       color_format);
+    }
+    return true;
+}
+
+bool evaluate_i420_convert(const ov::HostTensorVector& input_values,
+                           const ov::HostTensorPtr& output_value,
+                           bool single_tensor,
+                           ov::op::util::ConvertColorI420Base::ColorConversion conv_format) {
+    bool rc = false;
+    switch (input_values[0]->get_element_type()) {
+        NGRAPH_TYPE_CASE(evaluate_i420_convert, u8, input_values, output_value, single_tensor, conv_format);
+        NGRAPH_TYPE_CASE(evaluate_i420_convert, f16, input_values, output_value, single_tensor, conv_format);
+        NGRAPH_TYPE_CASE(evaluate_i420_convert, bf16, input_values, output_value, single_tensor, conv_format);
+        NGRAPH_TYPE_CASE(evaluate_i420_convert, f32, input_values, output_value, single_tensor, conv_format);
+        NGRAPH_TYPE_CASE(evaluate_i420_convert, f64, input_values, output_value, single_tensor, conv_format);
+    default:
+        break;
+    }
+    return rc;
+}
+
+}  // namespace color_convert_i420_op
+
+bool ov::op::util::ConvertColorI420Base::visit_attributes(AttributeVisitor& visitor) {
+    return true;
+}
+
+bool ov::op::util::ConvertColorI420Base::evaluate(const HostTensorVector& output_values,
+                                                  const HostTensorVector& input_values) const {
+    NGRAPH_OP_SCOPE(v0_ConvertColorI420_evaluate);
+    OPENVINO_ASSERT(ngraph::validate_host_tensor_vector(output_values, 1));
+    NODE_VALIDATION_CHECK(this,
+                          get_input_size() == 1 || get_input_size() == 3,
+                          "I420 conversion shall have one or 3 inputs, but it is ",
+                          get_input_size());
+    auto single_plane = get_input_size() == 1;
+    return color_convert_i420_op::evaluate_i420_convert(input_values, output_values[0], single_plane, m_format);
+}
+
+bool ov::op::util::ConvertColorI420Base::has_evaluate() const {
+    NGRAPH_OP_SCOPE(v0_ConvertColorI420Base_has_evaluate);
+
+    return is_type_supported(get_input_element_type(0));
+}
+
+bool ov::op::util::ConvertColorI420Base::is_type_supported(const ov::element::Type& type) const {
+    return type.is_dynamic() || type.is_real() || type == ov::element::u8;
+}
@@ -66,6 +66,35 @@ public:
         m_spatial_width = static_cast<int>(width);
     }
 
+    const ColorFormat& get_color_format() const {
+        return m_color_format;
+    }
+
+    const std::vector<std::string>& planes_sub_names() const {
+        return m_planes_sub_names;
+    }
+
+    void set_color_format(ColorFormat format, const std::vector<std::string>& sub_names) {
+        ColorFormatInfo info(format);
+        if (info.is_yuv()) {
+            OPENVINO_ASSERT(!m_layout_set || m_layout == Layout("NHWC"),
+                            "Layout of tensor with NV12/I420 color format shall be 'NHWC', got ",
+                            m_layout.to_string());
+        }
+        if (sub_names.empty()) {
+            m_planes_sub_names = info.default_sub_names();
+        } else {
+            OPENVINO_ASSERT(sub_names.size() == info.planes_count(),
+                            "Number of sub-names (",
+                            sub_names.size(),
+                            ") shall match with number of planes (",
+                            info.planes_count(),
+                            ") of the color format");
+            m_planes_sub_names = sub_names;
+        }
+        m_color_format = format;
+    }
+
 private:
     element::Type m_type = element::dynamic;
     bool m_type_set = false;
@@ -76,6 +105,9 @@ private:
     int m_spatial_width = -1;
     int m_spatial_height = -1;
     bool m_spatial_shape_set = false;
+
+    ColorFormat m_color_format = ColorFormat::UNDEFINED;
+    std::vector<std::string> m_planes_sub_names;
 };
 
 /// \brief InputNetworkInfoImpl - internal data structure
@@ -122,6 +154,78 @@ struct InputInfo::InputInfoImpl {
     std::unique_ptr<InputNetworkInfo::InputNetworkInfoImpl> m_network_data;
 };
 
+/// \brief OutputTensorInfoImpl - internal data structure
+class OutputTensorInfo::OutputTensorInfoImpl {
+public:
+    OutputTensorInfoImpl() = default;
+
+    void set_element_type(const element::Type& type) {
+        m_type = type;
+        m_type_set = true;
+    }
+    bool is_element_type_set() const {
+        return m_type_set;
+    }
+    const element::Type& get_element_type() const {
+        return m_type;
+    }
+
+    void set_layout(const Layout& layout) {
+        m_layout = layout;
+        m_layout_set = true;
+    }
+    bool is_layout_set() const {
+        return m_layout_set;
+    }
+    const Layout& get_layout() const {
+        return m_layout;
+    }
+
+private:
+    element::Type m_type = element::dynamic;
+    bool m_type_set = false;
+
+    Layout m_layout = Layout();
+    bool m_layout_set = false;
+};
+
+/// \brief OutputNetworkInfoImpl - internal data structure
+class OutputNetworkInfo::OutputNetworkInfoImpl {
+public:
+    OutputNetworkInfoImpl() = default;
+
+    void set_layout(const Layout& layout) {
+        m_layout = layout;
+        m_layout_set = true;
+    }
+    bool is_layout_set() const {
+        return m_layout_set;
+    }
+    const Layout& get_layout() const {
+        return m_layout;
+    }
+
+private:
+    Layout m_layout = Layout();
+    bool m_layout_set = false;
+};
+
+/// \brief OutputInfoImpl - internal data structure
+struct OutputInfo::OutputInfoImpl {
+    OutputInfoImpl() = default;
+    explicit OutputInfoImpl(size_t idx) : m_has_index(true), m_index(idx) {}
+
+    bool has_index() const {
+        return m_has_index;
+    }
+
+    bool m_has_index = false;
+    size_t m_index = 0;
+    std::unique_ptr<OutputTensorInfo::OutputTensorInfoImpl> m_tensor_data;
+    std::unique_ptr<PostProcessSteps::PostProcessStepsImpl> m_postprocess;
+    std::unique_ptr<OutputNetworkInfo::OutputNetworkInfoImpl> m_network_data;
+};
+
 //-------------- InputInfo ------------------
 InputInfo::InputInfo() : m_impl(std::unique_ptr<InputInfoImpl>(new InputInfoImpl)) {}
 InputInfo::InputInfo(size_t input_index) : m_impl(std::unique_ptr<InputInfoImpl>(new InputInfoImpl(input_index))) {}
@@ -159,10 +263,49 @@ InputInfo&& InputInfo::network(InputNetworkInfo&& builder) && {
     return std::move(*this);
 }
 
+//-------------- OutputInfo ------------------
+OutputInfo::OutputInfo() : m_impl(std::unique_ptr<OutputInfoImpl>(new OutputInfoImpl)) {}
+OutputInfo::OutputInfo(size_t output_index)
+    : m_impl(std::unique_ptr<OutputInfoImpl>(new OutputInfoImpl(output_index))) {}
+OutputInfo::OutputInfo(OutputInfo&&) noexcept = default;
+OutputInfo& OutputInfo::operator=(OutputInfo&&) noexcept = default;
+OutputInfo::~OutputInfo() = default;
+
+OutputInfo& OutputInfo::tensor(OutputTensorInfo&& builder) & {
+    m_impl->m_tensor_data = std::move(builder.m_impl);
+    return *this;
+}
+
+OutputInfo&& OutputInfo::tensor(OutputTensorInfo&& builder) && {
+    m_impl->m_tensor_data = std::move(builder.m_impl);
+    return std::move(*this);
+}
+
+OutputInfo& OutputInfo::postprocess(PostProcessSteps&& builder) & {
+    m_impl->m_postprocess = std::move(builder.m_impl);
+    return *this;
+}
+
+OutputInfo&& OutputInfo::postprocess(PostProcessSteps&& builder) && {
+    m_impl->m_postprocess = std::move(builder.m_impl);
+    return std::move(*this);
+}
+
+OutputInfo& OutputInfo::network(OutputNetworkInfo&& builder) & {
+    m_impl->m_network_data = std::move(builder.m_impl);
+    return *this;
+}
+
+OutputInfo&& OutputInfo::network(OutputNetworkInfo&& builder) && {
+    m_impl->m_network_data = std::move(builder.m_impl);
+    return std::move(*this);
+}
+
 // ------------------------ PrePostProcessor --------------------
 struct PrePostProcessor::PrePostProcessorImpl {
 public:
     std::list<std::unique_ptr<InputInfo::InputInfoImpl>> in_contexts;
+    std::list<std::unique_ptr<OutputInfo::OutputInfoImpl>> out_contexts;
 };
 
 PrePostProcessor::PrePostProcessor() : m_impl(std::unique_ptr<PrePostProcessorImpl>(new PrePostProcessorImpl())) {}
@@ -180,6 +323,16 @@ PrePostProcessor&& PrePostProcessor::input(InputInfo&& builder) && {
     return std::move(*this);
 }
 
+PrePostProcessor& PrePostProcessor::output(OutputInfo&& builder) & {
+    m_impl->out_contexts.push_back(std::move(builder.m_impl));
+    return *this;
+}
+
+PrePostProcessor&& PrePostProcessor::output(OutputInfo&& builder) && {
+    m_impl->out_contexts.push_back(std::move(builder.m_impl));
+    return std::move(*this);
+}
+
 std::shared_ptr<Function> PrePostProcessor::build(const std::shared_ptr<Function>& function) {
     bool tensor_data_updated = false;
     for (const auto& input : m_impl->in_contexts) {
@@ -204,6 +357,14 @@ std::shared_ptr<Function> PrePostProcessor::build(const std::shared_ptr<Function
         if (!input->m_tensor_data) {
             input->create_tensor_data(param->get_element_type(), param->get_layout());
         }
+        const ColorFormatInfo color_info(input->m_tensor_data->get_color_format());
+        if (color_info.is_yuv() && !input->m_tensor_data->is_layout_set()) {
+            // Planes of NV12/I420 images are always 'NHWC'
+            input->m_tensor_data->set_layout("NHWC");
+        }
+        OPENVINO_ASSERT(!color_info.is_yuv() || input->m_tensor_data->get_layout() == Layout("NHWC"),
+                        "Layout of tensor with NV12/I420 color format shall be 'NHWC', got ",
+                        input->m_tensor_data->get_layout().to_string());
         if (!input->m_tensor_data->is_layout_set() && param->get_layout() != Layout()) {
             input->m_tensor_data->set_layout(param->get_layout());
         }
@@ -236,25 +397,50 @@ std::shared_ptr<Function> PrePostProcessor::build(const std::shared_ptr<Function
                 new_param_shape[width_idx] = input->m_tensor_data->get_spatial_width();
             }
         }
-        auto new_param = std::make_shared<op::v0::Parameter>(input->m_tensor_data->get_element_type(), new_param_shape);
-        if (input->m_tensor_data->is_layout_set()) {
-            new_param->set_layout(input->m_tensor_data->get_layout());
-        }
-        // Old param will be removed, so friendly name can be reused
-        new_param->set_friendly_name(param->get_friendly_name());
+        // Multi-plane color formats create separate parameter for each plane
+        ParameterVector new_params;
+        const auto& sub_names = input->m_tensor_data->planes_sub_names();
+        for (size_t plane = 0; plane < color_info.planes_count(); plane++) {
+            auto plane_shape =
+                color_info.is_yuv() ? color_info.plane_shape(plane, new_param_shape) : new_param_shape;
+            auto plane_param =
+                std::make_shared<op::v0::Parameter>(input->m_tensor_data->get_element_type(), plane_shape);
+            if (input->m_tensor_data->is_layout_set()) {
+                plane_param->set_layout(input->m_tensor_data->get_layout());
+            }
+            if (sub_names.empty()) {
+                // Old param will be removed, so friendly name can be reused
+                plane_param->set_friendly_name(param->get_friendly_name());
 
-        // Also reuse names of original tensor
-        new_param->get_output_tensor(0).set_names(param->get_output_tensor(0).get_names());
+                // Also reuse names of original tensor
+                plane_param->get_output_tensor(0).set_names(param->get_output_tensor(0).get_names());
+            } else {
+                plane_param->set_friendly_name(param->get_friendly_name() + "/" + sub_names[plane]);
+                std::unordered_set<std::string> plane_names;
+                for (const auto& name : param->get_output_tensor(0).get_names()) {
+                    plane_names.insert(name + "/" + sub_names[plane]);
+                }
+                plane_param->get_output_tensor(0).set_names(plane_names);
+            }
+            new_params.push_back(plane_param);
+        }
 
-        std::shared_ptr<Node> node = new_param;
-        PreprocessingContext context(new_param->get_layout());
+        std::vector<std::shared_ptr<Node>> nodes(new_params.begin(), new_params.end());
+        PreprocessingContext context(new_params.front()->get_layout());
         context.network_layout() = param->get_layout();
         context.network_shape() = param->get_partial_shape();
+        context.color_format() = color_info.format();
         // 2. Apply preprocessing
-        for (const auto& action : input->m_preprocess->actions()) {
-            node = std::get<0>(action)({node}, context);
-            tensor_data_updated |= std::get<1>(action);
+        if (input->m_preprocess) {
+            for (const auto& action : input->m_preprocess->actions()) {
+                nodes = {std::get<0>(action)(nodes, context)};
+                tensor_data_updated |= std::get<1>(action);
+            }
         }
+        OPENVINO_ASSERT(nodes.size() == 1,
+                        "Multi-plane input is not converted to single image after preprocessing. Suggesting to "
+                        "convert current image to RGB/BGR color format using 'PreProcessSteps::convert_color'");
+        auto node = nodes.front();
 
         // Check final type
         OPENVINO_ASSERT(node->get_element_type() == param->get_element_type(),
@@ -267,10 +453,81 @@ std::shared_ptr<Function> PrePostProcessor::build(const std::shared_ptr<Function
         for (auto consumer : consumers) {
             consumer.replace_source_output(node);
         }
-        function->add_parameters({new_param});
+        function->add_parameters(new_params);
         // remove old parameter
         function->remove_parameter(param);
     }
+    // Post processing
+    for (const auto& output : m_impl->out_contexts) {
+        std::shared_ptr<op::v0::Result> result;
+        OPENVINO_ASSERT(output, "Internal error: Invalid postprocessing output, please report a problem");
+        if (output->has_index()) {
+            result = function->get_results().at(output->m_index);
+        } else {
+            // Default case
+            OPENVINO_ASSERT(function->get_results().size() == 1,
+                            std::string("Postprocessing info expects having 1 output, however function has ") +
+                                std::to_string(function->get_results().size()) +
+                                " outputs. Please use ov::preprocess::OutputInfo constructor specifying "
+                                "particular output instead of default one");
+            result = function->get_results().front();
+        }
+        // Set result layout from 'network' information
+        if (output->m_network_data && output->m_network_data->is_layout_set() && result->get_layout().empty()) {
+            result->set_layout(output->m_network_data->get_layout());
+        }
+        const auto orig_output = result->input_value(0);
+        auto node = orig_output;
+        PostprocessingContext context(result->get_layout());
+        if (output->m_tensor_data) {
+            if (output->m_tensor_data->is_layout_set()) {
+                context.target_layout() = output->m_tensor_data->get_layout();
+            }
+            if (output->m_tensor_data->is_element_type_set()) {
+                context.target_element_type() = output->m_tensor_data->get_element_type();
+            }
+        }
+
+        // 1. Apply post-processing steps
+        if (output->m_postprocess) {
+            for (const auto& action : output->m_postprocess->actions()) {
+                node = action(node, context);
+            }
+        }
+
+        // 2. Implicit conversions to user's tensor type and layout, if they aren't done by the steps
+        node = convert_output_element_type(node, context.target_element_type(), context);
+        if (!context.target_layout().empty() && !context.layout().empty()) {
+            node = convert_output_layout(node, context.target_layout(), context);
+        }
+
+        if (!context.layout().empty()) {
+            result->set_layout(context.layout());
+        }
+        if (node == orig_output) {
+            continue;
+        }
+        // Old API names the output by the friendly name of its producer, so the last post-processing node takes it
+        // over and the producer gets the unique auto-generated one. Names of parameters are kept for the inputs
+        auto orig_node = orig_output.get_node_shared_ptr();
+        if (!ov::is_type<op::v0::Parameter>(orig_node)) {
+            auto orig_name = orig_node->get_friendly_name();
+            if (orig_node->get_output_size() > 1) {
+                orig_name += "." + std::to_string(orig_output.get_index());
+            } else {
+                orig_node->set_friendly_name("");
+            }
+            node.get_node_shared_ptr()->set_friendly_name(orig_name);
+        }
+
+        // Move tensor names of original output to the post-processed one
+        const auto names = orig_output.get_tensor().get_names();
+        orig_output.get_tensor().set_names({});
+        node.get_tensor().set_names(names);
+
+        result->input(0).replace_source_output(node);
+        tensor_data_updated = true;
+    }
     if (tensor_data_updated) {
         function->validate_nodes_and_infer_types();
     }
@@ -323,6 +580,18 @@ InputTensorInfo&& InputTensorInfo::set_spatial_static_shape(size_t height, size_
     return std::move(*this);
 }
 
+InputTensorInfo& InputTensorInfo::set_color_format(const ov::preprocess::ColorFormat& format,
+                                                   const std::vector<std::string>& sub_names) & {
+    m_impl->set_color_format(format, sub_names);
+    return *this;
+}
+
+InputTensorInfo&& InputTensorInfo::set_color_format(const ov::preprocess::ColorFormat& format,
+                                                    const std::vector<std::string>& sub_names) && {
+    m_impl->set_color_format(format, sub_names);
+    return std::move(*this);
+}
+
 // --------------------- InputNetworkInfo ------------------
 InputNetworkInfo::InputNetworkInfo() : m_impl(std::unique_ptr<InputNetworkInfoImpl>(new InputNetworkInfoImpl())) {}
 InputNetworkInfo::InputNetworkInfo(InputNetworkInfo&&) noexcept = default;
@@ -339,6 +608,48 @@ InputNetworkInfo&& InputNetworkInfo::set_layout(const Layout& layout) && {
     return std::move(*this);
 }
 
+// --------------------- OutputTensorInfo ------------------
+OutputTensorInfo::OutputTensorInfo() : m_impl(std::unique_ptr<OutputTensorInfoImpl>(new OutputTensorInfoImpl())) {}
+OutputTensorInfo::OutputTensorInfo(OutputTensorInfo&&) noexcept = default;
+OutputTensorInfo& OutputTensorInfo::operator=(OutputTensorInfo&&) noexcept = default;
+OutputTensorInfo::~OutputTensorInfo() = default;
+
+OutputTensorInfo& OutputTensorInfo::set_element_type(const element::Type& type) & {
+    m_impl->set_element_type(type);
+    return *this;
+}
+
+OutputTensorInfo&& OutputTensorInfo::set_element_type(const element::Type& type) && {
+    m_impl->set_element_type(type);
+    return std::move(*this);
+}
+
+OutputTensorInfo& OutputTensorInfo::set_layout(const Layout& layout) & {
+    m_impl->set_layout(layout);
+    return *this;
+}
+
+OutputTensorInfo&& OutputTensorInfo::set_layout(const Layout& layout) && {
+    m_impl->set_layout(layout);
+    return std::move(*this);
+}
+
+// --------------------- OutputNetworkInfo ------------------
+OutputNetworkInfo::OutputNetworkInfo() : m_impl(std::unique_ptr<OutputNetworkInfoImpl>(new OutputNetworkInfoImpl())) {}
+OutputNetworkInfo::OutputNetworkInfo(OutputNetworkInfo&&) noexcept = default;
+OutputNetworkInfo& OutputNetworkInfo::operator=(OutputNetworkInfo&&) noexcept = default;
+OutputNetworkInfo::~OutputNetworkInfo() = default;
+
+OutputNetworkInfo& OutputNetworkInfo::set_layout(const Layout& layout) & {
+    m_impl->set_layout(layout);
+    return *this;
+}
+
+OutputNetworkInfo&& OutputNetworkInfo::set_layout(const Layout& layout) && {
+    m_impl->set_layout(layout);
+    return std::move(*this);
+}
+
 // --------------------- PreProcessSteps ------------------
 
 PreProcessSteps::PreProcessSteps() : m_impl(std::unique_ptr<PreProcessStepsImpl>(new PreProcessStepsImpl())) {}
@@ -432,6 +743,16 @@ PreProcessSteps&& PreProcessSteps::convert_layout(const Layout& dst_layout) && {
     return std::move(*this);
 }
 
+PreProcessSteps& PreProcessSteps::convert_color(const ov::preprocess::ColorFormat& dst_format) & {
+    m_impl->add_convert_color_impl(dst_format);
+    return *this;
+}
+
+PreProcessSteps&& PreProcessSteps::convert_color(const ov::preprocess::ColorFormat& dst_format) && {
+    m_impl->add_convert_color_impl(dst_format);
+    return std::move(*this);
+}
+
 PreProcessSteps& PreProcessSteps::custom(const CustomPreprocessOp& preprocess_cb) & {
     // 'true' indicates that custom preprocessing step will trigger validate_and_infer_types
     m_impl->actions().emplace_back(std::make_tuple(
@@ -458,5 +779,46 @@ PreProcessSteps&& PreProcessSteps::custom(const CustomPreprocessOp& preprocess_c
     return std::move(*this);
 }
 
+// --------------------- PostProcessSteps ------------------
+
+PostProcessSteps::PostProcessSteps() : m_impl(std::unique_ptr<PostProcessStepsImpl>(new PostProcessStepsImpl())) {}
+PostProcessSteps::PostProcessSteps(PostProcessSteps&&) noexcept = default;
+PostProcessSteps& PostProcessSteps::operator=(PostProcessSteps&&) noexcept = default;
+PostProcessSteps::~PostProcessSteps() = default;
+
+PostProcessSteps& PostProcessSteps::convert_element_type(const element::Type& type) & {
+    m_impl->add_convert_impl(type);
+    return *this;
+}
+
+PostProcessSteps&& PostProcessSteps::convert_element_type(const element::Type& type) && {
+    m_impl->add_convert_impl(type);
+    return std::move(*this);
+}
+
+PostProcessSteps& PostProcessSteps::convert_layout(const Layout& dst_layout) & {
+    m_impl->add_convert_layout_impl(dst_layout);
+    return *this;
+}
+
+PostProcessSteps&& PostProcessSteps::convert_layout(const Layout& dst_layout) && {
+    m_impl->add_convert_layout_impl(dst_layout);
+    return std::move(*this);
+}
+
+PostProcessSteps& PostProcessSteps::custom(const CustomPostprocessOp& postprocess_cb) & {
+    m_impl->actions().emplace_back([postprocess_cb](const Output<Node>& node, PostprocessingContext&) {
+        return postprocess_cb(node);
+    });
+    return *this;
+}
+
+PostProcessSteps&& PostProcessSteps::custom(const CustomPostprocessOp& postprocess_cb) && {
+    m_impl->actions().emplace_back([postprocess_cb](const Output<Node>& node, PostprocessingContext&) {
+        return postprocess_cb(node);
+    });
+    return std::move(*this);
+}
+
 }  // namespace preprocess
 }  // namespace ov
@@ -7,6 +7,10 @@
 #include "ngraph/opsets/opset1.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/shape.hpp"
+#include "openvino/op/i420_to_bgr.hpp"
+#include "openvino/op/i420_to_rgb.hpp"
+#include "openvino/op/nv12_to_bgr.hpp"
+#include "openvino/op/nv12_to_rgb.hpp"
 
 namespace ov {
 namespace preprocess {
@@ -166,5 +170,112 @@ void PreProcessSteps::PreProcessStepsImpl::add_convert_layout_impl(const Layout&
         true));
 }
 
+void PreProcessSteps::PreProcessStepsImpl::add_convert_color_impl(const ColorFormat& dst_format) {
+    m_actions.emplace_back(std::make_tuple(
+        [dst_format](const std::vector<std::shared_ptr<Node>>& nodes, PreprocessingContext& context) {
+            OPENVINO_ASSERT(!nodes.empty(), "Internal error: Can't convert color for empty input.");
+            OPENVINO_ASSERT(context.color_format() != ColorFormat::UNDEFINED,
+                            "Can't convert color of input with undefined color format. Use "
+                            "'InputTensorInfo::set_color_format' API to define color format of input");
+            OPENVINO_ASSERT(dst_format == ColorFormat::RGB || dst_format == ColorFormat::BGR,
+                            "Color conversion is supported to RGB or BGR formats only");
+            const auto src_format = context.color_format();
+            OPENVINO_ASSERT(nodes.size() == ColorFormatInfo(src_format).planes_count(),
+                            "Internal error: number of planes doesn't match to the source color format");
+            if (src_format == dst_format) {
+                return nodes[0];
+            }
+            const bool to_rgb = dst_format == ColorFormat::RGB;
+            std::shared_ptr<Node> convert;
+            switch (src_format) {
+            case ColorFormat::NV12_SINGLE_PLANE:
+                convert = to_rgb ? std::shared_ptr<Node>(std::make_shared<op::v8::NV12toRGB>(nodes[0]))
+                                 : std::make_shared<op::v8::NV12toBGR>(nodes[0]);
+                break;
+            case ColorFormat::NV12_TWO_PLANES:
+                convert = to_rgb ? std::shared_ptr<Node>(std::make_shared<op::v8::NV12toRGB>(nodes[0], nodes[1]))
+                                 : std::make_shared<op::v8::NV12toBGR>(nodes[0], nodes[1]);
+                break;
+            case ColorFormat::I420_SINGLE_PLANE:
+                convert = to_rgb ? std::shared_ptr<Node>(std::make_shared<op::v8::I420toRGB>(nodes[0]))
+                                 : std::make_shared<op::v8::I420toBGR>(nodes[0]);
+                break;
+            case ColorFormat::I420_THREE_PLANES:
+                convert = to_rgb
+                              ? std::shared_ptr<Node>(std::make_shared<op::v8::I420toRGB>(nodes[0], nodes[1], nodes[2]))
+                              : std::make_shared<op::v8::I420toBGR>(nodes[0], nodes[1], nodes[2]);
+                break;
+            default: {
+                // RGB <-> BGR, reverse order of channels
+                auto channels_idx = get_and_check_channels_idx(context.layout(), nodes[0]->get_output_partial_shape(0));
+                auto indices = op::v0::Constant::create<int64_t>(element::i64, Shape{3}, {2, 1, 0});
+                auto axis = op::v0::Constant::create<int64_t>(element::i64, Shape{}, {static_cast<int64_t>(channels_idx)});
+                convert = std::make_shared<op::v1::Gather>(nodes[0], indices, axis);
+                break;
+            }
+            }
+            // Friendly name of single plane input is the name of original input, planes are named with '/<sub_name>'
+            auto name = nodes[0]->get_friendly_name();
+            if (nodes.size() > 1) {
+                name = name.substr(0, name.rfind('/'));
+            }
+            convert->set_friendly_name(name + "/convert_color");
+            if (ColorFormatInfo(src_format).is_yuv()) {
+                // Color conversion operations produce 'NHWC' image
+                context.layout() = "NHWC";
+            }
+            context.color_format() = dst_format;
+            return convert;
+        },
+        true));
+}
+
+//------------- Post processing ------
+Output<Node> convert_output_element_type(const Output<Node>& node,
+                                         const element::Type& type,
+                                         PostprocessingContext& context) {
+    element::Type t = type == element::undefined ? context.target_element_type() : type;
+    if (t == element::undefined || t == node.get_element_type()) {
+        return node;
+    }
+    OPENVINO_ASSERT(!t.is_dynamic(), "Can't convert to dynamic element type");
+    OPENVINO_ASSERT(node.get_element_type().is_static(),
+                    "Can't insert 'convert_element_type' for dynamic source tensor type.");
+    auto convert = std::make_shared<op::v0::Convert>(node, t);
+    convert->set_friendly_name(node.get_node()->get_friendly_name() + "/convert_element_type");
+    return convert->output(0);
+}
+
+Output<Node> convert_output_layout(const Output<Node>& node, const Layout& layout, PostprocessingContext& context) {
+    Layout dst_layout = layout.empty() ? context.target_layout() : layout;
+    if (dst_layout == context.layout()) {
+        return node;
+    }
+    OPENVINO_ASSERT(!context.layout().empty(),
+                    "Can't convert layout of output without layout specified. Use 'OutputNetworkInfo::set_layout' "
+                    "API to define layout of network's output, like `NCHW`");
+    OPENVINO_ASSERT(!dst_layout.empty(),
+                    "Can't convert layout of output to undefined layout. Specify destination layout or use "
+                    "'OutputTensorInfo::set_layout' API");
+    auto permutation = layout::find_permutation(context.layout(), node.get_partial_shape().rank(), dst_layout);
+    auto perm_constant = op::v0::Constant::create<int64_t>(element::i64, Shape{permutation.size()}, permutation);
+    auto transpose = std::make_shared<op::v1::Transpose>(node, perm_constant);
+    transpose->set_friendly_name(node.get_node()->get_friendly_name() + "/convert_layout");
+    context.layout() = dst_layout;  // Update context's current layout
+    return transpose->output(0);
+}
+
+void PostProcessSteps::PostProcessStepsImpl::add_convert_impl(const element::Type& type) {
+    m_actions.emplace_back([type](const Output<Node>& node, PostprocessingContext& context) {
+        return convert_output_element_type(node, type, context);
+    });
+}
+
+void PostProcessSteps::PostProcessStepsImpl::add_convert_layout_impl(const Layout& layout) {
+    m_actions.emplace_back([layout](const Output<Node>& node, PostprocessingContext& context) {
+        return convert_output_layout(node, layout, context);
+    });
+}
+
 }  // namespace preprocess
 }  // namespace ov
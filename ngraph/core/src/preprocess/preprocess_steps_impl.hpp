@@ -8,6 +8,7 @@
 
 #include "openvino/core/layout.hpp"
 #include "openvino/core/partial_shape.hpp"
+#include "openvino/core/preprocess/postprocess_steps.hpp"
 #include "openvino/core/preprocess/preprocess_steps.hpp"
 
 namespace ov {
@@ -55,6 +56,70 @@ inline size_t get_and_check_channels_idx(const Layout& layout, const PartialShap
     return idx;
 }
 
+/// \brief Planes of the color format, used to create separate input parameters for multi-plane formats
+class ColorFormatInfo {
+public:
+    explicit ColorFormatInfo(ColorFormat format) : m_format(format) {}
+
+    ColorFormat format() const {
+        return m_format;
+    }
+
+    bool is_yuv() const {
+        return m_format == ColorFormat::NV12_SINGLE_PLANE || m_format == ColorFormat::NV12_TWO_PLANES ||
+               m_format == ColorFormat::I420_SINGLE_PLANE || m_format == ColorFormat::I420_THREE_PLANES;
+    }
+
+    size_t planes_count() const {
+        switch (m_format) {
+        case ColorFormat::NV12_TWO_PLANES:
+            return 2;
+        case ColorFormat::I420_THREE_PLANES:
+            return 3;
+        default:
+            return 1;
+        }
+    }
+
+    std::vector<std::string> default_sub_names() const {
+        switch (m_format) {
+        case ColorFormat::NV12_TWO_PLANES:
+            return {"Y", "UV"};
+        case ColorFormat::I420_THREE_PLANES:
+            return {"Y", "U", "V"};
+        default:
+            return {};
+        }
+    }
+
+    /// \brief Shape of the plane, calculated from 'NHWC' shape of the converted image
+    PartialShape plane_shape(size_t plane, const PartialShape& image_shape) const {
+        OPENVINO_ASSERT(image_shape.rank().compatible(4),
+                        "Input shape for color format conversion shall have 4 dimensions ('NHWC'), got ",
+                        image_shape);
+        if (!is_yuv()) {
+            return image_shape;
+        }
+        auto shape = image_shape.rank().is_static() ? image_shape : PartialShape::dynamic(4);
+        auto half = [](const Dimension& dim) {
+            return dim.is_static() ? Dimension(dim.get_length() / 2) : dim;
+        };
+        if (planes_count() == 1) {
+            // All the planes are stored one by one in one tensor with 1.5 height of the image
+            auto height = shape[1].is_static() ? Dimension(shape[1].get_length() * 3 / 2) : shape[1];
+            return {shape[0], height, shape[2], 1};
+        }
+        if (plane == 0) {
+            return {shape[0], shape[1], shape[2], 1};
+        }
+        // Interleaved UV plane of NV12 has 2 channels, U and V planes of I420 - 1 channel
+        return {shape[0], half(shape[1]), half(shape[2]), m_format == ColorFormat::NV12_TWO_PLANES ? 2 : 1};
+    }
+
+private:
+    ColorFormat m_format;
+};
+
 /// \brief Preprocessing context passed to each preprocessing operation.
 /// This is internal structure which is not shared to custom operations yet.
 class PreprocessingContext {
@@ -99,10 +164,20 @@ public:
         return network_shape()[network_width_idx].get_length();
     }
 
+    // Color format of the current input, updated by 'convert_color' step
+    const ColorFormat& color_format() const {
+        return m_color_format;
+    }
+
+    ColorFormat& color_format() {
+        return m_color_format;
+    }
+
 private:
     Layout m_layout;
     PartialShape m_network_shape;
     Layout m_network_layout;
+    ColorFormat m_color_format = ColorFormat::UNDEFINED;
 };
 
 using InternalPreprocessOp =
@@ -117,6 +192,7 @@ public:
     void add_convert_impl(const element::Type& type);
     void add_resize_impl(ResizeAlgorithm alg, int dst_height, int dst_width);
     void add_convert_layout_impl(const Layout& layout);
+    void add_convert_color_impl(const ColorFormat& dst_format);
 
     const std::list<std::tuple<InternalPreprocessOp, bool>>& actions() const {
         return m_actions;
@@ -129,5 +205,71 @@ private:
     std::list<std::tuple<InternalPreprocessOp, bool>> m_actions;
 };
 
+/// \brief Postprocessing context passed to each postprocessing operation.
+/// This is internal structure which is not shared to custom operations yet.
+class PostprocessingContext {
+public:
+    explicit PostprocessingContext(const Layout& layout) : m_layout(layout) {}
+
+    const Layout& layout() const {
+        return m_layout;
+    }
+
+    Layout& layout() {
+        return m_layout;
+    }
+
+    // Layout of user's output tensor, i.e. the layout after all postprocessing steps
+    const Layout& target_layout() const {
+        return m_target_layout;
+    }
+
+    Layout& target_layout() {
+        return m_target_layout;
+    }
+
+    // Element type of user's output tensor
+    const element::Type& target_element_type() const {
+        return m_target_element_type;
+    }
+
+    element::Type& target_element_type() {
+        return m_target_element_type;
+    }
+
+private:
+    Layout m_layout;
+    Layout m_target_layout;
+    element::Type m_target_element_type;
+};
+
+using InternalPostprocessOp =
+    std::function<ov::Output<ov::Node>(const ov::Output<ov::Node>& node, PostprocessingContext& context)>;
+
+/// \brief Converts element type of the output to the type, or to user's tensor type if the type is undefined
+Output<Node> convert_output_element_type(const Output<Node>& node,
+                                         const element::Type& type,
+                                         PostprocessingContext& context);
+
+/// \brief Converts layout of the output to the layout, or to user's tensor layout if the layout is empty
+Output<Node> convert_output_layout(const Output<Node>& node, const Layout& layout, PostprocessingContext& context);
+
+/// \brief PostProcessStepsImpl - internal data structure
+class PostProcessSteps::PostProcessStepsImpl {
+public:
+    void add_convert_impl(const element::Type& type);
+    void add_convert_layout_impl(const Layout& layout);
+
+    const std::list<InternalPostprocessOp>& actions() const {
+        return m_actions;
+    }
+    std::list<InternalPostprocessOp>& actions() {
+        return m_actions;
+    }
+
+private:
+    std::list<InternalPostprocessOp> m_actions;
+};
+
 }  // namespace preprocess
 }  // namespace ov
@@ -75,4 +75,22 @@ public:
 using Extensions = std::map<std::string, ngraph::OpSet>;
 using ExtensionsVariant = VariantWrapper<Extensions>;
 
+/// \brief Defines how a frontend loads the weights file provided by a path
+enum class WeightsLoadMode {
+    Read,  ///< the whole file is read to an allocated buffer
+    Mmap   ///< the file is memory-mapped, so constants refer to the file pages directly
+};
+
+template <>
+class FRONTEND_API VariantWrapper<WeightsLoadMode> : public VariantImpl<WeightsLoadMode> {
+public:
+    static constexpr VariantTypeInfo type_info{"Variant::WeightsLoadMode", 0};
+    const VariantTypeInfo& get_type_info() const override {
+        return type_info;
+    }
+    VariantWrapper(const value_type& value) : VariantImpl<value_type>(value) {}
+};
+
+using WeightsLoadModeVariant = VariantWrapper<WeightsLoadMode>;
+
 }  // namespace ov
\ No newline at end of file
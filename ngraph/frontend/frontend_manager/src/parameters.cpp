@@ -12,4 +12,6 @@ constexpr VariantTypeInfo VariantWrapper<std::istringstream*>::type_info;
 
 constexpr VariantTypeInfo VariantWrapper<std::shared_ptr<ngraph::runtime::AlignedBuffer>>::type_info;
 
-constexpr VariantTypeInfo VariantWrapper<std::map<std::string, ngraph::OpSet>>::type_info;
\ No newline at end of file
+constexpr VariantTypeInfo VariantWrapper<std::map<std::string, ngraph::OpSet>>::type_info;
+
+constexpr VariantTypeInfo VariantWrapper<ov::WeightsLoadMode>::type_info;
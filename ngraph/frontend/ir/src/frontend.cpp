@@ -10,6 +10,7 @@
 #include <ir_frontend/utility.hpp>
 #include <ngraph/variant.hpp>
 #include <openvino/util/file_util.hpp>
+#include <openvino/util/mmap_object.hpp>
 #include <vector>
 
 using namespace ngraph;
@@ -56,7 +57,7 @@ bool FrontEndIR::supported_impl(const std::vector<std::shared_ptr<Variant>>& var
     std::ifstream local_model_stream;
     std::istream* provided_model_stream = nullptr;
 
-    if (variants.empty() || variants.size() > 3) {
+    if (variants.empty() || variants.size() > 4) {
         return false;
     }
 
@@ -97,6 +98,7 @@ InputModel::Ptr FrontEndIR::load_impl(const std::vector<std::shared_ptr<Variant>
     std::istream* provided_model_stream = nullptr;
     ov::Weights weights;
     ov::Extensions extensions;
+    ov::WeightsLoadMode weights_load_mode = ov::WeightsLoadMode::Read;
 
     auto create_input_model = [&]() -> std::shared_ptr<InputModelIR> {
         if (provided_model_stream) {
@@ -154,6 +156,8 @@ InputModel::Ptr FrontEndIR::load_impl(const std::vector<std::shared_ptr<Variant>
             weights = ov::as_type_ptr<ov::WeightsVariant>(variant)->get();
         } else if (ov::is_type<ov::ExtensionsVariant>(variant)) {
             extensions = ov::as_type_ptr<ov::ExtensionsVariant>(variant)->get();
+        } else if (ov::is_type<ov::WeightsLoadModeVariant>(variant)) {
+            weights_load_mode = ov::as_type_ptr<ov::WeightsLoadModeVariant>(variant)->get();
         }
     }
 
@@ -173,7 +177,28 @@ InputModel::Ptr FrontEndIR::load_impl(const std::vector<std::shared_ptr<Variant>
         }
     }
 
-    if (!weights_path.empty()) {
+    if (!weights_path.empty() && weights_load_mode == ov::WeightsLoadMode::Mmap) {
+        std::shared_ptr<ov::util::MappedMemory> mapped_memory;
+        try {
+            mapped_memory = ov::util::load_mmap_object(weights_path);
+        } catch (const std::runtime_error&) {
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+            IR_THROW("Weights file " + ov::util::wstring_to_string(weights_path) + " cannot be mapped!");
+#else
+            IR_THROW("Weights file " + weights_path + " cannot be mapped!");
+#endif
+        }
+        if (mapped_memory->size() == 0) {
+            // nothing is mapped for the empty file, it is read as empty weights the same way as without mapping
+            weights = std::make_shared<runtime::AlignedBuffer>(0);
+        } else {
+            // the constants refer to the mapped pages, so the mapping lives as long as any of them
+            weights = std::make_shared<runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>>(
+                mapped_memory->data(),
+                mapped_memory->size(),
+                mapped_memory);
+        }
+    } else if (!weights_path.empty()) {
         std::ifstream bin_stream;
         bin_stream.open(weights_path, std::ios::binary);
         if (!bin_stream.is_open())
@@ -0,0 +1,73 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/util/mmap_object.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#include "gtest/gtest.h"
+
+using namespace std;
+
+namespace {
+class MmapObjectTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        std::remove(m_path.c_str());
+    }
+
+    void write_file(const string& content) {
+        ofstream file(m_path, ios::binary | ios::trunc);
+        file.write(content.data(), content.size());
+    }
+
+    const string m_path = "mmap_object_test.bin";
+};
+}  // namespace
+
+TEST_F(MmapObjectTest, load_file) {
+    const string content = "0123456789abcdef";
+    write_file(content);
+
+    for (bool read_only : {false, true}) {
+        auto mapped = ov::util::load_mmap_object(m_path, read_only);
+        ASSERT_NE(nullptr, mapped);
+        ASSERT_EQ(content.size(), mapped->size());
+        ASSERT_NE(nullptr, mapped->data());
+        ASSERT_EQ(0, memcmp(content.data(), mapped->data(), content.size()));
+    }
+}
+
+TEST_F(MmapObjectTest, writing_to_private_mapping_keeps_file) {
+    const string content = "0123456789abcdef";
+    write_file(content);
+
+    {
+        auto mapped = ov::util::load_mmap_object(m_path);
+        mapped->data()[0] = 'x';
+        ASSERT_EQ('x', mapped->data()[0]);
+    }
+    auto mapped = ov::util::load_mmap_object(m_path, true);
+    ASSERT_EQ(0, memcmp(content.data(), mapped->data(), content.size()));
+}
+
+TEST_F(MmapObjectTest, load_empty_file) {
+    write_file("");
+
+    for (bool read_only : {false, true}) {
+        auto mapped = ov::util::load_mmap_object(m_path, read_only);
+        ASSERT_NE(nullptr, mapped);
+        ASSERT_EQ(0, mapped->size());
+        // nothing is mapped for the empty file
+        ASSERT_EQ(nullptr, mapped->data());
+    }
+}
+
+TEST_F(MmapObjectTest, load_missing_file) {
+    ASSERT_THROW(ov::util::load_mmap_object(m_path), std::runtime_error);
+    ASSERT_THROW(ov::util::load_mmap_object(m_path, true), std::runtime_error);
+}
@@ -327,3 +327,335 @@ TEST(pre_post_process, resize_no_tensor_width) {
                          .build(f),
                  ov::AssertFailure);
 }
+
+// --- Color conversion ---
+
+TEST(pre_post_process, convert_color_nv12_rgb_single) {
+    auto f = create_simple_function(element::f32, PartialShape{Dimension::dynamic(), 2, 2, 3});
+    f = PrePostProcessor()
+            .input(InputInfo()
+                       .tensor(InputTensorInfo().set_color_format(ColorFormat::NV12_SINGLE_PLANE))
+                       .preprocess(PreProcessSteps().convert_color(ColorFormat::RGB)))
+            .build(f);
+
+    EXPECT_EQ(f->get_parameters().size(), 1);
+    EXPECT_EQ(f->get_parameters().front()->get_partial_shape(), (PartialShape{Dimension::dynamic(), 3, 2, 1}));
+    EXPECT_EQ(f->get_parameters().front()->get_layout(), "NHWC");
+    EXPECT_EQ(f->get_parameters().front()->get_friendly_name(), "input1");
+    EXPECT_EQ(f->get_parameters().front()->get_output_tensor(0).get_names(),
+              std::unordered_set<std::string>{"tensor_input1"});
+    EXPECT_EQ(f->get_output_partial_shape(0), (PartialShape{Dimension::dynamic(), 2, 2, 3}));
+    EXPECT_TRUE(ov::is_type<op::v8::NV12toRGB>(f->get_result()->get_input_node_shared_ptr(0)));
+}
+
+TEST(pre_post_process, convert_color_nv12_bgr_2_planes_u8) {
+    auto f = create_simple_function(element::f32, Shape{1, 3, 4, 6});
+    f = PrePostProcessor()
+            .input(InputInfo()
+                       .tensor(InputTensorInfo()
+                                   .set_element_type(element::u8)
+                                   .set_color_format(ColorFormat::NV12_TWO_PLANES))
+                       .preprocess(PreProcessSteps()
+                                       .convert_color(ColorFormat::BGR)
+                                       .convert_element_type(element::f32)
+                                       .convert_layout())
+                       .network(InputNetworkInfo().set_layout("NCHW")))
+            .build(f);
+
+    ASSERT_EQ(f->get_parameters().size(), 2);
+    EXPECT_EQ(f->get_parameters()[0]->get_element_type(), element::u8);
+    EXPECT_EQ(f->get_parameters()[0]->get_shape(), (Shape{1, 4, 6, 1}));
+    EXPECT_EQ(f->get_parameters()[0]->get_friendly_name(), "input1/Y");
+    EXPECT_EQ(f->get_parameters()[0]->get_output_tensor(0).get_names(),
+              std::unordered_set<std::string>{"tensor_input1/Y"});
+    EXPECT_EQ(f->get_parameters()[1]->get_element_type(), element::u8);
+    EXPECT_EQ(f->get_parameters()[1]->get_shape(), (Shape{1, 2, 3, 2}));
+    EXPECT_EQ(f->get_parameters()[1]->get_friendly_name(), "input1/UV");
+    EXPECT_EQ(f->get_parameters()[1]->get_output_tensor(0).get_names(),
+              std::unordered_set<std::string>{"tensor_input1/UV"});
+    EXPECT_EQ(f->get_output_element_type(0), element::f32);
+    EXPECT_EQ(f->get_output_shape(0), (Shape{1, 3, 4, 6}));
+}
+
+TEST(pre_post_process, convert_color_i420_three_planes_sub_names) {
+    auto f = create_simple_function(element::u8, Shape{2, 8, 4, 3});
+    f = PrePostProcessor()
+            .input(InputInfo()
+                       .tensor(InputTensorInfo().set_color_format(ColorFormat::I420_THREE_PLANES, {"y", "u", "v"}))
+                       .preprocess(PreProcessSteps().convert_color(ColorFormat::RGB)))
+            .build(f);
+
+    ASSERT_EQ(f->get_parameters().size(), 3);
+    EXPECT_EQ(f->get_parameters()[0]->get_shape(), (Shape{2, 8, 4, 1}));
+    EXPECT_EQ(f->get_parameters()[0]->get_friendly_name(), "input1/y");
+    EXPECT_EQ(f->get_parameters()[1]->get_shape(), (Shape{2, 4, 2, 1}));
+    EXPECT_EQ(f->get_parameters()[1]->get_friendly_name(), "input1/u");
+    EXPECT_EQ(f->get_parameters()[2]->get_shape(), (Shape{2, 4, 2, 1}));
+    EXPECT_EQ(f->get_parameters()[2]->get_friendly_name(), "input1/v");
+    EXPECT_EQ(f->get_output_shape(0), (Shape{2, 8, 4, 3}));
+    EXPECT_TRUE(ov::is_type<op::v8::I420toRGB>(f->get_result()->get_input_node_shared_ptr(0)));
+}
+
+TEST(pre_post_process, convert_color_i420_single_plane) {
+    auto f = create_simple_function(element::f32, Shape{1, 4, 2, 3});
+    f = PrePostProcessor()
+            .input(InputInfo()
+                       .tensor(InputTensorInfo().set_color_format(ColorFormat::I420_SINGLE_PLANE))
+                       .preprocess(PreProcessSteps().convert_color(ColorFormat::BGR).mean(1.f)))
+            .build(f);
+
+    ASSERT_EQ(f->get_parameters().size(), 1);
+    EXPECT_EQ(f->get_parameters().front()->get_shape(), (Shape{1, 6, 2, 1}));
+    EXPECT_EQ(f->get_output_shape(0), (Shape{1, 4, 2, 3}));
+}
+
+TEST(pre_post_process, convert_color_rgb_to_bgr) {
+    auto f = create_simple_function(element::f32, Shape{1, 3, 2, 2});
+    f = PrePostProcessor()
+            .input(InputInfo()
+                       .tensor(InputTensorInfo().set_layout("NCHW").set_color_format(ColorFormat::RGB))
+                       .preprocess(PreProcessSteps().convert_color(ColorFormat::BGR)))
+            .build(f);
+
+    EXPECT_EQ(f->get_parameters().front()->get_shape(), (Shape{1, 3, 2, 2}));
+    EXPECT_EQ(f->get_output_shape(0), (Shape{1, 3, 2, 2}));
+    EXPECT_TRUE(ov::is_type<op::v1::Gather>(f->get_result()->get_input_node_shared_ptr(0)));
+}
+
+TEST(pre_post_process, convert_color_same_format) {
+    auto f = create_simple_function(element::f32, Shape{1, 2, 2, 3});
+    f = PrePostProcessor()
+            .input(InputInfo()
+                       .tensor(InputTensorInfo().set_color_format(ColorFormat::BGR))
+                       .preprocess(PreProcessSteps().convert_color(ColorFormat::BGR)))
+            .build(f);
+
+    EXPECT_TRUE(ov::is_type<op::v0::Parameter>(f->get_result()->get_input_node_shared_ptr(0)));
+}
+
+TEST(pre_post_process, convert_color_undefined_source) {
+    auto f = create_simple_function(element::f32, Shape{1, 2, 2, 3});
+    EXPECT_THROW(f = PrePostProcessor()
+                         .input(InputInfo().preprocess(PreProcessSteps().convert_color(ColorFormat::RGB)))
+                         .build(f),
+                 ov::AssertFailure);
+}
+
+TEST(pre_post_process, convert_color_unsupported_destination) {
+    auto f = create_simple_function(element::f32, Shape{1, 2, 2, 3});
+    EXPECT_THROW(f = PrePostProcessor()
+                         .input(InputInfo()
+                                    .tensor(InputTensorInfo().set_color_format(ColorFormat::RGB))
+                                    .preprocess(PreProcessSteps().convert_color(ColorFormat::NV12_SINGLE_PLANE)))
+                         .build(f),
+                 ov::AssertFailure);
+}
+
+TEST(pre_post_process, convert_color_multi_plane_not_converted) {
+    auto f = create_simple_function(element::f32, Shape{1, 2, 2, 3});
+    EXPECT_THROW(f = PrePostProcessor()
+                         .input(InputInfo().tensor(InputTensorInfo().set_color_format(ColorFormat::NV12_TWO_PLANES)))
+                         .build(f),
+                 ov::AssertFailure);
+}
+
+TEST(pre_post_process, convert_color_multi_plane_step_before_convert) {
+    auto f = create_simple_function(element::f32, Shape{1, 2, 2, 3});
+    EXPECT_THROW(f = PrePostProcessor()
+                         .input(InputInfo()
+                                    .tensor(InputTensorInfo().set_color_format(ColorFormat::I420_THREE_PLANES))
+                                    .preprocess(PreProcessSteps().mean(1.f).convert_color(ColorFormat::RGB)))
+                         .build(f),
+                 ov::AssertFailure);
+}
+
+TEST(pre_post_process, convert_color_sub_names_mismatch) {
+    EXPECT_THROW(InputTensorInfo().set_color_format(ColorFormat::NV12_TWO_PLANES, {"Y"}), ov::AssertFailure);
+    EXPECT_THROW(InputTensorInfo().set_color_format(ColorFormat::I420_THREE_PLANES, {"Y", "U", "V", "A"}),
+                 ov::AssertFailure);
+}
+
+TEST(pre_post_process, convert_color_nv12_not_nhwc_layout) {
+    auto f = create_simple_function(element::f32, Shape{1, 3, 2, 2});
+    EXPECT_THROW(InputTensorInfo().set_layout("NCHW").set_color_format(ColorFormat::NV12_SINGLE_PLANE),
+                 ov::AssertFailure);
+    EXPECT_THROW(f = PrePostProcessor()
+                         .input(InputInfo()
+                                    .tensor(InputTensorInfo()
+                                                .set_color_format(ColorFormat::NV12_SINGLE_PLANE)
+                                                .set_layout("NCHW"))
+                                    .preprocess(PreProcessSteps().convert_color(ColorFormat::RGB)))
+                         .build(f),
+                 ov::AssertFailure);
+}
+
+// --- PostProcess - convert element type ---
+
+TEST(pre_post_process, postprocess_convert_element_type_explicit) {
+    auto f = create_simple_function(element::f32, Shape{1, 3, 2, 2});
+    f = PrePostProcessor()
+            .output(OutputInfo().postprocess(PostProcessSteps().convert_element_type(element::u8)))
+            .build(f);
+    EXPECT_EQ(f->get_results().size(), 1);
+    EXPECT_EQ(f->get_results()[0]->get_friendly_name(), "Result");
+    EXPECT_EQ(f->get_output_element_type(0), element::u8);
+    // names of the parameter are kept for the input
+    EXPECT_EQ(f->get_parameters()[0]->get_friendly_name(), "input1");
+}
+
+TEST(pre_post_process, postprocess_convert_element_type_implicit) {
+    auto f = create_simple_function(element::f32, Shape{1, 3, 2, 2});
+    f = PrePostProcessor().output(OutputInfo().tensor(OutputTensorInfo().set_element_type(element::f16))).build(f);
+    EXPECT_EQ(f->get_output_element_type(0), element::f16);
+}
+
+TEST(pre_post_process, postprocess_convert_element_type_same) {
+    auto f = create_simple_function(element::f32, Shape{1, 3, 2, 2});
+    auto producer = f->get_results()[0]->get_input_node_shared_ptr(0);
+    f = PrePostProcessor()
+            .output(OutputInfo()
+                        .postprocess(PostProcessSteps().convert_element_type())
+                        .tensor(OutputTensorInfo().set_element_type(element::f32)))
+            .build(f);
+    EXPECT_EQ(f->get_results()[0]->get_input_node_shared_ptr(0), producer);
+}
+
+TEST(pre_post_process, postprocess_names) {
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, Shape{1, 3, 2, 2});
+    data->set_friendly_name("input1");
+    auto relu = std::make_shared<op::v0::Relu>(data);
+    relu->set_friendly_name("relu");
+    relu->get_output_tensor(0).set_names({"tensor_relu"});
+    auto res = std::make_shared<op::v0::Result>(relu);
+    res->set_friendly_name("Result");
+    auto f = std::make_shared<Function>(ResultVector{res}, ParameterVector{data});
+
+    f = PrePostProcessor()
+            .output(OutputInfo().tensor(OutputTensorInfo().set_element_type(element::u8)))
+            .build(f);
+    auto last = f->get_results()[0]->get_input_node_shared_ptr(0);
+    EXPECT_TRUE(ov::is_type<op::v0::Convert>(last));
+    // the output keeps the name of the original producer and its tensor names
+    EXPECT_EQ(last->get_friendly_name(), "relu");
+    EXPECT_EQ(last->get_output_tensor(0).get_names(), std::unordered_set<std::string>{"tensor_relu"});
+    EXPECT_NE(relu->get_friendly_name(), "relu");
+    EXPECT_TRUE(relu->get_output_tensor(0).get_names().empty());
+    EXPECT_EQ(f->get_results()[0], res);
+}
+
+// --- PostProcess - convert layout ---
+
+TEST(pre_post_process, postprocess_convert_layout_explicit) {
+    auto f = create_simple_function(element::f32, Shape{1, 3, 2, 4});
+    f = PrePostProcessor()
+            .output(OutputInfo()
+                        .network(OutputNetworkInfo().set_layout("NCHW"))
+                        .postprocess(PostProcessSteps().convert_layout("NHWC")))
+            .build(f);
+    EXPECT_EQ(f->get_results()[0]->get_layout(), "NHWC");
+    EXPECT_EQ(f->get_results()[0]->get_output_shape(0), (Shape{1, 2, 4, 3}));
+}
+
+TEST(pre_post_process, postprocess_convert_layout_implicit) {
+    auto f = create_simple_function(element::f32, Shape{1, 3, 2, 4});
+    f = PrePostProcessor()
+            .output(OutputInfo()
+                        .network(OutputNetworkInfo().set_layout("NCHW"))
+                        .tensor(OutputTensorInfo().set_layout("NHWC").set_element_type(element::u8)))
+            .build(f);
+    EXPECT_EQ(f->get_results()[0]->get_layout(), "NHWC");
+    EXPECT_EQ(f->get_results()[0]->get_output_shape(0), (Shape{1, 2, 4, 3}));
+    EXPECT_EQ(f->get_output_element_type(0), element::u8);
+}
+
+TEST(pre_post_process, postprocess_convert_layout_default) {
+    auto f = create_simple_function(element::f32, Shape{1, 3, 2, 4});
+    f = PrePostProcessor()
+            .output(OutputInfo()
+                        .network(OutputNetworkInfo().set_layout("NCHW"))
+                        .postprocess(PostProcessSteps().convert_layout())
+                        .tensor(OutputTensorInfo().set_layout("NWHC")))
+            .build(f);
+    EXPECT_EQ(f->get_results()[0]->get_layout(), "NWHC");
+    EXPECT_EQ(f->get_results()[0]->get_output_shape(0), (Shape{1, 4, 2, 3}));
+}
+
+TEST(pre_post_process, postprocess_convert_layout_no_network_layout) {
+    auto f = create_simple_function(element::f32, Shape{1, 3, 2, 4});
+    EXPECT_THROW(f = PrePostProcessor()
+                         .output(OutputInfo().postprocess(PostProcessSteps().convert_layout("NHWC")))
+                         .build(f),
+                 ov::AssertFailure);
+}
+
+TEST(pre_post_process, postprocess_convert_layout_no_target_layout) {
+    auto f = create_simple_function(element::f32, Shape{1, 3, 2, 4});
+    EXPECT_THROW(f = PrePostProcessor()
+                         .output(OutputInfo()
+                                     .network(OutputNetworkInfo().set_layout("NCHW"))
+                                     .postprocess(PostProcessSteps().convert_layout()))
+                         .build(f),
+                 ov::AssertFailure);
+}
+
+// --- PostProcess - others ---
+
+TEST(pre_post_process, postprocess_custom_step) {
+    auto f = create_simple_function(element::f32, Shape{1, 3, 2, 2});
+    bool hit = false;
+    f = PrePostProcessor()
+            .output(OutputInfo().postprocess(PostProcessSteps().custom([&hit](const ov::Output<Node>& node) {
+                auto abs = std::make_shared<op::v0::Abs>(node);
+                hit = true;
+                return abs;
+            })))
+            .build(f);
+    EXPECT_TRUE(hit);
+    EXPECT_TRUE(ov::is_type<op::v0::Abs>(f->get_results()[0]->get_input_node_shared_ptr(0)));
+}
+
+TEST(pre_post_process, postprocess_lvalue) {
+    auto f = create_simple_function(element::f32, Shape{1, 3, 2, 2});
+    auto p = PrePostProcessor();
+    auto p1 = std::move(p);
+    p = std::move(p1);
+    auto outputInfo = OutputInfo();
+    auto outputInfo2 = std::move(outputInfo);
+    outputInfo = std::move(outputInfo2);
+    {
+        auto networkInfo = OutputNetworkInfo();
+        networkInfo.set_layout("NCHW");
+        outputInfo.network(std::move(networkInfo));
+    }
+    {
+        auto steps = PostProcessSteps();
+        steps.convert_layout("NHWC");
+        steps.convert_element_type(element::u8);
+        outputInfo.postprocess(std::move(steps));
+    }
+    {
+        auto tensorInfo = OutputTensorInfo();
+        tensorInfo.set_layout("NHWC");
+        tensorInfo.set_element_type(element::u8);
+        outputInfo.tensor(std::move(tensorInfo));
+    }
+    p.output(std::move(outputInfo));
+    f = p.build(f);
+    EXPECT_EQ(f->get_results()[0]->get_layout(), "NHWC");
+    EXPECT_EQ(f->get_results()[0]->get_output_shape(0), (Shape{1, 2, 2, 3}));
+    EXPECT_EQ(f->get_output_element_type(0), element::u8);
+}
+
+TEST(pre_post_process, postprocess_2_outputs) {
+    auto f = create_2inputs(element::f32, Shape{1, 3, 2, 2});
+    EXPECT_THROW(PrePostProcessor()
+                     .output(OutputInfo().tensor(OutputTensorInfo().set_element_type(element::u8)))
+                     .build(f),
+                 ov::AssertFailure);
+    f = PrePostProcessor()
+            .output(OutputInfo(1).tensor(OutputTensorInfo().set_element_type(element::u8)))
+            .build(f);
+    EXPECT_EQ(f->get_output_element_type(0), element::f32);
+    EXPECT_EQ(f->get_output_element_type(1), element::u8);
+    EXPECT_EQ(f->get_results()[1]->get_friendly_name(), "Result2");
+}
@@ -0,0 +1,182 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <vector>
+#include "gtest/gtest.h"
+#include "openvino/op/op.hpp"
+#include "openvino/opsets/opset8.hpp"
+
+using namespace ov;
+
+template <class T>
+class ConvertI420BaseTest : public testing::Test
+{
+};
+
+TYPED_TEST_SUITE_P(ConvertI420BaseTest);
+
+TYPED_TEST_P(ConvertI420BaseTest, shape_inference_single_tensor)
+{
+    auto param_shape = PartialShape{5, 3, 2, 1};
+    auto out_shape = PartialShape{5, 2, 2, 3};
+    auto param = std::make_shared<op::v0::Parameter>(element::f32, param_shape);
+    auto op = std::make_shared<TypeParam>(param);
+    ASSERT_EQ(op->output(0).get_element_type(), element::f32);
+    ASSERT_EQ(op->output(0).get_partial_shape(), out_shape);
+}
+
+TYPED_TEST_P(ConvertI420BaseTest, shape_inference_single_tensor_dynamic)
+{
+    auto param_shape = PartialShape::dynamic();
+    auto out_shape = PartialShape{Dimension::dynamic(), Dimension::dynamic(), Dimension::dynamic(), 3};
+    auto param = std::make_shared<op::v0::Parameter>(element::f32, param_shape);
+    auto op = std::make_shared<TypeParam>(param);
+    ASSERT_EQ(op->output(0).get_partial_shape(), out_shape);
+    ASSERT_EQ(op->output(0).get_element_type(), element::f32);
+}
+
+TYPED_TEST_P(ConvertI420BaseTest, shape_inference_single_tensor_dynamic_dims)
+{
+    auto param_shape = PartialShape{Dimension::dynamic(), 3, Dimension::dynamic(), Dimension::dynamic()};
+    auto out_shape = PartialShape{Dimension::dynamic(), 2, Dimension::dynamic(), 3};
+    auto param = std::make_shared<op::v0::Parameter>(element::u8, param_shape);
+    auto op = std::make_shared<TypeParam>(param);
+    ASSERT_EQ(op->output(0).get_partial_shape(), out_shape);
+    ASSERT_EQ(op->output(0).get_element_type(), element::u8);
+}
+
+TYPED_TEST_P(ConvertI420BaseTest, shape_inference_single_tensor_error_channels)
+{
+    auto param_shape = PartialShape{1, 3, 4, 2}; // shall be 1 channel, not 2
+    auto param = std::make_shared<op::v0::Parameter>(element::u8, param_shape);
+    EXPECT_THROW(std::make_shared<TypeParam>(param), ov::AssertFailure);
+}
+
+TYPED_TEST_P(ConvertI420BaseTest, shape_inference_single_tensor_error_height)
+{
+    auto param_shape = PartialShape{1, 4, 6, 1}; // height = 4, can't split to Y, U and V
+    auto param = std::make_shared<op::v0::Parameter>(element::u8, param_shape);
+    EXPECT_THROW(std::make_shared<TypeParam>(param), ov::AssertFailure);
+}
+
+TYPED_TEST_P(ConvertI420BaseTest, shape_inference_single_tensor_error_width_odd)
+{
+    auto param_shape = PartialShape{1, 6, 5, 1}; // width is odd, can't split to U and V
+    auto param = std::make_shared<op::v0::Parameter>(element::u8, param_shape);
+    EXPECT_THROW(std::make_shared<TypeParam>(param), ov::AssertFailure);
+}
+
+TYPED_TEST_P(ConvertI420BaseTest, shape_inference_single_tensor_error_i8)
+{
+    auto param_shape = PartialShape{1, 640, 480, 1};
+    auto param = std::make_shared<op::v0::Parameter>(element::i8, param_shape);
+    EXPECT_THROW(std::make_shared<TypeParam>(param), ov::AssertFailure);
+}
+
+TYPED_TEST_P(ConvertI420BaseTest, shape_inference_3_plane_simple)
+{
+    auto param_shape_y = PartialShape{10, 480, 640, 1};
+    auto param_shape_uv = PartialShape{10, 240, 320, 1};
+    auto out_shape = PartialShape{10, 480, 640, 3};
+    auto param_y = std::make_shared<op::v0::Parameter>(element::u8, param_shape_y);
+    auto param_u = std::make_shared<op::v0::Parameter>(element::u8, param_shape_uv);
+    auto param_v = std::make_shared<op::v0::Parameter>(element::u8, param_shape_uv);
+    auto op = std::make_shared<TypeParam>(param_y, param_u, param_v);
+    ASSERT_EQ(op->output(0).get_partial_shape(), out_shape);
+    ASSERT_EQ(op->output(0).get_element_type(), element::u8);
+}
+
+TYPED_TEST_P(ConvertI420BaseTest, shape_inference_3_plane_y_dynamic)
+{
+    auto param_shape_y = PartialShape::dynamic();
+    auto param_shape_uv = PartialShape{1, 3, 2, 1};
+    auto out_shape = PartialShape{1, 6, 4, 3};
+    auto param_y = std::make_shared<op::v0::Parameter>(element::bf16, param_shape_y);
+    auto param_u = std::make_shared<op::v0::Parameter>(element::bf16, param_shape_uv);
+    auto param_v = std::make_shared<op::v0::Parameter>(element::bf16, PartialShape::dynamic());
+    auto op = std::make_shared<TypeParam>(param_y, param_u, param_v);
+    ASSERT_EQ(op->output(0).get_partial_shape(), out_shape);
+    ASSERT_EQ(op->output(0).get_element_type(), element::bf16);
+}
+
+TYPED_TEST_P(ConvertI420BaseTest, shape_inference_3_plane_uv_type)
+{
+    auto param_shape_y = PartialShape{1, 4, 4, 1};
+    auto param_shape_uv = PartialShape{1, 2, 2, 1};
+    auto param_y = std::make_shared<op::v0::Parameter>(element::dynamic, param_shape_y);
+    auto param_u = std::make_shared<op::v0::Parameter>(element::dynamic, param_shape_uv);
+    auto param_v = std::make_shared<op::v0::Parameter>(element::f64, param_shape_uv);
+    auto op = std::make_shared<TypeParam>(param_y, param_u, param_v);
+    ASSERT_EQ(op->output(0).get_partial_shape(), (PartialShape{1, 4, 4, 3}));
+    ASSERT_EQ(op->output(0).get_element_type(), element::f64);
+}
+
+TYPED_TEST_P(ConvertI420BaseTest, shape_inference_3_plane_error_type_mismatch)
+{
+    auto param_y = std::make_shared<op::v0::Parameter>(element::u8, PartialShape::dynamic());
+    auto param_u = std::make_shared<op::v0::Parameter>(element::u8, PartialShape::dynamic());
+    auto param_v = std::make_shared<op::v0::Parameter>(element::f32, PartialShape::dynamic());
+    EXPECT_THROW(std::make_shared<TypeParam>(param_y, param_u, param_v), ov::AssertFailure);
+}
+
+TYPED_TEST_P(ConvertI420BaseTest, shape_inference_3_plane_error_batch)
+{
+    auto param_y = std::make_shared<op::v0::Parameter>(element::u8, PartialShape{2, 480, 640, 1});
+    auto param_u = std::make_shared<op::v0::Parameter>(element::u8, PartialShape{2, 240, 320, 1});
+    auto param_v = std::make_shared<op::v0::Parameter>(element::u8, PartialShape{1, 240, 320, 1});
+    EXPECT_THROW(std::make_shared<TypeParam>(param_y, param_u, param_v), ov::AssertFailure);
+}
+
+TYPED_TEST_P(ConvertI420BaseTest, shape_inference_3_plane_error_height)
+{
+    auto param_y = std::make_shared<op::v0::Parameter>(element::u8, PartialShape{2, 480, 640, 1});
+    auto param_u = std::make_shared<op::v0::Parameter>(element::u8, PartialShape{2, 480, 320, 1});
+    auto param_v = std::make_shared<op::v0::Parameter>(element::u8, PartialShape{2, 240, 320, 1});
+    EXPECT_THROW(std::make_shared<TypeParam>(param_y, param_u, param_v), ov::AssertFailure);
+}
+
+TYPED_TEST_P(ConvertI420BaseTest, shape_inference_3_plane_error_width)
+{
+    auto param_y = std::make_shared<op::v0::Parameter>(element::u8, PartialShape{2, 480, 640, 1});
+    auto param_u = std::make_shared<op::v0::Parameter>(element::u8, PartialShape{2, 240, 320, 1});
+    auto param_v = std::make_shared<op::v0::Parameter>(element::u8, PartialShape{2, 240, 640, 1});
+    EXPECT_THROW(std::make_shared<TypeParam>(param_y, param_u, param_v), ov::AssertFailure);
+}
+
+TYPED_TEST_P(ConvertI420BaseTest, shape_inference_3_plane_error_channels)
+{
+    auto param_y = std::make_shared<op::v0::Parameter>(element::u8, PartialShape{2, 480, 640, 1});
+    auto param_u = std::make_shared<op::v0::Parameter>(element::u8, PartialShape{2, 240, 320, 2});
+    auto param_v = std::make_shared<op::v0::Parameter>(element::u8, PartialShape{2, 240, 320, 1});
+    EXPECT_THROW(std::make_shared<TypeParam>(param_y, param_u, param_v), ov::AssertFailure);
+}
+
+TYPED_TEST_P(ConvertI420BaseTest, shape_inference_error_2_inputs)
+{
+    auto param_y = std::make_shared<op::v0::Parameter>(element::dynamic, PartialShape::dynamic());
+    auto param_uv = std::make_shared<op::v0::Parameter>(element::dynamic, PartialShape::dynamic());
+    auto empty = std::make_shared<TypeParam>();
+    empty->set_arguments(NodeVector{param_y, param_uv});
+
+    EXPECT_THROW(empty->constructor_validate_and_infer_types(), ov::AssertFailure);
+}
+
+REGISTER_TYPED_TEST_SUITE_P(ConvertI420BaseTest,
+                            shape_inference_single_tensor,
+                            shape_inference_single_tensor_dynamic,
+                            shape_inference_single_tensor_dynamic_dims,
+                            shape_inference_single_tensor_error_channels,
+                            shape_inference_single_tensor_error_height,
+                            shape_inference_single_tensor_error_width_odd,
+                            shape_inference_single_tensor_error_i8,
+                            shape_inference_3_plane_simple,
+                            shape_inference_3_plane_y_dynamic,
+                            shape_inference_3_plane_uv_type,
+                            shape_inference_3_plane_error_type_mismatch,
+                            shape_inference_3_plane_error_batch,
+                            shape_inference_3_plane_error_height,
+                            shape_inference_3_plane_error_width,
+                            shape_inference_3_plane_error_channels,
+                            shape_inference_error_2_inputs
+);
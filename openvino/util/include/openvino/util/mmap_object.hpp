@@ -0,0 +1,52 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A file containing the memory mapped files API.
+ * @file mmap_object.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "openvino/util/file_util.hpp"
+
+namespace ov {
+namespace util {
+
+/// \brief View of a file mapped to the process memory.
+/// The pages are loaded lazily on access and shared between all the processes mapping the same file.
+/// By default they are mapped copy-on-write, so writing to the memory doesn't affect the file.
+/// The read-only mappings can't be written at all, so the pages are never copied.
+/// The file must not be truncated while it is mapped: the access to the pages beyond the new end of the file
+/// crashes the process (SIGBUS on POSIX systems).
+class MappedMemory {
+public:
+    virtual char* data() noexcept = 0;
+    virtual size_t size() const noexcept = 0;
+    virtual ~MappedMemory() = default;
+};
+
+/// \brief Maps the whole file to the process memory
+/// \param path Path to the file
+/// \param read_only The memory is mapped read-only, writing to it crashes the process
+/// \return Mapped memory which is valid until the object is destroyed. Nothing is mapped for an empty file:
+/// the size is zero and the data is nullptr
+/// \throw std::runtime_error if the file can't be opened or mapped
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path, bool read_only = false);
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+/// \brief Maps the whole file to the process memory
+/// \param path Path to the file as a wide-char string
+/// \param read_only The memory is mapped read-only, writing to it crashes the process
+/// \return Mapped memory which is valid until the object is destroyed. Nothing is mapped for an empty file:
+/// the size is zero and the data is nullptr
+/// \throw std::runtime_error if the file can't be opened or mapped
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path, bool read_only = false);
+#endif
+
+}  // namespace util
+}  // namespace ov
@@ -0,0 +1,166 @@
+// Copyright (C) 2018-2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/util/mmap_object.hpp"
+
+#include <stdexcept>
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace ov {
+namespace util {
+
+namespace {
+
+#ifdef _WIN32
+
+class MapHolder : public MappedMemory {
+public:
+    MapHolder() = default;
+
+    template <typename Char, typename CreateFileFunc>
+    void set(const std::basic_string<Char>& path, CreateFileFunc create_file, bool read_only) {
+        m_file = create_file(path.c_str(),
+                             GENERIC_READ,
+                             FILE_SHARE_READ,
+                             nullptr,
+                             OPEN_EXISTING,
+                             FILE_ATTRIBUTE_NORMAL,
+                             nullptr);
+        if (m_file == INVALID_HANDLE_VALUE)
+            throw std::runtime_error("Can not open file for mapping.");
+
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(m_file, &file_size))
+            throw std::runtime_error("Can not get file size for mapping.");
+        m_size = static_cast<size_t>(file_size.QuadPart);
+        // the empty file can't be mapped, the data stays nullptr
+        if (m_size == 0)
+            return;
+
+        m_mapping = CreateFileMapping(m_file, nullptr, read_only ? PAGE_READONLY : PAGE_WRITECOPY, 0, 0, nullptr);
+        if (m_mapping == nullptr)
+            throw std::runtime_error("Can not create file mapping.");
+
+        m_data = static_cast<char*>(MapViewOfFile(m_mapping, read_only ? FILE_MAP_READ : FILE_MAP_COPY, 0, 0, 0));
+        if (m_data == nullptr)
+            throw std::runtime_error("Can not create map view.");
+    }
+
+    ~MapHolder() override {
+        if (m_data)
+            UnmapViewOfFile(m_data);
+        if (m_mapping)
+            CloseHandle(m_mapping);
+        if (m_file != INVALID_HANDLE_VALUE)
+            CloseHandle(m_file);
+    }
+
+    char* data() noexcept override {
+        return m_data;
+    }
+    size_t size() const noexcept override {
+        return m_size;
+    }
+
+private:
+    char* m_data = nullptr;
+    size_t m_size = 0;
+    HANDLE m_file = INVALID_HANDLE_VALUE;
+    HANDLE m_mapping = nullptr;
+};
+
+}  // namespace
+
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path, bool read_only) {
+    auto holder = std::make_shared<MapHolder>();
+    holder->set(path, CreateFileA, read_only);
+    return holder;
+}
+
+#    ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path, bool read_only) {
+    auto holder = std::make_shared<MapHolder>();
+    holder->set(path, CreateFileW, read_only);
+    return holder;
+}
+#    endif
+
+#else
+
+class MapHolder : public MappedMemory {
+public:
+    MapHolder() = default;
+
+    void set(const std::string& path, bool read_only) {
+        int fd = open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+            throw std::runtime_error("Can not open file " + path + " for mapping.");
+
+        struct stat sb = {};
+        if (fstat(fd, &sb) == -1) {
+            close(fd);
+            throw std::runtime_error("Can not get file size for " + path);
+        }
+        m_size = static_cast<size_t>(sb.st_size);
+        // the empty file can't be mapped, the data stays nullptr
+        if (m_size > 0) {
+            // the private writable mapping shares the pages until somebody writes to them
+            void* data = read_only ? mmap(nullptr, m_size, PROT_READ, MAP_SHARED, fd, 0)
+                                   : mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            if (data == MAP_FAILED) {
+                close(fd);
+                throw std::runtime_error("Can not create file mapping for " + path);
+            }
+            m_data = static_cast<char*>(data);
+        }
+        // the mapping stays valid after the descriptor is closed
+        close(fd);
+    }
+
+    ~MapHolder() override {
+        if (m_data)
+            munmap(m_data, m_size);
+    }
+
+    char* data() noexcept override {
+        return m_data;
+    }
+    size_t size() const noexcept override {
+        return m_size;
+    }
+
+private:
+    char* m_data = nullptr;
+    size_t m_size = 0;
+};
+
+}  // namespace
+
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path, bool read_only) {
+    auto holder = std::make_shared<MapHolder>();
+    holder->set(path, read_only);
+    return holder;
+}
+
+#    ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path, bool read_only) {
+    return load_mmap_object(ov::util::wstring_to_string(path), read_only);
+}
+#    endif
+
+#endif
+
+}  // namespace util
+}  // namespace ov
@@ -0,0 +1,66 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <inference_engine.hpp>
+#include <iostream>
+
+#include "common_utils.h"
+#include "timetests_helper/timer.h"
+#include "timetests_helper/utils.h"
+using namespace InferenceEngine;
+
+
+/**
+ * @brief Function that contain executable pipeline which will be called from
+ * main(). The function should not throw any exceptions and responsible for
+ * handling it by itself.
+ *
+ * The network is loaded from the memory with the cache enabled, so the cache
+ * key is computed over the topology and the weights. The second load of the
+ * same network reuses the digests of the weights computed by the first one.
+ * Run it on the models of the different sizes to get the latency versus the
+ * size of the weights.
+ */
+int runPipeline(const std::string &model, const std::string &device) {
+  auto pipeline = [](const std::string &model, const std::string &device) {
+    Core ie;
+    CNNNetwork cnnNetwork;
+    ExecutableNetwork exeNetwork;
+
+    {
+      SCOPED_TIMER(load_plugin);
+      ie.GetVersions(device);
+      ie.SetConfig({{"CACHE_DIR", "models_cache"}});
+    }
+    {
+      SCOPED_TIMER(read_network);
+      cnnNetwork = ie.ReadNetwork(model);
+    }
+    {
+      SCOPED_TIMER(load_network_from_cache);
+      exeNetwork = ie.LoadNetwork(cnnNetwork, device);
+    }
+    {
+      SCOPED_TIMER(reload_network_from_cache);
+      exeNetwork = ie.LoadNetwork(cnnNetwork, device);
+    }
+  };
+
+  try {
+    pipeline(model, device);
+  } catch (const InferenceEngine::Exception &iex) {
+    std::cerr
+        << "Inference Engine pipeline failed with Inference Engine exception:\n"
+        << iex.what();
+    return 1;
+  } catch (const std::exception &ex) {
+    std::cerr << "Inference Engine pipeline failed with exception:\n"
+              << ex.what();
+    return 2;
+  } catch (...) {
+    std::cerr << "Inference Engine pipeline failed\n";
+    return 3;
+  }
+  return 0;
+}